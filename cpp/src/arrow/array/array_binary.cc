@@ -89,6 +89,34 @@ LargeStringArray::LargeStringArray(int64_t length,
 
 Status LargeStringArray::ValidateUTF8() const { return internal::ValidateUTF8(*data_); }
 
+BinaryViewArray::BinaryViewArray(const std::shared_ptr<ArrayData>& data) {
+  ARROW_CHECK(is_binary_view_like(data->type->id()));
+  SetData(data);
+}
+
+BinaryViewArray::BinaryViewArray(const std::shared_ptr<DataType>& type, int64_t length,
+                                 const std::shared_ptr<Buffer>& views,
+                                 BufferVector data_buffers,
+                                 const std::shared_ptr<Buffer>& null_bitmap,
+                                 int64_t null_count, int64_t offset) {
+  data_buffers.insert(data_buffers.begin(), {null_bitmap, views});
+  SetData(ArrayData::Make(type, length, std::move(data_buffers), null_count, offset));
+}
+
+StringViewArray::StringViewArray(const std::shared_ptr<ArrayData>& data) {
+  ARROW_CHECK_EQ(data->type->id(), Type::STRING_VIEW);
+  SetData(data);
+}
+
+StringViewArray::StringViewArray(int64_t length, const std::shared_ptr<Buffer>& views,
+                                 BufferVector data_buffers,
+                                 const std::shared_ptr<Buffer>& null_bitmap,
+                                 int64_t null_count, int64_t offset)
+    : BinaryViewArray(utf8_view(), length, views, std::move(data_buffers), null_bitmap,
+                      null_count, offset) {}
+
+Status StringViewArray::ValidateUTF8() const { return internal::ValidateUTF8(*data_); }
+
 FixedSizeBinaryArray::FixedSizeBinaryArray(const std::shared_ptr<ArrayData>& data) {
   SetData(data);
 }
@@ -16,7 +16,7 @@
 // under the License.
 
 // Array accessor classes for Binary, LargeBinart, String, LargeString,
-// FixedSizeBinary
+// BinaryView, StringView, FixedSizeBinary
 
 #pragma once
 
@@ -217,6 +217,101 @@ class ARROW_EXPORT LargeStringArray : public LargeBinaryArray {
   Status ValidateUTF8() const;
 };
 
+// ----------------------------------------------------------------------
+// BinaryView and StringView
+
+/// Concrete Array class for variable-size binary view data
+///
+/// Buffer 1 holds one BinaryViewType::c_type per value; any following buffers
+/// hold the data of values too long to be inlined in their view.
+class ARROW_EXPORT BinaryViewArray : public FlatArray {
+ public:
+  using TypeClass = BinaryViewType;
+  using IteratorType = stl::ArrayIterator<BinaryViewArray>;
+  using c_type = BinaryViewType::c_type;
+
+  explicit BinaryViewArray(const std::shared_ptr<ArrayData>& data);
+
+  BinaryViewArray(const std::shared_ptr<DataType>& type, int64_t length,
+                  const std::shared_ptr<Buffer>& views, BufferVector data_buffers,
+                  const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                  int64_t null_count = kUnknownNullCount, int64_t offset = 0);
+
+  /// \brief Get binary value as a string_view
+  ///
+  /// \param i the value index
+  /// \return the view over the selected value
+  util::string_view GetView(int64_t i) const {
+    const c_type& v = raw_views_[i + data_->offset];
+    const uint8_t* data = v.is_inline()
+                              ? v.inlined.data
+                              : data_->buffers[v.ref.buffer_index + 2]->data() +
+                                    v.ref.offset;
+    return util::string_view(reinterpret_cast<const char*>(data), v.size());
+  }
+
+  util::optional<util::string_view> operator[](int64_t i) const {
+    return *IteratorType(*this, i);
+  }
+
+  /// \brief Get binary value as a string_view
+  /// Provided for consistency with other arrays.
+  util::string_view Value(int64_t i) const { return GetView(i); }
+
+  /// \brief Get binary value as a std::string
+  std::string GetString(int64_t i) const { return std::string(GetView(i)); }
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> views() const { return data_->buffers[1]; }
+
+  const c_type* raw_views() const { return raw_views_ + data_->offset; }
+
+  /// \brief The number of data buffers referenced by the views
+  int64_t num_data_buffers() const {
+    return static_cast<int64_t>(data_->buffers.size()) - 2;
+  }
+
+  /// \brief Pointer to the data buffers referenced by the views, indexed by
+  /// c_type::ref.buffer_index
+  const std::shared_ptr<Buffer>* data_buffers() const {
+    return data_->buffers.data() + 2;
+  }
+
+  IteratorType begin() const { return IteratorType(*this); }
+
+  IteratorType end() const { return IteratorType(*this, length()); }
+
+ protected:
+  // For subclasses such as StringViewArray
+  BinaryViewArray() = default;
+
+  // Protected method for constructors
+  void SetData(const std::shared_ptr<ArrayData>& data) {
+    this->Array::SetData(data);
+    raw_views_ = data->GetValuesSafe<c_type>(1, /*offset=*/0);
+  }
+
+  const c_type* raw_views_ = NULLPTR;
+};
+
+/// Concrete Array class for variable-size string view (utf-8) data
+class ARROW_EXPORT StringViewArray : public BinaryViewArray {
+ public:
+  using TypeClass = StringViewType;
+
+  explicit StringViewArray(const std::shared_ptr<ArrayData>& data);
+
+  StringViewArray(int64_t length, const std::shared_ptr<Buffer>& views,
+                  BufferVector data_buffers,
+                  const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                  int64_t null_count = kUnknownNullCount, int64_t offset = 0);
+
+  /// \brief Validate that this array contains only valid UTF8 entries
+  ///
+  /// This check is also implied by ValidateFull()
+  Status ValidateUTF8() const;
+};
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
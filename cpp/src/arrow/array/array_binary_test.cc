@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -910,4 +911,138 @@ TYPED_TEST(TestBaseBinaryDataVisitor, Basics) { this->TestBasics(); }
 
 TYPED_TEST(TestBaseBinaryDataVisitor, Sliced) { this->TestSliced(); }
 
+// ----------------------------------------------------------------------
+// BinaryView / StringView tests
+
+TEST(TestBinaryViewArray, Basics) {
+  StringViewBuilder builder;
+  ASSERT_OK(builder.Append("short"));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append("a value too long to be inlined"));
+  ASSERT_OK(builder.AppendEmptyValue());
+  std::shared_ptr<StringViewArray> array;
+  ASSERT_OK(builder.Finish(&array));
+  ASSERT_OK(array->ValidateFull());
+
+  ASSERT_EQ(array->length(), 4);
+  ASSERT_EQ(array->null_count(), 1);
+  ASSERT_EQ(array->GetView(0), "short");
+  ASSERT_EQ(array->GetView(2), "a value too long to be inlined");
+  ASSERT_EQ(array->GetView(3), "");
+
+  ASSERT_TRUE(array->raw_views()[0].is_inline());
+  ASSERT_FALSE(array->raw_views()[2].is_inline());
+  ASSERT_EQ(array->num_data_buffers(), 1);
+  // Null views are zeroed
+  ASSERT_EQ(array->raw_views()[1].size(), 0);
+
+  AssertArraysEqual(*array, *ArrayFromJSON(utf8_view(), R"(
+    ["short", null, "a value too long to be inlined", ""])"));
+}
+
+TEST(TestBinaryViewArray, SmallBlocks) {
+  // Values are spread over several data buffers
+  BinaryViewBuilder builder(default_memory_pool(), /*block_size=*/32);
+  std::vector<std::string> values;
+  for (int i = 0; i < 20; ++i) {
+    values.push_back(std::string(13 + i, static_cast<char>('a' + i)));
+  }
+  ASSERT_OK(builder.AppendValues(values));
+  std::shared_ptr<BinaryViewArray> array;
+  ASSERT_OK(builder.Finish(&array));
+  ASSERT_OK(array->ValidateFull());
+  ASSERT_GT(array->num_data_buffers(), 1);
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_EQ(array->GetString(i), values[i]);
+  }
+
+  // Equality doesn't depend on how values are laid out in the data buffers
+  BinaryViewBuilder other_builder;
+  ASSERT_OK(other_builder.AppendValues(values));
+  ASSERT_OK_AND_ASSIGN(auto other, other_builder.Finish());
+  ASSERT_EQ(other->data()->buffers.size(), 3);
+  AssertArraysEqual(*array, *other);
+  AssertArraysEqual(*array->Slice(3, 10), *other->Slice(3, 10));
+  ASSERT_FALSE(array->Slice(3, 10)->Equals(other->Slice(4, 10)));
+}
+
+TEST(TestBinaryViewArray, AppendArraySlice) {
+  auto array = ArrayFromJSON(
+      utf8_view(), R"(["first long value, not inlined", null, "inline",
+                       "second long value, not inlined"])");
+  StringViewBuilder builder;
+  ASSERT_OK(builder.Append("x"));
+  ASSERT_OK(builder.AppendArraySlice(*array->data(), 1, 3));
+  ASSERT_OK(builder.AppendArraySlice(*array->data(), 0, 1));
+  ASSERT_OK_AND_ASSIGN(auto out, builder.Finish());
+  ASSERT_OK(out->ValidateFull());
+  AssertArraysEqual(*out, *ArrayFromJSON(utf8_view(), R"(
+    ["x", null, "inline", "second long value, not inlined",
+     "first long value, not inlined"])"));
+
+  // The data buffer of the input is shared, and only once
+  const auto& out_buffers = out->data()->buffers;
+  ASSERT_EQ(std::count(out_buffers.begin() + 2, out_buffers.end(),
+                       array->data()->buffers[2]),
+            1);
+}
+
+TEST(TestBinaryViewArray, ValidateFull) {
+  auto array = ArrayFromJSON(
+      binary_view(), R"(["inline", "a value too long to be inlined", null])");
+  ASSERT_OK(array->ValidateFull());
+  const auto* views =
+      checked_cast<const BinaryViewArray&>(*array).raw_views();
+
+  auto with_view = [&](int64_t i, BinaryViewType::c_type view) {
+    std::string new_views(reinterpret_cast<const char*>(views),
+                          array->length() * BinaryViewType::kSize);
+    std::memcpy(&new_views[i * BinaryViewType::kSize], &view, BinaryViewType::kSize);
+    auto data = array->data()->Copy();
+    data->buffers[1] = Buffer::FromString(std::move(new_views));
+    return MakeArray(data);
+  };
+
+  // Out of bounds buffer index
+  auto view = views[1];
+  view.ref.buffer_index = 1;
+  ASSERT_RAISES(Invalid, with_view(1, view)->ValidateFull());
+
+  // Out of bounds offset
+  view = views[1];
+  view.ref.offset = 10;
+  ASSERT_RAISES(Invalid, with_view(1, view)->ValidateFull());
+
+  // Prefix doesn't match the data
+  view = views[1];
+  view.ref.prefix[0] = 'A';
+  ASSERT_RAISES(Invalid, with_view(1, view)->ValidateFull());
+
+  // Unused inline bytes aren't zeroed
+  view = views[0];
+  view.inlined.data[BinaryViewType::kInlineSize - 1] = 'x';
+  ASSERT_RAISES(Invalid, with_view(0, view)->ValidateFull());
+
+  // Invalid UTF8
+  auto invalid_utf8 = array->data()->Copy();
+  invalid_utf8->type = utf8_view();
+  ASSERT_OK(MakeArray(invalid_utf8)->ValidateFull());
+  view = views[0];
+  view.inlined.data[0] = '\xff';
+  auto invalid = with_view(0, view)->data()->Copy();
+  invalid->type = utf8_view();
+  ASSERT_RAISES(Invalid, MakeArray(invalid)->ValidateFull());
+}
+
+TEST(TestBinaryViewArray, DataVisitor) {
+  auto array =
+      ArrayFromJSON(utf8_view(), R"(["ab", null, "a value too long to be inlined"])");
+  BinaryAppender appender;
+  ArraySpanVisitor<StringViewType> visitor;
+  ASSERT_OK(visitor.Visit(*array->Slice(1)->data(), &appender));
+  ASSERT_THAT(appender.data, ::testing::ElementsAreArray(
+                                 {"(null)", "a value too long to be inlined"}));
+  ARROW_UNUSED(visitor);  // Workaround weird MSVC warning
+}
+
 }  // namespace arrow
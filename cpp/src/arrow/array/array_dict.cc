@@ -305,6 +305,22 @@ class DictionaryUnifierImpl : public DictionaryUnifier {
     return Status::OK();
   }
 
+  Status GetDelta(int64_t start_offset, std::shared_ptr<Array>* out_dict) override {
+    if (start_offset < 0 || start_offset > memo_table_.size()) {
+      return Status::IndexError("Delta start offset ", start_offset,
+                                " out of bounds for a unified dictionary of length ",
+                                memo_table_.size());
+    }
+    if (start_offset == memo_table_.size()) {
+      return MakeEmptyArray(value_type_, pool_).Value(out_dict);
+    }
+    std::shared_ptr<ArrayData> data;
+    RETURN_NOT_OK(DictTraits::GetDictionaryArrayData(pool_, value_type_, memo_table_,
+                                                     start_offset, &data));
+    *out_dict = MakeArray(data);
+    return Status::OK();
+  }
+
  private:
   MemoryPool* pool_;
   std::shared_ptr<DataType> value_type_;
@@ -175,6 +175,11 @@ class ARROW_EXPORT DictionaryUnifier {
   /// The unifier cannot be used after this is called
   virtual Status GetResultWithIndexType(const std::shared_ptr<DataType>& index_type,
                                         std::shared_ptr<Array>* out_dict) = 0;
+
+  /// \brief Return the values added to the unified dictionary since it had
+  /// the given length, i.e. a dictionary delta.  Unlike the GetResult methods,
+  /// the unifier can still be used after this is called
+  virtual Status GetDelta(int64_t start_offset, std::shared_ptr<Array>* out_dict) = 0;
 };
 
 }  // namespace arrow
@@ -1486,6 +1486,36 @@ TEST(TestDictionaryUnifier, String) {
   CheckTransposeMap(*b2, {2, 0});
 }
 
+TEST(TestDictionaryUnifier, Delta) {
+  auto dict_ty = utf8();
+
+  auto d1 = ArrayFromJSON(dict_ty, R"(["foo", "bar"])");
+  auto d2 = ArrayFromJSON(dict_ty, R"(["quux", "foo", "baz"])");
+  auto d3 = ArrayFromJSON(dict_ty, R"(["bar"])");
+
+  ASSERT_OK_AND_ASSIGN(auto unifier, DictionaryUnifier::Make(dict_ty));
+
+  std::shared_ptr<Buffer> transpose;
+  std::shared_ptr<Array> delta;
+
+  ASSERT_OK(unifier->Unify(*d1, &transpose));
+  ASSERT_OK(unifier->GetDelta(0, &delta));
+  AssertArraysEqual(*d1, *delta);
+
+  ASSERT_OK(unifier->Unify(*d2, &transpose));
+  CheckTransposeMap(*transpose, {2, 0, 3});
+  ASSERT_OK(unifier->GetDelta(2, &delta));
+  AssertArraysEqual(*ArrayFromJSON(dict_ty, R"(["quux", "baz"])"), *delta);
+
+  // The unifier is still usable after GetDelta
+  ASSERT_OK(unifier->Unify(*d3, &transpose));
+  CheckTransposeMap(*transpose, {1});
+  ASSERT_OK(unifier->GetDelta(4, &delta));
+  ASSERT_EQ(delta->length(), 0);
+
+  ASSERT_RAISES(IndexError, unifier->GetDelta(5, &delta));
+}
+
 TEST(TestDictionaryUnifier, FixedSizeBinary) {
   auto type = fixed_size_binary(3);
 
@@ -0,0 +1,129 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/array/array_run_end.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/ree_util.h"
+
+namespace arrow {
+
+// ----------------------------------------------------------------------
+// RunEndEncodedArray
+
+RunEndEncodedArray::RunEndEncodedArray(const std::shared_ptr<ArrayData>& data) {
+  ARROW_CHECK_EQ(data->type->id(), Type::RUN_END_ENCODED);
+  SetData(data);
+}
+
+RunEndEncodedArray::RunEndEncodedArray(const std::shared_ptr<DataType>& type,
+                                       int64_t length,
+                                       const std::shared_ptr<Array>& run_ends,
+                                       const std::shared_ptr<Array>& values,
+                                       int64_t offset) {
+  ARROW_CHECK_EQ(type->id(), Type::RUN_END_ENCODED);
+  auto data = ArrayData::Make(type, length, {NULLPTR}, /*null_count=*/0, offset);
+  data->child_data = {run_ends->data(), values->data()};
+  SetData(data);
+}
+
+Result<std::shared_ptr<RunEndEncodedArray>> RunEndEncodedArray::Make(
+    int64_t logical_length, const std::shared_ptr<Array>& run_ends,
+    const std::shared_ptr<Array>& values, int64_t logical_offset) {
+  if (logical_length < 0 || logical_offset < 0) {
+    return Status::Invalid("Negative length or offset for run-end encoded array");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto type,
+                        RunEndEncodedType::Make(run_ends->type(), values->type()));
+  RETURN_NOT_OK(ree_util::ValidateRunEndEncodedChildren(
+      internal::checked_cast<const RunEndEncodedType&>(*type), logical_length,
+      logical_offset, ArraySpan(*run_ends->data()), ArraySpan(*values->data()),
+      /*full=*/false));
+  return std::make_shared<RunEndEncodedArray>(type, logical_length, run_ends, values,
+                                              logical_offset);
+}
+
+void RunEndEncodedArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  ARROW_CHECK_EQ(data->child_data.size(), 2);
+  this->Array::SetData(data);
+  // No validity bitmap
+  ARROW_CHECK_EQ(data_->buffers[0], nullptr);
+  run_ends_ = MakeArray(data_->child_data[0]);
+  values_ = MakeArray(data_->child_data[1]);
+}
+
+namespace {
+
+template <typename RunEndCType>
+Result<std::shared_ptr<Array>> MakeLogicalRunEnds(
+    const std::shared_ptr<Array>& run_ends_array, const ArraySpan& span,
+    MemoryPool* pool) {
+  const int64_t physical_offset = ree_util::FindPhysicalOffset(span);
+  const int64_t physical_length = ree_util::FindPhysicalLength(span);
+  const RunEndCType* run_ends = ree_util::RunEnds<RunEndCType>(span) + physical_offset;
+  if (span.offset == 0 && physical_length == run_ends_array->length() &&
+      (physical_length == 0 || run_ends[physical_length - 1] == span.length)) {
+    // The run ends are already relative to the array
+    return run_ends_array;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto buffer,
+                        AllocateBuffer(physical_length * sizeof(RunEndCType), pool));
+  auto* out = reinterpret_cast<RunEndCType*>(buffer->mutable_data());
+  for (int64_t i = 0; i < physical_length; ++i) {
+    const int64_t run_end = static_cast<int64_t>(run_ends[i]) - span.offset;
+    out[i] = static_cast<RunEndCType>(std::min(run_end, span.length));
+  }
+  return std::make_shared<NumericArray<typename CTypeTraits<RunEndCType>::ArrowType>>(
+      run_ends_array->type(), physical_length, std::move(buffer), /*null_bitmap=*/NULLPTR,
+      /*null_count=*/0);
+}
+
+}  // namespace
+
+Result<std::shared_ptr<Array>> RunEndEncodedArray::LogicalRunEnds(
+    MemoryPool* pool) const {
+  const ArraySpan span(*data_);
+  switch (run_ends_->type_id()) {
+    case Type::INT16:
+      return MakeLogicalRunEnds<int16_t>(run_ends_, span, pool);
+    case Type::INT32:
+      return MakeLogicalRunEnds<int32_t>(run_ends_, span, pool);
+    default:
+      DCHECK_EQ(run_ends_->type_id(), Type::INT64);
+      return MakeLogicalRunEnds<int64_t>(run_ends_, span, pool);
+  }
+}
+
+std::shared_ptr<Array> RunEndEncodedArray::LogicalValues() const {
+  return values_->Slice(FindPhysicalOffset(), FindPhysicalLength());
+}
+
+int64_t RunEndEncodedArray::FindPhysicalOffset() const {
+  return ree_util::FindPhysicalOffset(ArraySpan(*data_));
+}
+
+int64_t RunEndEncodedArray::FindPhysicalLength() const {
+  return ree_util::FindPhysicalLength(ArraySpan(*data_));
+}
+
+}  // namespace arrow
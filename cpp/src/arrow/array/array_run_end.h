@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Array accessor class for run-end encoded arrays
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/data.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+/// \addtogroup nested-arrays
+///
+/// @{
+
+// ----------------------------------------------------------------------
+// RunEndEncoded
+
+/// \brief Array type for run-end encoded data
+///
+/// The logical value at position i is values()[j], where j is the index of
+/// the first run end strictly greater than offset() + i.  Run ends always
+/// refer to the unsliced array, so slicing only changes offset() and length().
+class ARROW_EXPORT RunEndEncodedArray : public Array {
+ public:
+  using TypeClass = RunEndEncodedType;
+
+  explicit RunEndEncodedArray(const std::shared_ptr<ArrayData>& data);
+
+  /// \brief Construct a RunEndEncodedArray from its children
+  ///
+  /// The run_ends child must not have nulls and its values must be strictly
+  /// increasing.  This constructor doesn't validate its inputs.
+  RunEndEncodedArray(const std::shared_ptr<DataType>& type, int64_t length,
+                     const std::shared_ptr<Array>& run_ends,
+                     const std::shared_ptr<Array>& values, int64_t offset = 0);
+
+  /// \brief Construct a RunEndEncodedArray from run ends and values
+  ///
+  /// The data type is inferred from the children.  The logical length and
+  /// offset are validated against the last run end.
+  ///
+  /// \param[in] logical_length the logical length of the array
+  /// \param[in] run_ends an int16, int32 or int64 array of run ends
+  /// \param[in] values an array of values, one per run
+  /// \param[in] logical_offset the logical offset of the array
+  static Result<std::shared_ptr<RunEndEncodedArray>> Make(
+      int64_t logical_length, const std::shared_ptr<Array>& run_ends,
+      const std::shared_ptr<Array>& values, int64_t logical_offset = 0);
+
+  const RunEndEncodedType* run_end_encoded_type() const {
+    return internal::checked_cast<const RunEndEncodedType*>(data_->type.get());
+  }
+
+  /// \brief Return the run ends child array
+  ///
+  /// The run ends are not adjusted for the slice offset of this array.
+  const std::shared_ptr<Array>& run_ends() const { return run_ends_; }
+
+  /// \brief Return the values child array, one value per run
+  ///
+  /// The values are not sliced to the runs covered by this array; use
+  /// FindPhysicalOffset() and FindPhysicalLength() for that.
+  const std::shared_ptr<Array>& values() const { return values_; }
+
+  /// \brief Return the run ends of the runs covered by this array, relative
+  /// to its offset
+  ///
+  /// The run ends are shifted by the offset of this array and the last one
+  /// is clipped to its length.  The run ends child is returned as-is if it
+  /// already satisfies this.
+  Result<std::shared_ptr<Array>> LogicalRunEnds(MemoryPool* pool) const;
+
+  /// \brief Return the values of the runs covered by this array
+  ///
+  /// This is a zero-copy slice of the values child.
+  std::shared_ptr<Array> LogicalValues() const;
+
+  /// \brief Return the physical index of the first run covered by this array
+  int64_t FindPhysicalOffset() const;
+
+  /// \brief Return the number of runs covered by this array
+  int64_t FindPhysicalLength() const;
+
+ protected:
+  void SetData(const std::shared_ptr<ArrayData>& data);
+
+ private:
+  std::shared_ptr<Array> run_ends_;
+  std::shared_ptr<Array> values_;
+};
+
+/// @}
+
+}  // namespace arrow
@@ -0,0 +1,233 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "arrow/array.h"
+#include "arrow/array/builder_run_end.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/builder.h"
+#include "arrow/pretty_print.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/ree_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+class TestRunEndEncodedArray
+    : public ::testing::TestWithParam<std::shared_ptr<DataType>> {
+ protected:
+  void SetUp() override { run_end_type_ = GetParam(); }
+
+  std::shared_ptr<RunEndEncodedArray> MakeStrings(const std::string& run_ends_json,
+                                                  const std::string& values_json,
+                                                  int64_t length, int64_t offset = 0) {
+    auto run_ends = ArrayFromJSON(run_end_type_, run_ends_json);
+    auto values = ArrayFromJSON(utf8(), values_json);
+    EXPECT_OK_AND_ASSIGN(auto array,
+                         RunEndEncodedArray::Make(length, run_ends, values, offset));
+    return array;
+  }
+
+  std::shared_ptr<DataType> run_end_type_;
+};
+
+TEST_P(TestRunEndEncodedArray, MakeAndAccessors) {
+  auto array = MakeStrings("[2, 3, 6]", R"(["a", null, "b"])", 6);
+  ASSERT_OK(array->ValidateFull());
+  ASSERT_EQ(array->length(), 6);
+  ASSERT_EQ(array->null_count(), 0);
+  ASSERT_EQ(array->data()->buffers[0], nullptr);
+  ASSERT_TRUE(array->type()->Equals(*run_end_encoded(run_end_type_, utf8())));
+  ASSERT_EQ(array->FindPhysicalOffset(), 0);
+  ASSERT_EQ(array->FindPhysicalLength(), 3);
+
+  auto sliced = checked_pointer_cast<RunEndEncodedArray>(array->Slice(2, 3));
+  ASSERT_OK(sliced->ValidateFull());
+  ASSERT_EQ(sliced->FindPhysicalOffset(), 1);
+  ASSERT_EQ(sliced->FindPhysicalLength(), 2);
+  // Run ends are not adjusted for the slice offset
+  AssertArraysEqual(*sliced->run_ends(), *array->run_ends());
+  ASSERT_EQ(ree_util::LogicalNullCount(ArraySpan(*sliced->data())), 1);
+  ASSERT_EQ(ree_util::LogicalNullCount(ArraySpan(*array->data())), 1);
+
+  auto empty = MakeStrings("[]", "[]", 0);
+  ASSERT_OK(empty->ValidateFull());
+  ASSERT_EQ(empty->FindPhysicalLength(), 0);
+}
+
+TEST_P(TestRunEndEncodedArray, MakeInvalid) {
+  auto values = ArrayFromJSON(utf8(), R"(["a", "b"])");
+  // Run ends shorter than the logical length
+  ASSERT_RAISES(Invalid, RunEndEncodedArray::Make(
+                             5, ArrayFromJSON(run_end_type_, "[2, 4]"), values));
+  ASSERT_RAISES(Invalid, RunEndEncodedArray::Make(
+                             3, ArrayFromJSON(run_end_type_, "[2, 4]"), values, 2));
+  // More run ends than values
+  ASSERT_RAISES(Invalid,
+                RunEndEncodedArray::Make(3, ArrayFromJSON(run_end_type_, "[1, 2, 3]"),
+                                         values));
+  // Unsupported run end type
+  ASSERT_RAISES(TypeError, RunEndEncodedArray::Make(
+                               4, ArrayFromJSON(uint32(), "[2, 4]"), values));
+
+  // Only full validation checks the run ends themselves
+  auto array = MakeStrings("[3, 2]", R"(["a", "b"])", 2);
+  ASSERT_OK(array->Validate());
+  ASSERT_RAISES(Invalid, array->ValidateFull());
+  array = MakeStrings("[0, 2]", R"(["a", "b"])", 2);
+  ASSERT_RAISES(Invalid, array->ValidateFull());
+  array = MakeStrings("[null, 2]", R"(["a", "b"])", 2);
+  ASSERT_RAISES(Invalid, array->ValidateFull());
+}
+
+TEST_P(TestRunEndEncodedArray, GetScalar) {
+  auto array = MakeStrings("[2, 3, 6]", R"(["a", null, "b"])", 6);
+  const auto type = array->type();
+  ASSERT_OK_AND_ASSIGN(auto scalar, array->GetScalar(1));
+  AssertScalarsEqual(RunEndEncodedScalar(MakeScalar("a"), type), *scalar);
+  ASSERT_OK_AND_ASSIGN(scalar, array->GetScalar(2));
+  ASSERT_FALSE(scalar->is_valid);
+  ASSERT_OK(scalar->ValidateFull());
+  ASSERT_OK_AND_ASSIGN(scalar, array->Slice(3)->GetScalar(0));
+  AssertScalarsEqual(RunEndEncodedScalar(MakeScalar("b"), type), *scalar);
+}
+
+TEST_P(TestRunEndEncodedArray, Equals) {
+  auto array = MakeStrings("[2, 3, 6]", R"(["a", null, "b"])", 6);
+  // Same logical values, different runs
+  auto other = MakeStrings("[1, 2, 3, 5, 6]", R"(["a", "a", null, "b", "b"])", 6);
+  AssertArraysEqual(*array, *other);
+  ASSERT_TRUE(array->RangeEquals(*other, 1, 4, 1));
+  ASSERT_TRUE(array->Slice(3)->Equals(other->Slice(3)));
+
+  auto different = MakeStrings("[2, 3, 6]", R"(["a", "c", "b"])", 6);
+  ASSERT_FALSE(array->Equals(different));
+  ASSERT_TRUE(array->RangeEquals(*different, 3, 6, 3));
+
+  // Offsets into the underlying runs are honored
+  auto shifted = MakeStrings("[3, 5, 6, 9]", R"(["x", "a", null, "b"])", 6, 3);
+  AssertArraysEqual(*array, *shifted);
+}
+
+TEST_P(TestRunEndEncodedArray, Builder) {
+  auto type = run_end_encoded(run_end_type_, utf8());
+  std::unique_ptr<ArrayBuilder> builder;
+  ASSERT_OK(MakeBuilder(default_memory_pool(), type, &builder));
+  auto ree_builder = checked_cast<RunEndEncodedBuilder*>(builder.get());
+
+  ASSERT_OK(ree_builder->AppendScalar(*MakeScalar("a"), 2));
+  ASSERT_OK(ree_builder->AppendScalar(*MakeScalar("a")));
+  ASSERT_OK(ree_builder->AppendNulls(2));
+  ASSERT_OK(ree_builder->AppendNull());
+  auto plain = ArrayFromJSON(utf8(), R"(["b", "b", "c", "c", "c"])");
+  ASSERT_OK(ree_builder->AppendArraySlice(ArraySpan(*plain->data()), 1, 4));
+  ASSERT_EQ(ree_builder->length(), 10);
+
+  ASSERT_OK_AND_ASSIGN(auto array, ree_builder->Finish());
+  ASSERT_OK(array->ValidateFull());
+  const auto& ree_array = checked_cast<const RunEndEncodedArray&>(*array);
+  AssertArraysEqual(*ArrayFromJSON(run_end_type_, "[3, 6, 7, 10]"),
+                    *ree_array.run_ends());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", null, "b", "c"])"),
+                    *ree_array.values());
+
+  // Appending a run-end encoded slice merges the adjacent runs
+  ASSERT_OK(ree_builder->AppendScalar(*MakeScalar("c")));
+  ASSERT_OK(ree_builder->AppendArraySlice(ArraySpan(*array->data()), 8, 2));
+  ASSERT_OK(ree_builder->AppendArraySlice(ArraySpan(*array->data()), 0, 2));
+  ASSERT_OK_AND_ASSIGN(auto second, ree_builder->Finish());
+  ASSERT_OK(second->ValidateFull());
+  const auto& second_ree = checked_cast<const RunEndEncodedArray&>(*second);
+  AssertArraysEqual(*ArrayFromJSON(run_end_type_, "[3, 5]"), *second_ree.run_ends());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["c", "a"])"), *second_ree.values());
+
+  ASSERT_RAISES(TypeError, ree_builder->AppendScalar(*MakeScalar(int64_t(1))));
+}
+
+TEST_P(TestRunEndEncodedArray, BuilderCapacity) {
+  if (run_end_type_->id() != Type::INT16) {
+    GTEST_SKIP() << "Only int16 run ends overflow in reasonable time";
+  }
+  RunEndEncodedBuilder builder(default_memory_pool(), std::make_shared<Int16Builder>(),
+                               std::make_shared<StringBuilder>(),
+                               run_end_encoded(int16(), utf8()));
+  ASSERT_OK(builder.AppendScalar(*MakeScalar("a"), 32767));
+  ASSERT_RAISES(CapacityError, builder.AppendNull());
+}
+
+TEST_P(TestRunEndEncodedArray, FromScalarAndNulls) {
+  auto type = run_end_encoded(run_end_type_, utf8());
+  RunEndEncodedScalar scalar(MakeScalar("a"), type);
+  ASSERT_OK_AND_ASSIGN(auto array, MakeArrayFromScalar(scalar, 5));
+  ASSERT_OK(array->ValidateFull());
+  ASSERT_EQ(checked_cast<const RunEndEncodedArray&>(*array).FindPhysicalLength(), 1);
+  ASSERT_OK_AND_ASSIGN(auto first, array->GetScalar(4));
+  AssertScalarsEqual(scalar, *first);
+
+  ASSERT_OK_AND_ASSIGN(auto nulls, MakeArrayOfNull(type, 4));
+  ASSERT_OK(nulls->ValidateFull());
+  ASSERT_EQ(ree_util::LogicalNullCount(ArraySpan(*nulls->data())), 4);
+  ASSERT_OK_AND_ASSIGN(first, nulls->GetScalar(0));
+  ASSERT_FALSE(first->is_valid);
+}
+
+TEST_P(TestRunEndEncodedArray, Concatenate) {
+  auto left = MakeStrings("[2, 4]", R"(["a", "b"])", 4);
+  auto right = MakeStrings("[1, 3]", R"(["b", "c"])", 3);
+  ASSERT_OK_AND_ASSIGN(auto result, Concatenate({left, right->Slice(0, 2)}));
+  ASSERT_OK(result->ValidateFull());
+  const auto& ree_result = checked_cast<const RunEndEncodedArray&>(*result);
+  AssertArraysEqual(*ArrayFromJSON(run_end_type_, "[2, 5, 6]"), *ree_result.run_ends());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "c"])"), *ree_result.values());
+}
+
+TEST_P(TestRunEndEncodedArray, PrettyPrint) {
+  auto array = MakeStrings("[2, 3, 6]", R"(["a", null, "b"])", 6);
+  std::stringstream ss;
+  ASSERT_OK(PrettyPrint(*array->Slice(1, 2), {}, &ss));
+  ASSERT_NE(ss.str().find("-- run_ends:"), std::string::npos);
+  ASSERT_NE(ss.str().find("-- values:"), std::string::npos);
+}
+
+INSTANTIATE_TEST_SUITE_P(RunEndTypes, TestRunEndEncodedArray,
+                         ::testing::Values(int16(), int32(), int64()));
+
+TEST(TestRunEndEncodedType, Basics) {
+  auto type = run_end_encoded(int32(), utf8());
+  ASSERT_EQ(type->id(), Type::RUN_END_ENCODED);
+  ASSERT_EQ(type->ToString(), "run_end_encoded<run_ends: int32, values: string>");
+  ASSERT_EQ(type->num_fields(), 2);
+  ASSERT_FALSE(type->field(0)->nullable());
+  ASSERT_TRUE(type->Equals(*run_end_encoded(int32(), utf8())));
+  ASSERT_FALSE(type->Equals(*run_end_encoded(int64(), utf8())));
+  ASSERT_FALSE(type->Equals(*run_end_encoded(int32(), binary())));
+  ASSERT_RAISES(TypeError, RunEndEncodedType::Make(float64(), utf8()));
+  ASSERT_OK(RunEndEncodedType::Make(int16(), utf8()));
+}
+
+}  // namespace arrow
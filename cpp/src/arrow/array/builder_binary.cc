@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <numeric>
 #include <string>
 #include <utility>
@@ -31,6 +32,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
@@ -40,6 +42,166 @@ namespace arrow {
 
 using internal::checked_cast;
 
+// ----------------------------------------------------------------------
+// BinaryView and StringView
+
+constexpr int64_t BinaryViewBuilder::kDefaultBlockSize;
+
+BinaryViewBuilder::BinaryViewBuilder(MemoryPool* pool, int64_t block_size)
+    : ArrayBuilder(pool),
+      block_size_(block_size),
+      views_builder_(pool),
+      current_block_(pool) {}
+
+Status BinaryViewBuilder::Append(const uint8_t* value, int64_t length) {
+  if (ARROW_PREDICT_FALSE(length > std::numeric_limits<int32_t>::max())) {
+    return Status::CapacityError("BinaryView values cannot be larger than ",
+                                 std::numeric_limits<int32_t>::max(), " bytes, got ",
+                                 length);
+  }
+  RETURN_NOT_OK(Reserve(1));
+  const auto size = static_cast<int32_t>(length);
+  if (size <= BinaryViewType::kInlineSize) {
+    views_builder_.UnsafeAppend(util::ToInlineBinaryView(value, size));
+  } else {
+    RETURN_NOT_OK(ReserveData(length));
+    const auto offset = static_cast<int32_t>(current_block_.length());
+    current_block_.UnsafeAppend(value, length);
+    views_builder_.UnsafeAppend(util::ToBinaryView(
+        value, size, static_cast<int32_t>(data_buffers_.size()), offset));
+  }
+  UnsafeAppendToBitmap(true);
+  return Status::OK();
+}
+
+Status BinaryViewBuilder::AppendNulls(int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  views_builder_.UnsafeAppend(length, c_type{});
+  UnsafeAppendToBitmap(length, false);
+  return Status::OK();
+}
+
+Status BinaryViewBuilder::AppendNull() { return AppendNulls(1); }
+
+Status BinaryViewBuilder::AppendEmptyValues(int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  views_builder_.UnsafeAppend(length, c_type{});
+  UnsafeAppendToBitmap(length, true);
+  return Status::OK();
+}
+
+Status BinaryViewBuilder::AppendEmptyValue() { return AppendEmptyValues(1); }
+
+Status BinaryViewBuilder::AppendValues(const std::vector<std::string>& values,
+                                       const uint8_t* valid_bytes) {
+  RETURN_NOT_OK(Reserve(values.size()));
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (valid_bytes == NULLPTR || valid_bytes[i]) {
+      RETURN_NOT_OK(Append(values[i]));
+    } else {
+      RETURN_NOT_OK(AppendNull());
+    }
+  }
+  return Status::OK();
+}
+
+Status BinaryViewBuilder::AppendArraySlice(const ArraySpan& array, int64_t offset,
+                                           int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  const c_type* views = array.GetValues<c_type>(1) + offset;
+  const std::shared_ptr<Buffer>* src_buffers = array.GetVariadicBuffers();
+  const int64_t num_src_buffers = array.num_variadic_buffers();
+
+  // Share the source data buffers, unless they were already shared by a
+  // previous call (e.g. when appending several slices of the same array)
+  int64_t buffer_index_offset = -1;
+  if (num_src_buffers > 0) {
+    for (int64_t start = 0;
+         start + num_src_buffers <= static_cast<int64_t>(data_buffers_.size());
+         ++start) {
+      if (std::equal(src_buffers, src_buffers + num_src_buffers,
+                     data_buffers_.begin() + start)) {
+        buffer_index_offset = start;
+        break;
+      }
+    }
+    if (buffer_index_offset < 0) {
+      // Close the current block so that the shared buffers can be numbered
+      RETURN_NOT_OK(FlushBlock());
+      buffer_index_offset = static_cast<int64_t>(data_buffers_.size());
+      if (buffer_index_offset + num_src_buffers > std::numeric_limits<int32_t>::max()) {
+        return Status::CapacityError("BinaryView array cannot have more than ",
+                                     std::numeric_limits<int32_t>::max(),
+                                     " data buffers");
+      }
+      data_buffers_.insert(data_buffers_.end(), src_buffers,
+                           src_buffers + num_src_buffers);
+    }
+  }
+
+  for (int64_t i = 0; i < length; ++i) {
+    c_type view = views[i];
+    if (!view.is_inline()) {
+      view.ref.buffer_index += static_cast<int32_t>(buffer_index_offset);
+    }
+    views_builder_.UnsafeAppend(view);
+  }
+  if (array.MayHaveNulls()) {
+    UnsafeAppendToBitmap(array.buffers[0].data, array.offset + offset, length);
+  } else {
+    UnsafeAppendToBitmap(length, true);
+  }
+  return Status::OK();
+}
+
+void BinaryViewBuilder::Reset() {
+  ArrayBuilder::Reset();
+  views_builder_.Reset();
+  current_block_.Reset();
+  data_buffers_.clear();
+}
+
+Status BinaryViewBuilder::Resize(int64_t capacity) {
+  RETURN_NOT_OK(CheckCapacity(capacity));
+  RETURN_NOT_OK(views_builder_.Resize(capacity));
+  return ArrayBuilder::Resize(capacity);
+}
+
+Status BinaryViewBuilder::ReserveData(int64_t length) {
+  const int64_t new_length = current_block_.length() + length;
+  if (new_length <= current_block_.capacity() &&
+      new_length <= std::numeric_limits<int32_t>::max()) {
+    return Status::OK();
+  }
+  // Start a new block rather than growing the current one, so that views
+  // can address it with 32-bit offsets
+  RETURN_NOT_OK(FlushBlock());
+  return current_block_.Reserve(std::max(block_size_, length));
+}
+
+Status BinaryViewBuilder::FlushBlock() {
+  if (current_block_.length() > 0) {
+    std::shared_ptr<Buffer> block;
+    RETURN_NOT_OK(current_block_.Finish(&block));
+    data_buffers_.push_back(std::move(block));
+  }
+  return Status::OK();
+}
+
+Status BinaryViewBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  RETURN_NOT_OK(FlushBlock());
+
+  std::shared_ptr<Buffer> views, null_bitmap;
+  RETURN_NOT_OK(views_builder_.Finish(&views));
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+
+  BufferVector buffers = {std::move(null_bitmap), std::move(views)};
+  buffers.insert(buffers.end(), data_buffers_.begin(), data_buffers_.end());
+  *out = ArrayData::Make(type(), length_, std::move(buffers), null_count_);
+  Reset();
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
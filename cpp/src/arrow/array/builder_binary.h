@@ -456,6 +456,98 @@ class ARROW_EXPORT LargeStringBuilder : public LargeBinaryBuilder {
   std::shared_ptr<DataType> type() const override { return large_utf8(); }
 };
 
+// ----------------------------------------------------------------------
+// BinaryView and StringView
+
+/// \class BinaryViewBuilder
+/// \brief Builder class for variable-length binary view data
+///
+/// Values too long to be inlined in their view are copied into data blocks of
+/// at least `block_size` bytes, which become the data buffers of the array.
+/// AppendArraySlice does not copy such values: the views are appended as-is
+/// and the data buffers of the source array are shared.
+class ARROW_EXPORT BinaryViewBuilder : public ArrayBuilder {
+ public:
+  using TypeClass = BinaryViewType;
+  using c_type = BinaryViewType::c_type;
+
+  static constexpr int64_t kDefaultBlockSize = 32 << 10;  // 32 KiB
+
+  explicit BinaryViewBuilder(MemoryPool* pool = default_memory_pool(),
+                             int64_t block_size = kDefaultBlockSize);
+
+  BinaryViewBuilder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : BinaryViewBuilder(pool) {}
+
+  Status Append(const uint8_t* value, int64_t length);
+
+  Status Append(const char* value, int64_t length) {
+    return Append(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  Status Append(util::string_view value) {
+    return Append(value.data(), static_cast<int64_t>(value.size()));
+  }
+
+  Status AppendNulls(int64_t length) final;
+  Status AppendNull() final;
+  Status AppendEmptyValue() final;
+  Status AppendEmptyValues(int64_t length) final;
+
+  /// \brief Append a sequence of strings in one shot.
+  ///
+  /// \param[in] values a vector of strings
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const std::vector<std::string>& values,
+                      const uint8_t* valid_bytes = NULLPTR);
+
+  Status AppendArraySlice(const ArraySpan& array, int64_t offset,
+                          int64_t length) override;
+
+  void Reset() override;
+  Status Resize(int64_t capacity) override;
+
+  /// \brief Ensures there is enough allocated capacity to append the indicated
+  /// number of bytes of non-inlined values without additional allocations
+  Status ReserveData(int64_t length);
+
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \cond FALSE
+  using ArrayBuilder::Finish;
+  /// \endcond
+
+  Status Finish(std::shared_ptr<BinaryViewArray>* out) { return FinishTyped(out); }
+
+  std::shared_ptr<DataType> type() const override { return binary_view(); }
+
+ protected:
+  // Emit the current data block as a data buffer
+  Status FlushBlock();
+
+  int64_t block_size_;
+  TypedBufferBuilder<c_type> views_builder_;
+  TypedBufferBuilder<uint8_t> current_block_;
+  BufferVector data_buffers_;
+};
+
+/// \class StringViewBuilder
+/// \brief Builder class for UTF8 string views
+class ARROW_EXPORT StringViewBuilder : public BinaryViewBuilder {
+ public:
+  using BinaryViewBuilder::BinaryViewBuilder;
+
+  /// \cond FALSE
+  using ArrayBuilder::Finish;
+  /// \endcond
+
+  Status Finish(std::shared_ptr<StringViewArray>* out) { return FinishTyped(out); }
+
+  std::shared_ptr<DataType> type() const override { return utf8_view(); }
+};
+
 // ----------------------------------------------------------------------
 // FixedSizeBinaryBuilder
 
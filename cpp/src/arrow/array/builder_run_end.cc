@@ -0,0 +1,239 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/array/builder_run_end.h"
+
+#include <limits>
+#include <utility>
+
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/compare.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/ree_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+// ----------------------------------------------------------------------
+// RunEndEncodedBuilder
+
+RunEndEncodedBuilder::RunEndEncodedBuilder(
+    MemoryPool* pool, const std::shared_ptr<ArrayBuilder>& run_end_builder,
+    const std::shared_ptr<ArrayBuilder>& value_builder, std::shared_ptr<DataType> type)
+    : ArrayBuilder(pool),
+      type_(internal::checked_pointer_cast<RunEndEncodedType>(std::move(type))) {
+  DCHECK(run_end_builder->type()->Equals(*type_->run_end_type()));
+  children_ = {run_end_builder, value_builder};
+}
+
+Status RunEndEncodedBuilder::AppendNulls(int64_t length) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  if (null_value_ == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(null_value_, MakeArrayOfNull(type_->value_type(), 1, pool_));
+  }
+  return AppendRun(null_value_, 0, length);
+}
+
+Status RunEndEncodedBuilder::AppendEmptyValues(int64_t length) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(CheckLength(length));
+  RETURN_NOT_OK(FlushPendingRun());
+  RETURN_NOT_OK(value_builder()->AppendEmptyValue());
+  length_ += length;
+  return AppendRunEnd(length_);
+}
+
+Status RunEndEncodedBuilder::AppendScalar(const Scalar& scalar, int64_t n_repeats) {
+  if (n_repeats == 0) {
+    return Status::OK();
+  }
+  const Scalar* value = &scalar;
+  if (scalar.type->id() == Type::RUN_END_ENCODED) {
+    value = checked_cast<const RunEndEncodedScalar&>(scalar).value.get();
+  }
+  if (!value->type->Equals(*type_->value_type())) {
+    return Status::TypeError("Cannot append scalar of type ", *scalar.type,
+                             " to builder for type ", *type_);
+  }
+  if (!value->is_valid) {
+    return AppendNulls(n_repeats);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto array, MakeArrayFromScalar(*value, 1, pool_));
+  return AppendRun(array, 0, n_repeats);
+}
+
+Status RunEndEncodedBuilder::AppendScalars(const ScalarVector& scalars) {
+  for (const auto& scalar : scalars) {
+    RETURN_NOT_OK(AppendScalar(*scalar, 1));
+  }
+  return Status::OK();
+}
+
+Status RunEndEncodedBuilder::AppendArraySlice(const ArraySpan& array, int64_t offset,
+                                              int64_t length) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  if (array.type->id() == Type::RUN_END_ENCODED) {
+    if (!array.type->Equals(*type_)) {
+      return Status::TypeError("Cannot append array of type ", *array.type,
+                               " to builder for type ", *type_);
+    }
+    ArraySpan sliced = array;
+    sliced.SetSlice(array.offset + offset, length);
+    auto values = MakeArray(ree_util::ValuesArray(sliced).ToArrayData());
+    switch (type_->run_end_type()->id()) {
+      case Type::INT16:
+        return AppendRuns<int16_t>(sliced, values);
+      case Type::INT32:
+        return AppendRuns<int32_t>(sliced, values);
+      default:
+        return AppendRuns<int64_t>(sliced, values);
+    }
+  }
+
+  if (!array.type->Equals(*type_->value_type())) {
+    return Status::TypeError("Cannot append array of type ", *array.type,
+                             " to builder for type ", *type_);
+  }
+  // Detect runs of equal consecutive values in the input
+  auto values = array.ToArray();
+  int64_t run_start = offset;
+  for (int64_t i = offset + 1; i < offset + length; ++i) {
+    if (!ArrayRangeEquals(*values, *values, i, i + 1, run_start)) {
+      RETURN_NOT_OK(AppendRun(values, run_start, i - run_start));
+      run_start = i;
+    }
+  }
+  return AppendRun(values, run_start, offset + length - run_start);
+}
+
+template <typename RunEndCType>
+Status RunEndEncodedBuilder::AppendRuns(const ArraySpan& span,
+                                        const std::shared_ptr<Array>& values) {
+  ree_util::RunEndEncodedArraySpan<RunEndCType> ree_span(span);
+  for (auto it = ree_span.begin(); it != ree_span.end(); ++it) {
+    RETURN_NOT_OK(AppendRun(values, it.index_into_array(), it.run_length()));
+  }
+  return Status::OK();
+}
+
+Status RunEndEncodedBuilder::AppendRun(const std::shared_ptr<Array>& source,
+                                       int64_t index, int64_t length) {
+  DCHECK_GT(length, 0);
+  RETURN_NOT_OK(CheckLength(length));
+  if (pending_length_ == 0 ||
+      !ArrayRangeEquals(*pending_source_, *source, pending_index_, pending_index_ + 1,
+                        index)) {
+    RETURN_NOT_OK(FlushPendingRun());
+    pending_source_ = source;
+    pending_index_ = index;
+  }
+  pending_length_ += length;
+  length_ += length;
+  return Status::OK();
+}
+
+Status RunEndEncodedBuilder::FlushPendingRun() {
+  if (pending_length_ == 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(
+      value_builder()->AppendArraySlice(ArraySpan(*pending_source_->data()),
+                                        pending_index_, /*length=*/1));
+  RETURN_NOT_OK(AppendRunEnd(length_));
+  pending_source_.reset();
+  pending_length_ = 0;
+  return Status::OK();
+}
+
+Status RunEndEncodedBuilder::AppendRunEnd(int64_t run_end) {
+  switch (type_->run_end_type()->id()) {
+    case Type::INT16:
+      return checked_cast<Int16Builder*>(run_end_builder())
+          ->Append(static_cast<int16_t>(run_end));
+    case Type::INT32:
+      return checked_cast<Int32Builder*>(run_end_builder())
+          ->Append(static_cast<int32_t>(run_end));
+    default:
+      DCHECK_EQ(type_->run_end_type()->id(), Type::INT64);
+      return checked_cast<Int64Builder*>(run_end_builder())->Append(run_end);
+  }
+}
+
+Status RunEndEncodedBuilder::CheckLength(int64_t additional_length) const {
+  int64_t max_length;
+  switch (type_->run_end_type()->id()) {
+    case Type::INT16:
+      max_length = std::numeric_limits<int16_t>::max();
+      break;
+    case Type::INT32:
+      max_length = std::numeric_limits<int32_t>::max();
+      break;
+    default:
+      max_length = std::numeric_limits<int64_t>::max();
+      break;
+  }
+  if (ARROW_PREDICT_FALSE(additional_length < 0 ||
+                          additional_length > max_length - length_)) {
+    return Status::CapacityError("Run-end encoded array cannot exceed ", max_length,
+                                 " logical values with run end type ",
+                                 *type_->run_end_type());
+  }
+  return Status::OK();
+}
+
+Status RunEndEncodedBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  RETURN_NOT_OK(FlushPendingRun());
+  std::shared_ptr<ArrayData> run_ends_data;
+  std::shared_ptr<ArrayData> values_data;
+  RETURN_NOT_OK(run_end_builder()->FinishInternal(&run_ends_data));
+  RETURN_NOT_OK(value_builder()->FinishInternal(&values_data));
+  *out = ArrayData::Make(type(), length_, {NULLPTR}, /*null_count=*/0);
+  (*out)->child_data = {std::move(run_ends_data), std::move(values_data)};
+  Reset();
+  return Status::OK();
+}
+
+Status RunEndEncodedBuilder::Resize(int64_t capacity) {
+  RETURN_NOT_OK(CheckCapacity(capacity));
+  capacity_ = capacity;
+  return Status::OK();
+}
+
+void RunEndEncodedBuilder::Reset() {
+  ArrayBuilder::Reset();
+  run_end_builder()->Reset();
+  value_builder()->Reset();
+  pending_source_.reset();
+  pending_index_ = 0;
+  pending_length_ = 0;
+}
+
+std::shared_ptr<DataType> RunEndEncodedBuilder::type() const {
+  return run_end_encoded(children_[0]->type(), children_[1]->type());
+}
+
+}  // namespace arrow
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/array/array_run_end.h"
+#include "arrow/array/builder_base.h"
+#include "arrow/array/data.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+/// \addtogroup nested-builders
+///
+/// @{
+
+/// \brief Builder for run-end encoded arrays
+///
+/// Consecutive equal values are coalesced into a single run, whether they
+/// are appended one at a time, as repeated scalars or as array slices.
+/// The run being built is kept pending until a different value is appended
+/// or the builder is finished.
+///
+/// Note that while we subclass ArrayBuilder, as run-end encoded types do not
+/// have a validity bitmap, the bitmap builder member of ArrayBuilder is not used.
+class ARROW_EXPORT RunEndEncodedBuilder : public ArrayBuilder {
+ public:
+  RunEndEncodedBuilder(MemoryPool* pool,
+                       const std::shared_ptr<ArrayBuilder>& run_end_builder,
+                       const std::shared_ptr<ArrayBuilder>& value_builder,
+                       std::shared_ptr<DataType> type);
+
+  Status AppendNull() final { return AppendNulls(1); }
+  Status AppendNulls(int64_t length) final;
+
+  Status AppendEmptyValue() final { return AppendEmptyValues(1); }
+  Status AppendEmptyValues(int64_t length) final;
+
+  using ArrayBuilder::AppendScalar;
+  Status AppendScalar(const Scalar& scalar, int64_t n_repeats) final;
+  Status AppendScalars(const ScalarVector& scalars) final;
+
+  /// \brief Append a range of values from an array
+  ///
+  /// The array may either be of the value type, or run-end encoded with
+  /// the same type as this builder.
+  Status AppendArraySlice(const ArraySpan& array, int64_t offset,
+                          int64_t length) final;
+
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) final;
+
+  /// \cond FALSE
+  using ArrayBuilder::Finish;
+  /// \endcond
+
+  Status Finish(std::shared_ptr<RunEndEncodedArray>* out) { return FinishTyped(out); }
+
+  /// \brief Set the logical capacity of the builder
+  ///
+  /// Child builders grow with the number of runs, which isn't known upfront,
+  /// so this only checks the requested capacity.
+  Status Resize(int64_t capacity) final;
+
+  void Reset() final;
+
+  std::shared_ptr<DataType> type() const final;
+
+  ArrayBuilder* run_end_builder() { return children_[0].get(); }
+  ArrayBuilder* value_builder() { return children_[1].get(); }
+
+ private:
+  // Append `length` logical values equal to source[index], extending the
+  // pending run if the value is equal to the pending one.
+  Status AppendRun(const std::shared_ptr<Array>& source, int64_t index, int64_t length);
+  template <typename RunEndCType>
+  Status AppendRuns(const ArraySpan& span, const std::shared_ptr<Array>& values);
+  // Close the pending run, if any, appending it to the child builders
+  Status FlushPendingRun();
+  Status AppendRunEnd(int64_t run_end);
+  Status CheckLength(int64_t additional_length) const;
+
+  std::shared_ptr<RunEndEncodedType> type_;
+  // A single null value, used as the source of null runs
+  std::shared_ptr<Array> null_value_;
+  // The pending run is pending_length_ repetitions of pending_source_[pending_index_]
+  std::shared_ptr<Array> pending_source_;
+  int64_t pending_index_ = 0;
+  int64_t pending_length_ = 0;
+};
+
+/// @}
+
+}  // namespace arrow
@@ -30,6 +30,7 @@
 #include "arrow/array/data.h"
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
+#include "arrow/builder.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -227,6 +228,38 @@ class ConcatenateImpl {
     return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
   }
 
+  Status Visit(const BinaryViewType&) {
+    // The data buffers are shared, so only the views are copied, with their
+    // buffer indices shifted past the data buffers of the preceding inputs
+    using c_type = BinaryViewType::c_type;
+    out_->buffers.resize(2);
+    ARROW_ASSIGN_OR_RAISE(auto views,
+                          AllocateBuffer(out_->length * BinaryViewType::kSize, pool_));
+    auto out_views = reinterpret_cast<c_type*>(views->mutable_data());
+    int64_t buffer_index_offset = 0;
+    for (const auto& array_data : in_) {
+      if (buffer_index_offset > std::numeric_limits<int32_t>::max()) {
+        return Status::Invalid("concatenation would have more than ",
+                               std::numeric_limits<int32_t>::max(), " data buffers");
+      }
+      if (array_data->length > 0) {
+        const c_type* in_views = array_data->GetValues<c_type>(1);
+        for (int64_t i = 0; i < array_data->length; ++i) {
+          *out_views = in_views[i];
+          if (!out_views->is_inline()) {
+            out_views->ref.buffer_index += static_cast<int32_t>(buffer_index_offset);
+          }
+          ++out_views;
+        }
+      }
+      out_->buffers.insert(out_->buffers.end(), array_data->buffers.begin() + 2,
+                           array_data->buffers.end());
+      buffer_index_offset += static_cast<int64_t>(array_data->buffers.size()) - 2;
+    }
+    out_->buffers[1] = std::move(views);
+    return Status::OK();
+  }
+
   Status Visit(const ListType&) {
     std::vector<Range> value_ranges;
     ARROW_ASSIGN_OR_RAISE(auto index_buffers, Buffers(1, sizeof(int32_t)));
@@ -436,6 +469,18 @@ class ConcatenateImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType&) {
+    // Run ends are absolute positions, so rebuild the runs rather than
+    // concatenating the children.  This also coalesces runs spanning inputs.
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(pool_, out_->type, &builder));
+    for (const auto& array_data : in_) {
+      RETURN_NOT_OK(
+          builder->AppendArraySlice(ArraySpan(*array_data), 0, array_data->length));
+    }
+    return builder->FinishInternal(&out_);
+  }
+
   Status Visit(const ExtensionType& e) {
     // XXX can we just concatenate their storage?
     return Status::NotImplemented("concatenation of ", e);
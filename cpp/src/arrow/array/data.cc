@@ -31,10 +31,12 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/slice_util_internal.h"
+#include "arrow/util/ubsan.h"
 
 namespace arrow {
 
@@ -145,7 +147,11 @@ void ArraySpan::SetMembers(const ArrayData& data) {
   }
   this->offset = data.offset;
 
-  for (int i = 0; i < static_cast<int>(data.buffers.size()); ++i) {
+  Type::type type_id = this->type->id();
+  const int num_buffers = is_binary_view_like(type_id)
+                              ? std::min(static_cast<int>(data.buffers.size()), 2)
+                              : static_cast<int>(data.buffers.size());
+  for (int i = 0; i < num_buffers; ++i) {
     const std::shared_ptr<Buffer>& buffer = data.buffers[i];
     // It is the invoker-of-kernels's responsibility to ensure that
     // const buffers are not written to accidentally.
@@ -156,7 +162,6 @@ void ArraySpan::SetMembers(const ArrayData& data) {
     }
   }
 
-  Type::type type_id = this->type->id();
   if (data.buffers[0] == nullptr && type_id != Type::NA &&
       type_id != Type::SPARSE_UNION && type_id != Type::DENSE_UNION) {
     // This should already be zero but we make for sure
@@ -164,10 +169,18 @@ void ArraySpan::SetMembers(const ArrayData& data) {
   }
 
   // Makes sure any other buffers are seen as null / non-existent
-  for (int i = static_cast<int>(data.buffers.size()); i < 3; ++i) {
+  for (int i = num_buffers; i < 3; ++i) {
     this->buffers[i] = {};
   }
 
+  if (is_binary_view_like(type_id) && data.buffers.size() > 2) {
+    // Expose the data buffers as a whole (see GetVariadicBuffers)
+    auto variadic_buffers = const_cast<std::shared_ptr<Buffer>*>(&data.buffers[2]);
+    this->buffers[2].data = reinterpret_cast<uint8_t*>(variadic_buffers);
+    this->buffers[2].size = static_cast<int64_t>(
+        (data.buffers.size() - 2) * sizeof(std::shared_ptr<Buffer>));
+  }
+
   if (this->type->id() == Type::DICTIONARY) {
     this->child_data.resize(1);
     this->child_data[0].SetMembers(*data.dictionary);
@@ -195,11 +208,14 @@ int GetNumBuffers(const DataType& type) {
     case Type::NA:
     case Type::STRUCT:
     case Type::FIXED_SIZE_LIST:
+    case Type::RUN_END_ENCODED:
       return 1;
     case Type::BINARY:
     case Type::LARGE_BINARY:
     case Type::STRING:
     case Type::LARGE_STRING:
+    case Type::BINARY_VIEW:
+    case Type::STRING_VIEW:
     case Type::DENSE_UNION:
       return 3;
     case Type::EXTENSION:
@@ -251,7 +267,7 @@ void ArraySpan::FillFromScalar(const Scalar& value) {
 
   // Populate null count and validity bitmap (only for non-union/null types)
   this->null_count = value.is_valid ? 0 : 1;
-  if (!is_union(type_id) && type_id != Type::NA) {
+  if (!is_union(type_id) && type_id != Type::NA && type_id != Type::RUN_END_ENCODED) {
     this->buffers[0].data = value.is_valid ? &kTrueBit : &kFalseBit;
     this->buffers[0].size = 1;
   }
@@ -291,6 +307,24 @@ void ArraySpan::FillFromScalar(const Scalar& value) {
     }
     this->buffers[2].data = const_cast<uint8_t*>(data_buffer);
     this->buffers[2].size = data_size;
+  } else if (is_binary_view_like(type_id)) {
+    const auto& scalar = checked_cast<const BaseBinaryScalar&>(value);
+    auto* view = reinterpret_cast<BinaryViewType::c_type*>(this->scratch_space);
+    static_assert(sizeof(this->scratch_space) == BinaryViewType::kSize, "");
+    if (scalar.is_valid) {
+      *view = util::ToBinaryView(scalar.value->data(),
+                                 static_cast<int32_t>(scalar.value->size()),
+                                 /*buffer_index=*/0, /*offset=*/0);
+      // The scalar's value is the single data buffer
+      this->buffers[2].data = reinterpret_cast<uint8_t*>(
+          const_cast<std::shared_ptr<Buffer>*>(&scalar.value));
+      this->buffers[2].size = sizeof(std::shared_ptr<Buffer>);
+    } else {
+      *view = {};
+      this->buffers[2] = {};
+    }
+    this->buffers[1].data = reinterpret_cast<uint8_t*>(view);
+    this->buffers[1].size = BinaryViewType::kSize;
   } else if (type_id == Type::FIXED_SIZE_BINARY) {
     const auto& scalar = checked_cast<const BaseBinaryScalar&>(value);
     this->buffers[1].data = const_cast<uint8_t*>(scalar.value->data());
@@ -367,6 +401,39 @@ void ArraySpan::FillFromScalar(const Scalar& value) {
         this->child_data[i].FillFromScalar(*scalar.value[i]);
       }
     }
+  } else if (type_id == Type::RUN_END_ENCODED) {
+    // No validity bitmap: nullness is that of the single run's value
+    this->buffers[0] = {};
+    this->null_count = 0;
+    const auto& scalar = checked_cast<const RunEndEncodedScalar&>(value);
+    const auto& run_end_type = scalar.ree_type().run_end_type();
+    this->child_data.resize(2);
+
+    // A single run ending at 1
+    ArraySpan& run_ends = this->child_data[0];
+    run_ends.type = run_end_type.get();
+    run_ends.length = 1;
+    run_ends.null_count = 0;
+    run_ends.offset = 0;
+    run_ends.buffers[0] = {};
+    run_ends.buffers[1].data = reinterpret_cast<uint8_t*>(run_ends.scratch_space);
+    run_ends.buffers[1].size = run_end_type->byte_width();
+    run_ends.buffers[2] = {};
+    switch (run_end_type->id()) {
+      case Type::INT16:
+        util::SafeStore(run_ends.scratch_space, int16_t{1});
+        break;
+      case Type::INT32:
+        util::SafeStore(run_ends.scratch_space, int32_t{1});
+        break;
+      default:
+        DCHECK_EQ(run_end_type->id(), Type::INT64);
+        util::SafeStore(run_ends.scratch_space, int64_t{1});
+        break;
+    }
+    run_ends.child_data.clear();
+
+    this->child_data[1].FillFromScalar(*scalar.value);
   } else if (type_id == Type::EXTENSION) {
     // Pass through storage
     const auto& scalar = checked_cast<const ExtensionScalar&>(value);
@@ -399,8 +466,15 @@ std::shared_ptr<ArrayData> ArraySpan::ToArrayData() const {
   auto result = std::make_shared<ArrayData>(this->type->GetSharedPtr(), this->length,
                                             this->null_count, this->offset);
 
-  for (int i = 0; i < this->num_buffers(); ++i) {
-    result->buffers.emplace_back(this->GetBuffer(i));
+  if (is_binary_view_like(this->type->id())) {
+    result->buffers = {this->GetBuffer(0), this->GetBuffer(1)};
+    const std::shared_ptr<Buffer>* data_buffers = this->GetVariadicBuffers();
+    result->buffers.insert(result->buffers.end(), data_buffers,
+                           data_buffers + this->num_variadic_buffers());
+  } else {
+    for (int i = 0; i < this->num_buffers(); ++i) {
+      result->buffers.emplace_back(this->GetBuffer(i));
+    }
   }
 
   if (this->type->id() == Type::NA) {
@@ -520,6 +594,26 @@ struct ViewDataImpl {
     int64_t out_offset = 0;
     int64_t out_null_count;
 
+    if (out_layout.variadic_spec) {
+      // Types with variadic buffers can only be viewed as a whole
+      RETURN_NOT_OK(CheckInputAvailable());
+      const auto& in_layout = in_layouts[in_layout_idx];
+      if (in_buffer_idx != 0 || !in_layout.variadic_spec ||
+          in_layout.buffers != out_layout.buffers ||
+          *in_layout.variadic_spec != *out_layout.variadic_spec) {
+        return InvalidView("incompatible layouts");
+      }
+      const auto& in_data_item = in_data[in_layout_idx];
+      if (!out_field->nullable() && in_data_item->GetNullCount() != 0) {
+        return InvalidView("nulls in input cannot be viewed as non-nullable");
+      }
+      *out = in_data_item->Copy();
+      (*out)->type = out_type;
+      in_buffer_idx = in_layout.buffers.size();
+      AdjustInputPointer();
+      return Status::OK();
+    }
+
     std::shared_ptr<ArrayData> dictionary;
     if (out_type->id() == Type::DICTIONARY) {
       ARROW_ASSIGN_OR_RAISE(dictionary, GetDictionaryView(*out_type));
@@ -577,7 +671,7 @@ struct ViewDataImpl {
 
       RETURN_NOT_OK(CheckInputAvailable());
       const auto& in_spec = in_layouts[in_layout_idx].buffers[in_buffer_idx];
-      if (out_spec != in_spec) {
+      if (out_spec != in_spec || in_layouts[in_layout_idx].variadic_spec) {
         return InvalidView("incompatible layouts");
       }
       // Copy input buffer
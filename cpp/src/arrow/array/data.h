@@ -298,6 +298,19 @@ struct ARROW_EXPORT ArraySpan {
 
   const ArraySpan& dictionary() const { return child_data[0]; }
 
+  /// \brief Return the data buffers of a binary view array
+  ///
+  /// As the number of data buffers is not bounded, buffers[2] points at the
+  /// shared_ptr<Buffer> array of the underlying ArrayData rather than at data.
+  const std::shared_ptr<Buffer>* GetVariadicBuffers() const {
+    return reinterpret_cast<const std::shared_ptr<Buffer>*>(buffers[2].data);
+  }
+
+  /// \brief Return the number of data buffers of a binary view array
+  int64_t num_variadic_buffers() const {
+    return buffers[2].size / static_cast<int64_t>(sizeof(std::shared_ptr<Buffer>));
+  }
+
   /// \brief Return the number of buffers (out of 3) that are used to
   /// constitute this array
   int num_buffers() const;
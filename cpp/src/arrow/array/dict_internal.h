@@ -31,6 +31,8 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
@@ -188,5 +190,44 @@ struct DictionaryTraits<T, enable_if_fixed_size_binary<T>> {
   }
 };
 
+template <typename T>
+struct DictionaryTraits<T, enable_if_binary_view_like<T>> {
+  using MemoTableType = typename HashTraits<T>::MemoTableType;
+
+  static Status GetDictionaryArrayData(MemoryPool* pool,
+                                       const std::shared_ptr<DataType>& type,
+                                       const MemoTableType& memo_table,
+                                       int64_t start_offset,
+                                       std::shared_ptr<ArrayData>* out) {
+    // Lay the values out contiguously, as for BinaryType, then view them in place
+    std::shared_ptr<ArrayData> binary_data;
+    RETURN_NOT_OK(DictionaryTraits<BinaryType>::GetDictionaryArrayData(
+        pool, binary(), memo_table, start_offset, &binary_data));
+    const int64_t dict_length = binary_data->length;
+    const auto* offsets = binary_data->GetValues<int32_t>(1);
+    const uint8_t* null_bitmap = binary_data->GetValues<uint8_t>(0, 0);
+    const std::shared_ptr<Buffer>& dict_data = binary_data->buffers[2];
+
+    ARROW_ASSIGN_OR_RAISE(auto dict_views,
+                          AllocateBuffer(dict_length * BinaryViewType::kSize, pool));
+    auto views = reinterpret_cast<BinaryViewType::c_type*>(dict_views->mutable_data());
+    for (int64_t i = 0; i < dict_length; ++i) {
+      if (null_bitmap != NULLPTR && !bit_util::GetBit(null_bitmap, i)) {
+        views[i] = {};
+      } else {
+        views[i] = util::ToBinaryView(dict_data->data() + offsets[i],
+                                      offsets[i + 1] - offsets[i],
+                                      /*buffer_index=*/0, offsets[i]);
+      }
+    }
+
+    *out = ArrayData::Make(
+        type, dict_length,
+        {binary_data->buffers[0], std::move(dict_views), dict_data},
+        binary_data->null_count);
+    return Status::OK();
+  }
+};
+
 }  // namespace internal
 }  // namespace arrow
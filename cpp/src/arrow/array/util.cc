@@ -38,6 +38,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
@@ -237,6 +238,7 @@ class ArrayDataEndianSwapper {
   Status Visit(const FixedSizeBinaryType& type) { return Status::OK(); }
   Status Visit(const FixedSizeListType& type) { return Status::OK(); }
   Status Visit(const StructType& type) { return Status::OK(); }
+  Status Visit(const RunEndEncodedType& type) { return Status::OK(); }
   Status Visit(const UnionType& type) {
     out_->buffers[1] = data_->buffers[1];
     if (type.mode() == UnionMode::DENSE) {
@@ -264,6 +266,29 @@ class ArrayDataEndianSwapper {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewType& type) {
+    using c_type = BinaryViewType::c_type;
+    out_->buffers = data_->buffers;
+    if (data_->buffers[1] == nullptr) {
+      return Status::OK();
+    }
+    auto data = reinterpret_cast<const c_type*>(data_->buffers[1]->data());
+    ARROW_ASSIGN_OR_RAISE(auto new_buffer, AllocateBuffer(data_->buffers[1]->size()));
+    auto new_data = reinterpret_cast<c_type*>(new_buffer->mutable_data());
+    // NOTE: data_->length not trusted (see warning above)
+    const int64_t length = data_->buffers[1]->size() / BinaryViewType::kSize;
+    for (int64_t i = 0; i < length; i++) {
+      new_data[i] = data[i];
+      new_data[i].inlined.size = bit_util::ByteSwap(data[i].inlined.size);
+      if (!new_data[i].is_inline()) {
+        new_data[i].ref.buffer_index = bit_util::ByteSwap(data[i].ref.buffer_index);
+        new_data[i].ref.offset = bit_util::ByteSwap(data[i].ref.offset);
+      }
+    }
+    out_->buffers[1] = std::move(new_buffer);
+    return Status::OK();
+  }
+
   Status Visit(const ListType& type) {
     RETURN_NOT_OK(SwapOffsets<int32_t>(1));
     return Status::OK();
@@ -317,6 +342,47 @@ std::shared_ptr<Array> MakeArray(const std::shared_ptr<ArrayData>& data) {
 
 namespace {
 
+// Make a run-end encoded array of the given length consisting of a single run
+// of `value`, a values array of length 1
+Result<std::shared_ptr<ArrayData>> MakeSingleRunArray(
+    const std::shared_ptr<DataType>& type, int64_t length,
+    std::shared_ptr<ArrayData> value, MemoryPool* pool) {
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*type);
+  const int64_t num_runs = length > 0 ? 1 : 0;
+  const int byte_width = ree_type.run_end_type()->byte_width();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> run_ends_buffer,
+                        AllocateBuffer(byte_width, pool));
+  switch (ree_type.run_end_type()->id()) {
+    case Type::INT16:
+      if (length > std::numeric_limits<int16_t>::max()) {
+        return Status::Invalid("Length ", length, " too large for run end type ",
+                               *ree_type.run_end_type());
+      }
+      *reinterpret_cast<int16_t*>(run_ends_buffer->mutable_data()) =
+          static_cast<int16_t>(length);
+      break;
+    case Type::INT32:
+      if (length > std::numeric_limits<int32_t>::max()) {
+        return Status::Invalid("Length ", length, " too large for run end type ",
+                               *ree_type.run_end_type());
+      }
+      *reinterpret_cast<int32_t*>(run_ends_buffer->mutable_data()) =
+          static_cast<int32_t>(length);
+      break;
+    default:
+      *reinterpret_cast<int64_t*>(run_ends_buffer->mutable_data()) = length;
+      break;
+  }
+  auto run_ends = ArrayData::Make(ree_type.run_end_type(), num_runs,
+                                  {nullptr, std::move(run_ends_buffer)}, 0);
+  if (num_runs == 0) {
+    value = value->Slice(0, 0);
+  }
+  auto out = ArrayData::Make(type, length, {nullptr}, /*null_count=*/0);
+  out->child_data = {std::move(run_ends), std::move(value)};
+  return out;
+}
+
 // get the maximum buffer length required, then allocate a single zeroed buffer
 // to use anywhere a buffer is required
 class NullArrayFactory {
@@ -355,6 +421,10 @@ class NullArrayFactory {
       return MaxOf(type.byte_width() * length_);
     }
 
+    Status Visit(const BinaryViewType& type) {
+      return MaxOf(BinaryViewType::kSize * length_);
+    }
+
     Status Visit(const StructType& type) {
       for (const auto& child : type.fields()) {
         RETURN_NOT_OK(MaxOf(GetBufferLength(child->type(), length_)));
@@ -384,6 +454,11 @@ class NullArrayFactory {
       return Status::OK();
     }
 
+    Status Visit(const RunEndEncodedType& type) {
+      // will create a values child of length 1
+      return MaxOf(GetBufferLength(type.value_type(), 1));
+    }
+
     Status Visit(const DictionaryType& type) {
       RETURN_NOT_OK(MaxOf(GetBufferLength(type.value_type(), length_)));
       return MaxOf(GetBufferLength(type.index_type(), length_));
@@ -455,6 +530,12 @@ class NullArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewType&) {
+    // Zeroed views, no data buffers
+    out_->buffers.resize(2, buffer_);
+    return Status::OK();
+  }
+
   template <typename T>
   enable_if_var_size_list<T, Status> Visit(const T& type) {
     out_->buffers.resize(2, buffer_);
@@ -505,6 +586,13 @@ class NullArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    ARROW_ASSIGN_OR_RAISE(auto value, CreateChild(type, 1, /*length=*/1));
+    ARROW_ASSIGN_OR_RAISE(out_, MakeSingleRunArray(type_, length_, std::move(value),
+                                                   pool_));
+    return Status::OK();
+  }
+
   Status Visit(const DictionaryType& type) {
     out_->buffers.resize(2, buffer_);
     ARROW_ASSIGN_OR_RAISE(auto typed_null_dict, MakeArrayOfNull(type.value_type(), 0));
@@ -596,6 +684,27 @@ class RepeatedArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const BinaryViewType&) {
+    // All views reference the scalar's value, which is not copied
+    std::shared_ptr<Buffer> value =
+        checked_cast<const BaseBinaryScalar&>(scalar_).value;
+    if (value->size() > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("BinaryView values cannot be larger than ",
+                                   std::numeric_limits<int32_t>::max(), " bytes");
+    }
+    const auto view = util::ToBinaryView(
+        value->data(), static_cast<int32_t>(value->size()), /*buffer_index=*/0,
+        /*offset=*/0);
+    std::shared_ptr<Buffer> views_buffer;
+    RETURN_NOT_OK(CreateBufferOf(&view, sizeof(view), &views_buffer));
+    BufferVector buffers = {nullptr, std::move(views_buffer)};
+    if (!view.is_inline()) {
+      buffers.push_back(std::move(value));
+    }
+    out_ = MakeArray(ArrayData::Make(scalar_.type, length_, std::move(buffers), 0));
+    return Status::OK();
+  }
+
   template <typename T>
   enable_if_var_size_list<T, Status> Visit(const T& type) {
     using ScalarType = typename TypeTraits<T>::ScalarType;
@@ -729,6 +838,15 @@ class RepeatedArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    const auto& ree_scalar = checked_cast<const RunEndEncodedScalar&>(scalar_);
+    ARROW_ASSIGN_OR_RAISE(auto value, MakeArrayFromScalar(*ree_scalar.value, 1, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto data, MakeSingleRunArray(scalar_.type, length_,
+                                                        value->data(), pool_));
+    out_ = MakeArray(std::move(data));
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionType& type) {
     return Status::NotImplemented("construction from scalar of type ", *scalar_.type);
   }
@@ -17,6 +17,8 @@
 
 #include "arrow/array/validate.h"
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
 #include "arrow/array.h"  // IWYU pragma: keep
@@ -30,6 +32,7 @@
 #include "arrow/util/decimal.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/util/utf8.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
@@ -48,7 +51,10 @@ struct UTF8DataValidator {
   }
 
   template <typename StringType>
-  enable_if_string<StringType, Status> Visit(const StringType&) {
+  enable_if_t<is_string_type<StringType>::value ||
+                  std::is_same<StringType, StringViewType>::value,
+              Status>
+  Visit(const StringType&) {
     util::InitializeUTF8();
 
     int64_t i = 0;
@@ -245,6 +251,14 @@ struct ValidateArrayImpl {
 
   Status Visit(const BinaryType& type) { return ValidateBinaryLike(type); }
 
+  Status Visit(const BinaryViewType& type) {
+    RETURN_NOT_OK(ValidateBinaryView());
+    if (full_validation && type.id() == Type::STRING_VIEW) {
+      RETURN_NOT_OK(ValidateUTF8(data));
+    }
+    return Status::OK();
+  }
+
   Status Visit(const LargeBinaryType& type) { return ValidateBinaryLike(type); }
 
   Status Visit(const ListType& type) { return ValidateListLike(type); }
@@ -386,6 +400,27 @@ struct ValidateArrayImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    if (!RunEndEncodedType::RunEndTypeValid(*type.run_end_type())) {
+      return Status::Invalid("Run end type must be int16, int32 or int64, got ",
+                             *type.run_end_type());
+    }
+    const auto& run_ends_data = *data.child_data[0];
+    const auto& values_data = *data.child_data[1];
+    const Status run_ends_valid = RecurseInto(run_ends_data);
+    if (!run_ends_valid.ok()) {
+      return Status::Invalid("Run ends array invalid: ", run_ends_valid.ToString());
+    }
+    const Status values_valid = RecurseInto(values_data);
+    if (!values_valid.ok()) {
+      return Status::Invalid("Values array invalid: ", values_valid.ToString());
+    }
+    return ree_util::ValidateRunEndEncodedChildren(type, data.length, data.offset,
+                                                   ArraySpan(run_ends_data),
+                                                   ArraySpan(values_data),
+                                                   full_validation);
+  }
+
   Status Visit(const DictionaryType& type) {
     Type::type index_type_id = type.index_type()->id();
     if (!is_integer(index_type_id)) {
@@ -438,7 +473,14 @@ struct ValidateArrayImpl {
       return Status::Invalid("Array length is negative");
     }
 
-    if (data.buffers.size() != layout.buffers.size()) {
+    if (layout.variadic_spec) {
+      if (data.buffers.size() < layout.buffers.size()) {
+        return Status::Invalid("Expected at least ", layout.buffers.size(),
+                               " buffers in array "
+                               "of type ",
+                               type.ToString(), ", got ", data.buffers.size());
+      }
+    } else if (data.buffers.size() != layout.buffers.size()) {
       return Status::Invalid("Expected ", layout.buffers.size(),
                              " buffers in array "
                              "of type ",
@@ -454,7 +496,9 @@ struct ValidateArrayImpl {
 
     for (int i = 0; i < static_cast<int>(data.buffers.size()); ++i) {
       const auto& buffer = data.buffers[i];
-      const auto& spec = layout.buffers[i];
+      const auto& spec = i < static_cast<int>(layout.buffers.size())
+                             ? layout.buffers[i]
+                             : *layout.variadic_spec;
 
       if (buffer == nullptr) {
         continue;
@@ -577,6 +621,60 @@ struct ValidateArrayImpl {
     return Status::OK();
   }
 
+  Status ValidateBinaryView() {
+    RETURN_NOT_OK(ValidateFixedWidthBuffers());
+    for (size_t i = 2; i < data.buffers.size(); ++i) {
+      if (!IsBufferValid(static_cast<int>(i))) {
+        return Status::Invalid("Data buffer #", i - 2, " is null");
+      }
+    }
+    if (!full_validation || data.length == 0 || !data.buffers[1]->is_cpu()) {
+      return Status::OK();
+    }
+
+    using c_type = BinaryViewType::c_type;
+    const c_type* views = data.GetValues<c_type>(1);
+    const int64_t num_data_buffers = static_cast<int64_t>(data.buffers.size()) - 2;
+    const uint8_t* validity = data.buffers[0] ? data.buffers[0]->data() : nullptr;
+    for (int64_t i = 0; i < data.length; ++i) {
+      if (validity && !bit_util::GetBit(validity, data.offset + i)) {
+        continue;
+      }
+      const c_type& view = views[i];
+      if (view.size() < 0) {
+        return Status::Invalid("View at slot ", i, " has negative size ", view.size());
+      }
+      if (view.is_inline()) {
+        const uint8_t* padding = view.inlined.data + view.size();
+        if (std::any_of(padding, view.inlined.data + BinaryViewType::kInlineSize,
+                        [](uint8_t byte) { return byte != 0; })) {
+          return Status::Invalid("View at slot ", i,
+                                 " has non-zeroed padding after its inline data");
+        }
+        continue;
+      }
+      if (view.ref.buffer_index < 0 || view.ref.buffer_index >= num_data_buffers) {
+        return Status::Invalid("View at slot ", i, " references data buffer ",
+                               view.ref.buffer_index, " but there are only ",
+                               num_data_buffers, " data buffers");
+      }
+      const Buffer& buffer = *data.buffers[view.ref.buffer_index + 2];
+      if (view.ref.offset < 0 ||
+          static_cast<int64_t>(view.ref.offset) + view.size() > buffer.size()) {
+        return Status::Invalid("View at slot ", i, " references range ", view.ref.offset,
+                               "-", static_cast<int64_t>(view.ref.offset) + view.size(),
+                               " of data buffer ", view.ref.buffer_index, " of size ",
+                               buffer.size());
+      }
+      if (std::memcmp(view.ref.prefix, buffer.data() + view.ref.offset,
+                      BinaryViewType::kPrefixSize) != 0) {
+        return Status::Invalid("View at slot ", i,
+                               " has a prefix which does not match its data");
+      }
+    }
+    return Status::OK();
+  }
+
   template <typename ListType>
   Status ValidateListLike(const ListType& type) {
     const ArrayData& values = *data.child_data[0];
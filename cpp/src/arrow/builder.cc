@@ -152,6 +152,8 @@ struct DictionaryBuilderCase {
 
   Status Visit(const DataType& value_type) { return NotImplemented(value_type); }
   Status Visit(const HalfFloatType& value_type) { return NotImplemented(value_type); }
+  Status Visit(const BinaryViewType& value_type) { return NotImplemented(value_type); }
+  Status Visit(const StringViewType& value_type) { return NotImplemented(value_type); }
   Status NotImplemented(const DataType& value_type) {
     return Status::NotImplemented(
         "MakeBuilder: cannot construct builder for dictionaries with value type ",
@@ -250,6 +252,14 @@ struct MakeBuilderImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& ree_type) {
+    ARROW_ASSIGN_OR_RAISE(auto run_end_builder, ChildBuilder(ree_type.run_end_type()));
+    ARROW_ASSIGN_OR_RAISE(auto value_builder, ChildBuilder(ree_type.value_type()));
+    out.reset(new RunEndEncodedBuilder(pool, std::move(run_end_builder),
+                                       std::move(value_builder), type));
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionType&) { return NotImplemented(); }
   Status Visit(const DataType&) { return NotImplemented(); }
 
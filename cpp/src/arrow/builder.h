@@ -26,6 +26,7 @@
 #include "arrow/array/builder_dict.h"       // IWYU pragma: keep
 #include "arrow/array/builder_nested.h"     // IWYU pragma: keep
 #include "arrow/array/builder_primitive.h"  // IWYU pragma: keep
+#include "arrow/array/builder_run_end.h"    // IWYU pragma: keep
 #include "arrow/array/builder_time.h"       // IWYU pragma: keep
 #include "arrow/array/builder_union.h"      // IWYU pragma: keep
 #include "arrow/status.h"
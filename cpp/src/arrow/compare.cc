@@ -38,6 +38,7 @@
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
@@ -46,6 +47,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/memory.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/visit_scalar_inline.h"
 #include "arrow/visit_type_inline.h"
 
@@ -262,6 +264,27 @@ class RangeDataEqualsImpl {
   // Also matches LargeStringType
   Status Visit(const LargeBinaryType& type) { return CompareBinary(type); }
 
+  // Also matches StringViewType
+  Status Visit(const BinaryViewType& type) {
+    using c_type = BinaryViewType::c_type;
+    const c_type* left_views = left_.GetValues<c_type>(1) + left_start_idx_;
+    const c_type* right_views = right_.GetValues<c_type>(1) + right_start_idx_;
+    const std::shared_ptr<Buffer>* left_buffers = left_.buffers.data() + 2;
+    const std::shared_ptr<Buffer>* right_buffers = right_.buffers.data() + 2;
+
+    auto compare_runs = [&](int64_t i, int64_t length) -> bool {
+      for (int64_t j = i; j < i + length; ++j) {
+        if (!util::EqualBinaryView(left_views[j], left_buffers, right_views[j],
+                                   right_buffers)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    VisitValidRuns(compare_runs);
+    return Status::OK();
+  }
+
   Status Visit(const FixedSizeBinaryType& type) {
     const auto byte_width = type.byte_width();
     const uint8_t* left_data = left_.GetValues<uint8_t>(1, 0);
@@ -373,6 +396,19 @@ class RangeDataEqualsImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    switch (type.run_end_type()->id()) {
+      case Type::INT16:
+        return CompareRunEndEncoded<int16_t>();
+      case Type::INT32:
+        return CompareRunEndEncoded<int32_t>();
+      case Type::INT64:
+        return CompareRunEndEncoded<int64_t>();
+      default:
+        return Status::Invalid("invalid run ends type: ", *type.run_end_type());
+    }
+  }
+
   Status Visit(const DictionaryType& type) {
     // Compare dictionaries
     result_ &= CompareArrayRanges(
@@ -506,6 +542,41 @@ class RangeDataEqualsImpl {
                                   });
   }
 
+  // Walk the runs of both sides in lockstep, comparing a single value for each
+  // range where neither side changes run
+  template <typename RunEndCType>
+  Status CompareRunEndEncoded() {
+    ArraySpan left_span(left_);
+    left_span.SetSlice(left_.offset + left_start_idx_, range_length_);
+    ArraySpan right_span(right_);
+    right_span.SetSlice(right_.offset + right_start_idx_, range_length_);
+    ree_util::RunEndEncodedArraySpan<RunEndCType> left_ree(left_span);
+    ree_util::RunEndEncodedArraySpan<RunEndCType> right_ree(right_span);
+
+    auto left_it = left_ree.begin();
+    auto right_it = right_ree.begin();
+    int64_t position = 0;
+    while (position < range_length_) {
+      RangeDataEqualsImpl impl(options_, floating_approximate_, *left_.child_data[1],
+                               *right_.child_data[1], left_it.index_into_array(),
+                               right_it.index_into_array(), 1);
+      if (!impl.Compare()) {
+        result_ = false;
+        return Status::OK();
+      }
+      const int64_t left_run_end = left_it.run_end();
+      const int64_t right_run_end = right_it.run_end();
+      position = std::min(left_run_end, right_run_end);
+      if (left_run_end == position) {
+        ++left_it;
+      }
+      if (right_run_end == position) {
+        ++right_it;
+      }
+    }
+    return Status::OK();
+  }
+
   // Visit and compare runs of non-null values
   template <typename CompareRuns>
   void VisitValidRuns(CompareRuns&& compare_runs) {
@@ -591,7 +662,7 @@ class TypeEqualsVisitor {
 
   template <typename T>
   enable_if_t<is_null_type<T>::value || is_primitive_ctype<T>::value ||
-                  is_base_binary_type<T>::value,
+                  is_base_binary_type<T>::value || is_binary_view_like_type<T>::value,
               Status>
   Visit(const T&) {
     result_ = true;
@@ -672,6 +743,8 @@ class TypeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& left) { return VisitChildren(left); }
+
   Status Visit(const DictionaryType& left) {
     const auto& right = checked_cast<const DictionaryType&>(right_);
     result_ = left.index_type()->Equals(right.index_type()) &&
@@ -809,6 +882,12 @@ class ScalarEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedScalar& left) {
+    const auto& right = checked_cast<const RunEndEncodedScalar&>(right_);
+    result_ = ScalarEquals(*left.value, *right.value, options_, floating_approximate_);
+    return Status::OK();
+  }
+
   Status Visit(const DictionaryScalar& left) {
     const auto& right = checked_cast<const DictionaryScalar&>(right_);
     result_ = ScalarEquals(*left.value.index, *right.value.index, options_,
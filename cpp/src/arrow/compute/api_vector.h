@@ -246,6 +246,17 @@ class ARROW_EXPORT CumulativeSumOptions : public FunctionOptions {
   bool check_overflow = false;
 };
 
+/// \brief Options for run_end_encode function
+class ARROW_EXPORT RunEndEncodeOptions : public FunctionOptions {
+ public:
+  explicit RunEndEncodeOptions(std::shared_ptr<DataType> run_end_type = int32());
+  static constexpr char const kTypeName[] = "RunEndEncodeOptions";
+  static RunEndEncodeOptions Defaults() { return RunEndEncodeOptions(); }
+
+  /// The type of the run ends, one of int16, int32 or int64
+  std::shared_ptr<DataType> run_end_type;
+};
+
 /// @}
 
 /// \brief Filter with a boolean selection filter
@@ -580,6 +591,35 @@ Result<Datum> DictionaryEncode(
     const DictionaryEncodeOptions& options = DictionaryEncodeOptions::Defaults(),
     ExecContext* ctx = NULLPTR);
 
+/// \brief Run-end encode values in an array-like object
+///
+/// Consecutive equal values, and consecutive nulls, are coalesced into a
+/// single run.  Chunked arrays are encoded chunk by chunk.
+///
+/// \param[in] value array-like input
+/// \param[in] options configures the run end type
+/// \param[in] ctx the function execution context, optional
+/// \return run-end encoded array or chunked array
+///
+/// \since 9.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> RunEndEncode(
+    const Datum& value,
+    const RunEndEncodeOptions& options = RunEndEncodeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Decode a run-end encoded array-like object to a plain array
+///
+/// \param[in] value run-end encoded array-like input
+/// \param[in] ctx the function execution context, optional
+/// \return array or chunked array of the value type
+///
+/// \since 9.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> RunEndDecode(const Datum& value, ExecContext* ctx = NULLPTR);
+
 ARROW_EXPORT
 Result<Datum> CumulativeSum(
     const Datum& values,
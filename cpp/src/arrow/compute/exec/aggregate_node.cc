@@ -15,11 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
 #include <mutex>
 #include <sstream>
 #include <thread>
 #include <unordered_map>
 
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec/aggregate.h"
 #include "arrow/compute/exec/exec_plan.h"
@@ -30,8 +33,10 @@
 #include "arrow/compute/row/grouper.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
+#include "arrow/scalar.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/tracing_internal.h"
 
@@ -60,6 +65,100 @@ void AggregatesToString(std::stringstream* ss, const Schema& input_schema,
   *ss << ']';
 }
 
+// ----------------------------------------------------------------------
+// Segment key comparison
+
+// Whether row `i` of `left` and row `j` of `right`, two spans of the same type, hold
+// equal values.  Values are compared bitwise, as when grouping by hashing them.
+using SegmentKeyEqualFunc = bool (*)(const ArraySpan& left, int64_t i,
+                                     const ArraySpan& right, int64_t j);
+
+// Compare validity, return true if both values are null and false if only one is
+inline bool BothNullOrValid(const ArraySpan& left, int64_t i, const ArraySpan& right,
+                            int64_t j, bool* both_valid) {
+  const bool left_valid = left.IsValid(i);
+  *both_valid = left_valid && right.IsValid(j);
+  return left_valid == right.IsValid(j);
+}
+
+bool NullKeysEqual(const ArraySpan&, int64_t, const ArraySpan&, int64_t) {
+  return true;
+}
+
+bool BooleanKeysEqual(const ArraySpan& left, int64_t i, const ArraySpan& right,
+                      int64_t j) {
+  bool both_valid;
+  if (!BothNullOrValid(left, i, right, j, &both_valid)) return false;
+  return !both_valid || bit_util::GetBit(left.buffers[1].data, left.offset + i) ==
+                            bit_util::GetBit(right.buffers[1].data, right.offset + j);
+}
+
+template <typename CType>
+bool FixedWidthKeysEqual(const ArraySpan& left, int64_t i, const ArraySpan& right,
+                         int64_t j) {
+  bool both_valid;
+  if (!BothNullOrValid(left, i, right, j, &both_valid)) return false;
+  // Bitwise comparison of floating-point values
+  return !both_valid || memcmp(left.GetValues<CType>(1) + i,
+                               right.GetValues<CType>(1) + j, sizeof(CType)) == 0;
+}
+
+bool FixedSizeBinaryKeysEqual(const ArraySpan& left, int64_t i, const ArraySpan& right,
+                              int64_t j) {
+  bool both_valid;
+  if (!BothNullOrValid(left, i, right, j, &both_valid)) return false;
+  const int64_t width = checked_cast<const FixedSizeBinaryType&>(*left.type).byte_width();
+  return !both_valid ||
+         memcmp(left.buffers[1].data + (left.offset + i) * width,
+                right.buffers[1].data + (right.offset + j) * width, width) == 0;
+}
+
+template <typename OffsetType>
+util::string_view GetBinaryKey(const ArraySpan& span, int64_t i) {
+  const OffsetType* offsets = span.GetValues<OffsetType>(1);
+  return util::string_view(reinterpret_cast<const char*>(span.buffers[2].data) +
+                               offsets[i],
+                           static_cast<size_t>(offsets[i + 1] - offsets[i]));
+}
+
+template <typename OffsetType>
+bool BinaryKeysEqual(const ArraySpan& left, int64_t i, const ArraySpan& right,
+                     int64_t j) {
+  bool both_valid;
+  if (!BothNullOrValid(left, i, right, j, &both_valid)) return false;
+  return !both_valid ||
+         GetBinaryKey<OffsetType>(left, i) == GetBinaryKey<OffsetType>(right, j);
+}
+
+Result<SegmentKeyEqualFunc> GetSegmentKeyEqualFunc(const DataType& type) {
+  if (type.id() == Type::NA) return NullKeysEqual;
+  if (type.id() == Type::BOOL) return BooleanKeysEqual;
+  if (type.id() == Type::BINARY || type.id() == Type::STRING) {
+    return BinaryKeysEqual<int32_t>;
+  }
+  if (type.id() == Type::LARGE_BINARY || type.id() == Type::LARGE_STRING) {
+    return BinaryKeysEqual<int64_t>;
+  }
+  if (is_fixed_size_binary(type.id())) return FixedSizeBinaryKeysEqual;
+  if (is_primitive(type.id())) {
+    switch (checked_cast<const FixedWidthType&>(type).bit_width()) {
+      case 8:
+        return FixedWidthKeysEqual<uint8_t>;
+      case 16:
+        return FixedWidthKeysEqual<uint16_t>;
+      case 32:
+        return FixedWidthKeysEqual<uint32_t>;
+      case 64:
+        return FixedWidthKeysEqual<uint64_t>;
+      case 128:
+        return FixedWidthKeysEqual<MonthDayNanoIntervalType::MonthDayNanos>;
+      default:
+        break;
+    }
+  }
+  return Status::NotImplemented("Segment key of type ", type);
+}
+
 class ScalarAggregateNode : public ExecNode {
  public:
   ScalarAggregateNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
@@ -266,15 +365,23 @@ class ScalarAggregateNode : public ExecNode {
 };
 
 class GroupByNode : public ExecNode {
+  struct ThreadLocalState {
+    std::unique_ptr<Grouper> grouper;
+    std::vector<std::unique_ptr<KernelState>> agg_states;
+  };
+
  public:
   GroupByNode(ExecNode* input, std::shared_ptr<Schema> output_schema, ExecContext* ctx,
-              std::vector<int> key_field_ids, std::vector<int> agg_src_field_ids,
-              std::vector<Aggregate> aggs,
+              std::vector<int> key_field_ids, std::vector<int> segment_key_field_ids,
+              std::vector<SegmentKeyEqualFunc> segment_key_equal,
+              std::vector<int> agg_src_field_ids, std::vector<Aggregate> aggs,
               std::vector<const HashAggregateKernel*> agg_kernels)
       : ExecNode(input->plan(), {input}, {"groupby"}, std::move(output_schema),
                  /*num_outputs=*/1),
         ctx_(ctx),
         key_field_ids_(std::move(key_field_ids)),
+        segment_key_field_ids_(std::move(segment_key_field_ids)),
+        segment_key_equal_(std::move(segment_key_equal)),
         agg_src_field_ids_(std::move(agg_src_field_ids)),
         aggs_(std::move(aggs)),
         agg_kernels_(std::move(agg_kernels)) {}
@@ -299,6 +406,7 @@ class GroupByNode : public ExecNode {
     auto input = inputs[0];
     const auto& aggregate_options = checked_cast<const AggregateNodeOptions&>(options);
     const auto& keys = aggregate_options.keys;
+    const auto& segment_keys = aggregate_options.segment_keys;
     // Copy (need to modify options pointer below)
     auto aggs = aggregate_options.aggregates;
 
@@ -312,6 +420,17 @@ class GroupByNode : public ExecNode {
       key_field_ids[i] = match[0];
     }
 
+    // Find input field indices for segment key fields
+    std::vector<int> segment_key_field_ids(segment_keys.size());
+    std::vector<SegmentKeyEqualFunc> segment_key_equal(segment_keys.size());
+    for (size_t i = 0; i < segment_keys.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto match, segment_keys[i].FindOne(*input_schema));
+      segment_key_field_ids[i] = match[0];
+      ARROW_ASSIGN_OR_RAISE(
+          segment_key_equal[i],
+          GetSegmentKeyEqualFunc(*input_schema->field(match[0])->type()));
+    }
+
     // Find input field indices for aggregates
     std::vector<int> agg_src_field_ids(aggs.size());
     for (size_t i = 0; i < aggs.size(); ++i) {
@@ -328,6 +447,13 @@ class GroupByNode : public ExecNode {
 
     auto ctx = input->plan()->exec_context();
 
+    // Segments are only delimited correctly if batches are received in order
+    if (!segment_keys.empty() && ctx->executor() != nullptr &&
+        ctx->executor()->GetCapacity() > 1) {
+      return Status::NotImplemented(
+          "Segmented aggregation in a plan executed by multiple threads");
+    }
+
     // Construct aggregates
     ARROW_ASSIGN_OR_RAISE(auto agg_kernels,
                           internal::GetKernels(ctx, aggs, agg_src_types));
@@ -340,7 +466,7 @@ class GroupByNode : public ExecNode {
         internal::ResolveKernels(aggs, agg_kernels, agg_states, ctx, agg_src_types));
 
     // Build field vector for output schema
-    FieldVector output_fields{keys.size() + aggs.size()};
+    FieldVector output_fields{keys.size() + segment_keys.size() + aggs.size()};
 
     // Aggregate fields come before key fields to match the behavior of GroupBy function
     for (size_t i = 0; i < aggs.size(); ++i) {
@@ -352,38 +478,45 @@ class GroupByNode : public ExecNode {
       int key_field_id = key_field_ids[i];
       output_fields[base + i] = input_schema->field(key_field_id);
     }
+    base += keys.size();
+    for (size_t i = 0; i < segment_keys.size(); ++i) {
+      int segment_key_field_id = segment_key_field_ids[i];
+      output_fields[base + i] = input_schema->field(segment_key_field_id);
+    }
 
     return input->plan()->EmplaceNode<GroupByNode>(
         input, schema(std::move(output_fields)), ctx, std::move(key_field_ids),
+        std::move(segment_key_field_ids), std::move(segment_key_equal),
         std::move(agg_src_field_ids), std::move(aggs), std::move(agg_kernels));
   }
 
   const char* kind_name() const override { return "GroupByNode"; }
 
-  Status Consume(ExecSpan batch) {
+  Status Consume(ExecSpan batch, ThreadLocalState* state) {
     util::tracing::Span span;
     START_COMPUTE_SPAN(span, "Consume",
                        {{"group_by", ToStringExtra()},
                         {"node.label", label()},
                         {"batch.length", batch.length}});
-    size_t thread_index = plan_->GetThreadIndex();
-    if (thread_index >= local_states_.size()) {
-      return Status::IndexError("thread index ", thread_index, " is out of range [0, ",
-                                local_states_.size(), ")");
-    }
-
-    auto state = &local_states_[thread_index];
     RETURN_NOT_OK(InitLocalStateIfNeeded(state));
 
-    // Create a batch with key columns
-    std::vector<ExecValue> keys(key_field_ids_.size());
-    for (size_t i = 0; i < key_field_ids_.size(); ++i) {
-      keys[i] = batch[key_field_ids_[i]];
-    }
-    ExecSpan key_batch(std::move(keys), batch.length);
-
     // Create a batch with group ids
-    ARROW_ASSIGN_OR_RAISE(Datum id_batch, state->grouper->Consume(key_batch));
+    Datum id_batch;
+    int64_t num_groups = 1;
+    if (state->grouper) {
+      // Create a batch with key columns
+      std::vector<ExecValue> keys(key_field_ids_.size());
+      for (size_t i = 0; i < key_field_ids_.size(); ++i) {
+        keys[i] = batch[key_field_ids_[i]];
+      }
+      ExecSpan key_batch(std::move(keys), batch.length);
+
+      ARROW_ASSIGN_OR_RAISE(id_batch, state->grouper->Consume(key_batch));
+      num_groups = state->grouper->num_groups();
+    } else {
+      // Segmented aggregation without keys: all rows fall in a single group
+      ARROW_ASSIGN_OR_RAISE(id_batch, GetZeroGroupIds(batch.length));
+    }
 
     // Execute aggregate kernels
     for (size_t i = 0; i < agg_kernels_.size(); ++i) {
@@ -398,7 +531,7 @@ class GroupByNode : public ExecNode {
 
       ExecSpan agg_batch({batch[agg_src_field_ids_[i]], ExecValue(*id_batch.array())},
                          batch.length);
-      RETURN_NOT_OK(agg_kernels_[i]->resize(&kernel_ctx, state->grouper->num_groups()));
+      RETURN_NOT_OK(agg_kernels_[i]->resize(&kernel_ctx, num_groups));
       RETURN_NOT_OK(agg_kernels_[i]->consume(&kernel_ctx, agg_batch));
     }
 
@@ -451,7 +584,7 @@ class GroupByNode : public ExecNode {
     // If we never got any batches, then state won't have been initialized
     RETURN_NOT_OK(InitLocalStateIfNeeded(state));
 
-    ExecBatch out_data{{}, state->grouper->num_groups()};
+    ExecBatch out_data{{}, state->grouper ? state->grouper->num_groups() : 1};
     out_data.values.resize(agg_kernels_.size() + key_field_ids_.size());
 
     // Aggregate fields come before key fields to match the behavior of GroupBy function
@@ -465,13 +598,15 @@ class GroupByNode : public ExecNode {
       KernelContext batch_ctx{ctx_};
       batch_ctx.SetState(state->agg_states[i].get());
       RETURN_NOT_OK(agg_kernels_[i]->finalize(&batch_ctx, &out_data.values[i]));
-      state->agg_states[i].reset();
     }
+    state->agg_states.clear();
 
-    ARROW_ASSIGN_OR_RAISE(ExecBatch out_keys, state->grouper->GetUniques());
-    std::move(out_keys.values.begin(), out_keys.values.end(),
-              out_data.values.begin() + agg_kernels_.size());
-    state->grouper.reset();
+    if (state->grouper) {
+      ARROW_ASSIGN_OR_RAISE(ExecBatch out_keys, state->grouper->GetUniques());
+      std::move(out_keys.values.begin(), out_keys.values.end(),
+                out_data.values.begin() + agg_kernels_.size());
+      state->grouper.reset();
+    }
     return out_data;
   }
 
@@ -483,7 +618,124 @@ class GroupByNode : public ExecNode {
     outputs_[0]->InputReceived(this, out_data_.Slice(batch_size * n, batch_size));
   }
 
+  Result<Datum> GetZeroGroupIds(int64_t length) {
+    if (!zero_group_ids_ || zero_group_ids_->length < length) {
+      ARROW_ASSIGN_OR_RAISE(auto ids, MakeArrayFromScalar(UInt32Scalar(0), length,
+                                                          ctx_->memory_pool()));
+      zero_group_ids_ = ids->data();
+    }
+    return zero_group_ids_->Slice(0, length);
+  }
+
+  // Whether row `i` of a batch has the same segment key values as row `i - 1`
+  bool SameSegmentAsPrevious(const std::vector<ArraySpan>& segment_keys,
+                             int64_t i) const {
+    for (size_t j = 0; j < segment_keys.size(); ++j) {
+      // Scalar segment keys have a single value for the whole batch
+      if (segment_keys[j].length == 1) continue;
+      if (!segment_key_equal_[j](segment_keys[j], i - 1, segment_keys[j], i)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Whether the first row of a batch belongs to the current segment, if any
+  bool SameSegmentAsCurrent(const std::vector<ArraySpan>& segment_keys) const {
+    if (segment_key_values_.empty()) return false;
+    for (size_t j = 0; j < segment_keys.size(); ++j) {
+      const Datum& current = segment_key_values_[j];
+      const ArraySpan current_span = current.is_scalar() ? ArraySpan(*current.scalar())
+                                                         : ArraySpan(*current.array());
+      if (!segment_key_equal_[j](current_span, 0, segment_keys[j], 0)) return false;
+    }
+    return true;
+  }
+
+  // Aggregate the runs of a batch into the current segment, outputting the current
+  // segment whenever the segment key values change.  Runs are found by comparing
+  // adjacent rows, the first row of the batch being compared to the current segment.
+  Status ConsumeSegments(const ExecBatch& batch) {
+    if (batch.length == 0) return Status::OK();
+    ThreadLocalState* state = &local_states_[0];
+
+    std::vector<ArraySpan> segment_keys(segment_key_field_ids_.size());
+    for (size_t j = 0; j < segment_key_field_ids_.size(); ++j) {
+      const Datum& value = batch.values[segment_key_field_ids_[j]];
+      if (value.is_scalar()) {
+        segment_keys[j].FillFromScalar(*value.scalar());
+      } else {
+        segment_keys[j].SetMembers(*value.array());
+      }
+    }
+
+    bool new_segment = !SameSegmentAsCurrent(segment_keys);
+    int64_t offset = 0;
+    for (int64_t i = 1; i <= batch.length; ++i) {
+      if (i < batch.length && SameSegmentAsPrevious(segment_keys, i)) continue;
+      if (new_segment) {
+        RETURN_NOT_OK(OutputSegment());
+        StartSegment(batch, offset);
+      }
+      RETURN_NOT_OK(Consume(ExecSpan(batch.Slice(offset, i - offset)), state));
+      offset = i;
+      new_segment = true;
+    }
+    return Status::OK();
+  }
+
+  // Make the segment starting at row `offset` of `batch` the current segment
+  void StartSegment(const ExecBatch& batch, int64_t offset) {
+    segment_key_values_.resize(segment_key_field_ids_.size());
+    for (size_t j = 0; j < segment_key_field_ids_.size(); ++j) {
+      const Datum& value = batch.values[segment_key_field_ids_[j]];
+      segment_key_values_[j] =
+          value.is_scalar() ? value : Datum(value.array()->Slice(offset, 1));
+    }
+  }
+
+  // Finalize the aggregates of the current segment, if any, and output them along
+  // with the segment key values
+  Status OutputSegment() {
+    if (segment_key_values_.empty()) return Status::OK();
+
+    ARROW_ASSIGN_OR_RAISE(ExecBatch out_data, Finalize());
+    for (const auto& value : segment_key_values_) {
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(auto array, MakeArrayFromScalar(*value.scalar(),
+                                                              out_data.length,
+                                                              ctx_->memory_pool()));
+        out_data.values.emplace_back(std::move(array));
+      } else if (out_data.length == 1) {
+        out_data.values.push_back(value);
+      } else {
+        // Repeat the value for each group of the segment
+        ARROW_ASSIGN_OR_RAISE(Datum ids, GetZeroGroupIds(out_data.length));
+        ARROW_ASSIGN_OR_RAISE(Datum repeated,
+                              Take(value, ids, TakeOptions::NoBoundsCheck(), ctx_));
+        out_data.values.push_back(std::move(repeated));
+      }
+    }
+    segment_key_values_.clear();
+
+    const int64_t batch_size = output_batch_size();
+    for (int64_t offset = 0; offset < out_data.length; offset += batch_size) {
+      if (finished_.is_finished()) break;
+      outputs_[0]->InputReceived(this, out_data.Slice(offset, batch_size));
+      ++num_output_batches_;
+    }
+    return Status::OK();
+  }
+
   Status OutputResult() {
+    if (!segment_key_field_ids_.empty()) {
+      // All segments but the last one were output already
+      RETURN_NOT_OK(OutputSegment());
+      outputs_[0]->InputFinished(this, static_cast<int>(num_output_batches_));
+      finished_.MarkFinished();
+      return Status::OK();
+    }
+
     // To simplify merging, ensure that the first grouper is nonempty
     for (size_t i = 0; i < local_states_.size(); i++) {
       if (local_states_[i].grouper) {
@@ -514,7 +766,18 @@ class GroupByNode : public ExecNode {
 
     DCHECK_EQ(input, inputs_[0]);
 
-    if (ErrorIfNotOk(Consume(ExecSpan(batch)))) return;
+    if (segment_key_field_ids_.empty()) {
+      size_t thread_index = plan_->GetThreadIndex();
+      if (thread_index >= local_states_.size()) {
+        ErrorIfNotOk(Status::IndexError("thread index ", thread_index,
+                                        " is out of range [0, ", local_states_.size(),
+                                        ")"));
+        return;
+      }
+      if (ErrorIfNotOk(Consume(ExecSpan(batch), &local_states_[thread_index]))) return;
+    } else {
+      if (ErrorIfNotOk(ConsumeSegments(batch))) return;
+    }
 
     if (input_counter_.Increment()) {
       ErrorIfNotOk(OutputResult());
@@ -582,16 +845,19 @@ class GroupByNode : public ExecNode {
       ss << '"' << input_schema->field(key_field_ids_[i])->name() << '"';
     }
     ss << "], ";
+    if (!segment_key_field_ids_.empty()) {
+      ss << "segment_keys=[";
+      for (size_t i = 0; i < segment_key_field_ids_.size(); i++) {
+        if (i > 0) ss << ", ";
+        ss << '"' << input_schema->field(segment_key_field_ids_[i])->name() << '"';
+      }
+      ss << "], ";
+    }
     AggregatesToString(&ss, *input_schema, aggs_, agg_src_field_ids_, indent);
     return ss.str();
   }
 
  private:
-  struct ThreadLocalState {
-    std::unique_ptr<Grouper> grouper;
-    std::vector<std::unique_ptr<KernelState>> agg_states;
-  };
-
   ThreadLocalState* GetLocalState() {
     size_t thread_index = plan_->GetThreadIndex();
     return &local_states_[thread_index];
@@ -601,17 +867,22 @@ class GroupByNode : public ExecNode {
     // Get input schema
     auto input_schema = inputs_[0]->output_schema();
 
-    if (state->grouper != nullptr) return Status::OK();
-
-    // Build vector of key field data types
-    std::vector<TypeHolder> key_types(key_field_ids_.size());
-    for (size_t i = 0; i < key_field_ids_.size(); ++i) {
-      auto key_field_id = key_field_ids_[i];
-      key_types[i] = input_schema->field(key_field_id)->type().get();
+    if (state->grouper != nullptr ||
+        (key_field_ids_.empty() && !state->agg_states.empty())) {
+      return Status::OK();
     }
 
-    // Construct grouper
-    ARROW_ASSIGN_OR_RAISE(state->grouper, Grouper::Make(key_types, ctx_));
+    if (!key_field_ids_.empty()) {
+      // Build vector of key field data types
+      std::vector<TypeHolder> key_types(key_field_ids_.size());
+      for (size_t i = 0; i < key_field_ids_.size(); ++i) {
+        auto key_field_id = key_field_ids_[i];
+        key_types[i] = input_schema->field(key_field_id)->type().get();
+      }
+
+      // Construct grouper
+      ARROW_ASSIGN_OR_RAISE(state->grouper, Grouper::Make(key_types, ctx_));
+    }
 
     // Build vector of aggregate source field data types
     std::vector<TypeHolder> agg_src_types(agg_kernels_.size());
@@ -638,6 +909,8 @@ class GroupByNode : public ExecNode {
   int output_task_group_id_;
 
   const std::vector<int> key_field_ids_;
+  const std::vector<int> segment_key_field_ids_;
+  const std::vector<SegmentKeyEqualFunc> segment_key_equal_;
   const std::vector<int> agg_src_field_ids_;
   const std::vector<Aggregate> aggs_;
   const std::vector<const HashAggregateKernel*> agg_kernels_;
@@ -646,6 +919,13 @@ class GroupByNode : public ExecNode {
 
   std::vector<ThreadLocalState> local_states_;
   ExecBatch out_data_;
+
+  // Segmented aggregation state: the segment key values of the current segment as
+  // scalars or single-row slices (empty if there is none yet), the number of batches
+  // output so far, and group ids for aggregation without keys
+  std::vector<Datum> segment_key_values_;
+  int64_t num_output_batches_ = 0;
+  std::shared_ptr<ArrayData> zero_group_ids_;
 };
 
 }  // namespace
@@ -660,7 +940,7 @@ void RegisterAggregateNode(ExecFactoryRegistry* registry) {
         const auto& aggregate_options =
             checked_cast<const AggregateNodeOptions&>(options);
 
-        if (aggregate_options.keys.empty()) {
+        if (aggregate_options.keys.empty() && aggregate_options.segment_keys.empty()) {
           // construct scalar agg node
           return ScalarAggregateNode::Make(plan, std::move(inputs), options);
         }
@@ -0,0 +1,450 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/accumulation_queue.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace {
+
+// Concatenate the accumulated batches into a single batch.  Scalar values are broadcast
+// unless all the batches have the same scalar value.
+Result<ExecBatch> ConcatenateBatches(util::AccumulationQueue* batches,
+                                     MemoryPool* pool) {
+  if (batches->batch_count() == 1) {
+    return std::move((*batches)[0]);
+  }
+
+  const auto& first = (*batches)[0];
+  std::vector<Datum> values(first.values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    bool same_scalar = first.values[i].is_scalar();
+    for (size_t j = 1; same_scalar && j < batches->batch_count(); ++j) {
+      const auto& value = (*batches)[j].values[i];
+      same_scalar =
+          value.is_scalar() && value.scalar()->Equals(*first.values[i].scalar());
+    }
+    if (same_scalar) {
+      values[i] = first.values[i];
+      continue;
+    }
+
+    ArrayVector arrays(batches->batch_count());
+    for (size_t j = 0; j < batches->batch_count(); ++j) {
+      const auto& batch = (*batches)[j];
+      if (batch.values[i].is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(arrays[j], MakeArrayFromScalar(*batch.values[i].scalar(),
+                                                             batch.length, pool));
+      } else {
+        arrays[j] = batch.values[i].make_array();
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(values[i], Concatenate(arrays, pool));
+  }
+
+  ExecBatch out(std::move(values), batches->row_count());
+  // keep the guarantee only if it holds for all of the batches
+  out.guarantee = first.guarantee;
+  for (size_t j = 1; j < batches->batch_count(); ++j) {
+    if ((*batches)[j].guarantee != out.guarantee) {
+      out.guarantee = literal(true);
+      break;
+    }
+  }
+  return out;
+}
+
+// The bytes of the buffer ranges a batch references, so that each slice of a larger batch
+// isn't charged for the whole of its parent's buffers.
+int64_t ReferencedBatchSize(const ExecBatch& batch) {
+  int64_t size = 0;
+  for (const auto& value : batch.values) {
+    if (!value.is_array()) continue;
+    auto referenced = util::ReferencedBufferSize(*value.array());
+    size += referenced.ok() ? *referenced : util::TotalBufferSize(*value.array());
+  }
+  return size;
+}
+
+// A process-wide timer running callbacks at given deadlines on a single thread, so that
+// coalesce_batches nodes don't each need a thread to wait for their latency deadlines.
+// The callbacks should be short: they only schedule work elsewhere.
+class DeadlineTimer {
+ public:
+  using Clock = std::chrono::steady_clock;
+  // Deadlines are unique thanks to the sequence number
+  using Key = std::pair<Clock::time_point, uint64_t>;
+
+  static DeadlineTimer* Get() {
+    static DeadlineTimer timer;
+    return &timer;
+  }
+
+  ~DeadlineTimer() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+      cv_.notify_one();
+    }
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  Key Schedule(Clock::time_point deadline, std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!thread_.joinable()) {
+      thread_ = std::thread([this] { Run(); });
+    }
+    Key key{deadline, next_sequence_++};
+    if (callbacks_.empty() || deadline < callbacks_.begin()->first.first) {
+      cv_.notify_one();
+    }
+    callbacks_.emplace(key, std::move(callback));
+    return key;
+  }
+
+  // Return false if the callback already ran or is running.
+  bool Cancel(const Key& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return callbacks_.erase(key) > 0;
+  }
+
+ private:
+  DeadlineTimer() = default;
+
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopped_) {
+      if (callbacks_.empty()) {
+        cv_.wait(lock);
+        continue;
+      }
+      auto next = callbacks_.begin();
+      if (Clock::now() < next->first.first) {
+        cv_.wait_until(lock, next->first.first);
+        continue;
+      }
+      auto callback = std::move(next->second);
+      callbacks_.erase(next);
+      lock.unlock();
+      callback();
+      lock.lock();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::map<Key, std::function<void()>> callbacks_;
+  uint64_t next_sequence_ = 0;
+  bool stopped_ = false;
+  std::thread thread_;
+};
+
+class CoalesceBatchesNode : public ExecNode {
+ public:
+  CoalesceBatchesNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                      std::shared_ptr<Schema> output_schema,
+                      CoalesceBatchesNodeOptions options)
+      : ExecNode(plan, std::move(inputs), /*input_labels=*/{"target"},
+                 std::move(output_schema), /*num_outputs=*/1),
+        options_(std::move(options)),
+        max_latency_(std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(options_.max_latency))) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "CoalesceBatchesNode"));
+    const auto& coalesce_options =
+        checked_cast<const CoalesceBatchesNodeOptions&>(options);
+
+    if (coalesce_options.target_rows <= 0) {
+      return Status::Invalid("CoalesceBatchesNode requires target_rows > 0, but got ",
+                             coalesce_options.target_rows);
+    }
+    if (coalesce_options.max_rows > 0 &&
+        coalesce_options.max_rows < coalesce_options.target_rows) {
+      return Status::Invalid(
+          "CoalesceBatchesNode requires max_rows >= target_rows, but got max_rows ",
+          coalesce_options.max_rows, " and target_rows ", coalesce_options.target_rows);
+    }
+
+    auto schema = inputs[0]->output_schema();
+    return plan->EmplaceNode<CoalesceBatchesNode>(plan, std::move(inputs),
+                                                  std::move(schema), coalesce_options);
+  }
+
+  const char* kind_name() const override { return "CoalesceBatchesNode"; }
+
+  void InputReceived(ExecNode* input, ExecBatch batch) override {
+    EVENT(span_, "InputReceived", {{"batch.length", batch.length}});
+    DCHECK_EQ(input, inputs_[0]);
+
+    if (input_counter_.Completed()) {
+      return;
+    }
+
+    std::vector<util::AccumulationQueue> ready;
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (options_.max_rows > 0 && batch.length > options_.max_rows) {
+      for (int64_t offset = 0; offset < batch.length; offset += options_.target_rows) {
+        Accumulate(batch.Slice(offset, options_.target_rows), &ready);
+      }
+    } else {
+      Accumulate(std::move(batch), &ready);
+    }
+    if (!Emit(&ready, &lock)) return;
+
+    if (input_counter_.Increment()) {
+      Finish();
+    }
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    EVENT(span_, "ErrorReceived", {{"error.message", error.message()}});
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->ErrorReceived(this, std::move(error));
+  }
+
+  void InputFinished(ExecNode* input, int total_batches) override {
+    EVENT(span_, "InputFinished", {{"batches.length", total_batches}});
+    DCHECK_EQ(input, inputs_[0]);
+    if (input_counter_.SetTotal(total_batches)) {
+      Finish();
+    }
+  }
+
+  Status StartProducing() override {
+    START_COMPUTE_SPAN(span_, std::string(kind_name()) + ":" + label(),
+                       {{"node.label", label()},
+                        {"node.detail", ToString()},
+                        {"node.kind", kind_name()}});
+    END_SPAN_ON_FUTURE_COMPLETION(span_, finished_);
+    // Flushes are run on the plan's executor. Plans executed serially have no thread
+    // besides the input's, so expired batches are only flushed when a batch is received.
+    use_timer_ =
+        options_.max_latency > 0 && plan()->exec_context()->executor() != nullptr;
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  void StopProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    StopProducing();
+  }
+
+  void StopProducing() override {
+    EVENT(span_, "StopProducing");
+    StopTimer();
+    if (input_counter_.Cancel()) {
+      finished_.MarkFinished();
+    }
+    inputs_[0]->StopProducing(this);
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    return "target_rows=" + std::to_string(options_.target_rows);
+  }
+
+ private:
+  using Clock = DeadlineTimer::Clock;
+
+  // Add a batch to the pending batches, moving them to ready once they are large enough.
+  // Must be called with mutex_ held.
+  void Accumulate(ExecBatch batch, std::vector<util::AccumulationQueue>* ready) {
+    if (batch.length == 0) return;
+    if (options_.max_rows > 0 && !pending_.empty() &&
+        pending_.row_count() + batch.length > options_.max_rows) {
+      TakePending(ready);
+    }
+    if (options_.max_latency > 0 && !pending_.empty() &&
+        Clock::now() - pending_since_ >= max_latency_) {
+      TakePending(ready);
+    }
+    if (pending_.empty()) {
+      pending_since_ = Clock::now();
+      if (use_timer_ && !timer_armed_) {
+        ArmTimer(pending_since_ + max_latency_);
+      }
+    }
+    if (options_.target_bytes > 0) {
+      pending_bytes_ += ReferencedBatchSize(batch);
+    }
+    pending_.InsertBatch(std::move(batch));
+
+    if (pending_.row_count() >= options_.target_rows ||
+        (options_.target_bytes > 0 && pending_bytes_ >= options_.target_bytes)) {
+      TakePending(ready);
+    }
+  }
+
+  // Must be called with mutex_ held.
+  void TakePending(std::vector<util::AccumulationQueue>* ready) {
+    ready->push_back(std::move(pending_));
+    pending_bytes_ = 0;
+    ++batches_emitted_;
+  }
+
+  // Concatenate and output the ready batches, returning false on error.  lock must hold
+  // mutex_ and is released before the batches are output.
+  bool Emit(std::vector<util::AccumulationQueue>* ready,
+            std::unique_lock<std::mutex>* lock) {
+    lock->unlock();
+    for (auto& batches : *ready) {
+      auto coalesced =
+          ConcatenateBatches(&batches, plan()->exec_context()->memory_pool());
+      if (ErrorIfNotOk(coalesced.status())) {
+        StopProducing();
+        return false;
+      }
+      outputs_[0]->InputReceived(this, coalesced.MoveValueUnsafe());
+    }
+    return true;
+  }
+
+  void Finish() {
+    StopTimer();
+
+    std::vector<util::AccumulationQueue> ready;
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!pending_.empty()) {
+      TakePending(&ready);
+    }
+    int total_batches = batches_emitted_;
+    if (Emit(&ready, &lock)) {
+      outputs_[0]->InputFinished(this, total_batches);
+      finished_.MarkFinished();
+    }
+  }
+
+  // Schedule a flush of the pending batches on the plan's executor at the deadline.
+  // The plan doesn't finish until the flush is scheduled or the timer is cancelled.
+  // Must be called with mutex_ held.
+  void ArmTimer(Clock::time_point deadline) {
+    if (timer_stopped_) return;
+    auto task = plan()->BeginExternalTask();
+    if (!task.ok() || !task->is_valid()) return;
+    timer_task_ = task.MoveValueUnsafe();
+    timer_armed_ = true;
+    timer_key_ = DeadlineTimer::Get()->Schedule(deadline, [this] { OnTimer(); });
+  }
+
+  // Called on the timer's thread
+  void OnTimer() {
+    Future<> task;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      task = std::move(timer_task_);
+    }
+    Status st = plan()->ScheduleTask([this] {
+      FlushExpired();
+      return Status::OK();
+    });
+    if (ErrorIfNotOk(st)) {
+      StopProducing();
+    }
+    task.MarkFinished();
+  }
+
+  void FlushExpired() {
+    std::vector<util::AccumulationQueue> ready;
+    std::unique_lock<std::mutex> lock(mutex_);
+    timer_armed_ = false;
+    if (!pending_.empty()) {
+      // The batches which timed out may have been emitted in the meantime
+      if (Clock::now() - pending_since_ >= max_latency_) {
+        TakePending(&ready);
+      } else {
+        ArmTimer(pending_since_ + max_latency_);
+      }
+    }
+    Emit(&ready, &lock);
+  }
+
+  void StopTimer() {
+    Future<> task;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      timer_stopped_ = true;
+      if (!timer_armed_ || !DeadlineTimer::Get()->Cancel(timer_key_)) return;
+      // The flush won't be scheduled
+      timer_armed_ = false;
+      task = std::move(timer_task_);
+    }
+    task.MarkFinished();
+  }
+
+  CoalesceBatchesNodeOptions options_;
+  const Clock::duration max_latency_;
+  AtomicCounter input_counter_;
+
+  std::mutex mutex_;
+  util::AccumulationQueue pending_;
+  int64_t pending_bytes_ = 0;
+  Clock::time_point pending_since_;
+  int batches_emitted_ = 0;
+
+  bool use_timer_ = false;
+  // Whether a flush is scheduled with the timer, or on the plan's executor
+  bool timer_armed_ = false;
+  bool timer_stopped_ = false;
+  DeadlineTimer::Key timer_key_;
+  Future<> timer_task_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterCoalesceBatchesNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory("coalesce_batches", CoalesceBatchesNode::Make));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
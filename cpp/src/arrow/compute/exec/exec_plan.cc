@@ -640,6 +640,7 @@ namespace internal {
 
 void RegisterSourceNode(ExecFactoryRegistry*);
 void RegisterFilterNode(ExecFactoryRegistry*);
+void RegisterCoalesceBatchesNode(ExecFactoryRegistry*);
 void RegisterProjectNode(ExecFactoryRegistry*);
 void RegisterUnionNode(ExecFactoryRegistry*);
 void RegisterAggregateNode(ExecFactoryRegistry*);
@@ -655,6 +656,7 @@ ExecFactoryRegistry* default_exec_factory_registry() {
     DefaultRegistry() {
       internal::RegisterSourceNode(this);
       internal::RegisterFilterNode(this);
+      internal::RegisterCoalesceBatchesNode(this);
       internal::RegisterProjectNode(this);
       internal::RegisterUnionNode(this);
       internal::RegisterAggregateNode(this);
@@ -352,9 +352,10 @@ class ARROW_EXPORT ExecNode {
 /// (See SubmitTask method) to each given ExecBatch object, which have one input, one
 /// output, and are pure functions on the input
 ///
-/// A simple parallel runner is created with a "map_fn" which is just a function that
-/// takes a batch in and returns a batch.  This simple parallel runner also needs an
-/// executor (use simple synchronous runner if there is no executor)
+/// The "map_fn", which is just a function that takes a batch in and returns a batch, is
+/// run synchronously on the thread which delivered the input batch, and its result is
+/// passed on to the output from the same thread.  Chains of MapNodes therefore process
+/// each batch end to end on one thread, without scheduling a task per node.
 
 class ARROW_EXPORT MapNode : public ExecNode {
  public:
@@ -494,13 +494,31 @@ Result<ExecBatch> MakeExecBatch(const Schema& full_schema, const Datum& partial)
     }
 
     if (partial.is_scalar()) {
-      ARROW_ASSIGN_OR_RAISE(auto partial_array,
-                            MakeArrayFromScalar(*partial.scalar(), 1));
-      ARROW_ASSIGN_OR_RAISE(auto out, MakeExecBatch(full_schema, partial_array));
+      // Pick the fields out of the struct scalar rather than broadcasting it
+      const auto& partial_scalar = checked_cast<const StructScalar&>(*partial.scalar());
+      const auto& partial_type = checked_cast<const StructType&>(*partial.type());
+      out.length = 1;
+
+      for (const auto& field : full_schema.fields()) {
+        ARROW_ASSIGN_OR_RAISE(auto match,
+                              FieldRef(field->name()).FindOneOrNone(partial_type));
+
+        if (match.empty()) {
+          out.values.emplace_back(MakeNullScalar(field->type()));
+          continue;
+        }
 
-      for (Datum& value : out.values) {
-        if (value.is_scalar()) continue;
-        ARROW_ASSIGN_OR_RAISE(value, value.make_array()->GetScalar(0));
+        std::shared_ptr<Scalar> value =
+            partial_scalar.is_valid
+                ? partial_scalar.value[match[0]]
+                : MakeNullScalar(partial_type.field(match[0])->type());
+        if (!value->type->Equals(field->type())) {
+          ARROW_ASSIGN_OR_RAISE(
+              Datum converted,
+              compute::Cast(value, field->type(), compute::CastOptions::Safe()));
+          value = converted.scalar();
+        }
+        out.values.emplace_back(std::move(value));
       }
       return out;
     }
@@ -219,6 +219,28 @@ TEST(ExpressionUtils, MakeExecBatch) {
   auto duplicated_names =
       RecordBatch::Make(schema({GetField("i32"), GetField("i32")}), kNumRows, {i32, i32});
   ASSERT_RAISES(Invalid, MakeExecBatch(*kBoringSchema, duplicated_names));
+
+  // struct scalars yield scalar columns
+  ASSERT_OK_AND_ASSIGN(auto partial_scalar,
+                       StructScalar::Make({MakeScalar(1.5f), MakeScalar(int32_t(7))},
+                                          {"f32", "i32"}));
+  ASSERT_OK_AND_ASSIGN(auto batch, MakeExecBatch(*kBoringSchema, partial_scalar));
+  ASSERT_EQ(batch.length, 1);
+  ASSERT_EQ(batch.num_values(), kBoringSchema->num_fields());
+  for (int i = 0; i < kBoringSchema->num_fields(); ++i) {
+    const auto& field = *kBoringSchema->field(i);
+    SCOPED_TRACE("Field#" + std::to_string(i) + " " + field.ToString());
+
+    ASSERT_TRUE(batch[i].is_scalar());
+    EXPECT_TRUE(batch[i].type()->Equals(field.type()));
+    if (field.name() == "i32") {
+      AssertDatumsEqual(MakeScalar(int32_t(7)), batch[i]);
+    } else if (field.name() == "f32") {
+      AssertDatumsEqual(MakeScalar(1.5f), batch[i]);
+    } else {
+      EXPECT_FALSE(batch[i].scalar()->is_valid);
+    }
+  }
 }
 
 class WidgetifyOptions : public compute::FunctionOptions {
@@ -59,9 +59,14 @@ class FilterNode : public MapNode {
                                filter_expression.ToString(), " evaluates to ",
                                filter_expression.type()->ToString());
     }
-    return plan->EmplaceNode<FilterNode>(plan, std::move(inputs), std::move(schema),
-                                         std::move(filter_expression),
-                                         filter_options.async_mode);
+    ExecNode* filter_node = plan->EmplaceNode<FilterNode>(
+        plan, std::move(inputs), std::move(schema), std::move(filter_expression),
+        filter_options.async_mode);
+    if (filter_options.coalesce_options == nullptr) {
+      return filter_node;
+    }
+    return MakeExecNode("coalesce_batches", plan, {filter_node},
+                        *filter_options.coalesce_options);
   }
 
   const char* kind_name() const override { return "FilterNode"; }
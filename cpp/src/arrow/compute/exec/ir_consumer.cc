@@ -284,10 +284,13 @@ struct ConvertLiteralImpl {
   Status Visit(const ExtensionType& t) { return NotImplemented(); }
   Status Visit(const SparseUnionType& t) { return NotImplemented(); }
   Status Visit(const DenseUnionType& t) { return NotImplemented(); }
+  Status Visit(const RunEndEncodedType& t) { return NotImplemented(); }
   Status Visit(const FixedSizeListType& t) { return NotImplemented(); }
   Status Visit(const DictionaryType& t) { return NotImplemented(); }
   Status Visit(const LargeStringType& t) { return NotImplemented(); }
   Status Visit(const LargeBinaryType& t) { return NotImplemented(); }
+  Status Visit(const StringViewType& t) { return NotImplemented(); }
+  Status Visit(const BinaryViewType& t) { return NotImplemented(); }
   Status Visit(const LargeListType& t) { return NotImplemented(); }
 
   template <typename T>
@@ -75,11 +75,45 @@ class ARROW_EXPORT TableSourceNodeOptions : public ExecNodeOptions {
   int64_t max_batch_size;
 };
 
+/// \brief Make a node which normalizes the sizes of the batches passed through it
+///
+/// Batches are accumulated until they hold at least target_rows rows, or at least
+/// target_bytes bytes if positive, and are then concatenated into a single batch.
+/// If max_rows is positive, no emitted batch has more than max_rows rows: larger batches
+/// are split into slices of target_rows rows first, and the accumulated batches are
+/// emitted early when the next one wouldn't fit. If max_latency is positive, accumulated
+/// batches are also emitted once the oldest of them has waited for max_latency seconds,
+/// by a task scheduled on the plan's executor, even if no other batch is received. Plans
+/// executed serially have no executor to run it, so there the expired batches are only
+/// emitted when the next batch is received. Whatever remains is emitted when the input
+/// finishes.
+///
+/// In plans executed serially (the only ones in which batch order is defined), the rows
+/// are emitted in the order they were received.
+class ARROW_EXPORT CoalesceBatchesNodeOptions : public ExecNodeOptions {
+ public:
+  explicit CoalesceBatchesNodeOptions(int64_t target_rows = 32 * 1024,
+                                      int64_t target_bytes = -1, int64_t max_rows = -1,
+                                      double max_latency = -1)
+      : target_rows(target_rows),
+        target_bytes(target_bytes),
+        max_rows(max_rows),
+        max_latency(max_latency) {}
+
+  int64_t target_rows;
+  int64_t target_bytes;
+  int64_t max_rows;
+  double max_latency;
+};
+
 /// \brief Make a node which excludes some rows from batches passed through it
 ///
 /// filter_expression will be evaluated against each batch which is pushed to
 /// this node. Any rows for which filter_expression does not evaluate to `true` will be
 /// excluded in the batch emitted by this node.
+///
+/// If coalesce_options is set, a coalesce_batches node with those options is added
+/// after the filter node, merging the small batches a selective filter emits.
 class ARROW_EXPORT FilterNodeOptions : public ExecNodeOptions {
  public:
   explicit FilterNodeOptions(Expression filter_expression, bool async_mode = true)
@@ -87,6 +121,7 @@ class ARROW_EXPORT FilterNodeOptions : public ExecNodeOptions {
 
   Expression filter_expression;
   bool async_mode;
+  std::shared_ptr<CoalesceBatchesNodeOptions> coalesce_options;
 };
 
 /// \brief Make a node which executes expressions on input batches, producing new batches.
@@ -113,16 +148,32 @@ class ARROW_EXPORT ProjectNodeOptions : public ExecNodeOptions {
 /// If the keys attribute is a non-empty vector, then each aggregate in `aggregates` is
 /// expected to be a HashAggregate function. If the keys attribute is an empty vector,
 /// then each aggregate is assumed to be a ScalarAggregate function.
+///
+/// If segment_keys is non-empty, the input is expected to arrive ordered (or at least
+/// clustered) on the segment keys, and each aggregate is expected to be a
+/// HashAggregate function. A segment is a run of consecutive rows with equal segment
+/// keys. Each segment is aggregated, grouped by keys, and output as soon as it ends,
+/// so that only the groups of the current segment are kept in memory. The output
+/// has the aggregates, then the keys, then the segment keys. A segment key value
+/// which appears again after another one starts a new segment. Since this requires
+/// the input batches in order, segmented aggregation is only supported in plans
+/// executed serially (NotImplemented is returned otherwise). Segment keys must be
+/// of a primitive, binary-like or fixed-size binary type.
 class ARROW_EXPORT AggregateNodeOptions : public ExecNodeOptions {
  public:
   explicit AggregateNodeOptions(std::vector<Aggregate> aggregates,
-                                std::vector<FieldRef> keys = {})
-      : aggregates(std::move(aggregates)), keys(std::move(keys)) {}
+                                std::vector<FieldRef> keys = {},
+                                std::vector<FieldRef> segment_keys = {})
+      : aggregates(std::move(aggregates)),
+        keys(std::move(keys)),
+        segment_keys(std::move(segment_keys)) {}
 
   // aggregations which will be applied to the targetted fields
   std::vector<Aggregate> aggregates;
   // keys by which aggregations will be grouped
   std::vector<FieldRef> keys;
+  // keys on which the input is ordered, delimiting segments aggregated separately
+  std::vector<FieldRef> segment_keys;
 };
 
 constexpr int32_t kDefaultBackpressureHighBytes = 1 << 30;  // 1GiB
@@ -20,6 +20,7 @@
 #include <functional>
 #include <memory>
 
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec/exec_plan.h"
 #include "arrow/compute/exec/expression.h"
@@ -819,6 +820,323 @@ TEST(ExecPlanExecution, StressSourceSinkStopped) {
   }
 }
 
+TEST(ExecPlanExecution, StressTableSourceSink) {
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "single threaded");
+
+    ExecContext exec_context(default_memory_pool(),
+                             parallel ? arrow::internal::GetCpuThreadPool() : nullptr);
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_context));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+    auto random_data =
+        MakeRandomBatches(schema({field("a", int32()), field("b", boolean())}), 300);
+    ASSERT_OK_AND_ASSIGN(auto table,
+                         TableFromExecBatches(random_data.schema, random_data.batches));
+
+    ASSERT_OK(Declaration::Sequence(
+                  {
+                      {"table_source", TableSourceNodeOptions{table, 4}},
+                      {"sink", SinkNodeOptions{&sink_gen}},
+                  })
+                  .AddToPlan(plan.get()));
+
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto res, StartAndCollect(plan.get(), sink_gen));
+    ASSERT_EQ(res.size(), random_data.batches.size());
+    ASSERT_OK_AND_ASSIGN(auto out_table, TableFromExecBatches(random_data.schema, res));
+    AssertTablesEqual(table, out_table);
+  }
+}
+
+TEST(ExecPlanExecution, StressTableSourceSinkStopped) {
+  auto random_data =
+      MakeRandomBatches(schema({field("a", int32()), field("b", boolean())}), 300);
+  ASSERT_OK_AND_ASSIGN(auto table,
+                       TableFromExecBatches(random_data.schema, random_data.batches));
+
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+    ASSERT_OK(Declaration::Sequence(
+                  {
+                      {"table_source", TableSourceNodeOptions{table, 4}},
+                      {"filter", FilterNodeOptions{greater_equal(field_ref("a"),
+                                                                 literal(0))}},
+                      {"sink", SinkNodeOptions{&sink_gen}},
+                  })
+                  .AddToPlan(plan.get()));
+
+    ASSERT_OK(plan->Validate());
+    ASSERT_OK(plan->StartProducing());
+    plan->StopProducing();
+    ASSERT_THAT(plan->finished(), Finishes(Ok()));
+  }
+}
+
+TEST(ExecPlanExecution, TableSourceSinkBackpressure) {
+  constexpr int kNumBatches = 20;
+  BatchesWithSchema data;
+  data.schema = schema({field("a", int32())});
+  for (int i = 0; i < kNumBatches; ++i) {
+    data.batches.push_back(
+        ExecBatchFromJSON({int32()}, "[" + std::to_string(i) + ", 1, 2, 3]"));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, TableFromExecBatches(data.schema, data.batches));
+  const auto batch_size = static_cast<uint64_t>(data.batches[0].TotalBufferSize());
+  BackpressureOptions backpressure_options(/*resume_if_below=*/2 * batch_size,
+                                           /*pause_if_above=*/4 * batch_size);
+
+  // Single threaded, so that all batches would be emitted by StartProducing
+  // without backpressure
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  BackpressureMonitor* backpressure_monitor;
+  ASSERT_OK(Declaration::Sequence(
+                {
+                    {"table_source", TableSourceNodeOptions{table, 4}},
+                    {"sink", SinkNodeOptions{&sink_gen, backpressure_options,
+                                             &backpressure_monitor}},
+                })
+                .AddToPlan(plan.get()));
+  ASSERT_OK(plan->StartProducing());
+
+  // The batches are held back once the sink is paused
+  ASSERT_TRUE(backpressure_monitor->is_paused());
+  ASSERT_LE(backpressure_monitor->bytes_in_use(), 5 * batch_size);
+  ASSERT_FALSE(plan->finished().is_finished());
+
+  // Consuming resumes the source
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto res, CollectAsyncGenerator(sink_gen));
+  ASSERT_EQ(res.size(), kNumBatches);
+  ASSERT_FINISHES_OK(plan->finished());
+  std::vector<ExecBatch> batches;
+  for (auto& batch : res) {
+    batches.push_back(std::move(*batch));
+  }
+  ASSERT_OK_AND_ASSIGN(auto out_table, TableFromExecBatches(data.schema, batches));
+  AssertTablesEqual(*table, *out_table, /*same_chunk_layout=*/false);
+}
+
+TEST(ExecPlanExecution, TableSourceCoalesceBatchesSink) {
+  auto random_data =
+      MakeRandomBatches(schema({field("a", int32()), field("b", boolean())}), 300);
+  ASSERT_OK_AND_ASSIGN(auto table,
+                       TableFromExecBatches(random_data.schema, random_data.batches));
+
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "single threaded");
+
+    ExecContext exec_context(default_memory_pool(),
+                             parallel ? arrow::internal::GetCpuThreadPool() : nullptr);
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_context));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+    ASSERT_OK(Declaration::Sequence(
+                  {
+                      {"table_source", TableSourceNodeOptions{table, 4}},
+                      {"coalesce_batches", CoalesceBatchesNodeOptions{100}},
+                      {"sink", SinkNodeOptions{&sink_gen}},
+                  })
+                  .AddToPlan(plan.get()));
+
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto res, StartAndCollect(plan.get(), sink_gen));
+    // only the batch emitted when the input finishes may be short
+    ASSERT_EQ(res.size(), 12);
+    int short_batches = 0;
+    for (const auto& batch : res) {
+      if (batch.length < 100) ++short_batches;
+    }
+    ASSERT_LE(short_batches, 1);
+
+    ASSERT_OK_AND_ASSIGN(auto out_table, TableFromExecBatches(random_data.schema, res));
+    AssertTablesEqual(table, out_table);
+  }
+}
+
+TEST(ExecPlanExecution, TableSourceCoalesceBatchesSplitsLargeBatches) {
+  auto random_data = MakeRandomBatches(schema({field("a", int32())}), 2, 1000);
+  ASSERT_OK_AND_ASSIGN(auto table,
+                       TableFromExecBatches(random_data.schema, random_data.batches));
+
+  // batch order is only defined when executing serially
+  ExecContext exec_context(default_memory_pool(), nullptr);
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_context));
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+  ASSERT_OK(Declaration::Sequence(
+                {
+                    {"table_source", TableSourceNodeOptions{table, 1000}},
+                    {"coalesce_batches",
+                     CoalesceBatchesNodeOptions{/*target_rows=*/300, /*target_bytes=*/-1,
+                                                /*max_rows=*/500}},
+                    {"sink", SinkNodeOptions{&sink_gen}},
+                })
+                .AddToPlan(plan.get()));
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto res, StartAndCollect(plan.get(), sink_gen));
+  std::vector<int64_t> lengths;
+  for (const auto& batch : res) {
+    lengths.push_back(batch.length);
+  }
+  ASSERT_THAT(lengths, ElementsAre(300, 300, 300, 400, 300, 300, 100));
+
+  ASSERT_OK_AND_ASSIGN(auto out_table, TableFromExecBatches(random_data.schema, res));
+  AssertTablesEqual(*table, *out_table, /*same_chunk_layout=*/false, /*flatten=*/true);
+}
+
+TEST(ExecPlanExecution, TableSourceCoalesceBatchesRespectsMaxRows) {
+  auto random_data = MakeRandomBatches(schema({field("a", int32())}), 2, 1000);
+  ASSERT_OK_AND_ASSIGN(auto table,
+                       TableFromExecBatches(random_data.schema, random_data.batches));
+
+  ExecContext exec_context(default_memory_pool(), nullptr);
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_context));
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+  ASSERT_OK(Declaration::Sequence(
+                {
+                    {"table_source", TableSourceNodeOptions{table, 1000}},
+                    {"coalesce_batches",
+                     CoalesceBatchesNodeOptions{/*target_rows=*/300, /*target_bytes=*/-1,
+                                                /*max_rows=*/350}},
+                    {"sink", SinkNodeOptions{&sink_gen}},
+                })
+                .AddToPlan(plan.get()));
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto res, StartAndCollect(plan.get(), sink_gen));
+  std::vector<int64_t> lengths;
+  for (const auto& batch : res) {
+    lengths.push_back(batch.length);
+  }
+  // the 100 leftover rows of the first batch are emitted rather than exceed max_rows
+  ASSERT_THAT(lengths, ElementsAre(300, 300, 300, 100, 300, 300, 300, 100));
+
+  ASSERT_OK_AND_ASSIGN(auto out_table, TableFromExecBatches(random_data.schema, res));
+  AssertTablesEqual(*table, *out_table, /*same_chunk_layout=*/false, /*flatten=*/true);
+}
+
+TEST(ExecPlanExecution, SourceCoalesceBatchesFlushesAfterMaxLatency) {
+  auto batch = ExecBatchFromJSON({int32()}, "[[1], [2], [3]]");
+  auto next_batch = ExecBatchFromJSON({int32()}, "[[4], [5]]");
+
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "single threaded");
+
+    // The source produces a batch, then waits until it is told to produce the next
+    // one, then to finish
+    auto next = Future<util::optional<ExecBatch>>::Make();
+    auto end = Future<util::optional<ExecBatch>>::Make();
+    int calls = 0;
+    AsyncGenerator<util::optional<ExecBatch>> source_gen = [&] {
+      switch (calls++) {
+        case 0:
+          return Future<util::optional<ExecBatch>>::MakeFinished(batch);
+        case 1:
+          return next;
+        default:
+          return end;
+      }
+    };
+
+    ExecContext exec_context(default_memory_pool(),
+                             parallel ? arrow::internal::GetCpuThreadPool() : nullptr);
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_context));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+    ASSERT_OK(Declaration::Sequence(
+                  {
+                      {"source", SourceNodeOptions{schema({field("a", int32())}),
+                                                   source_gen}},
+                      {"coalesce_batches",
+                       CoalesceBatchesNodeOptions{/*target_rows=*/100,
+                                                  /*target_bytes=*/-1, /*max_rows=*/-1,
+                                                  /*max_latency=*/0.01}},
+                      {"sink", SinkNodeOptions{&sink_gen}},
+                  })
+                  .AddToPlan(plan.get()));
+    ASSERT_OK(plan->StartProducing());
+
+    if (parallel) {
+      // The batch is emitted although the input neither finished nor produced more
+      // rows
+      ASSERT_FINISHES_OK_AND_ASSIGN(auto out, sink_gen());
+      ASSERT_TRUE(out.has_value());
+      ASSERT_EQ(*out, batch);
+      next.MarkFinished(next_batch);
+    } else {
+      // The batch is emitted when the next one is received, without waiting for
+      // more rows
+      SleepFor(0.05);
+      next.MarkFinished(next_batch);
+      ASSERT_FINISHES_OK_AND_ASSIGN(auto out, sink_gen());
+      ASSERT_TRUE(out.has_value());
+      ASSERT_EQ(*out, batch);
+    }
+
+    end.MarkFinished(util::nullopt);
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto out, sink_gen());
+    ASSERT_TRUE(out.has_value());
+    ASSERT_EQ(*out, next_batch);
+    ASSERT_FINISHES_OK_AND_ASSIGN(out, sink_gen());
+    ASSERT_FALSE(out.has_value());
+    ASSERT_FINISHES_OK(plan->finished());
+  }
+}
+
+TEST(ExecPlanExecution, SourceCoalesceBatchesStopsWithPendingFlush) {
+  // Plans with pending latency flushes stop and finish without waiting for them
+  for (int i = 0; i < 10; ++i) {
+    auto end = Future<util::optional<ExecBatch>>::Make();
+    int calls = 0;
+    AsyncGenerator<util::optional<ExecBatch>> source_gen = [&] {
+      if (calls++ == 0) {
+        return Future<util::optional<ExecBatch>>::MakeFinished(
+            ExecBatchFromJSON({int32()}, "[[1], [2], [3]]"));
+      }
+      return end;
+    };
+
+    ExecContext exec_context(default_memory_pool(),
+                             arrow::internal::GetCpuThreadPool());
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_context));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    ASSERT_OK(Declaration::Sequence(
+                  {
+                      {"source", SourceNodeOptions{schema({field("a", int32())}),
+                                                   source_gen}},
+                      {"coalesce_batches",
+                       CoalesceBatchesNodeOptions{/*target_rows=*/100,
+                                                  /*target_bytes=*/-1, /*max_rows=*/-1,
+                                                  /*max_latency=*/60}},
+                      {"sink", SinkNodeOptions{&sink_gen}},
+                  })
+                  .AddToPlan(plan.get()));
+    ASSERT_OK(plan->StartProducing());
+    plan->StopProducing();
+    end.MarkFinished(util::nullopt);
+    ASSERT_THAT(plan->finished(), Finishes(Ok()));
+  }
+}
+
+TEST(ExecPlanExecution, CoalesceBatchesInvalidOptions) {
+  auto random_data = MakeRandomBatches(schema({field("a", int32())}));
+
+  for (const auto& options :
+       {CoalesceBatchesNodeOptions{0}, CoalesceBatchesNodeOptions{100, -1, 50}}) {
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+    ASSERT_RAISES(Invalid,
+                  Declaration::Sequence(
+                      {
+                          {"source", SourceNodeOptions{random_data.schema,
+                                                       random_data.gen(/*parallel=*/false,
+                                                                       /*slow=*/false)}},
+                          {"coalesce_batches", options},
+                      })
+                      .AddToPlan(plan.get()));
+  }
+}
+
 TEST(ExecPlanExecution, SourceFilterSink) {
   auto basic_data = MakeBasicBatches();
 
@@ -841,6 +1159,46 @@ TEST(ExecPlanExecution, SourceFilterSink) {
                    ExecBatchFromJSON({int32(), boolean()}, "[[6, false]]")}))));
 }
 
+TEST(ExecPlanExecution, SourceFilterCoalesceBatchesSink) {
+  auto random_data =
+      MakeRandomBatches(schema({field("a", int32()), field("b", boolean())}), 100);
+
+  for (bool coalesce : {false, true}) {
+    SCOPED_TRACE(coalesce ? "coalesced" : "not coalesced");
+
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+    FilterNodeOptions filter_options{equal(field_ref("b"), literal(true))};
+    if (coalesce) {
+      filter_options.coalesce_options = std::make_shared<CoalesceBatchesNodeOptions>(50);
+    }
+    ASSERT_OK(Declaration::Sequence(
+                  {
+                      {"source", SourceNodeOptions{random_data.schema,
+                                                   random_data.gen(/*parallel=*/true,
+                                                                   /*slow=*/false)}},
+                      {"filter", filter_options},
+                      {"sink", SinkNodeOptions{&sink_gen}},
+                  })
+                  .AddToPlan(plan.get()));
+    ASSERT_EQ(plan->sources()[0]->outputs()[0]->outputs()[0]->kind_name(),
+              std::string(coalesce ? "CoalesceBatchesNode" : "SinkNode"));
+
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto res, StartAndCollect(plan.get(), sink_gen));
+    ASSERT_OK_AND_ASSIGN(auto out_table, TableFromExecBatches(random_data.schema, res));
+    ASSERT_OK_AND_ASSIGN(auto expected, TableFromExecBatches(random_data.schema,
+                                                             random_data.batches));
+    ASSERT_OK_AND_ASSIGN(
+        auto filtered,
+        Filter(expected, expected->GetColumnByName("b"), FilterOptions::Defaults()));
+    AssertTablesEqual(filtered.table(), out_table);
+    if (coalesce) {
+      ASSERT_LE(res.size(), filtered.table()->num_rows() / 50 + 1);
+    }
+  }
+}
+
 TEST(ExecPlanExecution, SourceProjectSink) {
   auto basic_data = MakeBasicBatches();
 
@@ -933,6 +1291,141 @@ TEST(ExecPlanExecution, SourceGroupedSum) {
   }
 }
 
+TEST(ExecPlanExecution, SourceSegmentedSum) {
+  BatchesWithSchema input;
+  input.batches = {
+      ExecBatchFromJSON({int32(), utf8(), utf8()},
+                        R"([[1, "a", "x"], [2, "a", "y"], [3, "a", "x"]])"),
+      ExecBatchFromJSON({int32(), utf8(), utf8()},
+                        R"([[4, "a", "y"], [5, "b", "x"], [6, "b", "x"]])"),
+      ExecBatchFromJSON({int32(), utf8(), utf8()},
+                        {ArgShape::ARRAY, ArgShape::SCALAR, ArgShape::ARRAY},
+                        R"([[7, "b", "y"], [8, "b", "x"]])"),
+      ExecBatchFromJSON({int32(), utf8(), utf8()}, R"([[9, "c", "x"]])"),
+  };
+  input.schema =
+      schema({field("i32", int32()), field("seg", utf8()), field("key", utf8())});
+
+  // Segmented aggregation relies on batches being received in order
+  auto exec_ctx = arrow::internal::make_unique<ExecContext>(default_memory_pool(),
+                                                            /*executor=*/nullptr);
+
+  auto run = [&](std::vector<FieldRef> keys) -> Result<std::vector<ExecBatch>> {
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(exec_ctx.get()));
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    RETURN_NOT_OK(
+        Declaration::Sequence(
+            {
+                {"source",
+                 SourceNodeOptions{input.schema, input.gen(/*parallel=*/false,
+                                                           /*slow=*/false)}},
+                {"aggregate",
+                 AggregateNodeOptions{
+                     /*aggregates=*/{{"hash_sum", nullptr, "i32", "sum(i32)"}},
+                     /*keys=*/std::move(keys), /*segment_keys=*/{"seg"}}},
+                {"sink", SinkNodeOptions{&sink_gen}},
+            })
+            .AddToPlan(plan.get()));
+    return StartAndCollect(plan.get(), sink_gen).result();
+  };
+
+  // One output batch per segment, in input order
+  ASSERT_OK_AND_ASSIGN(auto batches, run(/*keys=*/{}));
+  ASSERT_THAT(batches,
+              ElementsAreArray({
+                  ExecBatchFromJSON({int64(), utf8()}, R"([[10, "a"]])"),
+                  ExecBatchFromJSON({int64(), utf8()}, R"([[26, "b"]])"),
+                  ExecBatchFromJSON({int64(), utf8()}, R"([[9, "c"]])"),
+              }));
+
+  // Keys are grouped within each segment
+  ASSERT_OK_AND_ASSIGN(batches, run(/*keys=*/{"key"}));
+  ASSERT_THAT(batches,
+              ElementsAreArray({
+                  ExecBatchFromJSON({int64(), utf8(), utf8()},
+                                    R"([[4, "x", "a"], [6, "y", "a"]])"),
+                  ExecBatchFromJSON({int64(), utf8(), utf8()},
+                                    R"([[19, "x", "b"], [7, "y", "b"]])"),
+                  ExecBatchFromJSON({int64(), utf8(), utf8()}, R"([[9, "x", "c"]])"),
+              }));
+}
+
+TEST(ExecPlanExecution, SourceSegmentedSumMultipleKeys) {
+  // Segments spanning batches, delimited by two segment keys with nulls
+  BatchesWithSchema input;
+  input.batches = {
+      ExecBatchFromJSON({int32(), int32(), boolean()},
+                        R"([[1, null, true], [2, null, true], [3, 1, true]])"),
+      ExecBatchFromJSON({int32(), int32(), boolean()},
+                        R"([[4, 1, true], [5, 1, false], [6, 1, null]])"),
+      ExecBatchFromJSON({int32(), int32(), boolean()}, R"([[7, 1, null]])"),
+      ExecBatchFromJSON({int32(), int32(), boolean()},
+                        R"([[8, null, true], [9, null, true]])"),
+  };
+  input.schema =
+      schema({field("i32", int32()), field("seg1", int32()), field("seg2", boolean())});
+
+  auto exec_ctx = arrow::internal::make_unique<ExecContext>(default_memory_pool(),
+                                                            /*executor=*/nullptr);
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(exec_ctx.get()));
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  ASSERT_OK(Declaration::Sequence(
+                {
+                    {"source", SourceNodeOptions{input.schema,
+                                                 input.gen(/*parallel=*/false,
+                                                           /*slow=*/false)}},
+                    {"aggregate",
+                     AggregateNodeOptions{
+                         /*aggregates=*/{{"hash_sum", nullptr, "i32", "sum(i32)"}},
+                         /*keys=*/{}, /*segment_keys=*/{"seg1", "seg2"}}},
+                    {"sink", SinkNodeOptions{&sink_gen}},
+                })
+                .AddToPlan(plan.get()));
+  auto out_types = std::vector<TypeHolder>{int64(), int32(), boolean()};
+  ASSERT_THAT(StartAndCollect(plan.get(), sink_gen),
+              Finishes(ResultWith(ElementsAreArray({
+                  ExecBatchFromJSON(out_types, R"([[3, null, true]])"),
+                  ExecBatchFromJSON(out_types, R"([[7, 1, true]])"),
+                  ExecBatchFromJSON(out_types, R"([[5, 1, false]])"),
+                  ExecBatchFromJSON(out_types, R"([[13, 1, null]])"),
+                  ExecBatchFromJSON(out_types, R"([[17, null, true]])"),
+              }))));
+}
+
+TEST(ExecPlanExecution, SegmentedAggregationUnsupported) {
+  auto input_schema = schema(
+      {field("i32", int32()), field("seg", int32()), field("list", list(int32()))});
+  AsyncGenerator<util::optional<ExecBatch>> source_gen = [] {
+    return AsyncGeneratorEnd<util::optional<ExecBatch>>();
+  };
+
+  // Segments are only delimited correctly if batches are received in order, which
+  // isn't guaranteed by a plan executed by several threads
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, arrow::internal::ThreadPool::Make(4));
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&parallel_ctx));
+  auto source = MakeExecNode("source", plan.get(), {},
+                             SourceNodeOptions{input_schema, source_gen});
+  ASSERT_OK(source);
+  ASSERT_RAISES(NotImplemented,
+                MakeExecNode("aggregate", plan.get(), {*source},
+                             AggregateNodeOptions{
+                                 /*aggregates=*/{{"hash_sum", nullptr, "i32", "sum"}},
+                                 /*keys=*/{}, /*segment_keys=*/{"seg"}}));
+
+  // Segment keys of nested types are not supported
+  ExecContext serial_ctx(default_memory_pool(), /*executor=*/nullptr);
+  ASSERT_OK_AND_ASSIGN(plan, ExecPlan::Make(&serial_ctx));
+  source = MakeExecNode("source", plan.get(), {},
+                        SourceNodeOptions{input_schema, source_gen});
+  ASSERT_OK(source);
+  ASSERT_RAISES(NotImplemented,
+                MakeExecNode("aggregate", plan.get(), {*source},
+                             AggregateNodeOptions{
+                                 /*aggregates=*/{{"hash_sum", nullptr, "i32", "sum"}},
+                                 /*keys=*/{}, /*segment_keys=*/{"list"}}));
+}
+
 TEST(ExecPlanExecution, SourceMinMaxScalar) {
   // Regression test for ARROW-16904
   for (bool parallel : {false, true}) {
@@ -35,12 +35,10 @@
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/tracing_internal.h"
 #include "arrow/util/unreachable.h"
-#include "arrow/util/vector.h"
 
 namespace arrow {
 
 using internal::checked_cast;
-using internal::MapVector;
 
 namespace compute {
 namespace {
@@ -202,9 +200,15 @@ struct SourceNode : ExecNode {
   AsyncGenerator<util::optional<ExecBatch>> generator_;
 };
 
-struct TableSourceNode : public SourceNode {
+// A source of in-memory batches which are dispatched as morsels through a task group
+// of the plan's TaskScheduler. Each task pushes one batch through the downstream nodes,
+// which process it synchronously on the same thread, and idle threads claim the next
+// batch as they finish. Unlike SourceNode, no generator loop or per-batch scheduling
+// is involved, except for the batches held back while the output is paused.
+struct TableSourceNode : public ExecNode {
   TableSourceNode(ExecPlan* plan, std::shared_ptr<Table> table, int64_t batch_size)
-      : SourceNode(plan, table->schema(), TableGenerator(*table, batch_size)) {}
+      : ExecNode(plan, {}, {}, table->schema(), /*num_outputs=*/1),
+        batches_(ConvertTableToExecBatches(*table, batch_size)) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -220,6 +224,140 @@ struct TableSourceNode : public SourceNode {
 
   const char* kind_name() const override { return "TableSourceNode"; }
 
+  [[noreturn]] static void NoInputs() {
+    Unreachable("no inputs; this should never be called");
+  }
+  [[noreturn]] void InputReceived(ExecNode*, ExecBatch) override { NoInputs(); }
+  [[noreturn]] void ErrorReceived(ExecNode*, Status) override { NoInputs(); }
+  [[noreturn]] void InputFinished(ExecNode*, int) override { NoInputs(); }
+
+  Status Init() override {
+    task_group_ = plan_->RegisterTaskGroup(
+        [this](size_t, int64_t batch_index) { return EmitBatch(batch_index); },
+        [this](size_t) { return FinishEmitting(); });
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    START_COMPUTE_SPAN(span_, std::string(kind_name()) + ":" + label(),
+                       {{"node.kind", kind_name()},
+                        {"node.label", label()},
+                        {"node.output_schema", output_schema()->ToString()},
+                        {"node.detail", ToString()}});
+    END_SPAN_ON_FUTURE_COMPLETION(span_, finished_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stop_requested_) {
+        return Status::OK();
+      }
+      started_ = true;
+    }
+    return plan_->StartTaskGroup(task_group_, static_cast<int64_t>(batches_.size()));
+  }
+
+  // While paused, the tasks hold their batches back; they are emitted by tasks
+  // scheduled when the output resumes.
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (counter <= backpressure_counter_) {
+      return;
+    }
+    backpressure_counter_ = counter;
+    paused_ = true;
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    std::vector<int64_t> held_back;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (counter <= backpressure_counter_) {
+        return;
+      }
+      backpressure_counter_ = counter;
+      paused_ = false;
+      held_back.swap(held_back_);
+      num_resumed_ += static_cast<int64_t>(held_back.size());
+    }
+    for (int64_t batch_index : held_back) {
+      Status st = plan_->ScheduleTask([this, batch_index]() {
+        return EmitBatch(batch_index, /*resumed=*/true);
+      });
+      if (!st.ok()) {
+        // The plan is stopping
+        std::unique_lock<std::mutex> lock(mutex_);
+        --num_resumed_;
+        MaybeFinish(std::move(lock));
+      }
+    }
+  }
+
+  void StopProducing(ExecNode* output) override {
+    DCHECK_EQ(output, outputs_[0]);
+    StopProducing();
+  }
+
+  void StopProducing() override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stop_requested_ = true;
+    // Tasks which haven't pushed their batch yet skip it, so the node is finished
+    // as soon as the batches being pushed have been processed.
+    MaybeFinish(std::move(lock));
+  }
+
+ private:
+  Status EmitBatch(int64_t batch_index, bool resumed = false) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (resumed) {
+      --num_resumed_;
+    }
+    if (stop_requested_) {
+      MaybeFinish(std::move(lock));
+      return Status::OK();
+    }
+    if (paused_) {
+      held_back_.push_back(batch_index);
+      return Status::OK();
+    }
+    ++num_emitting_;
+    lock.unlock();
+
+    outputs_[0]->InputReceived(this, std::move(batches_[batch_index]));
+
+    lock.lock();
+    --num_emitting_;
+    ++num_emitted_;
+    MaybeFinish(std::move(lock));
+    return Status::OK();
+  }
+
+  Status FinishEmitting() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    all_tasks_run_ = true;
+    MaybeFinish(std::move(lock));
+    return Status::OK();
+  }
+
+  // Signal the end of the output and mark the node finished once no batch is being
+  // pushed and every batch has been emitted, or stopping was requested.
+  void MaybeFinish(std::unique_lock<std::mutex> lock) {
+    if (finishing_ || num_emitting_ > 0) {
+      return;
+    }
+    if (!stop_requested_ &&
+        (!all_tasks_run_ || !held_back_.empty() || num_resumed_ > 0)) {
+      return;
+    }
+    finishing_ = true;
+    const bool started = started_;
+    const int num_emitted = num_emitted_;
+    lock.unlock();
+
+    if (started) {
+      outputs_[0]->InputFinished(this, num_emitted);
+    }
+    finished_.MarkFinished();
+  }
+
   static arrow::Status ValidateTableSourceNodeInput(const std::shared_ptr<Table> table,
                                                     const int64_t batch_size) {
     if (table == nullptr) {
@@ -235,17 +373,6 @@ struct TableSourceNode : public SourceNode {
     return Status::OK();
   }
 
-  static arrow::AsyncGenerator<util::optional<ExecBatch>> TableGenerator(
-      const Table& table, const int64_t batch_size) {
-    auto batches = ConvertTableToExecBatches(table, batch_size);
-    auto opt_batches =
-        MapVector([](ExecBatch batch) { return util::make_optional(std::move(batch)); },
-                  std::move(batches));
-    AsyncGenerator<util::optional<ExecBatch>> gen;
-    gen = MakeVectorGenerator(std::move(opt_batches));
-    return gen;
-  }
-
   static std::vector<ExecBatch> ConvertTableToExecBatches(const Table& table,
                                                           const int64_t batch_size) {
     std::shared_ptr<TableBatchReader> reader = std::make_shared<TableBatchReader>(table);
@@ -267,6 +394,22 @@ struct TableSourceNode : public SourceNode {
     }
     return exec_batches;
   }
+
+  std::mutex mutex_;
+  int32_t backpressure_counter_ = 0;
+  bool paused_ = false;
+  bool stop_requested_ = false;
+  bool started_ = false;
+  bool all_tasks_run_ = false;
+  bool finishing_ = false;
+  // The batches held back while paused, and the number of them being emitted
+  // after resuming
+  std::vector<int64_t> held_back_;
+  int64_t num_resumed_ = 0;
+  int num_emitting_ = 0;
+  int num_emitted_ = 0;
+  int task_group_ = -1;
+  std::vector<ExecBatch> batches_;
 };
 
 }  // namespace
@@ -363,19 +363,34 @@ Status TaskSchedulerImpl::ScheduleMore(size_t thread_id, int num_tasks_finished)
   for (size_t i = 0; i < tasks.size(); ++i) {
     int group_id = tasks[i].first;
     int64_t task_id = tasks[i].second;
-    RETURN_NOT_OK(schedule_impl_([this, group_id, task_id](size_t thread_id) -> Status {
-      RETURN_NOT_OK(ScheduleMore(thread_id, 1));
+    Status status = schedule_impl_([this, group_id, task_id](size_t thread_id) -> Status {
+      // The task must be accounted for even if scheduling failed (e.g. because the
+      // scheduler was aborted), otherwise its task group would never finish.
+      Status schedule_status = ScheduleMore(thread_id, 1);
 
       bool task_group_finished = false;
       RETURN_NOT_OK(ExecuteTask(thread_id, group_id, task_id, &task_group_finished));
 
       if (task_group_finished) {
         bool all_task_groups_finished = false;
-        return OnTaskGroupFinished(thread_id, group_id, &all_task_groups_finished);
+        RETURN_NOT_OK(
+            OnTaskGroupFinished(thread_id, group_id, &all_task_groups_finished));
       }
 
-      return Status::OK();
-    }));
+      return schedule_status;
+    });
+    if (!status.ok()) {
+      // The picked tasks which weren't scheduled will never run, so mark them
+      // finished for their task groups to complete
+      for (size_t j = i; j < tasks.size(); ++j) {
+        if (PostExecuteTask(thread_id, tasks[j].first)) {
+          bool all_task_groups_finished = false;
+          RETURN_NOT_OK(OnTaskGroupFinished(thread_id, tasks[j].first,
+                                            &all_task_groups_finished));
+        }
+      }
+      return status;
+    }
   }
 
   return Status::OK();
@@ -26,6 +26,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/compute/exec/util.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/thread_pool.h"
 
@@ -224,5 +225,56 @@ TEST(TaskScheduler, StressTwo) {
   }
 }
 
+// Aborting while tasks are in flight must still finish the abort, even though the
+// running tasks can't schedule any more tasks once the scheduler has been aborted.
+TEST(TaskScheduler, AbortWhileRunning) {
+  constexpr int kNumThreads = 4;
+  constexpr int kTasksPerGroup = 1000;
+  constexpr int kIterations = 100;
+
+  ThreadIndexer thread_indexer;
+  int num_threads = std::min(static_cast<int>(thread_indexer.Capacity()), kNumThreads);
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<ThreadPool> thread_pool,
+                       MakePrimedThreadPool(num_threads));
+
+  for (int i = 0; i < kIterations; i++) {
+    auto scheduler = TaskScheduler::Make();
+    std::atomic<bool> aborted(false);
+    std::atomic<int> num_tasks_run(0);
+    Future<> abort_finished = Future<>::Make();
+
+    int group_id = scheduler->RegisterTaskGroup(
+        [&](std::size_t, int64_t) {
+          if (num_tasks_run.fetch_add(1) == kTasksPerGroup / 2) {
+            aborted.store(true);
+            scheduler->Abort([&] { abort_finished.MarkFinished(); });
+          }
+          return Status::OK();
+        },
+        [](std::size_t) -> Status {
+          ADD_FAILURE() << "Unexpected continuation of an aborted task group";
+          return Status::OK();
+        });
+    scheduler->RegisterEnd();
+
+    TaskScheduler::ScheduleImpl schedule =
+        [&](TaskScheduler::TaskGroupContinuationImpl task) -> Status {
+      // Like an ExecPlan which stops accepting tasks once it has failed
+      if (aborted.load()) return Status::Cancelled("not accepting tasks");
+      return thread_pool->Spawn([&, task] {
+        std::size_t thread_id = thread_indexer();
+        ARROW_UNUSED(task(thread_id));
+      });
+    };
+
+    ASSERT_OK(scheduler->StartScheduling(0, schedule, num_threads * 4, false));
+    // The abort may happen before the initial tasks have all been scheduled
+    Status st = scheduler->StartTaskGroup(0, group_id, kTasksPerGroup);
+    ASSERT_TRUE(st.ok() || st.IsCancelled()) << st.ToString();
+    ASSERT_FINISHES_OK(abort_finished);
+    thread_pool->WaitForIdle();
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -211,6 +211,44 @@ class PrimitiveMatcher : public TypeMatcher {
 
 std::shared_ptr<TypeMatcher> Primitive() { return std::make_shared<PrimitiveMatcher>(); }
 
+class RunEndEncodedMatcher : public TypeMatcher {
+ public:
+  explicit RunEndEncodedMatcher(Type::type value_type_id)
+      : value_type_id_(value_type_id) {}
+
+  bool Matches(const DataType& type) const override {
+    if (type.id() != Type::RUN_END_ENCODED) {
+      return false;
+    }
+    const auto& ree_type = checked_cast<const RunEndEncodedType&>(type);
+    return ree_type.value_type()->id() == value_type_id_;
+  }
+
+  bool Equals(const TypeMatcher& other) const override {
+    if (this == &other) {
+      return true;
+    }
+    auto casted = dynamic_cast<const RunEndEncodedMatcher*>(&other);
+    if (casted == nullptr) {
+      return false;
+    }
+    return this->value_type_id_ == casted->value_type_id_;
+  }
+
+  std::string ToString() const override {
+    std::stringstream ss;
+    ss << "run_end_encoded(Type::" << ::arrow::internal::ToString(value_type_id_) << ")";
+    return ss.str();
+  }
+
+ private:
+  Type::type value_type_id_;
+};
+
+std::shared_ptr<TypeMatcher> RunEndEncoded(Type::type value_type_id) {
+  return std::make_shared<RunEndEncodedMatcher>(value_type_id);
+}
+
 class BinaryLikeMatcher : public TypeMatcher {
  public:
   BinaryLikeMatcher() {}
@@ -141,6 +141,10 @@ ARROW_EXPORT std::shared_ptr<TypeMatcher> FixedSizeBinaryLike();
 // Type)
 ARROW_EXPORT std::shared_ptr<TypeMatcher> Primitive();
 
+/// \brief Match any run-end encoded type whose value type has the given
+/// DataType::id, regardless of the run end type
+ARROW_EXPORT std::shared_ptr<TypeMatcher> RunEndEncoded(Type::type value_type_id);
+
 }  // namespace match
 
 /// \brief An object used for type-checking arguments to be passed to a kernel
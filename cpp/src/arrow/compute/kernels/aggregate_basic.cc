@@ -30,6 +30,14 @@ namespace internal {
 
 namespace {
 
+// Run-end encoded inputs are aggregated by the kernels of their value type
+std::shared_ptr<DataType> AggregatedType(const TypeHolder& type) {
+  if (type.id() == Type::RUN_END_ENCODED) {
+    return checked_cast<const RunEndEncodedType&>(*type).value_type();
+  }
+  return type.GetSharedPtr();
+}
+
 Status AggregateConsume(KernelContext* ctx, const ExecSpan& batch) {
   return checked_cast<ScalarAggregator*>(ctx->state())->Consume(ctx, batch);
 }
@@ -76,7 +84,9 @@ struct CountImpl : public ScalarAggregator {
       this->non_nulls += batch.length;
     } else if (batch[0].is_array()) {
       const ArraySpan& input = batch[0].array;
-      const int64_t nulls = input.GetNullCount();
+      const int64_t nulls = input.type->id() == Type::RUN_END_ENCODED
+                                ? ree_util::LogicalNullCount(input)
+                                : input.GetNullCount();
       this->nulls += nulls;
       this->non_nulls += input.length - nulls;
     } else {
@@ -257,7 +267,7 @@ struct MeanImplDefault : public MeanImpl<ArrowType, SimdLevel::NONE> {
 Result<std::unique_ptr<KernelState>> SumInit(KernelContext* ctx,
                                              const KernelInitArgs& args) {
   SumLikeInit<SumImplDefault> visitor(
-      ctx, args.inputs[0].GetSharedPtr(),
+      ctx, AggregatedType(args.inputs[0]),
       static_cast<const ScalarAggregateOptions&>(*args.options));
   return visitor.Create();
 }
@@ -265,7 +275,7 @@ Result<std::unique_ptr<KernelState>> SumInit(KernelContext* ctx,
 Result<std::unique_ptr<KernelState>> MeanInit(KernelContext* ctx,
                                               const KernelInitArgs& args) {
   MeanKernelInit<MeanImplDefault> visitor(
-      ctx, args.inputs[0].GetSharedPtr(),
+      ctx, AggregatedType(args.inputs[0]),
       static_cast<const ScalarAggregateOptions&>(*args.options));
   return visitor.Create();
 }
@@ -420,17 +430,22 @@ Result<std::unique_ptr<KernelState>> MinMaxInit(KernelContext* ctx,
                                                 const KernelInitArgs& args) {
   ARROW_ASSIGN_OR_RAISE(TypeHolder out_type,
                         args.kernel->signature->out_type().Resolve(ctx, args.inputs));
+  const auto in_type = AggregatedType(args.inputs[0]);
   MinMaxInitState<SimdLevel::NONE> visitor(
-      ctx, *args.inputs[0], out_type.GetSharedPtr(),
+      ctx, *in_type, out_type.GetSharedPtr(),
       static_cast<const ScalarAggregateOptions&>(*args.options));
   return visitor.Create();
 }
 
+Result<TypeHolder> MinOrMaxType(KernelContext*, const std::vector<TypeHolder>& types) {
+  return AggregatedType(types.front());
+}
+
 // For "min" and "max" functions: override finalize and return the actual value
 template <MinOrMax min_or_max>
 void AddMinOrMaxAggKernel(ScalarAggregateFunction* func,
                           ScalarAggregateFunction* min_max_func) {
-  auto sig = KernelSignature::Make({InputType::Any()}, FirstType);
+  auto sig = KernelSignature::Make({InputType::Any()}, MinOrMaxType);
   auto init = [min_max_func](
                   KernelContext* ctx,
                   const KernelInitArgs& args) -> Result<std::unique_ptr<KernelState>> {
@@ -801,9 +816,21 @@ void AddArrayScalarAggKernels(KernelInit init,
 
 namespace {
 
+void AddRunEndEncodedAggKernels(KernelInit init,
+                                const std::vector<std::shared_ptr<DataType>>& types,
+                                std::shared_ptr<DataType> out_ty,
+                                ScalarAggregateFunction* func) {
+  for (const auto& ty : types) {
+    // run_end_encoded<_, InT> -> scalar[OutT]
+    auto sig =
+        KernelSignature::Make({InputType(match::RunEndEncoded(ty->id()))}, out_ty);
+    AddAggKernel(std::move(sig), init, func, SimdLevel::NONE);
+  }
+}
+
 Result<TypeHolder> MinMaxType(KernelContext*, const std::vector<TypeHolder>& types) {
   // T -> struct<min: T, max: T>
-  auto ty = types.front().GetSharedPtr();
+  auto ty = AggregatedType(types.front());
   return struct_({field("min", ty), field("max", ty)});
 }
 
@@ -825,6 +852,16 @@ void AddMinMaxKernels(KernelInit init,
 
 namespace {
 
+void AddRunEndEncodedMinMaxKernels(KernelInit init,
+                                   const std::vector<std::shared_ptr<DataType>>& types,
+                                   ScalarAggregateFunction* func) {
+  for (const auto& ty : types) {
+    auto sig =
+        KernelSignature::Make({InputType(match::RunEndEncoded(ty->id()))}, MinMaxType);
+    AddAggKernel(std::move(sig), init, func, SimdLevel::NONE);
+  }
+}
+
 const FunctionDoc count_doc{"Count the number of null / non-null values",
                             ("By default, only non-null values are counted.\n"
                              "This can be changed through CountOptions."),
@@ -932,6 +969,10 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddArrayScalarAggKernels(SumInit, UnsignedIntTypes(), uint64(), func.get());
   AddArrayScalarAggKernels(SumInit, FloatingPointTypes(), float64(), func.get());
   AddArrayScalarAggKernels(SumInit, {null()}, int64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, {boolean()}, uint64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, SignedIntTypes(), int64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, UnsignedIntTypes(), uint64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, FloatingPointTypes(), float64(), func.get());
   // Add the SIMD variants for sum
 #if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
   auto cpu_info = arrow::internal::CpuInfo::GetInstance();
@@ -957,6 +998,8 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddAggKernel(KernelSignature::Make({Type::DECIMAL256}, FirstType), MeanInit, func.get(),
                SimdLevel::NONE);
   AddArrayScalarAggKernels(MeanInit, {null()}, float64(), func.get());
+  AddRunEndEncodedAggKernels(MeanInit, {boolean()}, float64(), func.get());
+  AddRunEndEncodedAggKernels(MeanInit, NumericTypes(), float64(), func.get());
   // Add the SIMD variants for mean
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
@@ -980,6 +1023,7 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddMinMaxKernel(MinMaxInit, Type::INTERVAL_MONTHS, func.get());
   AddMinMaxKernel(MinMaxInit, Type::DECIMAL128, func.get());
   AddMinMaxKernel(MinMaxInit, Type::DECIMAL256, func.get());
+  AddRunEndEncodedMinMaxKernels(MinMaxInit, NumericTypes(), func.get());
   // Add the SIMD variants for min max
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
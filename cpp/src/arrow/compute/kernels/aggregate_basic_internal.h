@@ -28,6 +28,7 @@
 #include "arrow/util/align_util.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 namespace compute {
@@ -72,6 +73,9 @@ struct SumImpl : public ScalarAggregator {
   Status Consume(KernelContext*, const ExecSpan& batch) override {
     if (batch[0].is_array()) {
       const ArraySpan& data = batch[0].array;
+      if (data.type->id() == Type::RUN_END_ENCODED) {
+        return ConsumeRunEndEncoded(data);
+      }
       this->count += data.length - data.GetNullCount();
       this->nulls_observed = this->nulls_observed || data.GetNullCount();
 
@@ -96,6 +100,50 @@ struct SumImpl : public ScalarAggregator {
     return Status::OK();
   }
 
+  // Each run contributes its value times its length, without decoding
+  Status ConsumeRunEndEncoded(const ArraySpan& data) {
+    switch (ree_util::RunEndsArray(data).type->id()) {
+      case Type::INT16:
+        return ConsumeRuns<int16_t>(data);
+      case Type::INT32:
+        return ConsumeRuns<int32_t>(data);
+      default:
+        return ConsumeRuns<int64_t>(data);
+    }
+  }
+
+  template <typename RunEndCType>
+  Status ConsumeRuns(const ArraySpan& data) {
+    const ArraySpan& values = ree_util::ValuesArray(data);
+    const uint8_t* validity = values.MayHaveNulls() ? values.buffers[0].data : NULLPTR;
+    ree_util::RunEndEncodedArraySpan<RunEndCType> ree_span(data);
+    for (auto it = ree_span.begin(); it != ree_span.end(); ++it) {
+      const int64_t index = it.index_into_array();
+      if (validity != NULLPTR && !bit_util::GetBit(validity, values.offset + index)) {
+        this->nulls_observed = true;
+        continue;
+      }
+      this->count += it.run_length();
+      this->sum += RunValue(values, index) * static_cast<SumCType>(it.run_length());
+    }
+    return Status::OK();
+  }
+
+  template <typename T = ArrowType>
+  static enable_if_boolean<T, SumCType> RunValue(const ArraySpan& values, int64_t i) {
+    return bit_util::GetBit(values.buffers[1].data, values.offset + i);
+  }
+
+  template <typename T = ArrowType>
+  static enable_if_number<T, SumCType> RunValue(const ArraySpan& values, int64_t i) {
+    return static_cast<SumCType>(values.GetValues<CType>(1)[i]);
+  }
+
+  template <typename T = ArrowType>
+  static enable_if_decimal<T, SumCType> RunValue(const ArraySpan& values, int64_t i) {
+    return SumCType(values.buffers[1].data + (values.offset + i) * sizeof(SumCType));
+  }
+
   Status MergeFrom(KernelContext*, KernelState&& src) override {
     const auto& other = checked_cast<const ThisType&>(src);
     this->count += other.count;
@@ -431,11 +479,27 @@ struct MinMaxImpl : public ScalarAggregator {
 
   Status Consume(KernelContext*, const ExecSpan& batch) override {
     if (batch[0].is_array()) {
+      if (batch[0].array.type->id() == Type::RUN_END_ENCODED) {
+        return ConsumeRunEndEncoded(batch[0].array);
+      }
       return ConsumeArray(batch[0].array);
     }
     return ConsumeScalar(*batch[0].scalar);
   }
 
+  // Run lengths don't change the min and max, so only the values of the runs
+  // covered by the span are consumed.  The count is still that of logical
+  // values, as min_count applies to them.
+  Status ConsumeRunEndEncoded(const ArraySpan& span) {
+    ArraySpan values = ree_util::ValuesArray(span);
+    values.SetSlice(values.offset + ree_util::FindPhysicalOffset(span),
+                    ree_util::FindPhysicalLength(span));
+    const int64_t count_before = this->count;
+    RETURN_NOT_OK(ConsumeArray(values));
+    this->count = count_before + span.length - ree_util::LogicalNullCount(span);
+    return Status::OK();
+  }
+
   Status ConsumeScalar(const Scalar& scalar) {
     StateType local;
     local.has_nulls = !scalar.is_valid;
@@ -19,9 +19,11 @@
 
 #include <vector>
 
+#include "arrow/array/array_dict.h"
 #include "arrow/array/array_primitive.h"
 #include "arrow/compute/api.h"
 #include "arrow/compute/exec/aggregate.h"
+#include "arrow/compute/row/grouper.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
@@ -517,6 +519,124 @@ GROUP_BY_BENCHMARK(MinMaxLongStringsGroupedByMediumInt, [&] {
   BenchmarkGroupBy(state, {{"hash_min_max", NULLPTR}}, {input}, {int_key});
 });
 
+// Grouped integer aggregates across key cardinalities, with keys in random order
+// or sorted (so that equal keys arrive in runs)
+
+static void GroupByIntegerCardinality(benchmark::State& state,
+                                      const std::string& function, bool sorted_keys) {
+  RegressionArgs args(state, false);
+  const int64_t num_groups = state.range(2);
+  auto rng = random::RandomArrayGenerator(1923);
+
+  auto input = rng.Int64(args.size,
+                         /*min=*/-1000,
+                         /*max=*/1000,
+                         /*null_probability=*/args.null_proportion);
+  Datum key = rng.Int64(args.size, /*min=*/0, /*max=*/num_groups - 1);
+  if (sorted_keys) {
+    ASSIGN_OR_ABORT(auto indices, SortIndices(*key.make_array()));
+    ASSIGN_OR_ABORT(key, Take(key, indices));
+  }
+
+  BenchmarkGroupBy(state, {{function, NULLPTR}}, {input}, {key});
+}
+
+static void GroupByIntegerCardinalityArgs(benchmark::internal::Benchmark* bench) {
+  bench->Unit(benchmark::kMicrosecond);
+  for (const ArgsType num_groups : {1, 4, 16, 64, 256, 4096}) {
+    // 0 is treated as "no nulls"
+    for (const ArgsType inverse_null_proportion : {0, 10}) {
+      bench->Args({1 * 1024 * 1024, inverse_null_proportion, num_groups});
+    }
+  }
+}
+
+#define GROUP_BY_CARDINALITY_BENCHMARK(Name, Function, SortedKeys) \
+  static void Name(benchmark::State& state) {                      \
+    GroupByIntegerCardinality(state, Function, SortedKeys);        \
+  }                                                                \
+  BENCHMARK(Name)->Apply(GroupByIntegerCardinalityArgs)
+
+GROUP_BY_CARDINALITY_BENCHMARK(SumInt64sGroupedByRandomKeys, "hash_sum", false);
+GROUP_BY_CARDINALITY_BENCHMARK(SumInt64sGroupedBySortedKeys, "hash_sum", true);
+GROUP_BY_CARDINALITY_BENCHMARK(MeanInt64sGroupedByRandomKeys, "hash_mean", false);
+GROUP_BY_CARDINALITY_BENCHMARK(MeanInt64sGroupedBySortedKeys, "hash_mean", true);
+GROUP_BY_CARDINALITY_BENCHMARK(MinMaxInt64sGroupedByRandomKeys, "hash_min_max", false);
+GROUP_BY_CARDINALITY_BENCHMARK(MinMaxInt64sGroupedBySortedKeys, "hash_min_max", true);
+
+//
+// Grouper
+//
+
+// Integer, boolean and dictionary keys are grouped by addressing a table directly
+// while the range of key values is small, and hashed once it grows too large
+
+static void BenchmarkGrouper(benchmark::State& state, const std::vector<Datum>& keys) {
+  ASSIGN_OR_ABORT(auto key_batch, ExecBatch::Make(keys));
+  for (auto _ : state) {
+    ASSIGN_OR_ABORT(auto grouper, Grouper::Make(key_batch.GetTypes()));
+    ABORT_NOT_OK(grouper->Consume(ExecSpan(key_batch)).status());
+  }
+  state.SetItemsProcessed(state.iterations() * key_batch.length);
+}
+
+static void GrouperInt64Keys(benchmark::State& state) {
+  RegressionArgs args(state, false);
+  const int64_t key_range = state.range(2);
+  auto rng = random::RandomArrayGenerator(1923);
+
+  auto key = rng.Int64(args.size, /*min=*/0, /*max=*/key_range - 1,
+                       /*null_probability=*/args.null_proportion);
+  BenchmarkGrouper(state, {key});
+}
+
+static void GrouperInt32PairKeys(benchmark::State& state) {
+  RegressionArgs args(state, false);
+  const int64_t key_range = state.range(2);
+  auto rng = random::RandomArrayGenerator(1923);
+
+  auto key0 = rng.Int32(args.size, /*min=*/0, /*max=*/static_cast<int32_t>(key_range - 1),
+                        /*null_probability=*/args.null_proportion);
+  auto key1 = rng.Int32(args.size, /*min=*/0, /*max=*/static_cast<int32_t>(key_range - 1),
+                        /*null_probability=*/args.null_proportion);
+  BenchmarkGrouper(state, {key0, key1});
+}
+
+static void GrouperDictionaryKeys(benchmark::State& state) {
+  RegressionArgs args(state, false);
+  const int64_t num_values = state.range(2);
+  auto rng = random::RandomArrayGenerator(1923);
+
+  auto dict = rng.String(num_values, /*min_length=*/3, /*max_length=*/32);
+  auto indices = rng.Int32(args.size, /*min=*/0,
+                           /*max=*/static_cast<int32_t>(num_values - 1),
+                           /*null_probability=*/args.null_proportion);
+  ASSIGN_OR_ABORT(auto key, DictionaryArray::FromArrays(dictionary(int32(), utf8()),
+                                                        indices, dict));
+  BenchmarkGrouper(state, {key});
+}
+
+static void GrouperKeyRangeArgs(benchmark::internal::Benchmark* bench,
+                                std::vector<ArgsType> key_ranges) {
+  bench->Unit(benchmark::kMicrosecond);
+  for (const ArgsType key_range : key_ranges) {
+    // 0 is treated as "no nulls"
+    for (const ArgsType inverse_null_proportion : {0, 10}) {
+      bench->Args({1 * 1024 * 1024, inverse_null_proportion, key_range});
+    }
+  }
+}
+
+BENCHMARK(GrouperInt64Keys)->Apply([](benchmark::internal::Benchmark* bench) {
+  GrouperKeyRangeArgs(bench, {16, 256, 4096, 65536, 1 << 20});
+});
+BENCHMARK(GrouperInt32PairKeys)->Apply([](benchmark::internal::Benchmark* bench) {
+  GrouperKeyRangeArgs(bench, {4, 16, 256, 4096});
+});
+BENCHMARK(GrouperDictionaryKeys)->Apply([](benchmark::internal::Benchmark* bench) {
+  GrouperKeyRangeArgs(bench, {16, 256, 4096});
+});
+
 //
 // Sum
 //
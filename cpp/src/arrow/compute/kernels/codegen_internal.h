@@ -135,6 +135,7 @@ struct GetViewType<Type, enable_if_has_c_type<Type>> {
 
 template <typename Type>
 struct GetViewType<Type, enable_if_t<is_base_binary_type<Type>::value ||
+                                     is_binary_view_like_type<Type>::value ||
                                      is_fixed_size_binary_type<Type>::value>> {
   using T = util::string_view;
   using PhysicalType = T;
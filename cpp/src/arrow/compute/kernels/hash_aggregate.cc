@@ -221,6 +221,65 @@ void VisitGroupedValuesNonNull(const ExecSpan& batch, ConsumeValue&& valid_func)
                            [](uint32_t) {});
 }
 
+// Visit the slots of an array a block of the validity bitmap at a time: runs of
+// valid slots are passed whole to block_func(offset, length), so that they can be
+// accumulated without null checks, and the other slots individually to
+// valid_func(index) or null_func(index).
+template <typename ConsumeBlock, typename ConsumeValue, typename ConsumeNull>
+void VisitGroupedValueBlocks(const ArraySpan& input, ConsumeBlock&& block_func,
+                             ConsumeValue&& valid_func, ConsumeNull&& null_func) {
+  const uint8_t* bitmap = input.buffers[0].data;
+  arrow::internal::OptionalBitBlockCounter bit_counter(bitmap, input.offset,
+                                                       input.length);
+  int64_t position = 0;
+  while (position < input.length) {
+    const auto block = bit_counter.NextBlock();
+    if (block.AllSet()) {
+      block_func(position, block.length);
+    } else if (block.NoneSet()) {
+      for (int64_t i = position; i < position + block.length; ++i) {
+        null_func(i);
+      }
+    } else {
+      for (int64_t i = position; i < position + block.length; ++i) {
+        if (bit_util::GetBit(bitmap, input.offset + i)) {
+          valid_func(i);
+        } else {
+          null_func(i);
+        }
+      }
+    }
+    position += block.length;
+  }
+}
+
+// Whether group ids mostly arrive in runs (for example when the input is sorted or
+// clustered on the keys), so that each run is better accumulated in a register
+// before updating its group
+inline bool HasLongGroupIdRuns(const uint32_t* g, int64_t length) {
+  constexpr int64_t kMinAverageRunLength = 4;
+  int64_t num_runs = 1;
+  for (int64_t i = 1; i < length; ++i) {
+    num_runs += g[i] != g[i - 1];
+  }
+  return num_runs * kMinAverageRunLength <= length;
+}
+
+// Call run_func(group, begin, end) for each run of equal group ids in g[0:length)
+template <typename ConsumeRun>
+void VisitGroupIdRuns(const uint32_t* g, int64_t length, ConsumeRun&& run_func) {
+  int64_t begin = 0;
+  while (begin < length) {
+    const uint32_t group = g[begin];
+    int64_t end = begin + 1;
+    while (end < length && g[end] == group) {
+      ++end;
+    }
+    run_func(group, begin, end);
+    begin = end;
+  }
+}
+
 // ----------------------------------------------------------------------
 // Count implementation
 
@@ -339,7 +398,24 @@ struct GroupedReducingAggregator : public GroupedAggregator {
     return Status::OK();
   }
 
-  Status Consume(const ExecSpan& batch) override {
+  Status Consume(const ExecSpan& batch) override { return ConsumeImpl(batch); }
+
+  // Boolean values are bit-packed: visit them one by one
+  template <typename T = Type>
+  enable_if_boolean<T, Status> ConsumeImpl(const ExecSpan& batch) {
+    return ConsumeValues(batch);
+  }
+
+  template <typename T = Type>
+  enable_if_t<!is_boolean_type<T>::value, Status> ConsumeImpl(const ExecSpan& batch) {
+    if (batch[0].is_array()) {
+      ConsumeArray(batch[0].array, batch[1].array.GetValues<uint32_t>(1));
+      return Status::OK();
+    }
+    return ConsumeValues(batch);
+  }
+
+  Status ConsumeValues(const ExecSpan& batch) {
     CType* reduced = reduced_.mutable_data();
     int64_t* counts = counts_.mutable_data();
     uint8_t* no_nulls = no_nulls_.mutable_data();
@@ -354,6 +430,80 @@ struct GroupedReducingAggregator : public GroupedAggregator {
     return Status::OK();
   }
 
+  // Consume an array of fixed-width values, accumulating runs of valid values
+  // without per-value null checks
+  void ConsumeArray(const ArraySpan& input, const uint32_t* g) {
+    const InputCType* values = input.GetValues<InputCType>(1);
+    CType* reduced = reduced_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    uint8_t* no_nulls = no_nulls_.mutable_data();
+    const DataType& out_type = *out_type_;
+
+    // With few groups, consecutive values often update the same group, and each
+    // update has to wait for the previous one. Instead, spread consecutive values
+    // over kNumLanes partial accumulators per group, combined at the end.
+    const bool use_lanes =
+        num_groups_ <= kMaxLaneGroups && input.length >= kNumLanes * num_groups_;
+    if (use_lanes) {
+      lane_reduced_.assign(kNumLanes * num_groups_, Impl::NullValue(out_type));
+      lane_counts_.assign(kNumLanes * num_groups_, 0);
+    }
+    CType* lane_reduced = lane_reduced_.data();
+    int64_t* lane_counts = lane_counts_.data();
+
+    auto reduce_one = [&](uint32_t group, InputCType value) {
+      reduced[group] = Impl::Reduce(out_type, reduced[group], value);
+      counts[group]++;
+    };
+
+    VisitGroupedValueBlocks(
+        input,
+        [&](int64_t offset, int64_t length) {
+          const InputCType* block_values = values + offset;
+          const uint32_t* block_g = g + offset;
+
+          if (HasLongGroupIdRuns(block_g, length)) {
+            VisitGroupIdRuns(block_g, length,
+                             [&](uint32_t group, int64_t begin, int64_t end) {
+                               CType acc = reduced[group];
+                               for (int64_t i = begin; i < end; ++i) {
+                                 acc = Impl::Reduce(out_type, acc, block_values[i]);
+                               }
+                               reduced[group] = acc;
+                               counts[group] += end - begin;
+                             });
+            return;
+          }
+
+          int64_t i = 0;
+          if (use_lanes) {
+            for (; i + kNumLanes <= length; i += kNumLanes) {
+              for (int64_t lane = 0; lane < kNumLanes; ++lane) {
+                const int64_t slot = lane * num_groups_ + block_g[i + lane];
+                lane_reduced[slot] =
+                    Impl::Reduce(out_type, lane_reduced[slot], block_values[i + lane]);
+                lane_counts[slot]++;
+              }
+            }
+          }
+          for (; i < length; ++i) {
+            reduce_one(block_g[i], block_values[i]);
+          }
+        },
+        [&](int64_t i) { reduce_one(g[i], values[i]); },
+        [&](int64_t i) { bit_util::ClearBit(no_nulls, g[i]); });
+
+    if (use_lanes) {
+      for (int64_t lane = 0; lane < kNumLanes; ++lane) {
+        for (int64_t group = 0; group < num_groups_; ++group) {
+          const int64_t slot = lane * num_groups_ + group;
+          reduced[group] = Impl::Reduce(out_type, reduced[group], lane_reduced[slot]);
+          counts[group] += lane_counts[slot];
+        }
+      }
+    }
+  }
+
   Status Merge(GroupedAggregator&& raw_other,
                const ArrayData& group_id_mapping) override {
     auto other = checked_cast<GroupedReducingAggregator<Type, Impl>*>(&raw_other);
@@ -436,11 +586,17 @@ struct GroupedReducingAggregator : public GroupedAggregator {
     return in_type;
   }
 
+  static constexpr int64_t kNumLanes = 4;
+  static constexpr int64_t kMaxLaneGroups = 256;
+
   int64_t num_groups_ = 0;
   ScalarAggregateOptions options_;
   TypedBufferBuilder<CType> reduced_;
   TypedBufferBuilder<int64_t> counts_;
   TypedBufferBuilder<bool> no_nulls_;
+  // Scratch space for the partial accumulators of ConsumeArray
+  std::vector<CType> lane_reduced_;
+  std::vector<int64_t> lane_counts_;
   std::shared_ptr<DataType> out_type_;
   MemoryPool* pool_;
 };
@@ -1263,7 +1419,24 @@ struct GroupedMinMaxImpl final : public GroupedAggregator {
     return Status::OK();
   }
 
-  Status Consume(const ExecSpan& batch) override {
+  Status Consume(const ExecSpan& batch) override { return ConsumeImpl(batch); }
+
+  // Boolean values are bit-packed: visit them one by one
+  template <typename T = Type>
+  enable_if_boolean<T, Status> ConsumeImpl(const ExecSpan& batch) {
+    return ConsumeValues(batch);
+  }
+
+  template <typename T = Type>
+  enable_if_t<!is_boolean_type<T>::value, Status> ConsumeImpl(const ExecSpan& batch) {
+    if (batch[0].is_array()) {
+      ConsumeArray(batch[0].array, batch[1].array.GetValues<uint32_t>(1));
+      return Status::OK();
+    }
+    return ConsumeValues(batch);
+  }
+
+  Status ConsumeValues(const ExecSpan& batch) {
     auto raw_mins = mins_.mutable_data();
     auto raw_maxes = maxes_.mutable_data();
 
@@ -1278,6 +1451,50 @@ struct GroupedMinMaxImpl final : public GroupedAggregator {
     return Status::OK();
   }
 
+  // Consume an array of fixed-width values, accumulating runs of valid values
+  // without per-value null checks
+  void ConsumeArray(const ArraySpan& input, const uint32_t* g) {
+    const CType* values = input.GetValues<CType>(1);
+    CType* raw_mins = mins_.mutable_data();
+    CType* raw_maxes = maxes_.mutable_data();
+    uint8_t* has_values = has_values_.mutable_data();
+    uint8_t* has_nulls = has_nulls_.mutable_data();
+
+    auto update_one = [&](uint32_t group, CType value) {
+      raw_mins[group] = std::min(raw_mins[group], value);
+      raw_maxes[group] = std::max(raw_maxes[group], value);
+      bit_util::SetBit(has_values, group);
+    };
+
+    VisitGroupedValueBlocks(
+        input,
+        [&](int64_t offset, int64_t length) {
+          const CType* block_values = values + offset;
+          const uint32_t* block_g = g + offset;
+
+          if (HasLongGroupIdRuns(block_g, length)) {
+            VisitGroupIdRuns(block_g, length,
+                             [&](uint32_t group, int64_t begin, int64_t end) {
+                               CType min = raw_mins[group];
+                               CType max = raw_maxes[group];
+                               for (int64_t i = begin; i < end; ++i) {
+                                 min = std::min(min, block_values[i]);
+                                 max = std::max(max, block_values[i]);
+                               }
+                               raw_mins[group] = min;
+                               raw_maxes[group] = max;
+                               bit_util::SetBit(has_values, group);
+                             });
+            return;
+          }
+          for (int64_t i = 0; i < length; ++i) {
+            update_one(block_g[i], block_values[i]);
+          }
+        },
+        [&](int64_t i) { update_one(g[i], values[i]); },
+        [&](int64_t i) { bit_util::SetBit(has_nulls, g[i]); });
+  }
+
   Status Merge(GroupedAggregator&& raw_other,
                const ArrayData& group_id_mapping) override {
     auto other = checked_cast<GroupedMinMaxImpl*>(&raw_other);
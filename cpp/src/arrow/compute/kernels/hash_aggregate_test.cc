@@ -485,6 +485,44 @@ TEST(Grouper, NumericKey) {
   }
 }
 
+TEST(Grouper, IntegerKeyRange) {
+  for (auto ty : {int8(), uint16(), int32(), uint64(), int64()}) {
+    SCOPED_TRACE("key type: " + ty->ToString());
+
+    TestGrouper g({ty});
+
+    g.ExpectConsume("[[3], [5], [3]]", "[0, 1, 0]");
+
+    // keys outside of the range observed so far
+    g.ExpectConsume("[[100], [null], [5], [0]]", "[2, 3, 1, 4]");
+    g.ExpectUniques("[[3], [5], [100], [null], [0]]");
+  }
+
+  // keys spanning too large a range for direct addressing
+  TestGrouper g({int64()});
+
+  g.ExpectConsume("[[3], [5], [null], [3]]", "[0, 1, 2, 0]");
+
+  g.ExpectConsume("[[9223372036854775807], [5], [-9223372036854775808], [null]]",
+                  "[3, 1, 4, 2]");
+  g.ExpectUniques("[[3], [5], [null], [9223372036854775807], [-9223372036854775808]]");
+
+  g.ExpectConsume("[[-9223372036854775808], [3], [7]]", "[4, 0, 5]");
+  g.ExpectUniques(
+      "[[3], [5], [null], [9223372036854775807], [-9223372036854775808], [7]]");
+}
+
+TEST(Grouper, RandomSmallIntegerKeys) {
+  TestGrouper g({int8(), boolean(), uint8()});
+  for (int i = 0; i < 4; ++i) {
+    SCOPED_TRACE(std::to_string(i) + "th key batch");
+
+    ExecBatch key_batch{
+        *random::GenerateBatch(g.key_schema_->fields(), 1 << 12, 0xDEADBEEF)};
+    g.ConsumeAndValidate(key_batch);
+  }
+}
+
 TEST(Grouper, FloatingPointKey) {
   TestGrouper g({float32()});
 
@@ -3543,6 +3581,40 @@ TEST(GroupBy, RandomArraySum) {
   }
 }
 
+TEST(GroupBy, RandomArraySumClusteredKeys) {
+  // Exercise accumulation of runs of equal keys and of few groups
+  std::shared_ptr<ScalarAggregateOptions> options =
+      std::make_shared<ScalarAggregateOptions>(/*skip_nulls=*/true, /*min_count=*/0);
+  for (int64_t max_key : {0, 3, 100, 1000}) {
+    for (auto null_probability : {0.0, 0.1, 1.0}) {
+      auto batch = random::GenerateBatch(
+          {
+              field("argument", int64(),
+                    key_value_metadata(
+                        {"null_probability", "min", "max"},
+                        {std::to_string(null_probability), "-1000", "1000"})),
+              field("key", int64(),
+                    key_value_metadata({{"min", "0"}, {"max", std::to_string(max_key)}})),
+          },
+          1 << 12, 0xDEADBEEF);
+
+      for (bool sorted : {false, true}) {
+        ARROW_SCOPED_TRACE("max_key = ", max_key, ", null_probability = ",
+                           null_probability, ", sorted = ", sorted);
+        if (sorted) {
+          ASSERT_OK_AND_ASSIGN(auto indices,
+                               SortIndices(*batch->GetColumnByName("key")));
+          ASSERT_OK_AND_ASSIGN(Datum sorted_batch, Take(batch, indices));
+          batch = sorted_batch.record_batch();
+        }
+        ValidateGroupBy({{"hash_sum", options, "agg_0", "hash_sum"}},
+                        {batch->GetColumnByName("argument")},
+                        {batch->GetColumnByName("key")});
+      }
+    }
+  }
+}
+
 TEST(GroupBy, WithChunkedArray) {
   auto table =
       TableFromJSON(schema({field("argument", float64()), field("key", int64())}),
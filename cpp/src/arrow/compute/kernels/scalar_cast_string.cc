@@ -24,6 +24,7 @@
 #include "arrow/compute/kernels/scalar_cast_internal.h"
 #include "arrow/compute/kernels/temporal_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/formatting.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/optional.h"
@@ -362,6 +363,149 @@ BinaryToBinaryCastExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* ou
   return ZeroCopyCastExec(ctx, batch, out);
 }
 
+// ----------------------------------------------------------------------
+// Binary views
+
+// Copy the validity bitmap of `input` into `output`, zero-copy where possible
+Status CopyValidityBitmap(KernelContext* ctx, const ArraySpan& input, ArrayData* output) {
+  output->length = input.length;
+  output->SetNullCount(input.null_count);
+  if (input.buffers[0].data == nullptr) {
+    output->buffers[0] = nullptr;
+  } else if (input.offset == output->offset) {
+    output->buffers[0] = input.GetBuffer(0);
+  } else {
+    ARROW_ASSIGN_OR_RAISE(
+        output->buffers[0],
+        arrow::internal::CopyBitmap(ctx->memory_pool(), input.buffers[0].data,
+                                    input.offset, input.length));
+  }
+  return Status::OK();
+}
+
+// Cast (Large)Binary / (Large)String to BinaryView / StringView.
+//
+// The views reference the input's data buffer, so the cast does not copy any
+// values unless the input does not own its data (e.g. a promoted Scalar).
+template <typename O, typename I>
+Status BinaryToBinaryViewCastExec(KernelContext* ctx, const ExecSpan& batch,
+                                  ExecResult* out) {
+  using offset_type = typename I::offset_type;
+  const CastOptions& options = checked_cast<const CastState&>(*ctx->state()).options;
+  const ArraySpan& input = batch[0].array;
+
+  if (!I::is_utf8 && O::is_utf8 && !options.allow_invalid_utf8) {
+    InitializeUTF8();
+    ArraySpanVisitor<I> visitor;
+    Utf8Validator validator;
+    RETURN_NOT_OK(visitor.Visit(input, &validator));
+  }
+
+  const offset_type* offsets = input.GetValues<offset_type>(1);
+  const offset_type data_offset = offsets[0];
+  const int64_t data_length = offsets[input.length] - data_offset;
+  // View offsets are 32-bit
+  if (data_length > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Failed casting from ", input.type->ToString(), " to ",
+                           out->type()->ToString(), ": input array too large");
+  }
+
+  std::shared_ptr<Buffer> data_buffer;
+  if (input.buffers[2].owner != nullptr) {
+    data_buffer = SliceBuffer(*input.buffers[2].owner, data_offset, data_length);
+  } else {
+    ARROW_ASSIGN_OR_RAISE(data_buffer, ctx->Allocate(data_length));
+    if (data_length > 0) {
+      std::memcpy(data_buffer->mutable_data(), input.buffers[2].data + data_offset,
+                  data_length);
+    }
+  }
+
+  ArrayData* output = out->array_data().get();
+  RETURN_NOT_OK(CopyValidityBitmap(ctx, input, output));
+  ARROW_ASSIGN_OR_RAISE(output->buffers[1],
+                        ctx->Allocate(input.length * BinaryViewType::kSize));
+  auto* views = output->GetMutableValues<BinaryViewType::c_type>(1);
+  bool data_buffer_referenced = false;
+  for (int64_t i = 0; i < input.length; ++i) {
+    if (input.IsNull(i)) {
+      views[i] = {};
+      continue;
+    }
+    const auto offset = static_cast<int32_t>(offsets[i] - data_offset);
+    const auto size = static_cast<int32_t>(offsets[i + 1] - offsets[i]);
+    views[i] = util::ToBinaryView(data_buffer->data() + offset, size,
+                                  /*buffer_index=*/0, offset);
+    data_buffer_referenced |= !views[i].is_inline();
+  }
+  if (data_buffer_referenced) {
+    output->buffers.push_back(std::move(data_buffer));
+  }
+  return Status::OK();
+}
+
+// Cast BinaryView / StringView to (Large)Binary / (Large)String
+template <typename O, typename I>
+Status BinaryViewToBinaryCastExec(KernelContext* ctx, const ExecSpan& batch,
+                                  ExecResult* out) {
+  using offset_type = typename O::offset_type;
+  const CastOptions& options = checked_cast<const CastState&>(*ctx->state()).options;
+  const ArraySpan& input = batch[0].array;
+
+  if (!I::is_utf8 && O::is_utf8 && !options.allow_invalid_utf8) {
+    InitializeUTF8();
+    ArraySpanVisitor<I> visitor;
+    Utf8Validator validator;
+    RETURN_NOT_OK(visitor.Visit(input, &validator));
+  }
+
+  const auto* views = input.GetValues<BinaryViewType::c_type>(1);
+  const std::shared_ptr<Buffer>* data_buffers = input.GetVariadicBuffers();
+  int64_t data_length = 0;
+  for (int64_t i = 0; i < input.length; ++i) {
+    if (input.IsValid(i)) {
+      data_length += views[i].size();
+    }
+  }
+  if (data_length > std::numeric_limits<offset_type>::max()) {
+    return Status::Invalid("Failed casting from ", input.type->ToString(), " to ",
+                           out->type()->ToString(), ": input array too large");
+  }
+
+  ArrayData* output = out->array_data().get();
+  RETURN_NOT_OK(CopyValidityBitmap(ctx, input, output));
+  ARROW_ASSIGN_OR_RAISE(output->buffers[1],
+                        ctx->Allocate((input.length + 1) * sizeof(offset_type)));
+  ARROW_ASSIGN_OR_RAISE(output->buffers[2], ctx->Allocate(data_length));
+  auto* out_offsets = output->GetMutableValues<offset_type>(1);
+  uint8_t* out_data = output->buffers[2]->mutable_data();
+  out_offsets[0] = 0;
+  for (int64_t i = 0; i < input.length; ++i) {
+    offset_type size = 0;
+    if (input.IsValid(i)) {
+      size = views[i].size();
+      std::memcpy(out_data + out_offsets[i], util::BinaryViewData(views[i], data_buffers),
+                  size);
+    }
+    out_offsets[i + 1] = out_offsets[i] + size;
+  }
+  return Status::OK();
+}
+
+// Cast between BinaryView and StringView, zero-copy
+template <typename O, typename I>
+Status BinaryViewToBinaryViewCastExec(KernelContext* ctx, const ExecSpan& batch,
+                                      ExecResult* out) {
+  const CastOptions& options = checked_cast<const CastState&>(*ctx->state()).options;
+  if (!I::is_utf8 && O::is_utf8 && !options.allow_invalid_utf8) {
+    InitializeUTF8();
+    ArraySpanVisitor<I> visitor;
+    Utf8Validator validator;
+    RETURN_NOT_OK(visitor.Visit(batch[0].array, &validator));
+  }
+  return ZeroCopyCastExec(ctx, batch, out);
+}
+
 #if defined(_MSC_VER)
 #pragma warning(pop)
 #endif
@@ -414,23 +558,59 @@ void AddBinaryToBinaryCast(CastFunction* func) {
   AddBinaryToBinaryCast<OutType, FixedSizeBinaryType>(func);
 }
 
+template <typename OutType, typename InType>
+void AddBinaryViewCast(CastFunction* func, ArrayKernelExec exec) {
+  auto out_ty = TypeTraits<OutType>::type_singleton();
+
+  DCHECK_OK(func->AddKernel(InType::type_id, {InputType(InType::type_id)}, out_ty, exec,
+                            NullHandling::COMPUTED_NO_PREALLOCATE,
+                            MemAllocation::NO_PREALLOCATE));
+}
+
+template <typename OutType>
+void AddBinaryToBinaryViewCast(CastFunction* func) {
+  AddBinaryViewCast<OutType, StringType>(
+      func, BinaryToBinaryViewCastExec<OutType, StringType>);
+  AddBinaryViewCast<OutType, BinaryType>(
+      func, BinaryToBinaryViewCastExec<OutType, BinaryType>);
+  AddBinaryViewCast<OutType, LargeStringType>(
+      func, BinaryToBinaryViewCastExec<OutType, LargeStringType>);
+  AddBinaryViewCast<OutType, LargeBinaryType>(
+      func, BinaryToBinaryViewCastExec<OutType, LargeBinaryType>);
+  AddBinaryViewCast<OutType, StringViewType>(
+      func, BinaryViewToBinaryViewCastExec<OutType, StringViewType>);
+  AddBinaryViewCast<OutType, BinaryViewType>(
+      func, BinaryViewToBinaryViewCastExec<OutType, BinaryViewType>);
+}
+
+template <typename OutType>
+void AddBinaryViewToBinaryCast(CastFunction* func) {
+  AddBinaryViewCast<OutType, StringViewType>(
+      func, BinaryViewToBinaryCastExec<OutType, StringViewType>);
+  AddBinaryViewCast<OutType, BinaryViewType>(
+      func, BinaryViewToBinaryCastExec<OutType, BinaryViewType>);
+}
+
 }  // namespace
 
 std::vector<std::shared_ptr<CastFunction>> GetBinaryLikeCasts() {
   auto cast_binary = std::make_shared<CastFunction>("cast_binary", Type::BINARY);
   AddCommonCasts(Type::BINARY, binary(), cast_binary.get());
   AddBinaryToBinaryCast<BinaryType>(cast_binary.get());
+  AddBinaryViewToBinaryCast<BinaryType>(cast_binary.get());
 
   auto cast_large_binary =
       std::make_shared<CastFunction>("cast_large_binary", Type::LARGE_BINARY);
   AddCommonCasts(Type::LARGE_BINARY, large_binary(), cast_large_binary.get());
   AddBinaryToBinaryCast<LargeBinaryType>(cast_large_binary.get());
+  AddBinaryViewToBinaryCast<LargeBinaryType>(cast_large_binary.get());
 
   auto cast_string = std::make_shared<CastFunction>("cast_string", Type::STRING);
   AddCommonCasts(Type::STRING, utf8(), cast_string.get());
   AddNumberToStringCasts<StringType>(cast_string.get());
   AddTemporalToStringCasts<StringType>(cast_string.get());
   AddBinaryToBinaryCast<StringType>(cast_string.get());
+  AddBinaryViewToBinaryCast<StringType>(cast_string.get());
 
   auto cast_large_string =
       std::make_shared<CastFunction>("cast_large_string", Type::LARGE_STRING);
@@ -438,6 +618,17 @@ std::vector<std::shared_ptr<CastFunction>> GetBinaryLikeCasts() {
   AddNumberToStringCasts<LargeStringType>(cast_large_string.get());
   AddTemporalToStringCasts<LargeStringType>(cast_large_string.get());
   AddBinaryToBinaryCast<LargeStringType>(cast_large_string.get());
+  AddBinaryViewToBinaryCast<LargeStringType>(cast_large_string.get());
+
+  auto cast_binary_view =
+      std::make_shared<CastFunction>("cast_binary_view", Type::BINARY_VIEW);
+  AddCommonCasts(Type::BINARY_VIEW, binary_view(), cast_binary_view.get());
+  AddBinaryToBinaryViewCast<BinaryViewType>(cast_binary_view.get());
+
+  auto cast_string_view =
+      std::make_shared<CastFunction>("cast_string_view", Type::STRING_VIEW);
+  AddCommonCasts(Type::STRING_VIEW, utf8_view(), cast_string_view.get());
+  AddBinaryToBinaryViewCast<StringViewType>(cast_string_view.get());
 
   auto cast_fsb =
       std::make_shared<CastFunction>("cast_fixed_size_binary", Type::FIXED_SIZE_BINARY);
@@ -449,7 +640,8 @@ std::vector<std::shared_ptr<CastFunction>> GetBinaryLikeCasts() {
       BinaryToBinaryCastExec<FixedSizeBinaryType, FixedSizeBinaryType>,
       NullHandling::COMPUTED_NO_PREALLOCATE));
 
-  return {cast_binary, cast_large_binary, cast_string, cast_large_string, cast_fsb};
+  return {cast_binary,      cast_large_binary, cast_string,     cast_large_string,
+          cast_binary_view, cast_string_view,  cast_fsb};
 }
 
 }  // namespace internal
@@ -2102,6 +2102,70 @@ TEST(Cast, StringToString) {
   }
 }
 
+TEST(Cast, BinaryToBinaryView) {
+  const char* values = R"(["short", null, "a value too long to be inlined", ""])";
+  for (auto from_type : {utf8(), large_utf8(), binary(), large_binary()}) {
+    for (auto to_type : {binary_view(), utf8_view()}) {
+      // empty -> empty always works
+      CheckCast(ArrayFromJSON(from_type, "[]"), ArrayFromJSON(to_type, "[]"));
+
+      auto input = ArrayFromJSON(from_type, values);
+      CheckCast(input, ArrayFromJSON(to_type, values));
+
+      // Values which are not inlined reference the data buffer of the input
+      ASSERT_OK_AND_ASSIGN(auto views, Cast(*input, to_type));
+      ValidateOutput(*views);
+      ASSERT_EQ(views->data()->buffers.size(), 3);
+      ASSERT_EQ(views->data()->buffers[2]->data(), input->data()->buffers[2]->data());
+
+      // invalid utf-8 masked by a null bit is not an error
+      CheckCast(MaskArrayWithNullsAt(InvalidUtf8(from_type), {4}),
+                MaskArrayWithNullsAt(InvalidUtf8(to_type), {4}));
+    }
+  }
+
+  for (auto from_type : {binary(), large_binary()}) {
+    auto options = CastOptions::Safe(utf8_view());
+    CheckCastFails(InvalidUtf8(from_type), options);
+
+    options.allow_invalid_utf8 = true;
+    ASSERT_OK_AND_ASSIGN(auto strings,
+                         Cast(*InvalidUtf8(from_type), utf8_view(), options));
+    ASSERT_RAISES(Invalid, strings->ValidateFull());
+  }
+}
+
+TEST(Cast, BinaryViewToBinary) {
+  const char* values = R"(["short", null, "a value too long to be inlined", ""])";
+  for (auto from_type : {binary_view(), utf8_view()}) {
+    for (auto to_type : {utf8(), large_utf8(), binary(), large_binary()}) {
+      // empty -> empty always works
+      CheckCast(ArrayFromJSON(from_type, "[]"), ArrayFromJSON(to_type, "[]"));
+
+      CheckCast(ArrayFromJSON(from_type, values), ArrayFromJSON(to_type, values));
+
+      // invalid utf-8 masked by a null bit is not an error
+      CheckCast(MaskArrayWithNullsAt(InvalidUtf8(from_type), {4}),
+                MaskArrayWithNullsAt(InvalidUtf8(to_type), {4}));
+    }
+  }
+
+  for (auto to_type : {utf8(), large_utf8()}) {
+    CheckCastFails(InvalidUtf8(binary_view()), CastOptions::Safe(to_type));
+  }
+}
+
+TEST(Cast, BinaryViewToBinaryView) {
+  auto strings =
+      ArrayFromJSON(utf8_view(), R"(["short", null, "a value too long to be inlined"])");
+  CheckCastZeroCopy(strings, binary_view());
+
+  auto invalid_utf8 = InvalidUtf8(binary_view());
+  CheckCastFails(invalid_utf8, CastOptions::Safe(utf8_view()));
+  CheckCast(MaskArrayWithNullsAt(invalid_utf8, {4}),
+            MaskArrayWithNullsAt(InvalidUtf8(utf8_view()), {4}));
+}
+
 TEST(Cast, IntToString) {
   for (auto string_type : {utf8(), large_utf8()}) {
     CheckCast(ArrayFromJSON(int8(), "[0, 1, 127, -128, null]"),
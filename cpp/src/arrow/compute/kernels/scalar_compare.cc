@@ -19,9 +19,13 @@
 #include <cmath>
 #include <limits>
 
+#include "arrow/array/array_run_end.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_generate.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/optional.h"
 
@@ -309,6 +313,89 @@ struct CompareTimestamps {
   }
 };
 
+template <typename Op>
+struct CompareBinaryViewValues;
+
+template <>
+struct CompareBinaryViewValues<Equal> {
+  static bool Call(const BinaryViewType::c_type& left,
+                   const std::shared_ptr<Buffer>* left_buffers,
+                   const BinaryViewType::c_type& right,
+                   const std::shared_ptr<Buffer>* right_buffers) {
+    return util::EqualBinaryView(left, left_buffers, right, right_buffers);
+  }
+};
+
+template <>
+struct CompareBinaryViewValues<NotEqual> {
+  static bool Call(const BinaryViewType::c_type& left,
+                   const std::shared_ptr<Buffer>* left_buffers,
+                   const BinaryViewType::c_type& right,
+                   const std::shared_ptr<Buffer>* right_buffers) {
+    return !util::EqualBinaryView(left, left_buffers, right, right_buffers);
+  }
+};
+
+template <>
+struct CompareBinaryViewValues<Greater> {
+  static bool Call(const BinaryViewType::c_type& left,
+                   const std::shared_ptr<Buffer>* left_buffers,
+                   const BinaryViewType::c_type& right,
+                   const std::shared_ptr<Buffer>* right_buffers) {
+    return util::CompareBinaryView(left, left_buffers, right, right_buffers) > 0;
+  }
+};
+
+template <>
+struct CompareBinaryViewValues<GreaterEqual> {
+  static bool Call(const BinaryViewType::c_type& left,
+                   const std::shared_ptr<Buffer>* left_buffers,
+                   const BinaryViewType::c_type& right,
+                   const std::shared_ptr<Buffer>* right_buffers) {
+    return util::CompareBinaryView(left, left_buffers, right, right_buffers) >= 0;
+  }
+};
+
+// Compare binary views directly, without materializing string_views: most
+// values are told apart by their inline size and prefix alone.
+template <typename Op>
+struct CompareBinaryViews {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    ArraySpan left_scalar, right_scalar;
+    if (!batch[0].is_array()) {
+      left_scalar.FillFromScalar(*batch[0].scalar);
+    }
+    if (!batch[1].is_array()) {
+      right_scalar.FillFromScalar(*batch[1].scalar);
+    }
+    const ArraySpan& left = batch[0].is_array() ? batch[0].array : left_scalar;
+    const ArraySpan& right = batch[1].is_array() ? batch[1].array : right_scalar;
+    // Scalars are broadcast by not advancing their position
+    const int64_t left_step = batch[0].is_array() ? 1 : 0;
+    const int64_t right_step = batch[1].is_array() ? 1 : 0;
+
+    const auto* left_views = left.GetValues<BinaryViewType::c_type>(1);
+    const auto* right_views = right.GetValues<BinaryViewType::c_type>(1);
+    const std::shared_ptr<Buffer>* left_buffers = left.GetVariadicBuffers();
+    const std::shared_ptr<Buffer>* right_buffers = right.GetVariadicBuffers();
+
+    ArraySpan* out_span = out->array_span();
+    int64_t left_index = 0, right_index = 0;
+    ::arrow::internal::GenerateBitsUnrolled(
+        out_span->buffers[1].data, out_span->offset, out_span->length, [&]() -> bool {
+          // The views of null slots are not looked into
+          const bool result = left.IsValid(left_index) && right.IsValid(right_index) &&
+                              CompareBinaryViewValues<Op>::Call(
+                                  left_views[left_index], left_buffers,
+                                  right_views[right_index], right_buffers);
+          left_index += left_step;
+          right_index += right_step;
+          return result;
+        });
+    return Status::OK();
+  }
+};
+
 template <typename Op>
 ScalarKernel GetCompareKernel(InputType ty, Type::type compare_type,
                               ArrayKernelExec exec) {
@@ -335,6 +422,20 @@ void AddPrimitiveCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* fu
   DCHECK_OK(func->AddKernel(kernel));
 }
 
+// If exactly one argument is run-end encoded, cast the other one to its value
+// type.  Return whether an argument is run-end encoded.
+bool CastToRunEndEncodedValueType(std::vector<TypeHolder>* types) {
+  const bool lhs_encoded = (*types)[0].id() == Type::RUN_END_ENCODED;
+  const bool rhs_encoded = (*types)[1].id() == Type::RUN_END_ENCODED;
+  if (lhs_encoded == rhs_encoded) {
+    return lhs_encoded;
+  }
+  const int encoded_index = lhs_encoded ? 0 : 1;
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*(*types)[encoded_index]);
+  (*types)[1 - encoded_index] = ree_type.value_type();
+  return true;
+}
+
 struct CompareFunction : ScalarFunction {
   using ScalarFunction::ScalarFunction;
 
@@ -347,6 +448,11 @@ struct CompareFunction : ScalarFunction {
     using arrow::compute::detail::DispatchExactImpl;
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
+    if (CastToRunEndEncodedValueType(types)) {
+      if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
+      return arrow::compute::detail::NoMatchingKernel(this, *types);
+    }
+
     EnsureDictionaryDecoded(types);
     ReplaceNullWithOtherType(types);
 
@@ -432,6 +538,10 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name, FunctionDo
     DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
   }
 
+  for (const std::shared_ptr<DataType>& ty : BinaryViewTypes()) {
+    DCHECK_OK(func->AddKernel({ty, ty}, boolean(), CompareBinaryViews<Op>::Exec));
+  }
+
   for (const auto id : {Type::DECIMAL128, Type::DECIMAL256}) {
     auto exec = GenerateDecimal<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(id);
     DCHECK_OK(
@@ -448,6 +558,85 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name, FunctionDo
   return func;
 }
 
+// ----------------------------------------------------------------------
+// Comparisons of run-end encoded arrays
+//
+// When comparing with a scalar, only the value of each run is compared and
+// the output reuses the runs of the input.  Otherwise the input is decoded,
+// compared and the result encoded again.
+
+struct RunEndEncodedCompareData : public KernelState {
+  explicit RunEndEncodedCompareData(std::string function_name)
+      : function_name(std::move(function_name)) {}
+  std::string function_name;
+};
+
+Result<TypeHolder> ResolveRunEndEncodedCompareOutput(
+    KernelContext*, const std::vector<TypeHolder>& types) {
+  const int encoded_index = types[0].id() == Type::RUN_END_ENCODED ? 0 : 1;
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*types[encoded_index]);
+  return run_end_encoded(ree_type.run_end_type(), boolean());
+}
+
+Status RunEndEncodedCompareExec(KernelContext* ctx, const ExecSpan& batch,
+                                ExecResult* out) {
+  const auto& function_name =
+      checked_cast<const RunEndEncodedCompareData&>(*ctx->kernel()->data).function_name;
+  const int encoded_index = batch[0].type()->id() == Type::RUN_END_ENCODED ? 0 : 1;
+  const int other_index = 1 - encoded_index;
+  RunEndEncodedArray encoded(batch[encoded_index].array.ToArrayData());
+  const auto& run_end_type = encoded.run_end_encoded_type()->run_end_type();
+
+  std::vector<Datum> args(2);
+  if (batch[other_index].is_scalar()) {
+    args[encoded_index] = encoded.LogicalValues();
+    args[other_index] = batch[other_index].scalar->GetSharedPtr();
+    ARROW_ASSIGN_OR_RAISE(Datum compared,
+                          CallFunction(function_name, args, ctx->exec_context()));
+    ARROW_ASSIGN_OR_RAISE(auto run_ends, encoded.LogicalRunEnds(ctx->memory_pool()));
+    auto result = ArrayData::Make(run_end_encoded(run_end_type, boolean()),
+                                  encoded.length(), {NULLPTR}, /*null_count=*/0);
+    result->child_data = {run_ends->data(), compared.array()};
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(args[encoded_index],
+                        RunEndDecode(encoded.data(), ctx->exec_context()));
+  args[other_index] = batch[other_index].array.ToArrayData();
+  ARROW_ASSIGN_OR_RAISE(Datum compared,
+                        CallFunction(function_name, args, ctx->exec_context()));
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        RunEndEncode(compared, RunEndEncodeOptions(run_end_type),
+                                     ctx->exec_context()));
+  out->value = result.array();
+  return Status::OK();
+}
+
+void AddRunEndEncodedCompare(ScalarFunction* func) {
+  std::vector<std::shared_ptr<DataType>> types = {boolean(), date32(), date64()};
+  for (const auto& ty : NumericTypes()) {
+    types.push_back(ty);
+  }
+  for (const auto& ty : BaseBinaryTypes()) {
+    types.push_back(ty);
+  }
+  auto data = std::make_shared<RunEndEncodedCompareData>(func->name());
+  for (const auto& ty : types) {
+    InputType encoded(match::RunEndEncoded(ty->id()));
+    InputType plain(ty->id());
+    for (auto&& in_types : {std::vector<InputType>{encoded, plain},
+                            std::vector<InputType>{plain, encoded}}) {
+      ScalarKernel kernel(in_types, OutputType(ResolveRunEndEncodedCompareOutput),
+                          RunEndEncodedCompareExec);
+      kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+      kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+      kernel.data = data;
+      DCHECK_OK(func->AddKernel(std::move(kernel)));
+    }
+  }
+}
+
 struct FlippedData : public CompareData {
   ArrayKernelExec unflipped_exec;
   explicit FlippedData(ArrayKernelExec unflipped_exec, BinaryKernel func_aa = nullptr,
@@ -887,16 +1076,21 @@ const FunctionDoc max_element_wise_doc{
 }  // namespace
 
 void RegisterScalarComparison(FunctionRegistry* registry) {
-  DCHECK_OK(registry->AddFunction(MakeCompareFunction<Equal>("equal", equal_doc)));
-  DCHECK_OK(
-      registry->AddFunction(MakeCompareFunction<NotEqual>("not_equal", not_equal_doc)));
-
+  auto equal = MakeCompareFunction<Equal>("equal", equal_doc);
+  auto not_equal = MakeCompareFunction<NotEqual>("not_equal", not_equal_doc);
   auto greater = MakeCompareFunction<Greater>("greater", greater_doc);
   auto greater_equal =
       MakeCompareFunction<GreaterEqual>("greater_equal", greater_equal_doc);
 
   auto less = MakeFlippedCompare("less", *greater, less_doc);
   auto less_equal = MakeFlippedCompare("less_equal", *greater_equal, less_equal_doc);
+  // Added after flipping, as these kernels call their function by name
+  for (auto func : {equal.get(), not_equal.get(), greater.get(), greater_equal.get(),
+                    less.get(), less_equal.get()}) {
+    AddRunEndEncodedCompare(func);
+  }
+  DCHECK_OK(registry->AddFunction(std::move(equal)));
+  DCHECK_OK(registry->AddFunction(std::move(not_equal)));
   DCHECK_OK(registry->AddFunction(std::move(less)));
   DCHECK_OK(registry->AddFunction(std::move(less_equal)));
   DCHECK_OK(registry->AddFunction(std::move(greater)));
@@ -1175,6 +1175,43 @@ TEST_F(TestStringCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TEST_F(TestStringCompareKernel, BinaryView) {
+  // Views are compared on their size and prefix first: check against the
+  // comparison of the same values as classic strings
+  const char* lhs_json =
+      R"(["", "abc", "abcd", "abcde", null, "abcdefghijklm", "abcdefghijklmnop", "b",
+          "abcdefghijklmnop", "abcdefghijklmnoq"])";
+  const char* rhs_json =
+      R"(["a", "abc", "abce", "abcd", "a", null, "abcdefghijklmnop", "abcd",
+          "abcdefghijklmnoq", "abcdefghijklmnop"])";
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  std::vector<std::pair<std::shared_ptr<Array>, std::shared_ptr<Array>>> inputs = {
+      {ArrayFromJSON(utf8(), lhs_json), ArrayFromJSON(utf8(), rhs_json)},
+      {rand.String(256, 0, 20, 0.1), rand.String(256, 0, 20, 0.1)}};
+  Datum scalar(std::make_shared<StringScalar>("abcdefghijklmnop"));
+  ASSERT_OK_AND_ASSIGN(Datum scalar_view, Cast(scalar, utf8_view()));
+
+  for (const auto& input : inputs) {
+    ASSERT_OK_AND_ASSIGN(Datum lhs_view, Cast(input.first, utf8_view()));
+    ASSERT_OK_AND_ASSIGN(Datum rhs_view, Cast(input.second, utf8_view()));
+    for (const char* function :
+         {"equal", "not_equal", "greater", "greater_equal", "less", "less_equal"}) {
+      ASSERT_OK_AND_ASSIGN(Datum expected,
+                           CallFunction(function, {input.first, input.second}));
+      ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(function, {lhs_view, rhs_view}));
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+
+      ASSERT_OK_AND_ASSIGN(expected, CallFunction(function, {input.first, scalar}));
+      ASSERT_OK_AND_ASSIGN(actual, CallFunction(function, {lhs_view, scalar_view}));
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+
+      ASSERT_OK_AND_ASSIGN(expected, CallFunction(function, {scalar, input.second}));
+      ASSERT_OK_AND_ASSIGN(actual, CallFunction(function, {scalar_view, rhs_view}));
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+    }
+  }
+}
+
 template <typename T>
 class TestVarArgsCompare : public ::testing::Test {
  protected:
@@ -29,6 +29,7 @@
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bitmap.h"
 #include "arrow/util/bitmap_ops.h"
@@ -173,6 +174,37 @@ class ArrayCompareSorter {
   }
 };
 
+// Binary views are compared on their inline size and prefix first, so the data
+// buffers are only looked into for values sharing a prefix.
+template <typename ArrowType>
+class ArrayBinaryViewSorter {
+ public:
+  NullPartitionResult operator()(uint64_t* indices_begin, uint64_t* indices_end,
+                                 const Array& array, int64_t offset,
+                                 const ArraySortOptions& options) {
+    const auto& values = checked_cast<const BinaryViewArray&>(array);
+    const BinaryViewType::c_type* views = values.raw_views() - offset;
+    const std::shared_ptr<Buffer>* data_buffers = values.data_buffers();
+
+    const auto p = PartitionNulls<BinaryViewArray, StablePartitioner>(
+        indices_begin, indices_end, values, offset, options.null_placement);
+    if (options.order == SortOrder::Ascending) {
+      std::stable_sort(p.non_nulls_begin, p.non_nulls_end,
+                       [&](uint64_t left, uint64_t right) {
+                         return util::CompareBinaryView(views[left], data_buffers,
+                                                        views[right], data_buffers) < 0;
+                       });
+    } else {
+      std::stable_sort(p.non_nulls_begin, p.non_nulls_end,
+                       [&](uint64_t left, uint64_t right) {
+                         return util::CompareBinaryView(views[right], data_buffers,
+                                                        views[left], data_buffers) < 0;
+                       });
+    }
+    return p;
+  }
+};
+
 template <typename ArrowType>
 class ArrayCountSorter {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
@@ -409,6 +441,11 @@ struct ArraySorter<
   ArrayCompareSorter<Type> impl;
 };
 
+template <typename Type>
+struct ArraySorter<Type, enable_if_binary_view_like<Type>> {
+  ArrayBinaryViewSorter<Type> impl;
+};
+
 struct ArraySorterFactory {
   ArraySortFunc sorter;
 
@@ -502,6 +539,12 @@ void AddArraySortingKernels(VectorKernel base, VectorFunction* func) {
     base.exec = GenerateVarBinaryBase<ExecTemplate, UInt64Type>(*physical_type);
     DCHECK_OK(func->AddKernel(base));
   }
+  base.signature = KernelSignature::Make({binary_view()}, uint64());
+  base.exec = ExecTemplate<UInt64Type, BinaryViewType>::Exec;
+  DCHECK_OK(func->AddKernel(base));
+  base.signature = KernelSignature::Make({utf8_view()}, uint64());
+  base.exec = ExecTemplate<UInt64Type, StringViewType>::Exec;
+  DCHECK_OK(func->AddKernel(base));
   base.signature = KernelSignature::Make({Type::FIXED_SIZE_BINARY}, uint64());
   base.exec = ExecTemplate<UInt64Type, FixedSizeBinaryType>::Exec;
   DCHECK_OK(func->AddKernel(base));
@@ -520,6 +520,11 @@ struct HashKernelTraits<Type, Action, enable_if_has_string_view<Type>> {
   using HashKernel = RegularHashKernel<Type, util::string_view, Action>;
 };
 
+template <typename Type, typename Action>
+struct HashKernelTraits<Type, Action, enable_if_binary_view_like<Type>> {
+  using HashKernel = RegularHashKernel<Type, util::string_view, Action>;
+};
+
 template <typename Type, typename Action>
 Result<std::unique_ptr<HashKernel>> HashInitImpl(KernelContext* ctx,
                                                  const KernelInitArgs& args) {
@@ -573,6 +578,9 @@ KernelInit GetHashInit(Type::type type_id) {
     case Type::LARGE_BINARY:
     case Type::LARGE_STRING:
       return HashInit<LargeBinaryType, Action>;
+    case Type::BINARY_VIEW:
+    case Type::STRING_VIEW:
+      return HashInit<BinaryViewType, Action>;
     case Type::FIXED_SIZE_BINARY:
     case Type::DECIMAL128:
     case Type::DECIMAL256:
@@ -737,6 +745,12 @@ void AddHashKernels(VectorFunction* func, VectorKernel base, OutputType out_ty)
     base.signature = KernelSignature::Make({ty}, out_ty);
     DCHECK_OK(func->AddKernel(base));
   }
+
+  for (const auto& ty : BinaryViewTypes()) {
+    base.init = GetHashInit<Action>(ty->id());
+    base.signature = KernelSignature::Make({ty}, out_ty);
+    DCHECK_OK(func->AddKernel(base));
+  }
 }
 
 const FunctionDoc unique_doc(
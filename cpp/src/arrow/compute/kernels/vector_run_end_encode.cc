@@ -0,0 +1,429 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vector kernels for run-end encoding and decoding
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "arrow/array/builder_base.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/builder_run_end.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/codegen_internal.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/ree_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+using RunEndEncodeState = OptionsWrapper<RunEndEncodeOptions>;
+
+// ----------------------------------------------------------------------
+// Accessors for fixed-width values
+//
+// Values are compared by their bit pattern, so that e.g. 0.0 and -0.0 are
+// kept in separate runs and a NaN can be part of a run.
+
+template <typename CType>
+struct FixedWidthValues {
+  explicit FixedWidthValues(const ArraySpan& span) : values(span.GetValues<CType>(1)) {}
+
+  bool Equals(int64_t i, int64_t j) const { return values[i] == values[j]; }
+
+  Result<std::shared_ptr<Buffer>> Allocate(KernelContext* ctx, int64_t length) const {
+    return ctx->Allocate(length * sizeof(CType));
+  }
+
+  // Write `length` copies of values[index] at out[out_offset]
+  void Fill(uint8_t* out, int64_t out_offset, int64_t length, int64_t index) const {
+    auto* out_values = reinterpret_cast<CType*>(out) + out_offset;
+    std::fill(out_values, out_values + length, values[index]);
+  }
+
+  const CType* values;
+};
+
+struct GenericFixedWidthValues {
+  explicit GenericFixedWidthValues(const ArraySpan& span)
+      : byte_width(checked_cast<const FixedWidthType&>(*span.type).bit_width() / 8),
+        values(span.buffers[1].data + span.offset * byte_width) {}
+
+  bool Equals(int64_t i, int64_t j) const {
+    return std::memcmp(values + i * byte_width, values + j * byte_width, byte_width) == 0;
+  }
+
+  Result<std::shared_ptr<Buffer>> Allocate(KernelContext* ctx, int64_t length) const {
+    return ctx->Allocate(length * byte_width);
+  }
+
+  void Fill(uint8_t* out, int64_t out_offset, int64_t length, int64_t index) const {
+    uint8_t* out_values = out + out_offset * byte_width;
+    for (int64_t i = 0; i < length; ++i) {
+      std::memcpy(out_values + i * byte_width, values + index * byte_width, byte_width);
+    }
+  }
+
+  const int64_t byte_width;
+  const uint8_t* values;
+};
+
+struct BooleanValues {
+  explicit BooleanValues(const ArraySpan& span)
+      : bitmap(span.buffers[1].data), offset(span.offset) {}
+
+  bool Equals(int64_t i, int64_t j) const {
+    return bit_util::GetBit(bitmap, offset + i) == bit_util::GetBit(bitmap, offset + j);
+  }
+
+  Result<std::shared_ptr<Buffer>> Allocate(KernelContext* ctx, int64_t length) const {
+    return ctx->AllocateBitmap(length);
+  }
+
+  void Fill(uint8_t* out, int64_t out_offset, int64_t length, int64_t index) const {
+    bit_util::SetBitsTo(out, out_offset, length,
+                        bit_util::GetBit(bitmap, offset + index));
+  }
+
+  const uint8_t* bitmap;
+  const int64_t offset;
+};
+
+// Call Impl::Exec<RunEndCType, Values>() with the values accessor matching a
+// fixed-width value type, or Impl::ExecGeneric<RunEndCType>() for other types
+template <typename RunEndCType, typename Impl>
+Status DispatchValueType(const DataType& value_type, Impl* impl) {
+  switch (value_type.id()) {
+    case Type::BOOL:
+      return impl->template Exec<RunEndCType, BooleanValues>();
+    case Type::EXTENSION:
+    case Type::DICTIONARY:
+      // The values child must carry the extension type or the dictionary,
+      // which the builder takes care of
+      return impl->template ExecGeneric<RunEndCType>();
+    default:
+      break;
+  }
+  if (!is_fixed_width(value_type.id()) || value_type.id() == Type::NA) {
+    return impl->template ExecGeneric<RunEndCType>();
+  }
+  switch (checked_cast<const FixedWidthType&>(value_type).bit_width()) {
+    case 8:
+      return impl->template Exec<RunEndCType, FixedWidthValues<uint8_t>>();
+    case 16:
+      return impl->template Exec<RunEndCType, FixedWidthValues<uint16_t>>();
+    case 32:
+      return impl->template Exec<RunEndCType, FixedWidthValues<uint32_t>>();
+    case 64:
+      return impl->template Exec<RunEndCType, FixedWidthValues<uint64_t>>();
+    default:
+      return impl->template Exec<RunEndCType, GenericFixedWidthValues>();
+  }
+}
+
+template <typename Impl>
+Status DispatchRunEndType(const DataType& run_end_type, const DataType& value_type,
+                          Impl* impl) {
+  switch (run_end_type.id()) {
+    case Type::INT16:
+      return DispatchValueType<int16_t>(value_type, impl);
+    case Type::INT32:
+      return DispatchValueType<int32_t>(value_type, impl);
+    case Type::INT64:
+      return DispatchValueType<int64_t>(value_type, impl);
+    default:
+      return Status::Invalid("Run end type must be int16, int32 or int64 (got ",
+                             run_end_type, ")");
+  }
+}
+
+// ----------------------------------------------------------------------
+// run_end_encode
+
+struct RunEndEncodeImpl {
+  template <typename RunEndCType>
+  Status CheckLength() const {
+    if (input.length > std::numeric_limits<RunEndCType>::max()) {
+      return Status::Invalid("Cannot run-end encode an array of length ", input.length,
+                             " with run end type ", *run_end_type);
+    }
+    return Status::OK();
+  }
+
+  // Two passes over the input: the first one counts the runs so that the
+  // output can be allocated exactly, the second one writes them.
+  template <typename RunEndCType, typename Values>
+  Status Exec() {
+    RETURN_NOT_OK(CheckLength<RunEndCType>());
+    const int64_t length = input.length;
+    const uint8_t* validity = input.MayHaveNulls() ? input.buffers[0].data : NULLPTR;
+    const int64_t offset = input.offset;
+    const Values values(input);
+
+    auto is_valid = [&](int64_t i) {
+      return validity == NULLPTR || bit_util::GetBit(validity, offset + i);
+    };
+    // Whether a new run starts at position i > 0
+    auto starts_run = [&](int64_t i) {
+      const bool valid = is_valid(i);
+      if (valid != is_valid(i - 1)) {
+        return true;
+      }
+      return valid && !values.Equals(i - 1, i);
+    };
+
+    int64_t num_runs = length > 0 ? 1 : 0;
+    for (int64_t i = 1; i < length; ++i) {
+      num_runs += starts_run(i);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto run_ends_buffer,
+                          ctx->Allocate(num_runs * sizeof(RunEndCType)));
+    ARROW_ASSIGN_OR_RAISE(auto values_buffer, values.Allocate(ctx, num_runs));
+    std::shared_ptr<Buffer> validity_buffer;
+    if (validity != NULLPTR) {
+      ARROW_ASSIGN_OR_RAISE(validity_buffer, ctx->AllocateBitmap(num_runs));
+    }
+    auto* run_ends = reinterpret_cast<RunEndCType*>(run_ends_buffer->mutable_data());
+    uint8_t* out_values = values_buffer->mutable_data();
+    uint8_t* out_validity =
+        validity_buffer != nullptr ? validity_buffer->mutable_data() : NULLPTR;
+
+    int64_t run_index = 0;
+    int64_t null_count = 0;
+    auto write_run = [&](int64_t run_start, int64_t run_end) {
+      const bool valid = is_valid(run_start);
+      if (out_validity != NULLPTR) {
+        bit_util::SetBitTo(out_validity, run_index, valid);
+      }
+      null_count += !valid;
+      values.Fill(out_values, run_index, /*length=*/1, run_start);
+      run_ends[run_index++] = static_cast<RunEndCType>(run_end);
+    };
+    int64_t run_start = 0;
+    for (int64_t i = 1; i < length; ++i) {
+      if (starts_run(i)) {
+        write_run(run_start, i);
+        run_start = i;
+      }
+    }
+    if (length > 0) {
+      write_run(run_start, length);
+    }
+    DCHECK_EQ(run_index, num_runs);
+
+    auto run_ends_data =
+        ArrayData::Make(run_end_type, num_runs, {NULLPTR, std::move(run_ends_buffer)},
+                        /*null_count=*/0);
+    auto values_data = ArrayData::Make(
+        input.type->GetSharedPtr(), num_runs,
+        {std::move(validity_buffer), std::move(values_buffer)}, null_count);
+    return MakeOutput(std::move(run_ends_data), std::move(values_data));
+  }
+
+  // Fall back on the builder, which compares consecutive values one by one
+  template <typename RunEndCType>
+  Status ExecGeneric() {
+    RETURN_NOT_OK(CheckLength<RunEndCType>());
+    if (input.type->id() == Type::NA) {
+      // A single null run
+      const int64_t num_runs = input.length > 0 ? 1 : 0;
+      ARROW_ASSIGN_OR_RAISE(auto run_ends_buffer,
+                            ctx->Allocate(num_runs * sizeof(RunEndCType)));
+      if (num_runs > 0) {
+        reinterpret_cast<RunEndCType*>(run_ends_buffer->mutable_data())[0] =
+            static_cast<RunEndCType>(input.length);
+      }
+      return MakeOutput(
+          ArrayData::Make(run_end_type, num_runs, {NULLPTR, std::move(run_ends_buffer)},
+                          /*null_count=*/0),
+          ArrayData::Make(null(), num_runs, {NULLPTR}, num_runs));
+    }
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(),
+                              run_end_encoded(run_end_type, input.type->GetSharedPtr()),
+                              &builder));
+    RETURN_NOT_OK(builder->AppendArraySlice(input, 0, input.length));
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder->FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  Status MakeOutput(std::shared_ptr<ArrayData> run_ends_data,
+                    std::shared_ptr<ArrayData> values_data) {
+    auto output =
+        ArrayData::Make(run_end_encoded(run_end_type, input.type->GetSharedPtr()),
+                        input.length, {NULLPTR}, /*null_count=*/0);
+    output->child_data = {std::move(run_ends_data), std::move(values_data)};
+    out->value = std::move(output);
+    return Status::OK();
+  }
+
+  KernelContext* ctx;
+  const ArraySpan& input;
+  const std::shared_ptr<DataType>& run_end_type;
+  ExecResult* out;
+};
+
+Result<TypeHolder> ResolveRunEndEncodeOutput(KernelContext* ctx,
+                                             const std::vector<TypeHolder>& types) {
+  const auto& options = RunEndEncodeState::Get(ctx);
+  ARROW_ASSIGN_OR_RAISE(auto type, RunEndEncodedType::Make(options.run_end_type,
+                                                           types[0].GetSharedPtr()));
+  return type;
+}
+
+Status RunEndEncodeExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const ArraySpan& input = batch[0].array;
+  if (input.type->id() == Type::RUN_END_ENCODED) {
+    return Status::Invalid("Input is already run-end encoded: ", *input.type);
+  }
+  const auto& run_end_type = RunEndEncodeState::Get(ctx).run_end_type;
+  RunEndEncodeImpl impl{ctx, input, run_end_type, out};
+  return DispatchRunEndType(*run_end_type, *input.type, &impl);
+}
+
+// ----------------------------------------------------------------------
+// run_end_decode
+
+struct RunEndDecodeImpl {
+  // Fill the output run by run, without looking at each logical value
+  template <typename RunEndCType, typename Values>
+  Status Exec() {
+    const ArraySpan& values_span = ree_util::ValuesArray(input);
+    const Values values(values_span);
+    const uint8_t* validity =
+        values_span.MayHaveNulls() ? values_span.buffers[0].data : NULLPTR;
+
+    ARROW_ASSIGN_OR_RAISE(auto values_buffer, values.Allocate(ctx, input.length));
+    std::shared_ptr<Buffer> validity_buffer;
+    if (validity != NULLPTR) {
+      ARROW_ASSIGN_OR_RAISE(validity_buffer, ctx->AllocateBitmap(input.length));
+    }
+    uint8_t* out_values = values_buffer->mutable_data();
+    uint8_t* out_validity =
+        validity_buffer != nullptr ? validity_buffer->mutable_data() : NULLPTR;
+
+    int64_t null_count = 0;
+    ree_util::RunEndEncodedArraySpan<RunEndCType> ree_span(input);
+    for (auto it = ree_span.begin(); it != ree_span.end(); ++it) {
+      const int64_t index = it.index_into_array();
+      const int64_t run_length = it.run_length();
+      if (out_validity != NULLPTR) {
+        const bool valid = bit_util::GetBit(validity, values_span.offset + index);
+        bit_util::SetBitsTo(out_validity, it.logical_position(), run_length, valid);
+        null_count += valid ? 0 : run_length;
+      }
+      values.Fill(out_values, it.logical_position(), run_length, index);
+    }
+
+    out->value = ArrayData::Make(values_span.type->GetSharedPtr(), input.length,
+                                 {std::move(validity_buffer), std::move(values_buffer)},
+                                 null_count);
+    return Status::OK();
+  }
+
+  // Take the values child with the physical index of every logical position
+  template <typename RunEndCType>
+  Status ExecGeneric() {
+    Int64Builder indices_builder(ctx->memory_pool());
+    RETURN_NOT_OK(indices_builder.Reserve(input.length));
+    ree_util::RunEndEncodedArraySpan<RunEndCType> ree_span(input);
+    for (auto it = ree_span.begin(); it != ree_span.end(); ++it) {
+      for (int64_t i = 0; i < it.run_length(); ++i) {
+        indices_builder.UnsafeAppend(it.index_into_array());
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto indices, indices_builder.Finish());
+    ARROW_ASSIGN_OR_RAISE(
+        Datum result,
+        Take(ree_util::ValuesArray(input).ToArray(), indices,
+             TakeOptions::NoBoundsCheck(), ctx->exec_context()));
+    out->value = result.array();
+    return Status::OK();
+  }
+
+  KernelContext* ctx;
+  const ArraySpan& input;
+  ExecResult* out;
+};
+
+Result<TypeHolder> ResolveRunEndDecodeOutput(KernelContext*,
+                                             const std::vector<TypeHolder>& types) {
+  return checked_cast<const RunEndEncodedType&>(*types[0]).value_type();
+}
+
+Status RunEndDecodeExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const ArraySpan& input = batch[0].array;
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*input.type);
+  RunEndDecodeImpl impl{ctx, input, out};
+  return DispatchRunEndType(*ree_type.run_end_type(), *ree_type.value_type(), &impl);
+}
+
+const FunctionDoc run_end_encode_doc{
+    "Run-end encode array",
+    ("Return a run-end encoded version of the input array.\n"
+     "Consecutive equal values, and consecutive nulls, form a single run.\n"
+     "Chunked arrays are encoded chunk by chunk."),
+    {"array"},
+    "RunEndEncodeOptions"};
+
+const FunctionDoc run_end_decode_doc{
+    "Decode run-end encoded array",
+    ("Return a plain array with the value type of the run-end encoded input."),
+    {"array"}};
+
+}  // namespace
+
+void RegisterVectorRunEndEncode(FunctionRegistry* registry) {
+  static const auto default_options = RunEndEncodeOptions::Defaults();
+  auto encode = std::make_shared<VectorFunction>("run_end_encode", Arity::Unary(),
+                                                 run_end_encode_doc, &default_options);
+  VectorKernel encode_kernel({InputType()}, OutputType(ResolveRunEndEncodeOutput),
+                             RunEndEncodeExec, RunEndEncodeState::Init);
+  encode_kernel.null_handling = NullHandling::OUTPUT_NOT_NULL;
+  encode_kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  encode_kernel.can_execute_chunkwise = true;
+  encode_kernel.output_chunked = true;
+  DCHECK_OK(encode->AddKernel(std::move(encode_kernel)));
+  DCHECK_OK(registry->AddFunction(std::move(encode)));
+
+  auto decode = std::make_shared<VectorFunction>("run_end_decode", Arity::Unary(),
+                                                 run_end_decode_doc);
+  VectorKernel decode_kernel({InputType(Type::RUN_END_ENCODED)},
+                             OutputType(ResolveRunEndDecodeOutput), RunEndDecodeExec);
+  decode_kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  decode_kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  decode_kernel.can_execute_chunkwise = true;
+  decode_kernel.output_chunked = true;
+  DCHECK_OK(decode->AddKernel(std::move(decode_kernel)));
+  DCHECK_OK(registry->AddFunction(std::move(decode)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
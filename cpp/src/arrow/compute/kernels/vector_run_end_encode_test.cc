@@ -0,0 +1,302 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace compute {
+
+using arrow::internal::checked_cast;
+
+namespace {
+
+std::shared_ptr<Array> MakeRunEndEncoded(const std::shared_ptr<DataType>& run_end_type,
+                                         const std::shared_ptr<DataType>& value_type,
+                                         const std::string& run_ends_json,
+                                         const std::string& values_json,
+                                         int64_t length, int64_t offset = 0) {
+  EXPECT_OK_AND_ASSIGN(auto array, RunEndEncodedArray::Make(
+                                       length, ArrayFromJSON(run_end_type, run_ends_json),
+                                       ArrayFromJSON(value_type, values_json), offset));
+  return array;
+}
+
+// Encode, check the runs, then decode back to the input
+void CheckRoundTrip(const std::shared_ptr<DataType>& run_end_type,
+                    const std::shared_ptr<Array>& input,
+                    const std::shared_ptr<Array>& expected) {
+  ASSERT_OK_AND_ASSIGN(Datum encoded,
+                       RunEndEncode(input, RunEndEncodeOptions(run_end_type)));
+  ValidateOutput(encoded);
+  AssertDatumsEqual(expected, encoded, /*verbose=*/true);
+  const auto& ree_array = checked_cast<const RunEndEncodedArray&>(*encoded.make_array());
+  const auto& expected_ree = checked_cast<const RunEndEncodedArray&>(*expected);
+  AssertArraysEqual(*expected_ree.run_ends(), *ree_array.run_ends(), /*verbose=*/true);
+  AssertArraysEqual(*expected_ree.values(), *ree_array.values(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(encoded));
+  ValidateOutput(decoded);
+  AssertDatumsEqual(input, decoded, /*verbose=*/true);
+}
+
+}  // namespace
+
+class TestRunEndEncode : public ::testing::TestWithParam<std::shared_ptr<DataType>> {};
+
+TEST_P(TestRunEndEncode, FixedWidth) {
+  const auto& run_end_type = GetParam();
+  for (const auto& ty :
+       {int8(), int32(), int64(), date32(), timestamp(TimeUnit::MILLI)}) {
+    ARROW_SCOPED_TRACE("value type = ", *ty);
+    CheckRoundTrip(run_end_type, ArrayFromJSON(ty, "[1, 1, 2, null, null, 3, 3, 3]"),
+                   MakeRunEndEncoded(run_end_type, ty, "[2, 3, 5, 8]",
+                                     "[1, 2, null, 3]", 8));
+    CheckRoundTrip(run_end_type, ArrayFromJSON(ty, "[5]"),
+                   MakeRunEndEncoded(run_end_type, ty, "[1]", "[5]", 1));
+    CheckRoundTrip(run_end_type, ArrayFromJSON(ty, "[]"),
+                   MakeRunEndEncoded(run_end_type, ty, "[]", "[]", 0));
+  }
+}
+
+TEST_P(TestRunEndEncode, FloatingPoint) {
+  const auto& run_end_type = GetParam();
+  // Signed zeros are kept apart
+  CheckRoundTrip(run_end_type, ArrayFromJSON(float64(), "[0.0, -0.0, -0.0, 1.5]"),
+                 MakeRunEndEncoded(run_end_type, float64(), "[1, 3, 4]",
+                                   "[0.0, -0.0, 1.5]", 4));
+  // NaNs form runs
+  ASSERT_OK_AND_ASSIGN(Datum encoded,
+                       RunEndEncode(ArrayFromJSON(float64(), "[NaN, NaN, 1.5]"),
+                                    RunEndEncodeOptions(run_end_type)));
+  AssertArraysEqual(
+      *ArrayFromJSON(run_end_type, "[2, 3]"),
+      *checked_cast<const RunEndEncodedArray&>(*encoded.make_array()).run_ends());
+  CheckRoundTrip(run_end_type, ArrayFromJSON(float32(), "[2.5, 2.5, null]"),
+                 MakeRunEndEncoded(run_end_type, float32(), "[2, 3]", "[2.5, null]", 3));
+}
+
+TEST_P(TestRunEndEncode, Boolean) {
+  const auto& run_end_type = GetParam();
+  CheckRoundTrip(run_end_type,
+                 ArrayFromJSON(boolean(), "[true, true, false, null, false, false]"),
+                 MakeRunEndEncoded(run_end_type, boolean(), "[2, 3, 4, 6]",
+                                   "[true, false, null, false]", 6));
+}
+
+TEST_P(TestRunEndEncode, GenericTypes) {
+  const auto& run_end_type = GetParam();
+  CheckRoundTrip(run_end_type, ArrayFromJSON(utf8(), R"(["a", "a", null, "b", "b"])"),
+                 MakeRunEndEncoded(run_end_type, utf8(), "[2, 3, 5]",
+                                   R"(["a", null, "b"])", 5));
+  CheckRoundTrip(run_end_type, ArrayFromJSON(fixed_size_binary(3), R"(["abc", "abc"])"),
+                 MakeRunEndEncoded(run_end_type, fixed_size_binary(3), "[2]",
+                                   R"(["abc"])", 2));
+  CheckRoundTrip(run_end_type, ArrayFromJSON(list(int8()), "[[1], [1], [], null]"),
+                 MakeRunEndEncoded(run_end_type, list(int8()), "[2, 3, 4]",
+                                   "[[1], [], null]", 4));
+  CheckRoundTrip(run_end_type, ArrayFromJSON(null(), "[null, null, null]"),
+                 MakeRunEndEncoded(run_end_type, null(), "[3]", "[null]", 3));
+}
+
+TEST_P(TestRunEndEncode, SlicedInput) {
+  const auto& run_end_type = GetParam();
+  auto input = ArrayFromJSON(int32(), "[1, 1, 2, 2, 2, null, 3]")->Slice(1, 5);
+  CheckRoundTrip(run_end_type, input,
+                 MakeRunEndEncoded(run_end_type, int32(), "[1, 4, 5]", "[1, 2, null]",
+                                   5));
+
+  // Decoding honors the offset of the run-end encoded array
+  auto encoded = MakeRunEndEncoded(run_end_type, utf8(), "[2, 4, 7]",
+                                   R"(["a", null, "b"])", 7);
+  CheckVectorUnary("run_end_decode", encoded->Slice(1, 4),
+                   ArrayFromJSON(utf8(), R"(["a", null, null, "b"])"));
+  encoded = MakeRunEndEncoded(run_end_type, int16(), "[2, 4, 7]", "[1, null, 2]", 7);
+  CheckVectorUnary("run_end_decode", encoded->Slice(3, 3),
+                   ArrayFromJSON(int16(), "[null, 2, 2]"));
+}
+
+TEST_P(TestRunEndEncode, ChunkedArray) {
+  const auto& run_end_type = GetParam();
+  auto input = ChunkedArrayFromJSON(int32(), {"[1, 1, 2]", "[2, 2]"});
+  ASSERT_OK_AND_ASSIGN(Datum encoded,
+                       RunEndEncode(input, RunEndEncodeOptions(run_end_type)));
+  ValidateOutput(encoded);
+  // Chunks are encoded independently
+  ASSERT_EQ(encoded.chunked_array()->num_chunks(), 2);
+  AssertArraysEqual(
+      *MakeRunEndEncoded(run_end_type, int32(), "[2, 3]", "[1, 2]", 3),
+      *encoded.chunked_array()->chunk(0));
+  ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(encoded));
+  AssertDatumsEqual(input, decoded);
+}
+
+INSTANTIATE_TEST_SUITE_P(RunEndTypes, TestRunEndEncode,
+                         ::testing::Values(int16(), int32(), int64()));
+
+TEST(TestRunEndEncodeErrors, Basics) {
+  auto input = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(TypeError, RunEndEncode(input, RunEndEncodeOptions(uint8())));
+  ASSERT_OK_AND_ASSIGN(Datum encoded, RunEndEncode(input));
+  ASSERT_TRUE(encoded.type()->Equals(*run_end_encoded(int32(), int32())));
+  ASSERT_RAISES(Invalid, RunEndEncode(encoded));
+  ASSERT_RAISES(NotImplemented, RunEndDecode(input));
+}
+
+TEST(TestRunEndEncodedAggregate, CountSumMinMax) {
+  for (const auto& run_end_type : {int16(), int32(), int64()}) {
+    ARROW_SCOPED_TRACE("run end type = ", *run_end_type);
+    auto input = MakeRunEndEncoded(run_end_type, int32(), "[3, 5, 6, 10]",
+                                   "[2, null, -1, 4]", 10);
+    auto decoded = ArrayFromJSON(int32(), "[2, 2, 2, null, null, -1, 4, 4, 4, 4]");
+    for (const auto& array : {input, input->Slice(1, 6), input->Slice(4)}) {
+      auto plain = decoded->Slice(array->offset(), array->length());
+      for (const auto& func : {"count", "sum", "mean", "min_max", "min", "max"}) {
+        ARROW_SCOPED_TRACE(func, " of ", array->ToString());
+        ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func, {plain}));
+        ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func, {array}));
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      }
+    }
+
+    CountOptions only_null(CountOptions::ONLY_NULL);
+    ASSERT_OK_AND_ASSIGN(Datum nulls, Count(input, only_null));
+    AssertDatumsEqual(Datum(int64_t(2)), nulls);
+
+    ScalarAggregateOptions no_skip(/*skip_nulls=*/false);
+    ASSERT_OK_AND_ASSIGN(Datum sum, Sum(input, no_skip));
+    ASSERT_FALSE(sum.scalar()->is_valid);
+    ScalarAggregateOptions min_count(/*skip_nulls=*/true, /*min_count=*/9);
+    ASSERT_OK_AND_ASSIGN(Datum min_max, MinMax(input, min_count));
+    ASSERT_FALSE(checked_cast<const StructScalar&>(*min_max.scalar()).value[0]->is_valid);
+    ASSERT_OK_AND_ASSIGN(min_max, MinMax(input->Slice(0, 3), ScalarAggregateOptions(
+                                                                 true, /*min_count=*/3)));
+    AssertDatumsEqual(Datum(ScalarFromJSON(struct_({field("min", int32()),
+                                                    field("max", int32())}),
+                                           "[2, 2]")),
+                      min_max);
+  }
+}
+
+TEST(TestRunEndEncodedSelection, Filter) {
+  for (const auto& run_end_type : {int16(), int32(), int64()}) {
+    ARROW_SCOPED_TRACE("run end type = ", *run_end_type);
+    auto input = MakeRunEndEncoded(run_end_type, utf8(), "[3, 5, 6, 9]",
+                                   R"(["a", null, "b", "c"])", 9);
+    auto filter = ArrayFromJSON(boolean(), "[1, 0, 1, 1, 1, 0, 0, 1, null]");
+    ASSERT_OK_AND_ASSIGN(Datum filtered, Filter(input, filter));
+    ValidateOutput(filtered);
+    // Selections from the same run are coalesced
+    AssertDatumsEqual(MakeRunEndEncoded(run_end_type, utf8(), "[2, 4, 5]",
+                                        R"(["a", null, "c"])", 5),
+                      filtered, /*verbose=*/true);
+
+    ASSERT_OK_AND_ASSIGN(filtered,
+                         Filter(input, filter, FilterOptions(FilterOptions::EMIT_NULL)));
+    ValidateOutput(filtered);
+    ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(filtered));
+    AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["a", "a", null, null, "c", null])"),
+                      decoded, /*verbose=*/true);
+
+    // Sliced input
+    ASSERT_OK_AND_ASSIGN(filtered, Filter(input->Slice(4, 4),
+                                          ArrayFromJSON(boolean(), "[1, 1, 0, 1]")));
+    ValidateOutput(filtered);
+    AssertDatumsEqual(MakeRunEndEncoded(run_end_type, utf8(), "[1, 2, 3]",
+                                        R"([null, "b", "c"])", 3),
+                      filtered, /*verbose=*/true);
+  }
+}
+
+TEST(TestRunEndEncodedSelection, Take) {
+  for (const auto& run_end_type : {int16(), int32(), int64()}) {
+    ARROW_SCOPED_TRACE("run end type = ", *run_end_type);
+    auto input =
+        MakeRunEndEncoded(run_end_type, int32(), "[3, 5, 6, 9]", "[1, null, 2, 3]", 9);
+    for (const auto& index_type : {int8(), uint32(), int64()}) {
+      ARROW_SCOPED_TRACE("index type = ", *index_type);
+      auto indices = ArrayFromJSON(index_type, "[0, 2, 1, 8, 6, null, 5, 4, 3]");
+      ASSERT_OK_AND_ASSIGN(Datum taken, Take(input, indices));
+      ValidateOutput(taken);
+      AssertDatumsEqual(MakeRunEndEncoded(run_end_type, int32(), "[3, 5, 6, 7, 9]",
+                                          "[1, 3, null, 2, null]", 9),
+                        taken, /*verbose=*/true);
+    }
+
+    ASSERT_OK_AND_ASSIGN(Datum taken, Take(input->Slice(4, 3),
+                                           ArrayFromJSON(int32(), "[2, 2, 0]")));
+    ValidateOutput(taken);
+    AssertDatumsEqual(MakeRunEndEncoded(run_end_type, int32(), "[2, 3]", "[3, null]", 3),
+                      taken, /*verbose=*/true);
+
+    ASSERT_RAISES(IndexError, Take(input, ArrayFromJSON(int32(), "[9]")));
+  }
+}
+
+TEST(TestRunEndEncodedCompare, WithScalar) {
+  for (const auto& run_end_type : {int16(), int32(), int64()}) {
+    ARROW_SCOPED_TRACE("run end type = ", *run_end_type);
+    auto input =
+        MakeRunEndEncoded(run_end_type, int32(), "[3, 5, 6, 9]", "[1, null, 2, 3]", 9);
+    for (const auto& array : {input, input->Slice(2, 5)}) {
+      auto plain = RunEndDecode(array).ValueOrDie();
+      for (const auto& func :
+           {"equal", "not_equal", "less", "less_equal", "greater", "greater_equal"}) {
+        ARROW_SCOPED_TRACE(func, " of ", array->ToString());
+        // Scalars are cast to the value type
+        for (const auto& scalar : {ScalarFromJSON(int32(), "2"),
+                                   ScalarFromJSON(int8(), "2"),
+                                   ScalarFromJSON(int32(), "null")}) {
+          ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func, {plain, scalar}));
+          ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func, {array, scalar}));
+          ValidateOutput(actual);
+          ASSERT_TRUE(actual.type()->Equals(*run_end_encoded(run_end_type, boolean())));
+          ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(actual));
+          AssertDatumsEqual(expected, decoded, /*verbose=*/true);
+
+          ASSERT_OK_AND_ASSIGN(expected, CallFunction(func, {scalar, plain}));
+          ASSERT_OK_AND_ASSIGN(actual, CallFunction(func, {scalar, array}));
+          ValidateOutput(actual);
+          ASSERT_OK_AND_ASSIGN(decoded, RunEndDecode(actual));
+          AssertDatumsEqual(expected, decoded, /*verbose=*/true);
+        }
+      }
+    }
+  }
+}
+
+TEST(TestRunEndEncodedCompare, WithArray) {
+  auto input = MakeRunEndEncoded(int32(), utf8(), "[2, 4]", R"(["a", "b"])", 4);
+  auto other = ArrayFromJSON(utf8(), R"(["a", "b", "b", null])");
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("equal", {input, other}));
+  ValidateOutput(actual);
+  AssertDatumsEqual(MakeRunEndEncoded(int32(), boolean(), "[1, 2, 3, 4]",
+                                      "[true, false, true, null]", 4),
+                    actual, /*verbose=*/true);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -28,6 +28,7 @@
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/buffer_builder.h"
+#include "arrow/chunk_resolver.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
@@ -43,6 +44,7 @@
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bitmap_reader.h"
 #include "arrow/util/int_util.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 
@@ -51,6 +53,7 @@ using internal::BitBlockCount;
 using internal::BitBlockCounter;
 using internal::CheckIndexBounds;
 using internal::CopyBitmap;
+using internal::CountAndSetBits;
 using internal::CountSetBits;
 using internal::OptionalBitBlockCounter;
 using internal::OptionalBitIndexer;
@@ -1204,6 +1207,224 @@ Status ExtensionFilter(KernelContext* ctx, const ExecSpan& batch, ExecResult* ou
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded take and filter
+//
+// Selected positions are mapped to the run of the input containing them, and
+// consecutive selections from the same run are coalesced into a single
+// output run.  The values child is then gathered once per output run.
+
+class RunEndEncodedSelector {
+ public:
+  explicit RunEndEncodedSelector(KernelContext* ctx)
+      : ctx_(ctx), physical_indices_(ctx->memory_pool()) {}
+
+  // Append `length` values of the input run at `physical_index`, or `length`
+  // nulls if `physical_index` is negative
+  Status Append(int64_t physical_index, int64_t length) {
+    if (length == 0) {
+      return Status::OK();
+    }
+    length_ += length;
+    if (!run_ends_.empty() && physical_index == last_physical_index_) {
+      run_ends_.back() = length_;
+      return Status::OK();
+    }
+    if (physical_index < 0) {
+      RETURN_NOT_OK(physical_indices_.AppendNull());
+    } else {
+      RETURN_NOT_OK(physical_indices_.Append(physical_index));
+    }
+    run_ends_.push_back(length_);
+    last_physical_index_ = physical_index;
+    return Status::OK();
+  }
+
+  Status Finish(const ArraySpan& values, ExecResult* out) {
+    const auto& ree_type = checked_cast<const RunEndEncodedType&>(*values.type);
+    std::shared_ptr<ArrayData> run_ends;
+    switch (ree_type.run_end_type()->id()) {
+      case Type::INT16:
+        RETURN_NOT_OK(MakeRunEnds<Int16Type>(&run_ends));
+        break;
+      case Type::INT32:
+        RETURN_NOT_OK(MakeRunEnds<Int32Type>(&run_ends));
+        break;
+      default:
+        DCHECK_EQ(ree_type.run_end_type()->id(), Type::INT64);
+        RETURN_NOT_OK(MakeRunEnds<Int64Type>(&run_ends));
+        break;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto physical_indices, physical_indices_.Finish());
+    ARROW_ASSIGN_OR_RAISE(
+        Datum taken_values,
+        Take(ree_util::ValuesArray(values).ToArray(), physical_indices,
+             TakeOptions::NoBoundsCheck(), ctx_->exec_context()));
+    auto result = ArrayData::Make(values.type->GetSharedPtr(), length_, {NULLPTR},
+                                  /*null_count=*/0);
+    result->child_data = {std::move(run_ends), taken_values.array()};
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+ private:
+  template <typename RunEndType>
+  Status MakeRunEnds(std::shared_ptr<ArrayData>* out) {
+    using RunEndCType = typename RunEndType::c_type;
+    if (length_ > std::numeric_limits<RunEndCType>::max()) {
+      return Status::Invalid("Selection of length ", length_,
+                             " doesn't fit in a run-end encoded array with run end type ",
+                             *TypeTraits<RunEndType>::type_singleton());
+    }
+    const int64_t num_runs = static_cast<int64_t>(run_ends_.size());
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ctx_->Allocate(num_runs * sizeof(RunEndCType)));
+    std::copy(run_ends_.begin(), run_ends_.end(),
+              reinterpret_cast<RunEndCType*>(buffer->mutable_data()));
+    *out = ArrayData::Make(TypeTraits<RunEndType>::type_singleton(), num_runs,
+                           {NULLPTR, std::move(buffer)}, /*null_count=*/0);
+    return Status::OK();
+  }
+
+  KernelContext* ctx_;
+  Int64Builder physical_indices_;
+  std::vector<int64_t> run_ends_;
+  int64_t last_physical_index_ = -1;
+  int64_t length_ = 0;
+};
+
+template <typename RunEndCType>
+Status RunEndEncodedFilterImpl(const ArraySpan& values, const ArraySpan& filter,
+                               FilterOptions::NullSelectionBehavior null_selection,
+                               RunEndEncodedSelector* selector) {
+  const uint8_t* filter_data = filter.buffers[1].data;
+  const uint8_t* filter_is_valid =
+      filter.MayHaveNulls() ? filter.buffers[0].data : NULLPTR;
+  ree_util::RunEndEncodedArraySpan<RunEndCType> ree_span(values);
+  for (auto it = ree_span.begin(); it != ree_span.end(); ++it) {
+    const int64_t physical_index = it.index_into_array();
+    const int64_t start = filter.offset + it.logical_position();
+    const int64_t length = it.run_length();
+    if (filter_is_valid == NULLPTR) {
+      RETURN_NOT_OK(
+          selector->Append(physical_index, CountSetBits(filter_data, start, length)));
+    } else if (null_selection == FilterOptions::DROP) {
+      RETURN_NOT_OK(selector->Append(
+          physical_index,
+          CountAndSetBits(filter_data, start, filter_is_valid, start, length)));
+    } else {
+      // Null filter slots emit nulls, splitting the run
+      for (int64_t i = start; i < start + length; ++i) {
+        if (!bit_util::GetBit(filter_is_valid, i)) {
+          RETURN_NOT_OK(selector->Append(-1, 1));
+        } else if (bit_util::GetBit(filter_data, i)) {
+          RETURN_NOT_OK(selector->Append(physical_index, 1));
+        }
+      }
+    }
+  }
+  return Status::OK();
+}
+
+template <typename RunEndCType, typename IndexCType>
+Status RunEndEncodedTakeImpl(const ArraySpan& values, const ArraySpan& indices,
+                             RunEndEncodedSelector* selector) {
+  const RunEndCType* run_ends = ree_util::RunEnds<RunEndCType>(values);
+  const int64_t num_runs = ree_util::RunEndsArray(values).length;
+  const IndexCType* index_data = indices.GetValues<IndexCType>(1);
+  const uint8_t* is_valid = indices.MayHaveNulls() ? indices.buffers[0].data : NULLPTR;
+  // Consecutive indices often fall into the same run, so only search the run
+  // ends when leaving the run of the previous index
+  int64_t physical_index = -1;
+  int64_t run_start = 0;
+  int64_t run_end = 0;
+  for (int64_t i = 0; i < indices.length; ++i) {
+    if (is_valid != NULLPTR && !bit_util::GetBit(is_valid, indices.offset + i)) {
+      RETURN_NOT_OK(selector->Append(-1, 1));
+      continue;
+    }
+    const int64_t position = values.offset + static_cast<int64_t>(index_data[i]);
+    if (position < run_start || position >= run_end) {
+      physical_index = ree_util::FindPhysicalIndex(
+          run_ends, num_runs, static_cast<int64_t>(index_data[i]), values.offset);
+      run_start = physical_index == 0 ? 0 : run_ends[physical_index - 1];
+      run_end = run_ends[physical_index];
+    }
+    RETURN_NOT_OK(selector->Append(physical_index, 1));
+  }
+  return Status::OK();
+}
+
+template <typename RunEndCType>
+Status RunEndEncodedTakeDispatch(const ArraySpan& values, const ArraySpan& indices,
+                                 RunEndEncodedSelector* selector) {
+  switch (indices.type->id()) {
+    case Type::INT8:
+      return RunEndEncodedTakeImpl<RunEndCType, int8_t>(values, indices, selector);
+    case Type::INT16:
+      return RunEndEncodedTakeImpl<RunEndCType, int16_t>(values, indices, selector);
+    case Type::INT32:
+      return RunEndEncodedTakeImpl<RunEndCType, int32_t>(values, indices, selector);
+    case Type::INT64:
+      return RunEndEncodedTakeImpl<RunEndCType, int64_t>(values, indices, selector);
+    case Type::UINT8:
+      return RunEndEncodedTakeImpl<RunEndCType, uint8_t>(values, indices, selector);
+    case Type::UINT16:
+      return RunEndEncodedTakeImpl<RunEndCType, uint16_t>(values, indices, selector);
+    case Type::UINT32:
+      return RunEndEncodedTakeImpl<RunEndCType, uint32_t>(values, indices, selector);
+    case Type::UINT64:
+      return RunEndEncodedTakeImpl<RunEndCType, uint64_t>(values, indices, selector);
+    default:
+      return Status::TypeError("Invalid index type: ", *indices.type);
+  }
+}
+
+Status RunEndEncodedFilter(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const ArraySpan& values = batch[0].array;
+  const ArraySpan& filter = batch[1].array;
+  if (values.length != filter.length) {
+    return Status::Invalid("Filter inputs must all be the same length");
+  }
+  const auto null_selection = FilterState::Get(ctx).null_selection_behavior;
+  RunEndEncodedSelector selector(ctx);
+  switch (ree_util::RunEndsArray(values).type->id()) {
+    case Type::INT16:
+      RETURN_NOT_OK(
+          RunEndEncodedFilterImpl<int16_t>(values, filter, null_selection, &selector));
+      break;
+    case Type::INT32:
+      RETURN_NOT_OK(
+          RunEndEncodedFilterImpl<int32_t>(values, filter, null_selection, &selector));
+      break;
+    default:
+      RETURN_NOT_OK(
+          RunEndEncodedFilterImpl<int64_t>(values, filter, null_selection, &selector));
+      break;
+  }
+  return selector.Finish(values, out);
+}
+
+Status RunEndEncodedTake(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const ArraySpan& values = batch[0].array;
+  const ArraySpan& indices = batch[1].array;
+  if (TakeState::Get(ctx).boundscheck) {
+    RETURN_NOT_OK(CheckIndexBounds(indices, values.length));
+  }
+  RunEndEncodedSelector selector(ctx);
+  switch (ree_util::RunEndsArray(values).type->id()) {
+    case Type::INT16:
+      RETURN_NOT_OK(RunEndEncodedTakeDispatch<int16_t>(values, indices, &selector));
+      break;
+    case Type::INT32:
+      RETURN_NOT_OK(RunEndEncodedTakeDispatch<int32_t>(values, indices, &selector));
+      break;
+    default:
+      RETURN_NOT_OK(RunEndEncodedTakeDispatch<int64_t>(values, indices, &selector));
+      break;
+  }
+  return selector.Finish(values, out);
+}
+
 // ----------------------------------------------------------------------
 // Implement take for other data types where there is less performance
 // sensitivity by visiting the selected indices.
@@ -1607,6 +1828,46 @@ struct FSBImpl : public Selection<FSBImpl, FixedSizeBinaryType> {
   Status Finish() override { return data_builder.Finish(&out->buffers[1]); }
 };
 
+// A selection implementation for binary views (shared by BinaryView and
+// StringView). Only the views are gathered: the output shares the data buffers
+// of the input, so no value is copied.
+struct BinaryViewImpl : public Selection<BinaryViewImpl, BinaryViewType> {
+  using Base = Selection<BinaryViewImpl, BinaryViewType>;
+  LIFT_BASE_MEMBERS();
+
+  TypedBufferBuilder<BinaryViewType::c_type> views_builder;
+
+  BinaryViewImpl(KernelContext* ctx, const ExecSpan& batch, int64_t output_length,
+                 ExecResult* out)
+      : Base(ctx, batch, output_length, out), views_builder(ctx->memory_pool()) {}
+
+  template <typename Adapter>
+  Status GenerateOutput() {
+    const auto raw_views = this->values.template GetValues<BinaryViewType::c_type>(1);
+
+    RETURN_NOT_OK(views_builder.Reserve(output_length));
+    Adapter adapter(this);
+    return adapter.Generate(
+        [&](int64_t index) {
+          views_builder.UnsafeAppend(raw_views[index]);
+          return Status::OK();
+        },
+        [&]() {
+          views_builder.UnsafeAppend(BinaryViewType::c_type{});
+          return Status::OK();
+        });
+  }
+
+  Status Finish() override {
+    out->buffers.resize(2);
+    RETURN_NOT_OK(views_builder.Finish(&out->buffers[1]));
+    const std::shared_ptr<Buffer>* data_buffers = values.GetVariadicBuffers();
+    out->buffers.insert(out->buffers.end(), data_buffers,
+                        data_buffers + values.num_variadic_buffers());
+    return Status::OK();
+  }
+};
+
 template <typename Type>
 struct ListImpl : public Selection<ListImpl<Type>, Type> {
   using offset_type = typename Type::offset_type;
@@ -2005,34 +2266,174 @@ Result<std::shared_ptr<ArrayData>> TakeAA(const std::shared_ptr<ArrayData>& valu
   return result.array();
 }
 
+// Take from the chunks of `values` without concatenating them.
+//
+// Indices are resolved to their chunk, and the indices falling in each chunk are
+// grouped to take from that chunk alone.  The values taken are concatenated
+// (an output-sized copy) and, unless the indices were sorted without nulls
+// (so that the groups are already in output order), put back in index order
+// with a final take.
+template <typename IndexCType>
+Result<std::shared_ptr<ArrayData>> TakeFromChunksImpl(const ChunkedArray& values,
+                                                      const ArrayData& indices,
+                                                      const TakeOptions& options,
+                                                      ExecContext* ctx) {
+  const int64_t length = indices.length;
+  const IndexCType* raw_indices = indices.GetValues<IndexCType>(1);
+  const uint8_t* indices_is_valid =
+      indices.MayHaveNulls() ? indices.buffers[0]->data() : nullptr;
+  const auto values_length = static_cast<uint64_t>(values.length());
+  const auto num_chunks = values.num_chunks();
+  ::arrow::internal::ChunkResolver resolver(values.chunks());
+
+  // First pass: resolve indices, count them per chunk and check whether the
+  // groups are in output order
+  std::vector<int64_t> chunk_counts(num_chunks, 0);
+  std::vector<::arrow::internal::ChunkLocation> locations(length);
+  bool sorted = indices.GetNullCount() == 0;
+  int64_t num_valid = 0;
+  int64_t last_chunk = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    if (indices_is_valid != nullptr &&
+        !bit_util::GetBit(indices_is_valid, indices.offset + i)) {
+      continue;
+    }
+    const IndexCType index = raw_indices[i];
+    if (options.boundscheck &&
+        ((std::is_signed<IndexCType>::value && index < 0) ||
+         static_cast<uint64_t>(index) >= values_length)) {
+      return Status::IndexError("Index ", std::to_string(index), " out of bounds");
+    }
+    locations[i] = resolver.Resolve(static_cast<int64_t>(index));
+    sorted &= locations[i].chunk_index >= last_chunk;
+    last_chunk = locations[i].chunk_index;
+    ++chunk_counts[locations[i].chunk_index];
+    ++num_valid;
+  }
+
+  // Second pass: group in-chunk indices by chunk, and record where each output
+  // value lands in the concatenated groups
+  std::vector<int64_t> chunk_starts(num_chunks + 1, 0);
+  for (int c = 0; c < num_chunks; ++c) {
+    chunk_starts[c + 1] = chunk_starts[c] + chunk_counts[c];
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> grouped_indices,
+                        AllocateBuffer(num_valid * sizeof(int64_t), ctx->memory_pool()));
+  auto grouped = reinterpret_cast<int64_t*>(grouped_indices->mutable_data());
+  std::shared_ptr<Buffer> positions_buffer;
+  int64_t* positions = nullptr;
+  if (!sorted) {
+    ARROW_ASSIGN_OR_RAISE(positions_buffer,
+                          AllocateBuffer(length * sizeof(int64_t), ctx->memory_pool()));
+    positions = reinterpret_cast<int64_t*>(positions_buffer->mutable_data());
+  }
+  std::vector<int64_t> cursors(chunk_starts.begin(), chunk_starts.end() - 1);
+  for (int64_t i = 0; i < length; ++i) {
+    if (indices_is_valid != nullptr &&
+        !bit_util::GetBit(indices_is_valid, indices.offset + i)) {
+      positions[i] = 0;
+      continue;
+    }
+    const int64_t position = cursors[locations[i].chunk_index]++;
+    grouped[position] = locations[i].index_in_chunk;
+    if (positions != nullptr) {
+      positions[i] = position;
+    }
+  }
+  locations.clear();
+  locations.shrink_to_fit();
+
+  // Take from each chunk with its group of indices
+  const auto no_boundscheck = TakeOptions::NoBoundsCheck();
+  ArrayVector taken;
+  for (int c = 0; c < num_chunks; ++c) {
+    if (chunk_counts[c] == 0) {
+      continue;
+    }
+    auto chunk_indices = ArrayData::Make(
+        int64(), chunk_counts[c], {nullptr, grouped_indices},
+        /*null_count=*/0, chunk_starts[c]);
+    ARROW_ASSIGN_OR_RAISE(
+        auto chunk_taken,
+        TakeAA(values.chunk(c)->data(), chunk_indices, no_boundscheck, ctx));
+    taken.push_back(MakeArray(std::move(chunk_taken)));
+  }
+  std::shared_ptr<Array> gathered;
+  if (taken.empty()) {
+    ARROW_ASSIGN_OR_RAISE(
+        gathered, MakeArrayOfNull(values.type(), /*length=*/0, ctx->memory_pool()));
+  } else if (taken.size() == 1) {
+    gathered = std::move(taken[0]);
+  } else {
+    ARROW_ASSIGN_OR_RAISE(gathered, Concatenate(taken, ctx->memory_pool()));
+  }
+  if (sorted) {
+    return gathered->data();
+  }
+
+  // Put the values back in index order, emitting nulls for null indices
+  std::shared_ptr<Buffer> positions_is_valid;
+  if (indices_is_valid != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(positions_is_valid,
+                          CopyBitmap(ctx->memory_pool(), indices_is_valid,
+                                     indices.offset, length));
+  }
+  auto positions_data =
+      ArrayData::Make(int64(), length, {std::move(positions_is_valid), positions_buffer},
+                      indices.GetNullCount());
+  return TakeAA(gathered->data(), positions_data, no_boundscheck, ctx);
+}
+
+Result<std::shared_ptr<ArrayData>> TakeFromChunks(const ChunkedArray& values,
+                                                  const ArrayData& indices,
+                                                  const TakeOptions& options,
+                                                  ExecContext* ctx) {
+  switch (indices.type->id()) {
+    case Type::INT8:
+      return TakeFromChunksImpl<int8_t>(values, indices, options, ctx);
+    case Type::INT16:
+      return TakeFromChunksImpl<int16_t>(values, indices, options, ctx);
+    case Type::INT32:
+      return TakeFromChunksImpl<int32_t>(values, indices, options, ctx);
+    case Type::INT64:
+      return TakeFromChunksImpl<int64_t>(values, indices, options, ctx);
+    case Type::UINT8:
+      return TakeFromChunksImpl<uint8_t>(values, indices, options, ctx);
+    case Type::UINT16:
+      return TakeFromChunksImpl<uint16_t>(values, indices, options, ctx);
+    case Type::UINT32:
+      return TakeFromChunksImpl<uint32_t>(values, indices, options, ctx);
+    case Type::UINT64:
+      return TakeFromChunksImpl<uint64_t>(values, indices, options, ctx);
+    default:
+      return Status::NotImplemented(
+          "Function 'take' has no kernel matching input types (",
+          values.type()->ToString(), ", ", indices.type->ToString(), ")");
+  }
+}
+
 Result<std::shared_ptr<ChunkedArray>> TakeCA(const ChunkedArray& values,
                                              const Array& indices,
                                              const TakeOptions& options,
                                              ExecContext* ctx) {
   auto num_chunks = values.num_chunks();
-  std::shared_ptr<Array> current_chunk;
+  std::shared_ptr<ArrayData> new_chunk;
 
-  // Case 1: `values` has a single chunk, so just use it
   if (num_chunks == 1) {
-    current_chunk = values.chunk(0);
+    // Case 1: `values` has a single chunk, so just use it
+    ARROW_ASSIGN_OR_RAISE(new_chunk,
+                          TakeAA(values.chunk(0)->data(), indices.data(), options, ctx));
+  } else if (num_chunks == 0) {
+    // Case 2: `values` is empty, so any non-null index is out of bounds
+    ARROW_ASSIGN_OR_RAISE(auto empty, MakeArrayOfNull(values.type(), /*length=*/0,
+                                                      ctx->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(new_chunk,
+                          TakeAA(empty->data(), indices.data(), options, ctx));
   } else {
-    // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
-    // See
-    // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
-    // TODO Case 3: If indices are sorted, can slice them and call Array Take
-
-    // Case 4: Else, concatenate chunks and call Array Take
-    if (values.chunks().empty()) {
-      ARROW_ASSIGN_OR_RAISE(current_chunk, MakeArrayOfNull(values.type(), /*length=*/0,
-                                                           ctx->memory_pool()));
-    } else {
-      ARROW_ASSIGN_OR_RAISE(current_chunk,
-                            Concatenate(values.chunks(), ctx->memory_pool()));
-    }
+    // Case 3: take from each chunk the indices fall in
+    ARROW_ASSIGN_OR_RAISE(new_chunk,
+                          TakeFromChunks(values, *indices.data(), options, ctx));
   }
-  // Call Array Take on our single chunk
-  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ArrayData> new_chunk,
-                        TakeAA(current_chunk->data(), indices.data(), options, ctx));
   std::vector<std::shared_ptr<Array>> chunks = {MakeArray(new_chunk)};
   return std::make_shared<ChunkedArray>(std::move(chunks));
 }
@@ -2044,14 +2445,10 @@ Result<std::shared_ptr<ChunkedArray>> TakeCC(const ChunkedArray& values,
   auto num_chunks = indices.num_chunks();
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
   for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
+    // Take with that indices chunk (TakeCA always returns a single chunk)
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> current_chunk,
                           TakeCA(values, *indices.chunk(i), options, ctx));
-    // Concatenate the result to make a single array for this chunk
-    ARROW_ASSIGN_OR_RAISE(new_chunks[i],
-                          Concatenate(current_chunk->chunks(), ctx->memory_pool()));
+    new_chunks[i] = current_chunk->chunk(0);
   }
   return std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
 }
@@ -2476,6 +2873,8 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
       {InputType(match::Primitive()), PrimitiveFilter},
       {InputType(match::BinaryLike()), BinaryFilter},
       {InputType(match::LargeBinaryLike()), BinaryFilter},
+      {InputType(Type::BINARY_VIEW), FilterExec<BinaryViewImpl>},
+      {InputType(Type::STRING_VIEW), FilterExec<BinaryViewImpl>},
       {InputType(Type::FIXED_SIZE_BINARY), FilterExec<FSBImpl>},
       {InputType(null()), NullFilter},
       {InputType(Type::DECIMAL128), FilterExec<FSBImpl>},
@@ -2487,6 +2886,7 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
       {InputType(Type::FIXED_SIZE_LIST), FilterExec<FSLImpl>},
       {InputType(Type::DENSE_UNION), FilterExec<DenseUnionImpl>},
       {InputType(Type::STRUCT), StructFilter},
+      {InputType(Type::RUN_END_ENCODED), RunEndEncodedFilter},
       // TODO: Reuse ListType kernel for MAP
       {InputType(Type::MAP), FilterExec<ListImpl<MapType>>},
   };
@@ -2504,6 +2904,8 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
       {InputType(match::Primitive()), PrimitiveTake},
       {InputType(match::BinaryLike()), TakeExec<VarBinaryImpl<BinaryType>>},
       {InputType(match::LargeBinaryLike()), TakeExec<VarBinaryImpl<LargeBinaryType>>},
+      {InputType(Type::BINARY_VIEW), TakeExec<BinaryViewImpl>},
+      {InputType(Type::STRING_VIEW), TakeExec<BinaryViewImpl>},
       {InputType(Type::FIXED_SIZE_BINARY), TakeExec<FSBImpl>},
       {InputType(null()), NullTake},
       {InputType(Type::DECIMAL128), TakeExec<FSBImpl>},
@@ -2515,6 +2917,7 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
       {InputType(Type::FIXED_SIZE_LIST), TakeExec<FSLImpl>},
       {InputType(Type::DENSE_UNION), TakeExec<DenseUnionImpl>},
       {InputType(Type::STRUCT), TakeExec<StructImpl>},
+      {InputType(Type::RUN_END_ENCODED), RunEndEncodedTake},
       // TODO: Reuse ListType kernel for MAP
       {InputType(Type::MAP), TakeExec<ListImpl<MapType>>},
   };
@@ -25,6 +25,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
+#include "arrow/util/bit_util.h"
 
 namespace arrow {
 namespace compute {
@@ -135,21 +136,52 @@ struct TakeBenchmark {
     Bench(values);
   }
 
-  void Bench(const std::shared_ptr<Array>& values) {
+  void ChunkedInt64(int64_t num_chunks) {
+    auto values = rand.Int64(args.size, -100, 100, args.null_proportion);
+    BenchChunked(values, num_chunks);
+  }
+
+  void ChunkedString(int64_t num_chunks) {
+    int32_t string_min_length = 0, string_max_length = 32;
+    auto values = rand.String(args.size, string_min_length, string_max_length,
+                              args.null_proportion);
+    BenchChunked(values, num_chunks);
+  }
+
+  std::shared_ptr<Array> MakeIndices(int64_t length) {
     double indices_null_proportion = indices_have_nulls ? args.null_proportion : 0;
-    auto indices =
-        rand.Int32(values->length(), 0, static_cast<int32_t>(values->length() - 1),
-                   indices_null_proportion);
+    auto indices = rand.Int32(length, 0, static_cast<int32_t>(length - 1),
+                              indices_null_proportion);
 
     if (monotonic_indices) {
       auto arg_sorter = *SortIndices(*indices);
       indices = *Take(*indices, *arg_sorter);
     }
+    return indices;
+  }
+
+  void Bench(const std::shared_ptr<Array>& values) {
+    auto indices = MakeIndices(values->length());
 
     for (auto _ : state) {
       ABORT_NOT_OK(Take(values, indices).status());
     }
   }
+
+  void BenchChunked(const std::shared_ptr<Array>& values, int64_t num_chunks) {
+    // Split values in chunks of equal length
+    const int64_t chunk_length = bit_util::CeilDiv(values->length(), num_chunks);
+    ArrayVector chunks;
+    for (int64_t offset = 0; offset < values->length(); offset += chunk_length) {
+      chunks.push_back(values->Slice(offset, chunk_length));
+    }
+    auto chunked_values = std::make_shared<ChunkedArray>(std::move(chunks));
+    auto indices = MakeIndices(values->length());
+
+    for (auto _ : state) {
+      ABORT_NOT_OK(Take(chunked_values, indices).status());
+    }
+  }
 };
 
 struct FilterBenchmark {
@@ -307,6 +339,24 @@ static void TakeStringMonotonicIndices(benchmark::State& state) {
   TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true).FSLInt64();
 }
 
+static void TakeChunkedInt64RandomIndices(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false).ChunkedInt64(/*num_chunks=*/100);
+}
+
+static void TakeChunkedInt64MonotonicIndices(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true)
+      .ChunkedInt64(/*num_chunks=*/100);
+}
+
+static void TakeChunkedStringRandomIndices(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false).ChunkedString(/*num_chunks=*/100);
+}
+
+static void TakeChunkedStringMonotonicIndices(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true)
+      .ChunkedString(/*num_chunks=*/100);
+}
+
 void FilterSetArgs(benchmark::internal::Benchmark* bench) {
   for (int64_t size : g_data_sizes) {
     for (int i = 0; i < static_cast<int>(g_filter_params.size()); ++i) {
@@ -349,6 +399,10 @@ BENCHMARK(TakeFSLInt64MonotonicIndices)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringRandomIndicesNoNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringRandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringMonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedInt64RandomIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedInt64MonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedStringRandomIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedStringMonotonicIndices)->Apply(TakeSetArgs);
 
 }  // namespace compute
 }  // namespace arrow
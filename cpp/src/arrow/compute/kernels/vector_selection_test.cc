@@ -1218,6 +1218,21 @@ TYPED_TEST(TestTakeKernelWithString, TakeDictionary) {
   this->AssertTakeDictionary(dict, "[3, 4, 2]", "[null, 1, 0]", "[null, 4, 3]");
 }
 
+TEST(TestTakeKernelBinaryView, TakeBinaryView) {
+  for (auto type : {binary_view(), utf8_view()}) {
+    ARROW_SCOPED_TRACE("type = ", *type);
+    const char* values = R"(["a", null, "longer than twelve bytes", ""])";
+    CheckTake(type, values, "[2, 0, 2, 3]",
+              R"(["longer than twelve bytes", "a", "longer than twelve bytes", ""])");
+    CheckTake(type, values, "[null, 1, 2]",
+              R"([null, null, "longer than twelve bytes"])");
+    CheckTake(type, values, "[]", "[]");
+
+    std::shared_ptr<Array> arr;
+    ASSERT_RAISES(IndexError, TakeJSON(type, values, int8(), "[0, 4]", &arr));
+  }
+}
+
 class TestTakeKernelFSB : public TestTakeKernelTyped<FixedSizeBinaryType> {
  public:
   std::shared_ptr<DataType> value_type() { return fixed_size_binary(3); }
@@ -1669,6 +1684,54 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
   ASSERT_RAISES(IndexError, this->TakeWithChunkedArray(int8(), {"[]"}, {"[0]"}, &arr));
 }
 
+TEST_F(TestTakeKernelWithChunkedArray, TakeFromManyChunks) {
+  // Values are taken from the chunks directly, check against taking from the
+  // concatenated chunks
+  auto check = [](const std::shared_ptr<ChunkedArray>& values,
+                  const std::shared_ptr<Array>& indices) {
+    ARROW_SCOPED_TRACE("indices = ", indices->ToString());
+    ASSERT_OK_AND_ASSIGN(auto concatenated, Concatenate(values->chunks()));
+    ASSERT_OK_AND_ASSIGN(Datum expected, Take(concatenated, indices));
+    ASSERT_OK_AND_ASSIGN(Datum actual, Take(values, indices));
+    ValidateOutput(actual);
+    ASSERT_EQ(actual.chunked_array()->num_chunks(), 1);
+    AssertArraysEqual(*expected.make_array(), *actual.chunked_array()->chunk(0),
+                      /*verbose=*/true);
+  };
+
+  for (const auto& values : {
+           ChunkedArrayFromJSON(int16(), {"[1, 2]", "[]", "[3]", "[null, 5, 6]", "[7]"}),
+           ChunkedArrayFromJSON(utf8(), {R"(["a", "b"])", "[]", R"(["c"])",
+                                         R"([null, "e", "f"])", R"(["g"])"}),
+           ChunkedArrayFromJSON(list(int32()), {"[[1], []]", "[]", "[[3, 4]]",
+                                                "[null, [5], [6]]", "[[7, 8]]"})}) {
+    ARROW_SCOPED_TRACE("type = ", values->type()->ToString());
+    // Random order, with nulls
+    check(values, ArrayFromJSON(int32(), "[6, 0, null, 3, 3, 1, null, 5, 2, 0]"));
+    check(values, ArrayFromJSON(uint8(), "[4, 2]"));
+    check(values, ArrayFromJSON(int64(), "[null, null]"));
+    // Sorted, touching some chunks only
+    check(values, ArrayFromJSON(int8(), "[0, 0, 1, 4, 5]"));
+    check(values, ArrayFromJSON(uint64(), "[2, 3, 4, 5, 6]"));
+    check(values, ArrayFromJSON(int16(), "[]"));
+    // Sliced indices
+    check(values, ArrayFromJSON(int32(), "[1, null, 5, 0, 4, 3]")->Slice(1, 4));
+
+    ASSERT_RAISES_WITH_MESSAGE(IndexError, "Index error: Index 7 out of bounds",
+                               Take(values, ArrayFromJSON(int32(), "[0, 7]")));
+    ASSERT_RAISES_WITH_MESSAGE(IndexError, "Index error: Index -1 out of bounds",
+                               Take(values, ArrayFromJSON(int8(), "[-1]")));
+  }
+
+  // Chunks with different dictionaries
+  auto dict_type = dictionary(int8(), utf8());
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{DictArrayFromJSON(dict_type, "[0, 1]", R"(["a", "b"])"),
+                  DictArrayFromJSON(dict_type, "[1, null, 0]", R"(["c", "a"])")});
+  check(values, ArrayFromJSON(int32(), "[4, 0, null, 2, 1]"));
+  check(values, ArrayFromJSON(int32(), "[1, 2, 4]"));
+}
+
 class TestTakeKernelWithTable : public TestTakeKernelTyped<Table> {
  public:
   void AssertTake(const std::shared_ptr<Schema>& schm,
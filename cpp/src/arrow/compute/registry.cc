@@ -295,6 +295,7 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
   RegisterVectorHash(registry.get());
   RegisterVectorNested(registry.get());
   RegisterVectorReplace(registry.get());
+  RegisterVectorRunEndEncode(registry.get());
   RegisterVectorSelection(registry.get());
   RegisterVectorSort(registry.get());
 
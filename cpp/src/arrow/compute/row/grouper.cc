@@ -17,8 +17,12 @@
 
 #include "arrow/compute/row/grouper.h"
 
+#include <algorithm>
+#include <limits>
 #include <mutex>
+#include <type_traits>
 
+#include "arrow/array/util.h"
 #include "arrow/compute/exec/key_hash.h"
 #include "arrow/compute/exec/key_map.h"
 #include "arrow/compute/exec/options.h"
@@ -29,6 +33,7 @@
 #include "arrow/compute/registry.h"
 #include "arrow/compute/row/compare_internal.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
@@ -529,14 +534,476 @@ struct GrouperFastImpl : Grouper {
   SwissTable::AppendImpl map_append_impl_;
 };
 
+Result<std::unique_ptr<Grouper>> MakeHashGrouper(const std::vector<TypeHolder>& key_types,
+                                                 ExecContext* ctx) {
+  if (GrouperFastImpl::CanUse(key_types)) {
+    return GrouperFastImpl::Make(key_types, ctx);
+  }
+  return GrouperImpl::Make(key_types, ctx);
+}
+
+// Order-preserving mapping of signed and unsigned integers to uint64_t
+constexpr uint64_t kKeyBitsSignBit = uint64_t(1) << 63;
+
+template <typename CType>
+uint64_t ToKeyBits(CType value) {
+  return std::is_signed<CType>::value
+             ? static_cast<uint64_t>(static_cast<int64_t>(value)) ^ kKeyBitsSignBit
+             : static_cast<uint64_t>(value);
+}
+
+template <typename CType>
+CType FromKeyBits(uint64_t bits) {
+  return std::is_signed<CType>::value
+             ? static_cast<CType>(static_cast<int64_t>(bits ^ kKeyBitsSignBit))
+             : static_cast<CType>(bits);
+}
+
+template <typename CType>
+void DecodeKeyBits(const ArraySpan& data, uint64_t* out) {
+  const CType* values = data.GetValues<CType>(1);
+  for (int64_t i = 0; i < data.length; ++i) {
+    out[i] = ToKeyBits(values[i]);
+  }
+}
+
+template <typename CType>
+void EncodeKeyBits(const std::vector<uint64_t>& bits, uint8_t* out) {
+  CType* values = reinterpret_cast<CType*>(out);
+  for (size_t i = 0; i < bits.size(); ++i) {
+    values[i] = FromKeyBits<CType>(bits[i]);
+  }
+}
+
+// Groups boolean, integer and dictionary keys by addressing a table with the key
+// values: each key column contributes its offset from the minimum observed value
+// (or 0 for null) scaled by the product of the ranges of the preceding columns.
+// This maps a single bounded column to its own direct index and several columns
+// whose combined range is small to a compact table, without hashing or comparing
+// keys. The covered ranges grow as new values are observed, and once the table
+// would exceed kMaxSlots the groups are handed over to a hash based grouper, which
+// consumes all further batches. The group ids assigned so far are kept by mapping
+// the ids of the hash grouper back to them.
+struct GrouperDirectImpl : Grouper {
+  // Bounds the table to 1MiB
+  static constexpr uint64_t kMaxSlots = uint64_t(1) << 18;
+  static constexpr uint32_t kEmptySlot = std::numeric_limits<uint32_t>::max();
+
+  struct KeyRange {
+    bool any = false;
+    uint64_t min = std::numeric_limits<uint64_t>::max();
+    uint64_t max = 0;
+
+    void Add(uint64_t bits) {
+      any = true;
+      min = std::min(min, bits);
+      max = std::max(max, bits);
+    }
+    void Add(const KeyRange& other) {
+      if (other.any) {
+        Add(other.min);
+        Add(other.max);
+      }
+    }
+    bool Covers(const KeyRange& other) const {
+      return !other.any || (any && min <= other.min && other.max <= max);
+    }
+  };
+
+  struct KeyColumn {
+    TypeHolder type;
+    // type of the values addressing the table (the index type of dictionaries)
+    Type::type bits_id;
+    // range of values covered by the table
+    KeyRange range;
+    uint64_t stride = 1;
+    std::shared_ptr<Array> dictionary;
+    // key values of each group
+    std::vector<uint64_t> group_bits;
+    std::vector<bool> group_valid;
+  };
+
+  static bool CanUse(const std::vector<TypeHolder>& key_types) {
+    if (key_types.empty()) return false;
+    for (const auto& key : key_types) {
+      if (!is_integer(key.id()) && key.id() != Type::BOOL &&
+          key.id() != Type::DICTIONARY) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static Result<std::unique_ptr<GrouperDirectImpl>> Make(
+      const std::vector<TypeHolder>& key_types, ExecContext* ctx) {
+    auto impl = ::arrow::internal::make_unique<GrouperDirectImpl>();
+    impl->ctx_ = ctx;
+    impl->key_types_ = key_types;
+    impl->columns_.resize(key_types.size());
+    for (size_t i = 0; i < key_types.size(); ++i) {
+      KeyColumn* column = &impl->columns_[i];
+      column->type = key_types[i];
+      column->bits_id = key_types[i].id();
+      if (column->bits_id == Type::DICTIONARY) {
+        column->bits_id =
+            checked_cast<const DictionaryType&>(*key_types[i]).index_type()->id();
+      } else if (column->bits_id == Type::BOOL) {
+        column->range.Add(0);
+        column->range.Add(1);
+      }
+    }
+    RETURN_NOT_OK(impl->ResizeTable(impl->RangesOf(impl->columns_)).status());
+    return std::move(impl);
+  }
+
+  Result<Datum> Consume(const ExecSpan& batch) override {
+    if (hash_grouper_) return ConsumeHashed(batch);
+
+    const size_t num_columns = columns_.size();
+    const int64_t num_rows = batch.length;
+
+    // Decode key values, broadcasting scalars as arrays of length 1
+    std::vector<std::shared_ptr<ArrayData>> scalar_arrays(num_columns);
+    std::vector<ArraySpan> spans(num_columns);
+    std::vector<std::vector<uint64_t>> bits(num_columns);
+    std::vector<KeyRange> ranges(num_columns);
+    for (size_t i = 0; i < num_columns; ++i) {
+      if (batch[i].is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto array, MakeArrayFromScalar(*batch[i].scalar, 1, ctx_->memory_pool()));
+        scalar_arrays[i] = array->data();
+        spans[i].SetMembers(*scalar_arrays[i]);
+      } else {
+        spans[i] = batch[i].array;
+      }
+      RETURN_NOT_OK(CheckDictionary(&columns_[i], spans[i]));
+      DecodeColumn(columns_[i], spans[i], &bits[i]);
+      for (int64_t row = 0; row < spans[i].length; ++row) {
+        if (spans[i].IsValid(row)) ranges[i].Add(bits[i][row]);
+      }
+    }
+
+    bool covered = true;
+    for (size_t i = 0; i < num_columns; ++i) {
+      covered &= columns_[i].range.Covers(ranges[i]);
+    }
+    if (!covered) {
+      ARROW_ASSIGN_OR_RAISE(bool resized, ResizeTable(ranges));
+      if (!resized) {
+        RETURN_NOT_OK(SwitchToHashGrouper());
+        return ConsumeHashed(batch);
+      }
+    }
+
+    // Compute the slot of each row
+    std::vector<uint32_t> slots(num_rows, 0);
+    for (size_t i = 0; i < num_columns; ++i) {
+      const KeyColumn& column = columns_[i];
+      if (spans[i].length != num_rows) {
+        const uint32_t slot = SlotOf(column, spans[i].IsValid(0), bits[i][0]);
+        for (int64_t row = 0; row < num_rows; ++row) {
+          slots[row] += slot;
+        }
+        continue;
+      }
+      for (int64_t row = 0; row < num_rows; ++row) {
+        slots[row] += SlotOf(column, spans[i].IsValid(row), bits[i][row]);
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> group_ids,
+        AllocateBuffer(num_rows * sizeof(uint32_t), ctx_->memory_pool()));
+    auto ids = reinterpret_cast<uint32_t*>(group_ids->mutable_data());
+    for (int64_t row = 0; row < num_rows; ++row) {
+      uint32_t* group = &table_[slots[row]];
+      if (*group == kEmptySlot) {
+        *group = num_groups_++;
+        for (size_t i = 0; i < num_columns; ++i) {
+          const int64_t index = spans[i].length != num_rows ? 0 : row;
+          columns_[i].group_bits.push_back(bits[i][index]);
+          columns_[i].group_valid.push_back(spans[i].IsValid(index));
+        }
+      }
+      ids[row] = *group;
+    }
+    return Datum(UInt32Array(num_rows, std::move(group_ids)));
+  }
+
+  uint32_t num_groups() const override {
+    return hash_grouper_ ? hash_grouper_->num_groups() : num_groups_;
+  }
+
+  Result<ExecBatch> GetUniques() override {
+    if (hash_grouper_) {
+      ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, hash_grouper_->GetUniques());
+      if (hash_ids_.empty()) return uniques;
+
+      // Reorder the groups which existed before switching to the hash grouper
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices,
+                            AllocateBuffer(uniques.length * sizeof(uint32_t),
+                                           ctx_->memory_pool()));
+      auto indices_data = reinterpret_cast<uint32_t*>(indices->mutable_data());
+      std::copy(hash_ids_.begin(), hash_ids_.end(), indices_data);
+      for (auto i = static_cast<uint32_t>(hash_ids_.size()); i < uniques.length; ++i) {
+        indices_data[i] = i;
+      }
+      UInt32Array indices_array(uniques.length, std::move(indices));
+      for (Datum& value : uniques.values) {
+        ARROW_ASSIGN_OR_RAISE(value, compute::Take(value, indices_array,
+                                                   TakeOptions::NoBoundsCheck(), ctx_));
+      }
+      return uniques;
+    }
+
+    ExecBatch out({}, num_groups_);
+    out.values.resize(columns_.size());
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      const KeyColumn& column = columns_[i];
+
+      std::shared_ptr<Buffer> validity;
+      int64_t null_count = 0;
+      for (bool valid : column.group_valid) {
+        null_count += !valid;
+      }
+      if (null_count > 0) {
+        ARROW_ASSIGN_OR_RAISE(validity,
+                              AllocateEmptyBitmap(num_groups_, ctx_->memory_pool()));
+        for (uint32_t g = 0; g < num_groups_; ++g) {
+          if (column.group_valid[g]) bit_util::SetBit(validity->mutable_data(), g);
+        }
+      }
+
+      std::shared_ptr<Buffer> values;
+      if (column.bits_id == Type::BOOL) {
+        ARROW_ASSIGN_OR_RAISE(values,
+                              AllocateEmptyBitmap(num_groups_, ctx_->memory_pool()));
+        for (uint32_t g = 0; g < num_groups_; ++g) {
+          if (column.group_bits[g] != 0) bit_util::SetBit(values->mutable_data(), g);
+        }
+      } else {
+        const int byte_width = bit_width(column.bits_id) / 8;
+        ARROW_ASSIGN_OR_RAISE(
+            values, AllocateBuffer(num_groups_ * byte_width, ctx_->memory_pool()));
+        EncodeColumn(column, values->mutable_data());
+      }
+
+      auto data = ArrayData::Make(column.type.GetSharedPtr(), num_groups_,
+                                  {std::move(validity), std::move(values)}, null_count);
+      if (column.type.id() == Type::DICTIONARY) {
+        if (column.dictionary) {
+          data->dictionary = column.dictionary->data();
+        } else {
+          ARROW_ASSIGN_OR_RAISE(auto dict,
+                                MakeArrayOfNull(column.type.GetSharedPtr(), 0));
+          data->dictionary = dict->data();
+        }
+      }
+      out.values[i] = std::move(data);
+    }
+    return out;
+  }
+
+ private:
+  static std::vector<KeyRange> RangesOf(const std::vector<KeyColumn>& columns) {
+    std::vector<KeyRange> ranges(columns.size());
+    for (size_t i = 0; i < columns.size(); ++i) {
+      ranges[i] = columns[i].range;
+    }
+    return ranges;
+  }
+
+  // Count the slots needed to cover the given ranges, or return false if there are
+  // more than kMaxSlots
+  static bool CountSlots(const std::vector<KeyRange>& ranges, uint64_t* num_slots) {
+    *num_slots = 1;
+    for (const auto& range : ranges) {
+      // One slot per value and one for null
+      uint64_t width = 1;
+      if (range.any) {
+        if (range.max - range.min >= kMaxSlots) return false;
+        width += range.max - range.min + 1;
+      }
+      *num_slots *= width;
+      if (*num_slots > kMaxSlots) return false;
+    }
+    return true;
+  }
+
+  static uint32_t SlotOf(const KeyColumn& column, bool valid, uint64_t bits) {
+    return valid ? static_cast<uint32_t>((bits - column.range.min + 1) * column.stride)
+                 : 0;
+  }
+
+  static void DecodeColumn(const KeyColumn& column, const ArraySpan& data,
+                           std::vector<uint64_t>* out) {
+    out->resize(data.length);
+    switch (column.bits_id) {
+      case Type::BOOL:
+        for (int64_t i = 0; i < data.length; ++i) {
+          (*out)[i] = bit_util::GetBit(data.buffers[1].data, data.offset + i);
+        }
+        break;
+      case Type::INT8:
+        return DecodeKeyBits<int8_t>(data, out->data());
+      case Type::UINT8:
+        return DecodeKeyBits<uint8_t>(data, out->data());
+      case Type::INT16:
+        return DecodeKeyBits<int16_t>(data, out->data());
+      case Type::UINT16:
+        return DecodeKeyBits<uint16_t>(data, out->data());
+      case Type::INT32:
+        return DecodeKeyBits<int32_t>(data, out->data());
+      case Type::UINT32:
+        return DecodeKeyBits<uint32_t>(data, out->data());
+      case Type::INT64:
+        return DecodeKeyBits<int64_t>(data, out->data());
+      case Type::UINT64:
+        return DecodeKeyBits<uint64_t>(data, out->data());
+      default:
+        DCHECK(false) << "unexpected key type";
+    }
+  }
+
+  static void EncodeColumn(const KeyColumn& column, uint8_t* out) {
+    switch (column.bits_id) {
+      case Type::INT8:
+        return EncodeKeyBits<int8_t>(column.group_bits, out);
+      case Type::UINT8:
+        return EncodeKeyBits<uint8_t>(column.group_bits, out);
+      case Type::INT16:
+        return EncodeKeyBits<int16_t>(column.group_bits, out);
+      case Type::UINT16:
+        return EncodeKeyBits<uint16_t>(column.group_bits, out);
+      case Type::INT32:
+        return EncodeKeyBits<int32_t>(column.group_bits, out);
+      case Type::UINT32:
+        return EncodeKeyBits<uint32_t>(column.group_bits, out);
+      case Type::INT64:
+        return EncodeKeyBits<int64_t>(column.group_bits, out);
+      case Type::UINT64:
+        return EncodeKeyBits<uint64_t>(column.group_bits, out);
+      default:
+        DCHECK(false) << "unexpected key type";
+    }
+  }
+
+  Status CheckDictionary(KeyColumn* column, const ArraySpan& data) {
+    if (column->type.id() != Type::DICTIONARY) return Status::OK();
+    auto dict = MakeArray(data.dictionary().ToArrayData());
+    if (column->dictionary) {
+      if (!column->dictionary->Equals(dict)) {
+        // Same limitation as GrouperFastImpl::ConsumeImpl
+        return Status::NotImplemented("Unifying differing dictionaries");
+      }
+    } else {
+      column->dictionary = std::move(dict);
+    }
+    return Status::OK();
+  }
+
+  // Grow the table to cover the given ranges in addition to the current ones, or
+  // return false if that would take more than kMaxSlots. Ranges which grow are padded
+  // by half their size, so that steadily growing keys are not rehoused on every batch.
+  Result<bool> ResizeTable(const std::vector<KeyRange>& observed) {
+    std::vector<KeyRange> exact = RangesOf(columns_);
+    std::vector<KeyRange> padded(columns_.size());
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      const KeyRange current = exact[i];
+      exact[i].Add(observed[i]);
+      padded[i] = exact[i];
+      if (!current.any || current.Covers(exact[i])) continue;
+
+      const uint64_t padding = (exact[i].max - exact[i].min) / 2;
+      if (exact[i].min < current.min) {
+        padded[i].min = exact[i].min < padding ? 0 : exact[i].min - padding;
+      }
+      if (exact[i].max > current.max) {
+        padded[i].max = exact[i].max > std::numeric_limits<uint64_t>::max() - padding
+                            ? std::numeric_limits<uint64_t>::max()
+                            : exact[i].max + padding;
+      }
+    }
+
+    uint64_t num_slots, num_padded_slots;
+    if (!CountSlots(exact, &num_slots)) return false;
+    const std::vector<KeyRange>* ranges = &exact;
+    if (CountSlots(padded, &num_padded_slots)) {
+      ranges = &padded;
+      num_slots = num_padded_slots;
+    }
+
+    uint64_t stride = 1;
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      const KeyRange& range = (*ranges)[i];
+      columns_[i].range = range;
+      columns_[i].stride = stride;
+      stride *= range.any ? range.max - range.min + 2 : 1;
+    }
+
+    table_.assign(num_slots, kEmptySlot);
+    for (uint32_t g = 0; g < num_groups_; ++g) {
+      uint32_t slot = 0;
+      for (const auto& column : columns_) {
+        slot += SlotOf(column, column.group_valid[g], column.group_bits[g]);
+      }
+      table_[slot] = g;
+    }
+    return true;
+  }
+
+  Status SwitchToHashGrouper() {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, GetUniques());
+    ARROW_ASSIGN_OR_RAISE(auto hash_grouper, MakeHashGrouper(key_types_, ctx_));
+    if (num_groups_ > 0) {
+      ARROW_ASSIGN_OR_RAISE(Datum ids, hash_grouper->Consume(ExecSpan(uniques)));
+      const uint32_t* hash_ids = ids.array()->GetValues<uint32_t>(1);
+      hash_ids_.assign(hash_ids, hash_ids + num_groups_);
+      group_ids_.resize(num_groups_);
+      for (uint32_t g = 0; g < num_groups_; ++g) {
+        group_ids_[hash_ids_[g]] = g;
+      }
+    }
+    hash_grouper_ = std::move(hash_grouper);
+    table_ = {};
+    columns_ = {};
+    return Status::OK();
+  }
+
+  Result<Datum> ConsumeHashed(const ExecSpan& batch) {
+    ARROW_ASSIGN_OR_RAISE(Datum ids, hash_grouper_->Consume(batch));
+    if (group_ids_.empty()) return ids;
+
+    // The hash grouper numbers the groups which existed before switching to it
+    // differently, while groups added since then get the same ids
+    uint32_t* data = ids.array()->GetMutableValues<uint32_t>(1);
+    for (int64_t i = 0; i < ids.length(); ++i) {
+      if (data[i] < group_ids_.size()) data[i] = group_ids_[data[i]];
+    }
+    return ids;
+  }
+
+  ExecContext* ctx_;
+  std::vector<TypeHolder> key_types_;
+  std::vector<KeyColumn> columns_;
+  std::vector<uint32_t> table_;
+  uint32_t num_groups_ = 0;
+
+  std::unique_ptr<Grouper> hash_grouper_;
+  // For the groups which existed before switching to the hash grouper, their ids
+  // in the hash grouper and the reverse mapping
+  std::vector<uint32_t> hash_ids_;
+  std::vector<uint32_t> group_ids_;
+};
+
 }  // namespace
 
 Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<TypeHolder>& key_types,
                                                ExecContext* ctx) {
-  if (GrouperFastImpl::CanUse(key_types)) {
-    return GrouperFastImpl::Make(key_types, ctx);
+  if (GrouperDirectImpl::CanUse(key_types)) {
+    return GrouperDirectImpl::Make(key_types, ctx);
   }
-  return GrouperImpl::Make(key_types, ctx);
+  return MakeHashGrouper(key_types, ctx);
 }
 
 Result<std::shared_ptr<ListArray>> Grouper::ApplyGroupings(const ListArray& groupings,
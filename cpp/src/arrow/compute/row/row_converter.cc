@@ -0,0 +1,286 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/row/row_converter.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "arrow/array/data.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/compute/light_array.h"
+#include "arrow/compute/row/encode_internal.h"
+#include "arrow/compute/row/row_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/make_unique.h"
+
+namespace arrow {
+namespace compute {
+
+EncodedRows::EncodedRows() = default;
+
+EncodedRows::~EncodedRows() = default;
+
+int64_t EncodedRows::num_rows() const { return rows_ ? rows_->length() : 0; }
+
+bool EncodedRows::is_fixed_length() const {
+  return rows_ ? rows_->metadata().is_fixed_length : true;
+}
+
+util::string_view EncodedRows::row(int64_t i) const {
+  DCHECK_GE(i, 0);
+  DCHECK_LT(i, num_rows());
+  const RowTableMetadata& metadata = rows_->metadata();
+  if (metadata.is_fixed_length) {
+    return util::string_view(
+        reinterpret_cast<const char*>(rows_->data(1)) + i * metadata.fixed_length,
+        metadata.fixed_length);
+  }
+  const uint32_t* offsets = rows_->offsets();
+  return util::string_view(reinterpret_cast<const char*>(rows_->data(2)) + offsets[i],
+                           offsets[i + 1] - offsets[i]);
+}
+
+bool EncodedRows::IsNull(int64_t i, int column) const {
+  DCHECK_GE(i, 0);
+  DCHECK_LT(i, num_rows());
+  const RowTableMetadata& metadata = rows_->metadata();
+  const int64_t bit_id = i * metadata.null_masks_bytes_per_row * 8 +
+                         metadata.pos_after_encoding(static_cast<uint32_t>(column));
+  return bit_util::GetBit(rows_->null_masks(), bit_id);
+}
+
+class RowConverter::Impl {
+ public:
+  // Same mini-batch size and padding as the group-by's use of the row encoder
+  static constexpr int kMiniBatchLength = 1024;
+  static constexpr int kPaddingForSIMD = 64;
+
+  explicit Impl(MemoryPool* pool) : pool_(pool) {}
+
+  Status Init(const Schema& schema) {
+    const int num_columns = schema.num_fields();
+    types_.resize(num_columns);
+    col_metadata_.resize(num_columns);
+    for (int i = 0; i < num_columns; ++i) {
+      const auto& type = schema.field(i)->type();
+      if (type->id() == Type::DICTIONARY || is_large_binary_like(type->id())) {
+        return Status::NotImplemented("Row conversion of columns of type ", *type);
+      }
+      ARROW_ASSIGN_OR_RAISE(col_metadata_[i], ColumnMetadataFromDataType(type));
+      types_[i] = type;
+    }
+    hardware_flags_ = arrow::internal::CpuInfo::GetInstance()->hardware_flags();
+    RETURN_NOT_OK(temp_stack_.Init(pool_, 64 * kMiniBatchLength));
+    encoder_.Init(col_metadata_, /*row_alignment=*/sizeof(uint64_t),
+                  /*string_alignment=*/sizeof(uint64_t));
+    RETURN_NOT_OK(minibatch_.Init(pool_, encoder_.row_metadata()));
+    cols_.resize(num_columns);
+    identity_selection_.resize(kMiniBatchLength);
+    std::iota(identity_selection_.begin(), identity_selection_.end(), 0);
+    return Status::OK();
+  }
+
+  Status Encode(const RecordBatch& batch, RowTableImpl* rows) {
+    const int64_t num_rows = batch.num_rows();
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      if (col_metadata_[i].is_null_type) {
+        cols_[i] = KeyColumnArray(col_metadata_[i], num_rows,
+                                  static_cast<const uint8_t*>(nullptr), nullptr, nullptr);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(cols_[i],
+                              ColumnArrayFromArrayData(batch.column_data(i), 0, num_rows));
+      }
+    }
+    for (int64_t start_row = 0; start_row < num_rows;) {
+      const auto next_batch_size = static_cast<uint32_t>(
+          std::min(num_rows - start_row, static_cast<int64_t>(kMiniBatchLength)));
+      encoder_.PrepareEncodeSelected(start_row, next_batch_size, cols_);
+      RETURN_NOT_OK(encoder_.EncodeSelected(&minibatch_, next_batch_size,
+                                            identity_selection_.data()));
+      RETURN_NOT_OK(rows->AppendSelectionFrom(minibatch_, next_batch_size,
+                                              /*source_row_ids=*/nullptr));
+      start_row += next_batch_size;
+    }
+    return Status::OK();
+  }
+
+  Result<std::vector<std::shared_ptr<ArrayData>>> Decode(const RowTableImpl& rows,
+                                                         int64_t offset, int64_t length) {
+    const auto num_columns = static_cast<int>(col_metadata_.size());
+    std::vector<std::shared_ptr<Buffer>> validity_bufs(num_columns);
+    std::vector<std::shared_ptr<Buffer>> fixedlen_bufs(num_columns);
+    std::vector<std::shared_ptr<Buffer>> varlen_bufs(num_columns);
+
+    for (int i = 0; i < num_columns; ++i) {
+      const KeyColumnMetadata& metadata = col_metadata_[i];
+      if (metadata.is_null_type) {
+        cols_[i] = KeyColumnArray(metadata, length, static_cast<uint8_t*>(nullptr),
+                                  nullptr, nullptr);
+        continue;
+      }
+      ARROW_ASSIGN_OR_RAISE(validity_bufs[i],
+                            AllocatePaddedBuffer(bit_util::BytesForBits(length)));
+      int64_t fixedlen_size;
+      if (!metadata.is_fixed_length) {
+        fixedlen_size = (length + 1) * sizeof(uint32_t);
+      } else if (metadata.fixed_length == 0) {
+        fixedlen_size = bit_util::BytesForBits(length);
+      } else {
+        fixedlen_size = length * metadata.fixed_length;
+      }
+      ARROW_ASSIGN_OR_RAISE(fixedlen_bufs[i], AllocatePaddedBuffer(fixedlen_size));
+      cols_[i] = KeyColumnArray(metadata, length, validity_bufs[i]->mutable_data(),
+                                fixedlen_bufs[i]->mutable_data(), nullptr);
+    }
+
+    for (int64_t start_row = 0; start_row < length;) {
+      const int64_t next_batch_size =
+          std::min(length - start_row, static_cast<int64_t>(kMiniBatchLength));
+      encoder_.DecodeFixedLengthBuffers(offset + start_row, start_row, next_batch_size,
+                                        rows, &cols_, hardware_flags_, &temp_stack_);
+      start_row += next_batch_size;
+    }
+
+    if (!rows.metadata().is_fixed_length) {
+      // The offsets are known now, allocate the data buffers of varlength columns
+      for (int i = 0; i < num_columns; ++i) {
+        if (col_metadata_[i].is_fixed_length) continue;
+        const auto varlen_size =
+            reinterpret_cast<const uint32_t*>(fixedlen_bufs[i]->data())[length];
+        ARROW_ASSIGN_OR_RAISE(varlen_bufs[i], AllocatePaddedBuffer(varlen_size));
+        cols_[i] = KeyColumnArray(col_metadata_[i], length,
+                                  validity_bufs[i]->mutable_data(),
+                                  fixedlen_bufs[i]->mutable_data(),
+                                  varlen_bufs[i]->mutable_data());
+      }
+      for (int64_t start_row = 0; start_row < length;) {
+        const int64_t next_batch_size =
+            std::min(length - start_row, static_cast<int64_t>(kMiniBatchLength));
+        encoder_.DecodeVaryingLengthBuffers(offset + start_row, start_row,
+                                            next_batch_size, rows, &cols_,
+                                            hardware_flags_, &temp_stack_);
+        start_row += next_batch_size;
+      }
+    }
+
+    std::vector<std::shared_ptr<ArrayData>> columns(num_columns);
+    for (int i = 0; i < num_columns; ++i) {
+      if (col_metadata_[i].is_null_type) {
+        columns[i] = ArrayData::Make(null(), length, {nullptr}, length);
+        continue;
+      }
+      const int64_t null_count =
+          length - arrow::internal::CountSetBits(validity_bufs[i]->data(), 0, length);
+      if (col_metadata_[i].is_fixed_length) {
+        columns[i] = ArrayData::Make(
+            types_[i], length, {std::move(validity_bufs[i]), std::move(fixedlen_bufs[i])},
+            null_count);
+      } else {
+        columns[i] = ArrayData::Make(
+            types_[i], length,
+            {std::move(validity_bufs[i]), std::move(fixedlen_bufs[i]),
+             std::move(varlen_bufs[i])},
+            null_count);
+      }
+    }
+    return columns;
+  }
+
+  const RowTableMetadata& row_metadata() { return encoder_.row_metadata(); }
+
+  MemoryPool* pool() const { return pool_; }
+
+ private:
+  // The row decoders may read or write a few bytes past the end of their output
+  Result<std::shared_ptr<Buffer>> AllocatePaddedBuffer(int64_t size) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buf,
+                          AllocateBuffer(size + kPaddingForSIMD, pool_));
+    return SliceMutableBuffer(buf, 0, size);
+  }
+
+  MemoryPool* pool_;
+  int64_t hardware_flags_ = 0;
+  std::vector<std::shared_ptr<DataType>> types_;
+  std::vector<KeyColumnMetadata> col_metadata_;
+  std::vector<KeyColumnArray> cols_;
+  std::vector<uint16_t> identity_selection_;
+  util::TempVectorStack temp_stack_;
+  RowTableEncoder encoder_;
+  RowTableImpl minibatch_;
+};
+
+RowConverter::RowConverter(std::shared_ptr<Schema> schema, MemoryPool* pool)
+    : schema_(std::move(schema)), impl_(new Impl(pool)) {}
+
+RowConverter::~RowConverter() = default;
+
+Result<std::unique_ptr<RowConverter>> RowConverter::Make(std::shared_ptr<Schema> schema,
+                                                         MemoryPool* pool) {
+  std::unique_ptr<RowConverter> converter(new RowConverter(std::move(schema), pool));
+  RETURN_NOT_OK(converter->impl_->Init(*converter->schema_));
+  return std::move(converter);
+}
+
+Status RowConverter::Encode(const RecordBatch& batch, EncodedRows* out) {
+  if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+    return Status::Invalid("RecordBatch schema does not match the RowConverter schema: ",
+                           batch.schema()->ToString(), " vs ", schema_->ToString());
+  }
+  if (out->rows_ == nullptr ||
+      !out->rows_->metadata().is_compatible(impl_->row_metadata())) {
+    out->rows_ = ::arrow::internal::make_unique<RowTableImpl>();
+    RETURN_NOT_OK(out->rows_->Init(impl_->pool(), impl_->row_metadata()));
+  } else {
+    // Keep the buffers of the previous contents around for reuse
+    out->rows_->Clean();
+  }
+  return impl_->Encode(batch, out->rows_.get());
+}
+
+Result<std::unique_ptr<EncodedRows>> RowConverter::Encode(const RecordBatch& batch) {
+  auto out = ::arrow::internal::make_unique<EncodedRows>();
+  RETURN_NOT_OK(Encode(batch, out.get()));
+  return std::move(out);
+}
+
+Result<std::shared_ptr<RecordBatch>> RowConverter::Decode(const EncodedRows& rows,
+                                                          int64_t offset,
+                                                          int64_t length) {
+  if (offset < 0 || length < 0 || offset + length > rows.num_rows()) {
+    return Status::IndexError("Row range [", offset, ", ", offset + length,
+                              ") out of bounds for ", rows.num_rows(), " rows");
+  }
+  if (length == 0) {
+    return RecordBatch::MakeEmpty(schema_, impl_->pool());
+  }
+  if (!rows.rows_->metadata().is_compatible(impl_->row_metadata())) {
+    return Status::Invalid("Rows were not encoded with a compatible RowConverter");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto columns, impl_->Decode(*rows.rows_, offset, length));
+  return RecordBatch::Make(schema_, length, std::move(columns));
+}
+
+Result<std::shared_ptr<RecordBatch>> RowConverter::Decode(const EncodedRows& rows) {
+  return Decode(rows, 0, rows.num_rows());
+}
+
+}  // namespace compute
+}  // namespace arrow
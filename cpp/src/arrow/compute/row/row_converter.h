@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class RowTableImpl;
+
+/// \brief A batch of rows encoded in a compact row-major format
+///
+/// Each row stores the values of all columns contiguously.  Fixed-width values
+/// are stored inline; variable-length values follow the fixed-width part of the
+/// row.  Rows start at 8-byte aligned offsets.  Validity is kept separately
+/// from the row bytes and can be queried with IsNull().
+///
+/// Instances are produced by RowConverter::Encode() and may be reused across
+/// calls, in which case their buffers are recycled.
+class ARROW_EXPORT EncodedRows {
+ public:
+  EncodedRows();
+  ~EncodedRows();
+
+  /// \brief The number of rows in this batch
+  int64_t num_rows() const;
+
+  /// \brief Whether all rows have the same encoded width (no variable-length columns)
+  bool is_fixed_length() const;
+
+  /// \brief A view of the encoded bytes of row `i`
+  ///
+  /// The view is valid until this instance is modified or destroyed.
+  util::string_view row(int64_t i) const;
+
+  /// \brief Whether column `column` of row `i` is null
+  bool IsNull(int64_t i, int column) const;
+
+ private:
+  friend class RowConverter;
+
+  std::unique_ptr<RowTableImpl> rows_;
+};
+
+/// \brief Converts record batches to and from a row-major format
+///
+/// The conversion is done a few hundred rows at a time with the vectorized
+/// encoders used by the hash join and group-by, so that no allocation happens
+/// per row.  Supported column types are null, boolean, fixed-width primitive
+/// and decimal types, binary and string.  The total size of an encoded batch
+/// must be below 4GB.
+class ARROW_EXPORT RowConverter {
+ public:
+  ~RowConverter();
+
+  /// \brief Create a converter for record batches with the given schema
+  static Result<std::unique_ptr<RowConverter>> Make(
+      std::shared_ptr<Schema> schema, MemoryPool* pool = default_memory_pool());
+
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+
+  /// \brief Encode `batch` into `out`, replacing its previous contents
+  Status Encode(const RecordBatch& batch, EncodedRows* out);
+
+  /// \brief Encode `batch` into a new EncodedRows instance
+  Result<std::unique_ptr<EncodedRows>> Encode(const RecordBatch& batch);
+
+  /// \brief Decode a range of rows back into a record batch
+  Result<std::shared_ptr<RecordBatch>> Decode(const EncodedRows& rows, int64_t offset,
+                                              int64_t length);
+
+  /// \brief Decode all rows back into a record batch
+  Result<std::shared_ptr<RecordBatch>> Decode(const EncodedRows& rows);
+
+ private:
+  RowConverter(std::shared_ptr<Schema> schema, MemoryPool* pool);
+
+  class Impl;
+
+  std::shared_ptr<Schema> schema_;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
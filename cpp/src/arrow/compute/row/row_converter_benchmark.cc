@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/array/builder_base.h"
+#include "arrow/compute/row/row_converter.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr int32_t kSeed = 0x5eed;
+constexpr int64_t kNumRows = 1 << 16;
+
+static std::shared_ptr<RecordBatch> MakeBatch(bool with_strings) {
+  random::RandomArrayGenerator rng(kSeed);
+  FieldVector fields = {field("i64", int64()), field("i32", int32()),
+                        field("f64", float64()), field("b", boolean())};
+  if (with_strings) {
+    fields.push_back(field("s", utf8()));
+  }
+  return rng.BatchOf(fields, kNumRows);
+}
+
+// Baseline: materialize each row as a vector of scalars
+static std::vector<ScalarVector> EncodeWithScalars(const RecordBatch& batch) {
+  std::vector<ScalarVector> rows(batch.num_rows());
+  for (int64_t i = 0; i < batch.num_rows(); ++i) {
+    rows[i].resize(batch.num_columns());
+    for (int j = 0; j < batch.num_columns(); ++j) {
+      rows[i][j] = batch.column(j)->GetScalar(i).ValueOrDie();
+    }
+  }
+  return rows;
+}
+
+static void RowEncodeScalar(benchmark::State& state, bool with_strings) {
+  auto batch = MakeBatch(with_strings);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(EncodeWithScalars(*batch));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+static void RowDecodeScalar(benchmark::State& state, bool with_strings) {
+  auto batch = MakeBatch(with_strings);
+  auto rows = EncodeWithScalars(*batch);
+  for (auto _ : state) {
+    ArrayVector columns(batch->num_columns());
+    for (int j = 0; j < batch->num_columns(); ++j) {
+      std::unique_ptr<ArrayBuilder> builder;
+      ABORT_NOT_OK(MakeBuilder(default_memory_pool(), batch->schema()->field(j)->type(),
+                               &builder));
+      ABORT_NOT_OK(builder->Reserve(kNumRows));
+      for (const auto& row : rows) {
+        ABORT_NOT_OK(builder->AppendScalar(*row[j]));
+      }
+      ABORT_NOT_OK(builder->Finish(&columns[j]));
+    }
+    benchmark::DoNotOptimize(columns);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+static void RowEncode(benchmark::State& state, bool with_strings) {
+  auto batch = MakeBatch(with_strings);
+  auto converter = RowConverter::Make(batch->schema()).ValueOrDie();
+  EncodedRows rows;
+  for (auto _ : state) {
+    ABORT_NOT_OK(converter->Encode(*batch, &rows));
+    benchmark::DoNotOptimize(rows.row(0));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+static void RowDecode(benchmark::State& state, bool with_strings) {
+  auto batch = MakeBatch(with_strings);
+  auto converter = RowConverter::Make(batch->schema()).ValueOrDie();
+  auto rows = converter->Encode(*batch).ValueOrDie();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(converter->Decode(*rows).ValueOrDie());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+BENCHMARK_CAPTURE(RowEncodeScalar, fixed_width, false);
+BENCHMARK_CAPTURE(RowEncodeScalar, with_strings, true);
+BENCHMARK_CAPTURE(RowDecodeScalar, fixed_width, false);
+BENCHMARK_CAPTURE(RowDecodeScalar, with_strings, true);
+BENCHMARK_CAPTURE(RowEncode, fixed_width, false);
+BENCHMARK_CAPTURE(RowEncode, with_strings, true);
+BENCHMARK_CAPTURE(RowDecode, fixed_width, false);
+BENCHMARK_CAPTURE(RowDecode, with_strings, true);
+
+}  // namespace compute
+}  // namespace arrow
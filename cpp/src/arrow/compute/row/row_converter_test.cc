@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/row/row_converter.h"
+
+#include <gtest/gtest.h>
+
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+void AssertRoundTrip(const std::shared_ptr<RecordBatch>& batch) {
+  ASSERT_OK_AND_ASSIGN(auto converter, RowConverter::Make(batch->schema()));
+  ASSERT_OK_AND_ASSIGN(auto rows, converter->Encode(*batch));
+  ASSERT_EQ(batch->num_rows(), rows->num_rows());
+  ASSERT_OK_AND_ASSIGN(auto decoded, converter->Decode(*rows));
+  ASSERT_OK(decoded->ValidateFull());
+  AssertBatchesEqual(*batch, *decoded);
+}
+
+}  // namespace
+
+TEST(RowConverter, FixedWidth) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("i32", int32()), field("b", boolean()), field("f64", float64()),
+              field("n", null()), field("dec", decimal128(10, 2))}),
+      R"([[1, true, 1.5, null, "1.23"],
+          [null, false, null, null, "-4.56"],
+          [3, null, -2.5, null, null]])");
+  AssertRoundTrip(batch);
+
+  ASSERT_OK_AND_ASSIGN(auto converter, RowConverter::Make(batch->schema()));
+  ASSERT_OK_AND_ASSIGN(auto rows, converter->Encode(*batch));
+  ASSERT_TRUE(rows->is_fixed_length());
+  ASSERT_EQ(rows->row(0).size(), rows->row(2).size());
+  ASSERT_EQ(0, rows->row(0).size() % sizeof(uint64_t));
+  ASSERT_FALSE(rows->IsNull(0, 0));
+  ASSERT_TRUE(rows->IsNull(1, 0));
+  ASSERT_TRUE(rows->IsNull(2, 1));
+  ASSERT_TRUE(rows->IsNull(0, 3));
+  ASSERT_TRUE(rows->IsNull(2, 4));
+}
+
+TEST(RowConverter, VarLength) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("s", utf8()), field("i", int64()), field("bin", binary())}),
+      R"([["", 1, "abc"],
+          [null, 2, null],
+          ["a much longer string value", null, ""],
+          ["x", 4, "defghijklmnop"]])");
+  AssertRoundTrip(batch);
+
+  ASSERT_OK_AND_ASSIGN(auto converter, RowConverter::Make(batch->schema()));
+  ASSERT_OK_AND_ASSIGN(auto rows, converter->Encode(*batch));
+  ASSERT_FALSE(rows->is_fixed_length());
+  ASSERT_LT(rows->row(0).size(), rows->row(2).size());
+  ASSERT_TRUE(rows->IsNull(1, 0));
+  ASSERT_TRUE(rows->IsNull(1, 2));
+  ASSERT_FALSE(rows->IsNull(1, 1));
+}
+
+TEST(RowConverter, Random) {
+  auto fields = FieldVector{field("i8", int8()), field("u16", uint16()),
+                            field("i64", int64()), field("b", boolean()),
+                            field("f32", float32()), field("s", utf8()),
+                            field("bin", binary()), field("fsb", fixed_size_binary(5)),
+                            field("ts", timestamp(TimeUnit::MILLI))};
+  random::RandomArrayGenerator rng(42);
+  // Exercise several mini-batches and a partial last one
+  for (int64_t length : {0, 1, 1000, 5000}) {
+    ARROW_SCOPED_TRACE("length = ", length);
+    AssertRoundTrip(rng.BatchOf(fields, length));
+  }
+}
+
+TEST(RowConverter, SlicedInput) {
+  random::RandomArrayGenerator rng(42);
+  auto batch = rng.BatchOf({field("b", boolean()), field("s", utf8()),
+                            field("i16", int16())},
+                           3000);
+  AssertRoundTrip(batch->Slice(3, 2000));
+}
+
+TEST(RowConverter, PartialDecode) {
+  random::RandomArrayGenerator rng(0);
+  auto batch =
+      rng.BatchOf({field("i32", int32()), field("s", utf8()), field("b", boolean())},
+                  4000);
+  ASSERT_OK_AND_ASSIGN(auto converter, RowConverter::Make(batch->schema()));
+  ASSERT_OK_AND_ASSIGN(auto rows, converter->Encode(*batch));
+
+  for (auto range : {std::make_pair(0, 10), std::make_pair(5, 1500),
+                     std::make_pair(1023, 2049), std::make_pair(3999, 1)}) {
+    ARROW_SCOPED_TRACE("offset = ", range.first, ", length = ", range.second);
+    ASSERT_OK_AND_ASSIGN(auto decoded,
+                         converter->Decode(*rows, range.first, range.second));
+    ASSERT_OK(decoded->ValidateFull());
+    AssertBatchesEqual(*batch->Slice(range.first, range.second), *decoded);
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto empty, converter->Decode(*rows, 4000, 0));
+  ASSERT_EQ(0, empty->num_rows());
+  ASSERT_RAISES(IndexError, converter->Decode(*rows, 3999, 2));
+  ASSERT_RAISES(IndexError, converter->Decode(*rows, -1, 1));
+}
+
+TEST(RowConverter, ReuseEncodedRows) {
+  random::RandomArrayGenerator rng(7);
+  auto fields = FieldVector{field("u8", uint8()), field("s", utf8())};
+  ASSERT_OK_AND_ASSIGN(auto converter, RowConverter::Make(schema(fields)));
+
+  EncodedRows rows;
+  ASSERT_EQ(0, rows.num_rows());
+  for (int64_t length : {2000, 10, 3000}) {
+    auto batch = rng.BatchOf(fields, length);
+    ASSERT_OK(converter->Encode(*batch, &rows));
+    ASSERT_EQ(length, rows.num_rows());
+    ASSERT_OK_AND_ASSIGN(auto decoded, converter->Decode(rows));
+    AssertBatchesEqual(*batch, *decoded);
+  }
+}
+
+TEST(RowConverter, Errors) {
+  ASSERT_RAISES(NotImplemented,
+                RowConverter::Make(schema({field("d", dictionary(int32(), utf8()))})));
+  ASSERT_RAISES(NotImplemented,
+                RowConverter::Make(schema({field("s", large_utf8())})));
+  ASSERT_RAISES(TypeError, RowConverter::Make(schema({field("l", list(int32()))})));
+
+  ASSERT_OK_AND_ASSIGN(auto converter,
+                       RowConverter::Make(schema({field("i", int32())})));
+  auto batch = RecordBatchFromJSON(schema({field("i", int64())}), "[[1]]");
+  ASSERT_RAISES(Invalid, converter->Encode(*batch));
+}
+
+}  // namespace compute
+}  // namespace arrow
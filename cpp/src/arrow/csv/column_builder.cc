@@ -212,10 +212,11 @@ void TypedColumnBuilder::Insert(int64_t block_index,
 class InferringColumnBuilder : public ConcreteColumnBuilder {
  public:
   InferringColumnBuilder(int32_t col_index, const ConvertOptions& options,
-                         MemoryPool* pool, const std::shared_ptr<TaskGroup>& task_group)
+                         InferKind initial_kind, MemoryPool* pool,
+                         const std::shared_ptr<TaskGroup>& task_group)
       : ConcreteColumnBuilder(pool, task_group, col_index),
         options_(options),
-        infer_status_(options) {}
+        infer_status_(options, initial_kind) {}
 
   Status Init();
 
@@ -350,8 +351,14 @@ Result<std::shared_ptr<ColumnBuilder>> ColumnBuilder::Make(
 Result<std::shared_ptr<ColumnBuilder>> ColumnBuilder::Make(
     MemoryPool* pool, int32_t col_index, const ConvertOptions& options,
     const std::shared_ptr<TaskGroup>& task_group) {
-  auto ptr =
-      std::make_shared<InferringColumnBuilder>(col_index, options, pool, task_group);
+  return Make(pool, col_index, options, InferKind::Null, task_group);
+}
+
+Result<std::shared_ptr<ColumnBuilder>> ColumnBuilder::Make(
+    MemoryPool* pool, int32_t col_index, const ConvertOptions& options,
+    InferKind initial_kind, const std::shared_ptr<TaskGroup>& task_group) {
+  auto ptr = std::make_shared<InferringColumnBuilder>(col_index, options, initial_kind,
+                                                      pool, task_group);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
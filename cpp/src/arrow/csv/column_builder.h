@@ -31,6 +31,7 @@ namespace csv {
 
 class BlockParser;
 struct ConvertOptions;
+enum class InferKind;
 
 class ARROW_EXPORT ColumnBuilder {
  public:
@@ -61,6 +62,13 @@ class ARROW_EXPORT ColumnBuilder {
       MemoryPool* pool, int32_t col_index, const ConvertOptions& options,
       const std::shared_ptr<arrow::internal::TaskGroup>& task_group);
 
+  /// Construct a type-inferring ColumnBuilder whose inference starts
+  /// from `initial_kind` rather than from the null type.
+  static Result<std::shared_ptr<ColumnBuilder>> Make(
+      MemoryPool* pool, int32_t col_index, const ConvertOptions& options,
+      InferKind initial_kind,
+      const std::shared_ptr<arrow::internal::TaskGroup>& task_group);
+
   /// Construct a ColumnBuilder for a column of nulls
   /// (i.e. not present in the CSV file).
   static Result<std::shared_ptr<ColumnBuilder>> MakeNull(
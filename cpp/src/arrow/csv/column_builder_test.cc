@@ -23,6 +23,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/csv/inference_internal.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/test_common.h"
 #include "arrow/memory_pool.h"
@@ -385,6 +386,26 @@ TEST_F(InferringColumnBuilderTest, MultipleChunkReal) {
                  ArrayFromJSON(float64(), "[null, 12.5]")});
 }
 
+TEST_F(InferringColumnBuilderTest, InitialKind) {
+  auto options = ConvertOptions::Defaults();
+  std::shared_ptr<ChunkedArray> actual;
+
+  // Inference starts from the given kind
+  ASSERT_OK_AND_ASSIGN(auto builder,
+                       ColumnBuilder::Make(default_memory_pool(), 0, options,
+                                           InferKind::Real, TaskGroup::MakeSerial()));
+  AssertBuilding(builder, {{"", "123"}, {"456"}}, &actual);
+  AssertChunkedEqual(*actual, *ChunkedArrayFromJSON(float64(), {"[null, 123]", "[456]"}));
+
+  // ... and is still loosened if necessary
+  ASSERT_OK_AND_ASSIGN(builder,
+                       ColumnBuilder::Make(default_memory_pool(), 0, options,
+                                           InferKind::Integer, TaskGroup::MakeSerial()));
+  AssertBuilding(builder, {{"", "123"}, {"abc"}}, &actual);
+  AssertChunkedEqual(*actual,
+                     *ChunkedArrayFromJSON(utf8(), {R"(["", "123"])", R"(["abc"])"}));
+}
+
 TEST_F(InferringColumnBuilderTest, SingleChunkDate) {
   auto options = ConvertOptions::Defaults();
   auto tg = TaskGroup::MakeSerial();
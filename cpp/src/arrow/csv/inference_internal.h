@@ -43,10 +43,48 @@ enum class InferKind {
   Binary
 };
 
+// The position of `kind` in the order InferStatus loosens types
+inline int InferKindRank(InferKind kind) {
+  switch (kind) {
+    case InferKind::Null:
+      return 0;
+    case InferKind::Integer:
+      return 1;
+    case InferKind::Boolean:
+      return 2;
+    case InferKind::Date:
+      return 3;
+    case InferKind::Time:
+      return 4;
+    case InferKind::Timestamp:
+      return 5;
+    case InferKind::TimestampNS:
+      return 6;
+    case InferKind::TimestampWithZone:
+      return 7;
+    case InferKind::TimestampWithZoneNS:
+      return 8;
+    case InferKind::Real:
+      return 9;
+    case InferKind::TextDict:
+      return 10;
+    case InferKind::BinaryDict:
+      return 11;
+    case InferKind::Text:
+      return 12;
+    case InferKind::Binary:
+      return 13;
+  }
+  return 0;
+}
+
 class InferStatus {
  public:
-  explicit InferStatus(const ConvertOptions& options)
-      : kind_(InferKind::Null), can_loosen_type_(true), options_(options) {}
+  explicit InferStatus(const ConvertOptions& options,
+                       InferKind initial_kind = InferKind::Null)
+      : kind_(initial_kind),
+        can_loosen_type_(initial_kind != InferKind::Binary),
+        options_(options) {}
 
   InferKind kind() const { return kind_; }
 
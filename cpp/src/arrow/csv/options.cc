@@ -62,6 +62,10 @@ Status ReadOptions::Validate() const {
     return Status::Invalid("ReadOptions: skip_rows_after_names cannot be negative: ",
                            skip_rows_after_names);
   }
+  if (ARROW_PREDICT_FALSE(inference_sample_size < 0)) {
+    return Status::Invalid("ReadOptions: inference_sample_size cannot be negative: ",
+                           inference_sample_size);
+  }
   if (ARROW_PREDICT_FALSE(autogenerate_column_names && !column_names.empty())) {
     return Status::Invalid(
         "ReadOptions: autogenerate_column_names cannot be true when column_names are "
@@ -163,6 +163,20 @@ struct ARROW_EXPORT ReadOptions {
   /// If false, column names will be read from the first CSV row after `skip_rows`.
   bool autogenerate_column_names = false;
 
+  /// \brief Number of bytes sampled across the input to infer column types
+  ///
+  /// If positive, blocks adding up to this many bytes are read in parallel from
+  /// evenly spaced positions of the input, and each inferred column starts being
+  /// converted from the type its sampled values require.  Values appearing late in
+  /// the input (e.g. floats in a column starting with integers) then don't force
+  /// already converted blocks to be converted again.  Values not covered by the
+  /// sample still loosen the type as usual.
+  ///
+  /// Sampling requires the input to be a RandomAccessFile, and is skipped if
+  /// `ParseOptions::newlines_in_values` is true or `skip_rows_after_names` is
+  /// non-zero.  It is ignored by the streaming reader.
+  int64_t inference_sample_size = 0;
+
   /// Create read options with default values
   static ReadOptions Defaults();
 
@@ -17,6 +17,7 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -33,6 +34,7 @@
 #include "arrow/csv/chunker.h"
 #include "arrow/csv/column_builder.h"
 #include "arrow/csv/column_decoder.h"
+#include "arrow/csv/inference_internal.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/io/interfaces.h"
@@ -42,6 +44,7 @@
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -779,7 +782,8 @@ class BaseTableReader : public ReaderMixin, public csv::TableReader {
  protected:
   // Make column builders from conversion schema
   Status MakeColumnBuilders() {
-    for (const auto& column : conversion_schema_.columns) {
+    for (size_t i = 0; i < conversion_schema_.columns.size(); ++i) {
+      const auto& column = conversion_schema_.columns[i];
       std::shared_ptr<ColumnBuilder> builder;
       if (column.is_missing) {
         ARROW_ASSIGN_OR_RAISE(builder, ColumnBuilder::MakeNull(io_context_.pool(),
@@ -789,15 +793,172 @@ class BaseTableReader : public ReaderMixin, public csv::TableReader {
             builder, ColumnBuilder::Make(io_context_.pool(), column.type, column.index,
                                          convert_options_, task_group_));
       } else {
-        ARROW_ASSIGN_OR_RAISE(builder,
-                              ColumnBuilder::Make(io_context_.pool(), column.index,
-                                                  convert_options_, task_group_));
+        const InferKind initial_kind =
+            initial_kinds_.empty() ? InferKind::Null : initial_kinds_[i];
+        ARROW_ASSIGN_OR_RAISE(
+            builder, ColumnBuilder::Make(io_context_.pool(), column.index,
+                                         convert_options_, initial_kind, task_group_));
       }
       column_builders_.push_back(std::move(builder));
     }
     return Status::OK();
   }
 
+  // Start reading samples of the input to infer column types, if enabled and
+  // possible (see ReadOptions::inference_sample_size).  The header is not known yet,
+  // so samples are spread from the start of the input.
+  Status InitSampling() {
+    if (read_options_.inference_sample_size == 0 || parse_options_.newlines_in_values ||
+        read_options_.skip_rows_after_names != 0) {
+      // Rows can't be reliably found from an arbitrary position in the input,
+      // or the first rows must not be taken into account
+      return Status::OK();
+    }
+    auto file = std::dynamic_pointer_cast<io::RandomAccessFile>(input_);
+    if (file == nullptr) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(sample_start_, file->Tell());
+    ARROW_ASSIGN_OR_RAISE(sample_end_, file->GetSize());
+    const int64_t input_size = sample_end_ - sample_start_;
+    if (input_size <= 0) {
+      return Status::OK();
+    }
+    const int64_t sample_size = std::min(read_options_.inference_sample_size, input_size);
+    const int64_t block_size = std::min<int64_t>(read_options_.block_size, sample_size);
+    const int64_t num_samples = bit_util::CeilDiv(sample_size, block_size);
+
+    // Spread samples evenly, from the start to the end of the input
+    for (int64_t i = 0; i < num_samples; ++i) {
+      int64_t offset = sample_start_;
+      if (num_samples > 1) {
+        offset += i * (input_size - block_size) / (num_samples - 1);
+      }
+      sample_offsets_.push_back(offset);
+      sample_reads_.push_back(file->ReadAsync(io_context_, offset, block_size));
+    }
+    return Status::OK();
+  }
+
+  // Finishes when all samples are read.  Since implementations may not support
+  // positional reads concurrently with sequential reads, the input must not be
+  // read from before then.
+  Future<> SamplesRead() {
+    return All(sample_reads_)
+        .Then([](const std::vector<Result<std::shared_ptr<Buffer>>>&) {});
+  }
+
+  // Infer the type each inferred column starts being converted from, using the
+  // samples read.  `header_size` is the number of bytes consumed by ProcessHeader().
+  // Samples are inferred in parallel on `cpu_executor` if non-null.
+  Future<> InferFromSamples(int64_t header_size, Executor* cpu_executor) {
+    if (sample_reads_.empty()) {
+      return Future<>::MakeFinished();
+    }
+    // Find where rows start in the input, past the UTF8 byte order mark if any
+    // (a sample too short to tell starts with a prefix of it) and the header
+    ARROW_ASSIGN_OR_RAISE(auto first_sample, sample_reads_[0].result());
+    auto maybe_data = util::SkipUTF8BOM(first_sample->data(), first_sample->size());
+    const int64_t bom_size = maybe_data.ok() ? *maybe_data - first_sample->data() : 3;
+    const int64_t data_start = sample_start_ + bom_size + header_size;
+
+    std::vector<Future<std::vector<InferKind>>> sample_kinds;
+    for (size_t i = 0; i < sample_reads_.size(); ++i) {
+      // Samples starting before the first row are inferred from the first row,
+      // others from the first row starting in the sample
+      const int64_t row_start = std::max<int64_t>(data_start - sample_offsets_[i], -1);
+      ARROW_ASSIGN_OR_RAISE(auto sample, sample_reads_[i].result());
+      const bool is_final = sample_offsets_[i] + sample->size() >= sample_end_;
+      auto infer = [this, sample, row_start, is_final]() {
+        return InferSample(*sample, row_start, is_final);
+      };
+      if (cpu_executor == nullptr) {
+        sample_kinds.push_back(Future<std::vector<InferKind>>(infer()));
+      } else {
+        sample_kinds.push_back(DeferNotOk(cpu_executor->Submit(infer)));
+      }
+    }
+    sample_reads_.clear();
+
+    return All(std::move(sample_kinds))
+        .Then([this](const std::vector<Result<std::vector<InferKind>>>& results)
+                  -> Status {
+          // Start from the loosest kind required by a sample: all stricter kinds
+          // would fail converting the sampled rows anyway
+          initial_kinds_.assign(conversion_schema_.columns.size(), InferKind::Null);
+          for (const auto& result : results) {
+            ARROW_ASSIGN_OR_RAISE(auto kinds, result);
+            for (size_t i = 0; i < kinds.size(); ++i) {
+              if (InferKindRank(kinds[i]) > InferKindRank(initial_kinds_[i])) {
+                initial_kinds_[i] = kinds[i];
+              }
+            }
+          }
+          return Status::OK();
+        });
+  }
+
+  // Infer the kind of each inferred column from the complete rows of a sample.
+  // Rows start at `row_start` in the sample, or after the first line break
+  // if it is negative.
+  Result<std::vector<InferKind>> InferSample(const Buffer& sample, int64_t row_start,
+                                             bool is_final) {
+    std::vector<InferKind> kinds(conversion_schema_.columns.size(), InferKind::Null);
+    const uint8_t* data = sample.data();
+    const uint8_t* data_end = sample.data() + sample.size();
+    if (row_start >= 0) {
+      data += std::min(row_start, sample.size());
+    } else if (SkipRows(data, static_cast<uint32_t>(sample.size()), 1, &data) == 0) {
+      // No row starts in the sample
+      return kinds;
+    }
+    if (data == data_end) {
+      return kinds;
+    }
+
+    // Rows with an invalid number of columns are ignored rather than reported,
+    // since they will be handled while reading anyway.
+    auto parse_options = parse_options_;
+    parse_options.invalid_row_handler = [](const InvalidRow&) {
+      return InvalidRowResult::Skip;
+    };
+    BlockParser parser(io_context_.pool(), parse_options, num_csv_cols_,
+                       /*first_row=*/-1, std::numeric_limits<int32_t>::max());
+    const util::string_view view(reinterpret_cast<const char*>(data), data_end - data);
+    uint32_t parsed_size;
+    if (is_final) {
+      RETURN_NOT_OK(parser.ParseFinal(view, &parsed_size));
+    } else {
+      RETURN_NOT_OK(parser.Parse(view, &parsed_size));
+    }
+
+    for (size_t i = 0; i < conversion_schema_.columns.size(); ++i) {
+      const auto& column = conversion_schema_.columns[i];
+      if (column.is_missing || column.type != nullptr) {
+        continue;
+      }
+      InferStatus infer_status(convert_options_);
+      while (true) {
+        ARROW_ASSIGN_OR_RAISE(auto converter,
+                              infer_status.MakeConverter(io_context_.pool()));
+        auto maybe_array = converter->Convert(parser, column.index);
+        if (maybe_array.ok() || !infer_status.can_loosen_type()) {
+          break;
+        }
+        // Dictionary cardinality is per block and sample blocks don't match the
+        // blocks being read, so leave it to conversion to give up on dictionaries
+        if (infer_status.kind() == InferKind::BinaryDict ||
+            (infer_status.kind() == InferKind::TextDict &&
+             maybe_array.status().IsIndexError())) {
+          break;
+        }
+        infer_status.LoosenType(maybe_array.status());
+      }
+      kinds[i] = infer_status.kind();
+    }
+    return kinds;
+  }
+
   Result<int64_t> ParseAndInsert(const std::shared_ptr<Buffer>& partial,
                                  const std::shared_ptr<Buffer>& completion,
                                  const std::shared_ptr<Buffer>& block,
@@ -833,6 +994,14 @@ class BaseTableReader : public ReaderMixin, public csv::TableReader {
 
   // Column builders for target Table (in ConversionSchema order)
   std::vector<std::shared_ptr<ColumnBuilder>> column_builders_;
+
+  // Samples of the input read to infer column types, if any
+  int64_t sample_start_ = 0;
+  int64_t sample_end_ = 0;
+  std::vector<int64_t> sample_offsets_;
+  std::vector<Future<std::shared_ptr<Buffer>>> sample_reads_;
+  // Kind each inferred column starts from (in ConversionSchema order), if sampled
+  std::vector<InferKind> initial_kinds_;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -978,6 +1147,7 @@ class SerialTableReader : public BaseTableReader {
   using BaseTableReader::BaseTableReader;
 
   Status Init() override {
+    RETURN_NOT_OK(InitSampling());
     ARROW_ASSIGN_OR_RAISE(auto istream_it,
                           io::MakeInputStreamIterator(input_, read_options_.block_size));
 
@@ -992,12 +1162,15 @@ class SerialTableReader : public BaseTableReader {
   Result<std::shared_ptr<Table>> Read() override {
     task_group_ = TaskGroup::MakeSerial(io_context_.stop_token());
 
+    RETURN_NOT_OK(SamplesRead().status());
+
     // First block
     ARROW_ASSIGN_OR_RAISE(auto first_buffer, buffer_iterator_.Next());
     if (first_buffer == nullptr) {
       return Status::Invalid("Empty CSV file");
     }
-    RETURN_NOT_OK(ProcessHeader(first_buffer, &first_buffer));
+    ARROW_ASSIGN_OR_RAISE(auto header_size, ProcessHeader(first_buffer, &first_buffer));
+    RETURN_NOT_OK(InferFromSamples(header_size, /*cpu_executor=*/nullptr).status());
     RETURN_NOT_OK(MakeColumnBuilders());
 
     auto block_iterator = SerialBlockReader::MakeIterator(
@@ -1051,6 +1224,7 @@ class AsyncThreadedTableReader
   }
 
   Status Init() override {
+    RETURN_NOT_OK(InitSampling());
     ARROW_ASSIGN_OR_RAISE(auto istream_it,
                           io::MakeInputStreamIterator(input_, read_options_.block_size));
 
@@ -1112,16 +1286,21 @@ class AsyncThreadedTableReader
  protected:
   Future<std::shared_ptr<Buffer>> ProcessFirstBuffer() {
     // First block
-    auto first_buffer_future = buffer_generator_();
+    auto first_buffer_future =
+        SamplesRead().Then([this]() { return buffer_generator_(); });
     return first_buffer_future.Then([this](const std::shared_ptr<Buffer>& first_buffer)
-                                        -> Result<std::shared_ptr<Buffer>> {
+                                        -> Future<std::shared_ptr<Buffer>> {
       if (first_buffer == nullptr) {
         return Status::Invalid("Empty CSV file");
       }
-      std::shared_ptr<Buffer> first_buffer_processed;
-      RETURN_NOT_OK(ProcessHeader(first_buffer, &first_buffer_processed));
-      RETURN_NOT_OK(MakeColumnBuilders());
-      return first_buffer_processed;
+      auto first_buffer_processed = std::make_shared<std::shared_ptr<Buffer>>();
+      ARROW_ASSIGN_OR_RAISE(auto header_size,
+                            ProcessHeader(first_buffer, first_buffer_processed.get()));
+      return InferFromSamples(header_size, cpu_executor_)
+          .Then([this, first_buffer_processed]() -> Result<std::shared_ptr<Buffer>> {
+            RETURN_NOT_OK(MakeColumnBuilders());
+            return *first_buffer_processed;
+          });
     });
   }
 
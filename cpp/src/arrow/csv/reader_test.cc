@@ -206,6 +206,49 @@ void TestInvalidRowsSkipped(TableReaderFactory reader_factory, bool async) {
   ASSERT_EQ(NINVALID, num_invalid_rows);
 }
 
+void TestInferenceSampling(bool use_threads) {
+  // Column "b" only reveals its type near the end of the input, column "c" in
+  // the last row, which may be outside of the sample
+  const int NROWS = 2000;
+  std::string csv = "\xEF\xBB\xBFa,b,c,d\n";
+  for (int i = 0; i < NROWS; ++i) {
+    csv += std::to_string(i) + ",";
+    csv += (i == NROWS * 9 / 10) ? "1.5," : std::to_string(i) + ",";
+    csv += (i == NROWS - 1) ? "x," : "2020-01-01,";
+    csv += (i % 7 == 0) ? "\n" : "s" + std::to_string(i % 3) + "\n";
+  }
+  auto buffer = Buffer::FromString(std::move(csv));
+
+  auto read = [&](int64_t inference_sample_size, bool auto_dict_encode) {
+    auto read_options = ReadOptions::Defaults();
+    read_options.use_threads = use_threads;
+    read_options.block_size = 1 << 10;
+    read_options.inference_sample_size = inference_sample_size;
+    auto convert_options = ConvertOptions::Defaults();
+    convert_options.auto_dict_encode = auto_dict_encode;
+    EXPECT_OK_AND_ASSIGN(
+        auto reader,
+        TableReader::Make(io::default_io_context(),
+                          std::make_shared<io::BufferReader>(buffer), read_options,
+                          ParseOptions::Defaults(), convert_options));
+    EXPECT_OK_AND_ASSIGN(auto table, reader->Read());
+    return table;
+  };
+
+  for (const bool auto_dict_encode : {false, true}) {
+    ARROW_SCOPED_TRACE("auto_dict_encode = ", auto_dict_encode);
+    auto expected = read(0, auto_dict_encode);
+    AssertTypeEqual(*int64(), *expected->column(0)->type());
+    AssertTypeEqual(*float64(), *expected->column(1)->type());
+    for (const int64_t sample_size : {1, 100, 1 << 10, 1 << 12, 1 << 20}) {
+      ARROW_SCOPED_TRACE("inference_sample_size = ", sample_size);
+      auto actual = read(sample_size, auto_dict_encode);
+      ASSERT_OK(actual->ValidateFull());
+      AssertTablesEqual(*expected, *actual);
+    }
+  }
+}
+
 TableReaderFactory MakeSerialFactory() {
   return [](std::shared_ptr<io::InputStream> input_stream, ParseOptions parse_options) {
     auto read_options = ReadOptions::Defaults();
@@ -227,6 +270,9 @@ TEST(SerialReaderTests, NestedParallelism) {
 TEST(SerialReaderTests, InvalidRowsSkipped) {
   TestInvalidRowsSkipped(MakeSerialFactory(), /*async=*/false);
 }
+TEST(SerialReaderTests, InferenceSampling) {
+  TestInferenceSampling(/*use_threads=*/false);
+}
 
 Result<TableReaderFactory> MakeAsyncFactory(
     std::shared_ptr<internal::ThreadPool> thread_pool = nullptr) {
@@ -271,6 +317,9 @@ TEST(AsyncReaderTests, InvalidRowsSkipped) {
   ASSERT_OK_AND_ASSIGN(auto table_factory, MakeAsyncFactory());
   TestInvalidRowsSkipped(table_factory, /*async=*/true);
 }
+TEST(AsyncReaderTests, InferenceSampling) {
+  TestInferenceSampling(/*use_threads=*/true);
+}
 
 TableReaderFactory MakeStreamingFactory(bool use_threads = true) {
   return [use_threads](
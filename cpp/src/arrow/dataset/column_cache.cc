@@ -0,0 +1,344 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/column_cache.h"
+
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/chunked_array.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hash_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+namespace {
+
+struct ColumnKey {
+  std::string file_key;
+  int chunk_index;
+  int field_index;
+
+  bool operator==(const ColumnKey& other) const {
+    return chunk_index == other.chunk_index && field_index == other.field_index &&
+           file_key == other.file_key;
+  }
+};
+
+struct ColumnKeyHash {
+  size_t operator()(const ColumnKey& key) const {
+    size_t h = std::hash<std::string>()(key.file_key);
+    arrow::internal::hash_combine(h, key.chunk_index);
+    arrow::internal::hash_combine(h, key.field_index);
+    return h;
+  }
+};
+
+}  // namespace
+
+class ColumnCache::Impl {
+ public:
+  explicit Impl(int64_t capacity) : capacity_(capacity) {}
+
+  std::shared_ptr<ChunkedArray> Get(const ColumnKey& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      ++stats_.misses;
+      return nullptr;
+    }
+    ++stats_.hits;
+    // Move the entry to the front of the list, as the most recently used
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->column;
+  }
+
+  void Put(ColumnKey key, std::shared_ptr<ChunkedArray> column) {
+    const int64_t num_bytes = util::TotalBufferSize(*column);
+    if (num_bytes > capacity_) return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) {
+      Erase(it);
+    }
+    entries_.push_front(Entry{key, std::move(column), num_bytes});
+    map_.emplace(std::move(key), entries_.begin());
+    ++stats_.insertions;
+    ++stats_.num_columns;
+    stats_.num_bytes += num_bytes;
+
+    while (stats_.num_bytes > capacity_) {
+      Erase(map_.find(entries_.back().key));
+      ++stats_.evictions;
+    }
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.clear();
+    entries_.clear();
+    stats_.num_columns = 0;
+    stats_.num_bytes = 0;
+  }
+
+  Stats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+  size_t FileSystemId(const std::shared_ptr<fs::FileSystem>& filesystem) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < filesystems_.size(); ++i) {
+      if (filesystems_[i]->Equals(filesystem)) return i;
+    }
+    filesystems_.push_back(filesystem);
+    return filesystems_.size() - 1;
+  }
+
+ private:
+  struct Entry {
+    ColumnKey key;
+    std::shared_ptr<ChunkedArray> column;
+    int64_t num_bytes;
+  };
+  using EntryList = std::list<Entry>;
+  using EntryMap = std::unordered_map<ColumnKey, EntryList::iterator, ColumnKeyHash>;
+
+  void Erase(EntryMap::iterator it) {
+    DCHECK(it != map_.end());
+    --stats_.num_columns;
+    stats_.num_bytes -= it->second->num_bytes;
+    entries_.erase(it->second);
+    map_.erase(it);
+  }
+
+  const int64_t capacity_;
+  mutable std::mutex mutex_;
+  // In most to least recently used order
+  EntryList entries_;
+  EntryMap map_;
+  Stats stats_;
+  std::vector<std::shared_ptr<fs::FileSystem>> filesystems_;
+};
+
+ColumnCache::ColumnCache(int64_t capacity)
+    : capacity_(capacity), impl_(::arrow::internal::make_unique<Impl>(capacity)) {}
+
+ColumnCache::~ColumnCache() = default;
+
+std::shared_ptr<ColumnCache> ColumnCache::Make(int64_t capacity) {
+  return std::make_shared<ColumnCache>(capacity);
+}
+
+std::shared_ptr<ChunkedArray> ColumnCache::Get(const std::string& file_key,
+                                               int chunk_index, int field_index) {
+  return impl_->Get(ColumnKey{file_key, chunk_index, field_index});
+}
+
+void ColumnCache::Put(const std::string& file_key, int chunk_index, int field_index,
+                      std::shared_ptr<ChunkedArray> column) {
+  impl_->Put(ColumnKey{file_key, chunk_index, field_index}, std::move(column));
+}
+
+void ColumnCache::Clear() { impl_->Clear(); }
+
+Future<std::string> ColumnCache::FileKey(const FileFormat& format,
+                                         const FileSource& source) {
+  auto filesystem = source.filesystem();
+  if (filesystem == nullptr) return std::string();
+
+  // Identify files of sub-tree filesystems by their path in the base filesystem, so
+  // that datasets rooted at different directories share their columns
+  std::string path = source.path();
+  while (filesystem->type_name() == "subtree") {
+    const auto& subtree = checked_cast<const fs::SubTreeFileSystem&>(*filesystem);
+    path = fs::internal::ConcatAbstractPath(subtree.base_path(), path);
+    filesystem = subtree.base_fs();
+  }
+  auto prefix = format.type_name() + ":" + filesystem->type_name() + ":" +
+                std::to_string(impl_->FileSystemId(filesystem)) + ":";
+
+  // Stat the file, so that a modified file doesn't get the columns of its previous
+  // version
+  return filesystem->GetFileInfoAsync({path}).Then(
+      [prefix, path](const std::vector<fs::FileInfo>& infos) -> std::string {
+        const auto& info = infos[0];
+        // Let the scan fail, without the cache, if the file doesn't exist anymore
+        if (info.type() != fs::FileType::File) return "";
+        return prefix + std::to_string(info.size()) + ":" +
+               std::to_string(info.mtime().time_since_epoch().count()) + ":" + path;
+      });
+}
+
+ColumnCache::Stats ColumnCache::stats() const { return impl_->stats(); }
+
+namespace internal {
+
+Result<std::vector<int>> ColumnCacheFieldIndices(
+    const Schema& physical_schema, const std::vector<FieldRef>& materialized_fields) {
+  std::vector<int> field_indices;
+  for (const auto& ref : materialized_fields) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema));
+    if (match.indices().empty()) continue;
+    field_indices.push_back(match.indices()[0]);
+  }
+  std::sort(field_indices.begin(), field_indices.end());
+  field_indices.erase(std::unique(field_indices.begin(), field_indices.end()),
+                      field_indices.end());
+  return field_indices;
+}
+
+bool CachedColumns::complete() const {
+  for (const auto& chunk_columns : columns) {
+    for (const auto& column : chunk_columns) {
+      if (column == nullptr) return false;
+    }
+  }
+  return true;
+}
+
+std::vector<int> CachedColumns::missing_field_indices() const {
+  std::vector<int> missing;
+  for (size_t j = 0; j < field_indices.size(); ++j) {
+    for (const auto& chunk_columns : columns) {
+      if (chunk_columns[j] == nullptr) {
+        missing.push_back(field_indices[j]);
+        break;
+      }
+    }
+  }
+  return missing;
+}
+
+CachedColumns LookupCachedColumns(ColumnCache* cache, const std::string& file_key,
+                                  std::vector<int> chunk_indices,
+                                  std::vector<int> field_indices) {
+  CachedColumns cached;
+  cached.columns.resize(chunk_indices.size());
+  for (size_t i = 0; i < chunk_indices.size(); ++i) {
+    cached.columns[i].reserve(field_indices.size());
+    for (int field_index : field_indices) {
+      cached.columns[i].push_back(cache->Get(file_key, chunk_indices[i], field_index));
+    }
+  }
+  cached.chunk_indices = std::move(chunk_indices);
+  cached.field_indices = std::move(field_indices);
+  return cached;
+}
+
+RecordBatchGenerator MakeCachedColumnsGenerator(
+    std::shared_ptr<ColumnCache> cache, std::string file_key, CachedColumns cached,
+    std::shared_ptr<Schema> physical_schema, DecodeColumns decode, int64_t batch_size,
+    int readahead) {
+  struct State {
+    std::shared_ptr<ColumnCache> cache;
+    std::string file_key;
+    CachedColumns cached;
+    std::shared_ptr<Schema> schema;
+    DecodeColumns decode;
+    int64_t batch_size;
+
+    Result<RecordBatchGenerator> MakeBatches(ChunkedArrayVector columns) const {
+      const int64_t num_rows = columns[0]->length();
+      TableBatchReader reader(Table::Make(schema, std::move(columns), num_rows));
+      reader.set_chunksize(batch_size);
+      ARROW_ASSIGN_OR_RAISE(auto batches, reader.ToRecordBatches());
+      return MakeVectorGenerator(std::move(batches));
+    }
+  };
+
+  FieldVector fields;
+  for (int field_index : cached.field_indices) {
+    fields.push_back(physical_schema->field(field_index));
+  }
+  auto state = std::make_shared<State>(
+      State{std::move(cache), std::move(file_key), std::move(cached),
+            schema(std::move(fields), physical_schema->metadata()), std::move(decode),
+            batch_size});
+
+  // The columns of a chunk, released once its batches have been emitted
+  struct Chunk {
+    int chunk_index;
+    ChunkedArrayVector columns;
+  };
+  std::vector<std::shared_ptr<Chunk>> chunks;
+  for (size_t i = 0; i < state->cached.chunk_indices.size(); ++i) {
+    chunks.push_back(std::make_shared<Chunk>(Chunk{
+        state->cached.chunk_indices[i], std::move(state->cached.columns[i])}));
+  }
+  state->cached.columns.clear();
+
+  auto load_chunk =
+      [state](const std::shared_ptr<Chunk>& chunk) -> Future<RecordBatchGenerator> {
+    auto columns = std::move(chunk->columns);
+    std::vector<int> missing_fields;
+    std::vector<size_t> missing_positions;
+    for (size_t j = 0; j < columns.size(); ++j) {
+      if (columns[j] == nullptr) {
+        missing_fields.push_back(state->cached.field_indices[j]);
+        missing_positions.push_back(j);
+      }
+    }
+    if (missing_fields.empty()) {
+      return state->MakeBatches(std::move(columns));
+    }
+
+    const int chunk_index = chunk->chunk_index;
+    return state->decode(chunk_index, std::move(missing_fields))
+        .Then([state, chunk_index, columns, missing_positions](
+                  const ChunkedArrayVector& decoded) mutable
+              -> Result<RecordBatchGenerator> {
+          DCHECK_EQ(decoded.size(), missing_positions.size());
+          for (size_t k = 0; k < missing_positions.size(); ++k) {
+            const size_t j = missing_positions[k];
+            state->cache->Put(state->file_key, chunk_index,
+                              state->cached.field_indices[j], decoded[k]);
+            columns[j] = decoded[k];
+          }
+          return state->MakeBatches(std::move(columns));
+        });
+  };
+
+  AsyncGenerator<RecordBatchGenerator> batches =
+      MakeMappedGenerator(MakeVectorGenerator(std::move(chunks)), load_chunk);
+  if (readahead > 0) {
+    batches = MakeReadaheadGenerator(std::move(batches), readahead);
+  }
+  return MakeConcatenatedGenerator(std::move(batches));
+}
+
+}  // namespace internal
+}  // namespace dataset
+}  // namespace arrow
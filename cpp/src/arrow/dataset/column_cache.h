@@ -0,0 +1,161 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \addtogroup dataset-file-formats
+///
+/// @{
+
+/// \brief A cache of the columns decoded while scanning files
+///
+/// When FileFormat::column_cache is set, ParquetFileFormat and IpcFileFormat keep the
+/// columns they decode in the cache, keyed by file, row group (or record batch) and
+/// top-level field, and consult it before reading and decoding a file.  Scans of the
+/// same files by any Scanner whose format uses the cache then skip the I/O and decoding
+/// of the columns found there.  A single cache may be shared by several formats and
+/// datasets to bound the memory used for caching by the whole process.
+///
+/// The cache holds at most capacity() bytes of buffers, evicting the least recently used
+/// columns first.  Files are identified by their format, filesystem, path, size and
+/// modification time, which are looked up whenever a file is scanned: the columns of a
+/// file which was modified since they were cached aren't used anymore, and are
+/// eventually evicted.  Formats sharing a cache must decode the same files identically.
+/// Files read from buffers or from custom open functions are never cached.
+class ARROW_DS_EXPORT ColumnCache {
+ public:
+  /// \brief Counters describing the use of a ColumnCache, to help sizing it
+  struct Stats {
+    /// The number of lookups which found a column in the cache
+    int64_t hits = 0;
+    /// The number of lookups which didn't find a column in the cache
+    int64_t misses = 0;
+    /// The number of columns inserted in the cache
+    int64_t insertions = 0;
+    /// The number of columns evicted from the cache to stay within its capacity
+    int64_t evictions = 0;
+    /// The number of columns currently in the cache
+    int64_t num_columns = 0;
+    /// The size in bytes of the buffers of the columns currently in the cache
+    int64_t num_bytes = 0;
+  };
+
+  /// \brief Create a cache holding at most capacity bytes of columns
+  explicit ColumnCache(int64_t capacity);
+  ~ColumnCache();
+
+  static std::shared_ptr<ColumnCache> Make(int64_t capacity);
+
+  /// \brief The maximum size in bytes of the buffers of the columns held by the cache
+  int64_t capacity() const { return capacity_; }
+
+  /// \brief Look up a column, returning null if it isn't in the cache
+  std::shared_ptr<ChunkedArray> Get(const std::string& file_key, int chunk_index,
+                                    int field_index);
+
+  /// \brief Insert a column, evicting the least recently used ones as needed
+  ///
+  /// Columns larger than the capacity of the cache are not inserted.
+  void Put(const std::string& file_key, int chunk_index, int field_index,
+           std::shared_ptr<ChunkedArray> column);
+
+  /// \brief Evict all the columns held by the cache
+  void Clear();
+
+  /// \brief The key identifying a file in this cache, or the empty string if the file
+  /// can't be cached
+  ///
+  /// Filesystems are identified by comparing them with FileSystem::Equals to the ones
+  /// seen by this cache before, which it keeps alive.
+  Future<std::string> FileKey(const FileFormat& format, const FileSource& source);
+
+  /// \brief Return the counters of this cache
+  Stats stats() const;
+
+ private:
+  class Impl;
+
+  const int64_t capacity_;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// @}
+
+namespace internal {
+
+/// \brief The indices of the top-level fields of a file schema which are needed to
+/// evaluate the given field references, sorted and without duplicates
+ARROW_DS_EXPORT Result<std::vector<int>> ColumnCacheFieldIndices(
+    const Schema& physical_schema, const std::vector<FieldRef>& materialized_fields);
+
+/// \brief The columns of some chunks (row groups or record batches) of a file which
+/// were found in a ColumnCache
+struct ARROW_DS_EXPORT CachedColumns {
+  std::vector<int> chunk_indices;
+  std::vector<int> field_indices;
+  /// columns[i][j] is the field field_indices[j] of the chunk chunk_indices[i], or null
+  /// if it wasn't found in the cache
+  std::vector<ChunkedArrayVector> columns;
+
+  /// \brief Whether all the columns were found in the cache
+  bool complete() const;
+
+  /// \brief The fields which weren't found in the cache for some chunk, sorted
+  std::vector<int> missing_field_indices() const;
+};
+
+/// \brief Look up the given fields of the given chunks of a file in a cache
+ARROW_DS_EXPORT CachedColumns LookupCachedColumns(ColumnCache* cache,
+                                                  const std::string& file_key,
+                                                  std::vector<int> chunk_indices,
+                                                  std::vector<int> field_indices);
+
+/// \brief Read and decode the given top-level fields of a chunk of a file, returning
+/// one column per field
+using DecodeColumns =
+    std::function<Future<ChunkedArrayVector>(int chunk_index, std::vector<int>)>;
+
+/// \brief Generate the batches of the chunks of a file from cached columns
+///
+/// Columns missing from the cache are decoded with decode, up to readahead chunks
+/// ahead, and inserted into the cache.  Batches hold at most batch_size rows and the
+/// fields of physical_schema listed in cached.field_indices.
+ARROW_DS_EXPORT RecordBatchGenerator MakeCachedColumnsGenerator(
+    std::shared_ptr<ColumnCache> cache, std::string file_key, CachedColumns cached,
+    std::shared_ptr<Schema> physical_schema, DecodeColumns decode, int64_t batch_size,
+    int readahead);
+
+}  // namespace internal
+}  // namespace dataset
+}  // namespace arrow
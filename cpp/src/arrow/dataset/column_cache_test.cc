@@ -0,0 +1,182 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/column_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/chunked_array.h"
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/byte_size.h"
+
+namespace arrow {
+namespace dataset {
+
+std::shared_ptr<ChunkedArray> MakeColumn(const std::string& json) {
+  return std::make_shared<ChunkedArray>(ArrayFromJSON(int64(), json));
+}
+
+void AssertStats(const ColumnCache& cache, int64_t hits, int64_t misses,
+                 int64_t insertions, int64_t evictions, int64_t num_columns) {
+  auto stats = cache.stats();
+  ASSERT_EQ(stats.hits, hits);
+  ASSERT_EQ(stats.misses, misses);
+  ASSERT_EQ(stats.insertions, insertions);
+  ASSERT_EQ(stats.evictions, evictions);
+  ASSERT_EQ(stats.num_columns, num_columns);
+}
+
+TEST(ColumnCache, GetPut) {
+  auto cache = ColumnCache::Make(1 << 20);
+  auto column = MakeColumn("[1, 2, 3]");
+
+  ASSERT_EQ(cache->Get("file", 0, 0), nullptr);
+  cache->Put("file", 0, 0, column);
+  ASSERT_EQ(cache->Get("file", 0, 0), column);
+  ASSERT_EQ(cache->Get("file", 0, 1), nullptr);
+  ASSERT_EQ(cache->Get("file", 1, 0), nullptr);
+  ASSERT_EQ(cache->Get("other", 0, 0), nullptr);
+  AssertStats(*cache, /*hits=*/1, /*misses=*/4, /*insertions=*/1, /*evictions=*/0,
+              /*num_columns=*/1);
+  ASSERT_EQ(cache->stats().num_bytes, util::TotalBufferSize(*column));
+
+  // Replacing a column doesn't count its bytes twice
+  cache->Put("file", 0, 0, column);
+  AssertStats(*cache, 1, 4, 2, 0, 1);
+  ASSERT_EQ(cache->stats().num_bytes, util::TotalBufferSize(*column));
+
+  cache->Clear();
+  ASSERT_EQ(cache->Get("file", 0, 0), nullptr);
+  AssertStats(*cache, 1, 5, 2, 0, 0);
+  ASSERT_EQ(cache->stats().num_bytes, 0);
+}
+
+TEST(ColumnCache, EvictsLeastRecentlyUsed) {
+  auto column = MakeColumn("[1, 2, 3, 4]");
+  const int64_t column_size = util::TotalBufferSize(*column);
+  auto cache = ColumnCache::Make(3 * column_size);
+
+  cache->Put("file", 0, 0, column);
+  cache->Put("file", 1, 0, column);
+  cache->Put("file", 2, 0, column);
+  // Use the first column, so that the second one is the least recently used
+  ASSERT_NE(cache->Get("file", 0, 0), nullptr);
+  cache->Put("file", 3, 0, column);
+
+  AssertStats(*cache, 1, 0, 4, 1, 3);
+  ASSERT_EQ(cache->stats().num_bytes, 3 * column_size);
+  ASSERT_NE(cache->Get("file", 0, 0), nullptr);
+  ASSERT_EQ(cache->Get("file", 1, 0), nullptr);
+  ASSERT_NE(cache->Get("file", 2, 0), nullptr);
+  ASSERT_NE(cache->Get("file", 3, 0), nullptr);
+}
+
+TEST(ColumnCache, SkipsColumnsLargerThanCapacity) {
+  auto small = MakeColumn("[1]");
+  auto large = MakeColumn("[1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16]");
+  auto cache = ColumnCache::Make(util::TotalBufferSize(*large) - 1);
+
+  cache->Put("file", 0, 0, small);
+  cache->Put("file", 0, 1, large);
+  // The small column wasn't evicted to make room for the large one
+  ASSERT_EQ(cache->Get("file", 0, 0), small);
+  ASSERT_EQ(cache->Get("file", 0, 1), nullptr);
+  AssertStats(*cache, 1, 1, 1, 0, 1);
+}
+
+TEST(ColumnCache, FileKey) {
+  IpcFileFormat format;
+  auto cache = ColumnCache::Make(1 << 20);
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  auto subtree_fs = std::make_shared<fs::SubTreeFileSystem>("base/dir", mock_fs);
+
+  // Files which don't exist can't be cached
+  ASSERT_FINISHES_OK_AND_EQ("",
+                            cache->FileKey(format, FileSource("base/dir/a", mock_fs)));
+
+  ASSERT_OK(mock_fs->CreateFile("base/dir/a", "abc"));
+  ASSERT_FINISHES_OK_AND_ASSIGN(
+      auto key, cache->FileKey(format, FileSource("base/dir/a", mock_fs)));
+  ASSERT_EQ(key, "ipc:mock:0:3:-1:base/dir/a");
+  // Files of sub-tree filesystems are identified by their path in the base filesystem
+  ASSERT_FINISHES_OK_AND_EQ(key, cache->FileKey(format, FileSource("a", subtree_fs)));
+
+  // Files of different filesystems don't share their columns
+  auto other_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  ASSERT_OK(other_fs->CreateFile("base/dir/a", "abc"));
+  ASSERT_FINISHES_OK_AND_EQ("ipc:mock:1:3:-1:base/dir/a",
+                            cache->FileKey(format, FileSource("base/dir/a", other_fs)));
+
+  // Nor do the versions of a modified file
+  ASSERT_OK(mock_fs->CreateFile("base/dir/a", "abcd"));
+  ASSERT_FINISHES_OK_AND_EQ("ipc:mock:0:4:-1:base/dir/a",
+                            cache->FileKey(format, FileSource("base/dir/a", mock_fs)));
+
+  // Buffers can't be cached
+  ASSERT_FINISHES_OK_AND_EQ(
+      "", cache->FileKey(format, FileSource(Buffer::FromString("abc"))));
+}
+
+TEST(ColumnCache, CachedColumnsGenerator) {
+  auto physical_schema = schema({field("a", int64()), field("b", int64())});
+  auto cache = ColumnCache::Make(1 << 20);
+  cache->Put("file", 0, 0, MakeColumn("[0, 1, 2]"));
+  cache->Put("file", 1, 0, MakeColumn("[3, 4]"));
+  cache->Put("file", 1, 1, MakeColumn("[13, 14]"));
+
+  auto cached = internal::LookupCachedColumns(cache.get(), "file", {0, 1}, {0, 1});
+  ASSERT_FALSE(cached.complete());
+  ASSERT_EQ(cached.missing_field_indices(), std::vector<int>{1});
+
+  std::vector<int> decoded_chunks;
+  internal::DecodeColumns decode =
+      [&](int chunk_index, std::vector<int> field_indices) -> Future<ChunkedArrayVector> {
+    decoded_chunks.push_back(chunk_index);
+    EXPECT_EQ(field_indices, std::vector<int>{1});
+    return Future<ChunkedArrayVector>::MakeFinished(
+        ChunkedArrayVector{MakeColumn("[10, 11, 12]")});
+  };
+
+  auto generator = internal::MakeCachedColumnsGenerator(
+      cache, "file", std::move(cached), physical_schema, decode, /*batch_size=*/2,
+      /*readahead=*/0);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(generator));
+  ASSERT_EQ(decoded_chunks, std::vector<int>{0});
+  ASSERT_EQ(batches.size(), 3);
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(physical_schema, batches));
+  AssertTablesEqual(*TableFromJSON(physical_schema, {R"([
+    {"a": 0, "b": 10}, {"a": 1, "b": 11}, {"a": 2, "b": 12},
+    {"a": 3, "b": 13}, {"a": 4, "b": 14}
+  ])"}),
+                    *table, /*same_chunk_layout=*/false);
+
+  // The decoded column was inserted in the cache
+  ASSERT_NE(cache->Get("file", 0, 1), nullptr);
+}
+
+}  // namespace dataset
+}  // namespace arrow
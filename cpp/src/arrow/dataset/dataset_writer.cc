@@ -22,6 +22,7 @@
 #include <unordered_map>
 
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/memory.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
@@ -29,11 +30,59 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/map.h"
 #include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace dataset {
 namespace internal {
 
+constexpr int64_t EncodedBytesStream::kInitialCapacity;
+
+Status EncodedBytesStream::Open(std::shared_ptr<io::OutputStream> sink) {
+  sink_ = std::move(sink);
+  return io::BufferOutputStream::Create(kInitialCapacity, pool_).Value(&buffer_);
+}
+
+Status EncodedBytesStream::Write(const void* data, int64_t nbytes) {
+  RETURN_NOT_OK(buffer_->Write(data, nbytes));
+  position_ += nbytes;
+  return Status::OK();
+}
+
+Future<> EncodedBytesStream::CloseAsync() {
+  closed_ = true;
+  auto sink = sink_;
+  return FlushToSink().Then([sink]() { return sink->CloseAsync(); });
+}
+
+Status EncodedBytesStream::Abort() {
+  closed_ = true;
+  // Skip the writes which haven't started yet, and wait for the one in progress
+  // (if any): the sink mustn't be written to while it is aborted
+  aborted_->store(true);
+  last_write_.Wait();
+  return sink_->Abort();
+}
+
+Future<> EncodedBytesStream::FlushToSink() {
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> bytes, buffer_->Finish());
+  RETURN_NOT_OK(buffer_->Reset(kInitialCapacity, pool_));
+  if (bytes->size() > 0) {
+    auto sink = sink_;
+    auto io_executor = io_executor_;
+    auto aborted = aborted_;
+    last_write_ = last_write_.Then([sink, io_executor, bytes, aborted]() {
+      return DeferNotOk(io_executor->Submit([sink, bytes, aborted]() {
+        if (aborted->load()) {
+          return Status::Cancelled("Output stream was aborted");
+        }
+        return sink->Write(bytes);
+      }));
+    });
+  }
+  return last_write_;
+}
+
 namespace {
 
 constexpr util::string_view kIntegerToken = "{i}";
@@ -115,9 +164,12 @@ struct DatasetWriterState {
 class DatasetWriterFileQueue : public util::AsyncDestroyable {
  public:
   explicit DatasetWriterFileQueue(const Future<std::shared_ptr<FileWriter>>& writer_fut,
+                                  std::shared_ptr<EncodedBytesStream> encoded_stream,
                                   const FileSystemDatasetWriteOptions& options,
                                   DatasetWriterState* writer_state)
-      : options_(options), writer_state_(writer_state) {
+      : options_(options),
+        writer_state_(writer_state),
+        encoded_stream_(std::move(encoded_stream)) {
     // If this AddTask call fails (e.g. we're given an already failing future) then we
     // will get the error later when we try and write to it.
     ARROW_UNUSED(file_tasks_.AddTask([this, writer_fut] {
@@ -198,6 +250,9 @@ class DatasetWriterFileQueue : public util::AsyncDestroyable {
 
  private:
   Future<> WriteNext(std::shared_ptr<RecordBatch> next) {
+    if (encoded_stream_) {
+      return EncodeNext(std::move(next));
+    }
     struct WriteTask {
       Status operator()() {
         int64_t rows_to_release = batch->num_rows();
@@ -213,6 +268,27 @@ class DatasetWriterFileQueue : public util::AsyncDestroyable {
         WriteTask{this, std::move(next)}));
   }
 
+  // Encode a batch on the CPU thread pool, then write the encoded bytes from the IO
+  // thread pool.  The next batch of this file may be encoded while they are written.
+  Future<> EncodeNext(std::shared_ptr<RecordBatch> next) {
+    const int64_t rows_to_release = next->num_rows();
+    DatasetWriterState* writer_state = writer_state_;
+    auto encoded = DeferNotOk(::arrow::internal::GetCpuThreadPool()->Submit(
+        [this, next]() { return writer_->Write(next); }));
+    return encoded.Then(
+        [this, writer_state, rows_to_release]() {
+          // Errors writing the bytes are reported when the file is finished
+          encoded_stream_->FlushToSink().AddCallback(
+              [writer_state, rows_to_release](const Status&) {
+                writer_state->rows_in_flight_throttle.Release(rows_to_release);
+              });
+        },
+        [writer_state, rows_to_release](const Status& status) {
+          writer_state->rows_in_flight_throttle.Release(rows_to_release);
+          return status;
+        });
+  }
+
   Future<> DoFinish() {
     {
       std::lock_guard<std::mutex> lg(writer_state_->visitors_mutex);
@@ -226,6 +302,8 @@ class DatasetWriterFileQueue : public util::AsyncDestroyable {
 
   const FileSystemDatasetWriteOptions& options_;
   DatasetWriterState* writer_state_;
+  // Only set if batches are encoded on the CPU thread pool
+  std::shared_ptr<EncodedBytesStream> encoded_stream_;
   std::shared_ptr<FileWriter> writer_;
   // Batches are accumulated here until they are large enough to write out at which
   // point they are merged together and added to write_queue_
@@ -297,9 +375,15 @@ class DatasetWriterDirectoryQueue : public util::AsyncDestroyable {
     return GetNextFilename().Value(&current_filename_);
   }
 
-  Result<std::shared_ptr<FileWriter>> OpenWriter(const std::string& filename) {
+  Result<std::shared_ptr<FileWriter>> OpenWriter(
+      const std::string& filename,
+      const std::shared_ptr<EncodedBytesStream>& encoded_stream) {
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<io::OutputStream> out_stream,
                           write_options_.filesystem->OpenOutputStream(filename));
+    if (encoded_stream) {
+      RETURN_NOT_OK(encoded_stream->Open(std::move(out_stream)));
+      out_stream = encoded_stream;
+    }
     return write_options_.format()->MakeWriter(std::move(out_stream), schema_,
                                                write_options_.file_write_options,
                                                {write_options_.filesystem, filename});
@@ -307,15 +391,21 @@ class DatasetWriterDirectoryQueue : public util::AsyncDestroyable {
 
   Result<std::shared_ptr<DatasetWriterFileQueue>> OpenFileQueue(
       const std::string& filename) {
+    ::arrow::internal::Executor* io_executor =
+        write_options_.filesystem->io_context().executor();
+    std::shared_ptr<EncodedBytesStream> encoded_stream;
+    if (write_options_.encode_on_cpu_thread_pool) {
+      encoded_stream = std::make_shared<EncodedBytesStream>(
+          io_executor, write_options_.filesystem->io_context().pool());
+    }
     Future<std::shared_ptr<FileWriter>> file_writer_fut =
-        init_future_.Then([this, filename] {
-          ::arrow::internal::Executor* io_executor =
-              write_options_.filesystem->io_context().executor();
-          return DeferNotOk(
-              io_executor->Submit([this, filename]() { return OpenWriter(filename); }));
+        init_future_.Then([this, filename, io_executor, encoded_stream] {
+          return DeferNotOk(io_executor->Submit([this, filename, encoded_stream]() {
+            return OpenWriter(filename, encoded_stream);
+          }));
         });
     auto file_queue = util::MakeSharedAsync<DatasetWriterFileQueue>(
-        file_writer_fut, write_options_, writer_state_);
+        file_writer_fut, encoded_stream, write_options_, writer_state_);
     RETURN_NOT_OK(task_group_.AddTask(file_queue->on_closed().Then(
         [this] { writer_state_->open_files_throttle.Release(1); },
         [this](const Status& err) {
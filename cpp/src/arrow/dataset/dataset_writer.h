@@ -17,13 +17,17 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <string>
 
 #include "arrow/dataset/file_base.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/async_util.h"
 #include "arrow/util/future.h"
+#include "arrow/util/type_fwd.h"
 
 namespace arrow {
 namespace dataset {
@@ -32,6 +36,56 @@ namespace internal {
 // This lines up with our other defaults in the scanner and execution plan
 constexpr uint64_t kDefaultDatasetWriterMaxRowsQueued = 8 * 1024 * 1024;
 
+/// \brief An OutputStream accumulating the bytes written by a FileWriter in memory
+///
+/// This allows batches to be encoded on the CPU thread pool while the destination
+/// stream is only written to from the IO thread pool.
+class ARROW_DS_EXPORT EncodedBytesStream : public io::OutputStream {
+ public:
+  EncodedBytesStream(::arrow::internal::Executor* io_executor, MemoryPool* pool)
+      : io_executor_(io_executor), pool_(pool) {}
+
+  Status Open(std::shared_ptr<io::OutputStream> sink);
+
+  Status Write(const void* data, int64_t nbytes) override;
+  using io::OutputStream::Write;
+
+  /// The accumulated bytes are written by FlushToSink()
+  Status Flush() override { return Status::OK(); }
+
+  Result<int64_t> Tell() const override { return position_; }
+
+  bool closed() const override { return closed_; }
+
+  Status Close() override { return CloseAsync().status(); }
+
+  Future<> CloseAsync() override;
+
+  /// Abort the destination stream, once the write in progress (if any) is finished.
+  /// Pending writes are skipped.
+  Status Abort() override;
+
+  /// \brief Write the bytes accumulated so far to the destination stream
+  ///
+  /// The bytes are written on the IO thread pool.  Writes are chained so that they
+  /// reach the destination in order.
+  Future<> FlushToSink();
+
+ private:
+  static constexpr int64_t kInitialCapacity = 1 << 16;
+
+  ::arrow::internal::Executor* io_executor_;
+  MemoryPool* pool_;
+  std::shared_ptr<io::OutputStream> sink_;
+  std::shared_ptr<io::BufferOutputStream> buffer_;
+  Future<> last_write_ = Future<>::MakeFinished();
+  // Shared with the pending writes, which are skipped once it is set
+  std::shared_ptr<std::atomic<bool>> aborted_ =
+      std::make_shared<std::atomic<bool>>(false);
+  int64_t position_ = 0;
+  bool closed_ = false;
+};
+
 /// \brief Utility class that manages a set of writers to different paths
 ///
 /// Writers may be closed and reopened (and a new file created) based on the dataset
@@ -17,6 +17,7 @@
 
 #include "arrow/dataset/dataset_writer.h"
 
+#include <atomic>
 #include <chrono>
 #include <mutex>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/thread_pool.h"
 #include "gtest/gtest.h"
 
 namespace arrow {
@@ -40,6 +42,46 @@ namespace internal {
 using arrow::fs::internal::MockFileInfo;
 using arrow::fs::internal::MockFileSystem;
 
+// A filesystem counting the writes to its output streams which don't run on its IO
+// thread pool
+class IOThreadCheckingFileSystem : public MockFileSystem {
+ public:
+  using MockFileSystem::MockFileSystem;
+
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override {
+    ARROW_ASSIGN_OR_RAISE(auto stream, MockFileSystem::OpenOutputStream(path, metadata));
+    return std::make_shared<CheckingStream>(std::move(stream), this);
+  }
+
+  std::atomic<int> writes_off_io_thread_pool{0};
+
+ private:
+  class CheckingStream : public io::OutputStream {
+   public:
+    CheckingStream(std::shared_ptr<io::OutputStream> stream,
+                   IOThreadCheckingFileSystem* fs)
+        : stream_(std::move(stream)), fs_(fs) {}
+
+    Status Write(const void* data, int64_t nbytes) override {
+      if (!fs_->io_context().executor()->OwnsThisThread()) {
+        ++fs_->writes_off_io_thread_pool;
+      }
+      return stream_->Write(data, nbytes);
+    }
+    Status Flush() override { return stream_->Flush(); }
+    Status Close() override { return stream_->Close(); }
+    Status Abort() override { return stream_->Abort(); }
+    bool closed() const override { return stream_->closed(); }
+    Result<int64_t> Tell() const override { return stream_->Tell(); }
+
+   private:
+    std::shared_ptr<io::OutputStream> stream_;
+    IOThreadCheckingFileSystem* fs_;
+  };
+};
+
 class DatasetWriterTestFixture : public testing::Test {
  protected:
   struct ExpectedFile {
@@ -345,6 +387,48 @@ TEST_F(DatasetWriterTestFixture, ConcurrentWritesDifferentFiles) {
   AssertCreatedData(expected_files);
 }
 
+TEST_F(DatasetWriterTestFixture, EncodeOnCpuThreadPool) {
+  write_options_.encode_on_cpu_thread_pool = true;
+  constexpr int kNumPartitions = 20;
+  std::vector<ExpectedFile> expected_files;
+  EXPECT_OK_AND_ASSIGN(auto dataset_writer, DatasetWriter::Make(write_options_));
+  for (int i = 0; i < kNumPartitions; i++) {
+    std::string i_str = std::to_string(i);
+    expected_files.push_back(ExpectedFile{"testdir/part" + i_str + "/chunk-0.arrow",
+                                          static_cast<uint64_t>(i) * 10, 10});
+    Future<> queue_fut = dataset_writer->WriteRecordBatch(MakeBatch(10), "part" + i_str);
+    ASSERT_FINISHES_OK(queue_fut);
+  }
+  ASSERT_FINISHES_OK(dataset_writer->Finish());
+  AssertCreatedData(expected_files);
+}
+
+TEST_F(DatasetWriterTestFixture, EncodeOnCpuThreadPoolWritesOnIOThreadPool) {
+  ASSERT_OK_AND_ASSIGN(auto io_thread_pool, ::arrow::internal::ThreadPool::Make(2));
+  auto fs = std::make_shared<IOThreadCheckingFileSystem>(
+      std::chrono::system_clock::now(),
+      io::IOContext(default_memory_pool(), io_thread_pool.get()));
+  ASSERT_OK(fs->CreateDir("testdir"));
+  filesystem_ = fs;
+  write_options_.filesystem = fs;
+  write_options_.encode_on_cpu_thread_pool = true;
+
+  std::vector<ExpectedFile> expected_files;
+  EXPECT_OK_AND_ASSIGN(auto dataset_writer, DatasetWriter::Make(write_options_));
+  for (int i = 0; i < 4; i++) {
+    std::string i_str = std::to_string(i);
+    expected_files.push_back(ExpectedFile{"testdir/part" + i_str + "/chunk-0.arrow",
+                                          static_cast<uint64_t>(i) * 30, 30, 3});
+    for (int j = 0; j < 3; j++) {
+      ASSERT_FINISHES_OK(dataset_writer->WriteRecordBatch(MakeBatch(10), "part" + i_str));
+    }
+  }
+  ASSERT_FINISHES_OK(dataset_writer->Finish());
+  AssertCreatedData(expected_files);
+  // Batches were encoded on the CPU thread pool, but only written from the IO one
+  ASSERT_EQ(fs->writes_off_io_thread_pool.load(), 0);
+}
+
 TEST_F(DatasetWriterTestFixture, MaxOpenFiles) {
   auto gated_fs = UseGatedFs();
   write_options_.max_open_files = 2;
@@ -467,6 +551,66 @@ TEST_F(DatasetWriterTestFixture, ErrOnExistingData) {
   AssertEmptyFiles({"testdir/part-0.arrow"});
 }
 
+// An output stream whose writes wait for a gate to be opened
+class GatedOutputStream : public io::OutputStream {
+ public:
+  Status Write(const void* data, int64_t nbytes) override {
+    if (aborted) {
+      return Status::Invalid("Write to an aborted stream");
+    }
+    write_started.MarkFinished();
+    RETURN_NOT_OK(gate.status());
+    return sink_->Write(data, nbytes);
+  }
+  Status Close() override { return sink_->Close(); }
+  Status Abort() override {
+    aborted = true;
+    return sink_->Abort();
+  }
+  bool closed() const override { return sink_->closed(); }
+  Result<int64_t> Tell() const override { return sink_->Tell(); }
+
+  Result<std::shared_ptr<Buffer>> Finish() { return sink_->Finish(); }
+
+  Future<> write_started = Future<>::Make();
+  Future<> gate = Future<>::Make();
+  std::atomic<bool> aborted{false};
+
+ private:
+  std::shared_ptr<io::BufferOutputStream> sink_ =
+      io::BufferOutputStream::Create().ValueOrDie();
+};
+
+TEST(EncodedBytesStream, AbortDuringFlush) {
+  ASSERT_OK_AND_ASSIGN(auto io_pool, ::arrow::internal::ThreadPool::Make(1));
+  auto sink = std::make_shared<GatedOutputStream>();
+  EncodedBytesStream stream(io_pool.get(), default_memory_pool());
+  ASSERT_OK(stream.Open(sink));
+
+  ASSERT_OK(stream.Write("abc", 3));
+  Future<> first_flush = stream.FlushToSink();
+  ASSERT_FINISHES_OK(sink->write_started);
+  ASSERT_OK(stream.Write("def", 3));
+  Future<> second_flush = stream.FlushToSink();
+
+  // Abort must wait for the write in progress
+  ASSERT_OK_AND_ASSIGN(auto abort_thread_pool, ::arrow::internal::ThreadPool::Make(1));
+  Future<> abort =
+      DeferNotOk(abort_thread_pool->Submit([&] { return stream.Abort(); }));
+  SleepABit();
+  ASSERT_FALSE(sink->aborted);
+  AssertNotFinished(abort);
+
+  sink->gate.MarkFinished();
+  ASSERT_FINISHES_OK(abort);
+  ASSERT_TRUE(sink->aborted);
+  ASSERT_FINISHES_OK(first_flush);
+  // The pending write was skipped
+  ASSERT_FINISHES_AND_RAISES(Cancelled, second_flush);
+  ASSERT_OK_AND_ASSIGN(auto written, sink->Finish());
+  AssertBufferEqual(*written, "abc");
+}
+
 }  // namespace internal
 }  // namespace dataset
 }  // namespace arrow
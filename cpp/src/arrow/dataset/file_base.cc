@@ -20,10 +20,13 @@
 #include <arrow/compute/exec/exec_plan.h>
 
 #include <algorithm>
+#include <iterator>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/exec/expression_internal.h"
 #include "arrow/compute/exec/forest_internal.h"
 #include "arrow/compute/exec/subtree_internal.h"
 #include "arrow/dataset/dataset_internal.h"
@@ -154,6 +157,177 @@ struct FileSystemDataset::FragmentSubtrees {
   std::vector<util::Variant<int, compute::Expression>> fragments_and_subtrees;
 };
 
+namespace {
+
+// A sortable partition key: integers are widened to int64 and string-like values are
+// compared bytewise, which matches the ordering of the comparison kernels.
+struct PartitionKey {
+  bool is_string = false;
+  int64_t integer = 0;
+  std::string string;
+
+  bool operator<(const PartitionKey& other) const {
+    return is_string ? string < other.string : integer < other.integer;
+  }
+};
+
+template <typename ScalarType>
+PartitionKey MakeIntegerKey(const Scalar& scalar) {
+  PartitionKey key;
+  key.integer = static_cast<int64_t>(checked_cast<const ScalarType&>(scalar).value);
+  return key;
+}
+
+// Get the key of a partition field value or filter literal. Returns nullopt for nulls
+// and for types which can't be indexed.
+util::optional<PartitionKey> GetPartitionKey(const Datum& value) {
+  if (!value.is_scalar() || !value.scalar()->is_valid) return util::nullopt;
+
+  const Scalar& scalar = *value.scalar();
+  switch (scalar.type->id()) {
+    case Type::INT8:
+      return MakeIntegerKey<Int8Scalar>(scalar);
+    case Type::INT16:
+      return MakeIntegerKey<Int16Scalar>(scalar);
+    case Type::INT32:
+      return MakeIntegerKey<Int32Scalar>(scalar);
+    case Type::INT64:
+      return MakeIntegerKey<Int64Scalar>(scalar);
+    case Type::UINT8:
+      return MakeIntegerKey<UInt8Scalar>(scalar);
+    case Type::UINT16:
+      return MakeIntegerKey<UInt16Scalar>(scalar);
+    case Type::UINT32:
+      return MakeIntegerKey<UInt32Scalar>(scalar);
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY: {
+      PartitionKey key;
+      key.is_string = true;
+      key.string = checked_cast<const BaseBinaryScalar&>(scalar).value->ToString();
+      return key;
+    }
+    case Type::DICTIONARY: {
+      auto encoded = checked_cast<const DictionaryScalar&>(scalar).GetEncodedValue();
+      if (!encoded.ok()) return util::nullopt;
+      return GetPartitionKey(Datum(encoded.MoveValueUnsafe()));
+    }
+    default:
+      return util::nullopt;
+  }
+}
+
+// Get the field compared by one side of a comparison, looking through casts which
+// preserve ordering (such as an implicit cast of an int32 field to int64).
+const FieldRef* GetComparedField(const compute::Expression& expr) {
+  if (!expr.IsBound()) return expr.field_ref();
+  return compute::Comparison::StripOrderPreservingCasts(expr).field_ref();
+}
+
+}  // namespace
+
+struct FileSystemDataset::FragmentIndex {
+  struct FieldIndex {
+    bool is_string = false;
+    // (key, fragment index) pairs sorted by key
+    std::vector<std::pair<PartitionKey, int>> keys;
+    // fragments whose partition expression doesn't pin the field to a non-null value
+    std::vector<int> unconstrained;
+
+    // Return the sorted indices of fragments which may satisfy "field <op> key".
+    std::vector<int> Lookup(compute::Comparison::type op, const PartitionKey& key) const {
+      auto lower = std::lower_bound(
+          keys.begin(), keys.end(), key,
+          [](const std::pair<PartitionKey, int>& e, const PartitionKey& k) {
+            return e.first < k;
+          });
+      auto upper = std::upper_bound(
+          lower, keys.end(), key,
+          [](const PartitionKey& k, const std::pair<PartitionKey, int>& e) {
+            return k < e.first;
+          });
+
+      auto begin = keys.begin(), end = keys.end();
+      switch (op) {
+        case compute::Comparison::EQUAL:
+          begin = lower;
+          end = upper;
+          break;
+        case compute::Comparison::LESS:
+          end = lower;
+          break;
+        case compute::Comparison::LESS_EQUAL:
+          end = upper;
+          break;
+        case compute::Comparison::GREATER:
+          begin = upper;
+          break;
+        case compute::Comparison::GREATER_EQUAL:
+          begin = lower;
+          break;
+        default:
+          break;
+      }
+
+      std::vector<int> out = unconstrained;
+      for (auto it = begin; it != end; ++it) {
+        out.push_back(it->second);
+      }
+      std::sort(out.begin(), out.end());
+      return out;
+    }
+  };
+
+  std::unordered_map<FieldRef, FieldIndex, FieldRef::Hash> fields;
+
+  // Return the sorted indices of fragments which may satisfy predicate, or nullopt if
+  // none of predicate's conjunction members could be looked up in the index.
+  util::optional<std::vector<int>> Lookup(const compute::Expression& predicate) const {
+    if (fields.empty()) return util::nullopt;
+
+    std::vector<compute::Expression> members{predicate};
+    auto call = predicate.call();
+    if (call && call->function_name == "and_kleene") {
+      members = compute::FlattenedAssociativeChain(predicate).fringe;
+    }
+
+    util::optional<std::vector<int>> candidates;
+    for (const auto& member : members) {
+      auto cmp = compute::Comparison::Get(member);
+      if (!cmp || *cmp == compute::Comparison::NOT_EQUAL) continue;
+
+      auto op = *cmp;
+      const auto& args = member.call()->arguments;
+      const FieldRef* ref = GetComparedField(args[0]);
+      const Datum* lit = args[1].literal();
+      if (!ref || !lit) {
+        ref = GetComparedField(args[1]);
+        lit = args[0].literal();
+        op = compute::Comparison::GetFlipped(op);
+      }
+      if (!ref || !lit) continue;
+
+      auto field_index = fields.find(*ref);
+      if (field_index == fields.end()) continue;
+
+      auto key = GetPartitionKey(*lit);
+      if (!key || key->is_string != field_index->second.is_string) continue;
+
+      auto matches = field_index->second.Lookup(op, *key);
+      if (!candidates) {
+        candidates = std::move(matches);
+        continue;
+      }
+      std::vector<int> intersection;
+      std::set_intersection(candidates->begin(), candidates->end(), matches.begin(),
+                            matches.end(), std::back_inserter(intersection));
+      *candidates = std::move(intersection);
+    }
+    return candidates;
+  }
+};
+
 Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Make(
     std::shared_ptr<Schema> schema, compute::Expression root_partition,
     std::shared_ptr<FileFormat> format, std::shared_ptr<fs::FileSystem> filesystem,
@@ -166,6 +340,7 @@ Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Make(
   out->fragments_ = std::move(fragments);
   out->partitioning_ = std::move(partitioning);
   out->SetupSubtreePruning();
+  out->SetupIndexedPruning();
   return out;
 }
 
@@ -226,6 +401,59 @@ void FileSystemDataset::SetupSubtreePruning() {
                                       compute::SubtreeImpl::IsAncestor{encoded});
 }
 
+void FileSystemDataset::SetupIndexedPruning() {
+  index_ = std::make_shared<FragmentIndex>();
+  // fields with values which can't be indexed (or keys of mixed kinds)
+  std::unordered_set<FieldRef, FieldRef::Hash> unindexable;
+
+  const int num_fragments = static_cast<int>(fragments_.size());
+  for (int i = 0; i < num_fragments; ++i) {
+    auto known_values =
+        compute::ExtractKnownFieldValues(fragments_[i]->partition_expression());
+    if (!known_values.ok()) continue;
+
+    for (const auto& ref_value : known_values->map) {
+      const FieldRef& ref = ref_value.first;
+      if (unindexable.count(ref)) continue;
+
+      const Datum& value = ref_value.second;
+      if (value.is_scalar() && !value.scalar()->is_valid) {
+        // null partition; leave the fragment unconstrained for this field
+        continue;
+      }
+
+      auto key = GetPartitionKey(value);
+      auto& field_index = index_->fields[ref];
+      if (field_index.keys.empty() && key) {
+        field_index.is_string = key->is_string;
+      }
+      if (!key || key->is_string != field_index.is_string) {
+        unindexable.insert(ref);
+        index_->fields.erase(ref);
+        continue;
+      }
+      field_index.keys.emplace_back(std::move(*key), i);
+    }
+  }
+
+  for (auto& ref_index : index_->fields) {
+    auto& field_index = ref_index.second;
+    std::stable_sort(field_index.keys.begin(), field_index.keys.end(),
+                     [](const std::pair<PartitionKey, int>& l,
+                        const std::pair<PartitionKey, int>& r) {
+                       return l.first < r.first;
+                     });
+
+    std::vector<bool> constrained(num_fragments, false);
+    for (const auto& key_index : field_index.keys) {
+      constrained[key_index.second] = true;
+    }
+    for (int i = 0; i < num_fragments; ++i) {
+      if (!constrained[i]) field_index.unconstrained.push_back(i);
+    }
+  }
+}
+
 Result<FragmentIterator> FileSystemDataset::GetFragmentsImpl(
     compute::Expression predicate) {
   if (predicate == compute::literal(true)) {
@@ -233,6 +461,22 @@ Result<FragmentIterator> FileSystemDataset::GetFragmentsImpl(
     return MakeVectorIterator(FragmentVector(fragments_.begin(), fragments_.end()));
   }
 
+  auto candidates = index_->Lookup(predicate);
+  if (candidates && candidates->size() < fragments_.size()) {
+    // The index excluded some fragments by their partition keys, so only the remaining
+    // candidates need to be checked against their full partition expressions.
+    FragmentVector fragments;
+    for (int i : *candidates) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto simplified,
+          SimplifyWithGuarantee(predicate, fragments_[i]->partition_expression()));
+      if (simplified.IsSatisfiable()) {
+        fragments.push_back(fragments_[i]);
+      }
+    }
+    return MakeVectorIterator(std::move(fragments));
+  }
+
   std::vector<int> fragment_indices;
 
   std::vector<compute::Expression> predicates{predicate};
@@ -294,12 +538,14 @@ Result<int64_t> FileWriter::GetBytesWritten() const {
 namespace {
 
 Status WriteBatch(
-    std::shared_ptr<RecordBatch> batch, compute::Expression guarantee,
+    const compute::ExecBatch& batch, const std::shared_ptr<Schema>& schema,
     FileSystemDatasetWriteOptions write_options,
     std::function<Status(std::shared_ptr<RecordBatch>, const PartitionPathFormat&)>
         write) {
-  ARROW_ASSIGN_OR_RAISE(auto groups, write_options.partitioning->Partition(batch));
-  batch.reset();  // drop to hopefully conserve memory
+  // Scalar columns are kept as such until here: partition keys are often constant
+  // across a batch and need not be materialized at all
+  ARROW_ASSIGN_OR_RAISE(auto groups,
+                        write_options.partitioning->PartitionExecBatch(batch, schema));
 
   if (write_options.max_partitions <= 0) {
     return Status::Invalid("max_partitions must be positive (was ",
@@ -313,7 +559,7 @@ Status WriteBatch(
   }
 
   for (std::size_t index = 0; index < groups.batches.size(); index++) {
-    auto partition_expression = and_(groups.expressions[index], guarantee);
+    auto partition_expression = and_(groups.expressions[index], batch.guarantee);
     auto next_batch = groups.batches[index];
     PartitionPathFormat destination;
     ARROW_ASSIGN_OR_RAISE(destination,
@@ -343,11 +589,7 @@ class DatasetWritingSinkNodeConsumer : public compute::SinkNodeConsumer {
     return Status::OK();
   }
 
-  Status Consume(compute::ExecBatch batch) override {
-    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
-                          batch.ToRecordBatch(schema_));
-    return WriteNextBatch(std::move(record_batch), batch.guarantee);
-  }
+  Status Consume(compute::ExecBatch batch) override { return WriteNextBatch(batch); }
 
   Future<> Finish() override {
     RETURN_NOT_OK(task_group_.AddTask([this] { return dataset_writer_->Finish(); }));
@@ -355,10 +597,9 @@ class DatasetWritingSinkNodeConsumer : public compute::SinkNodeConsumer {
   }
 
  private:
-  Status WriteNextBatch(std::shared_ptr<RecordBatch> batch,
-                        compute::Expression guarantee) {
+  Status WriteNextBatch(const compute::ExecBatch& batch) {
     return WriteBatch(
-        batch, guarantee, write_options_,
+        batch, schema_, write_options_,
         [this](std::shared_ptr<RecordBatch> next_batch,
                const PartitionPathFormat& destination) {
           return task_group_.AddTask([this, next_batch, destination] {
@@ -494,15 +735,12 @@ class TeeNode : public compute::MapNode {
   }
 
   Result<compute::ExecBatch> DoTee(const compute::ExecBatch& batch) {
-    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
-                          batch.ToRecordBatch(output_schema()));
-    ARROW_RETURN_NOT_OK(WriteNextBatch(std::move(record_batch), batch.guarantee));
+    ARROW_RETURN_NOT_OK(WriteNextBatch(batch));
     return batch;
   }
 
-  Status WriteNextBatch(std::shared_ptr<RecordBatch> batch,
-                        compute::Expression guarantee) {
-    return WriteBatch(batch, guarantee, write_options_,
+  Status WriteNextBatch(const compute::ExecBatch& batch) {
+    return WriteBatch(batch, output_schema(), write_options_,
                       [this](std::shared_ptr<RecordBatch> next_batch,
                              const PartitionPathFormat& destination) {
                         return task_group_.AddTask([this, next_batch, destination] {
@@ -137,6 +137,12 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
   /// The options here can be overridden at scan time.
   std::shared_ptr<FragmentScanOptions> default_fragment_scan_options;
 
+  /// A cache of the columns decoded when scanning files of this format, if any.
+  ///
+  /// The cache may be shared with other formats. Only ParquetFileFormat and
+  /// IpcFileFormat use it; see ColumnCache.
+  std::shared_ptr<ColumnCache> column_cache;
+
   virtual ~FileFormat() = default;
 
   /// \brief The name identifying the kind of file format
@@ -271,6 +277,7 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
 
  protected:
   struct FragmentSubtrees;
+  struct FragmentIndex;
 
   explicit FileSystemDataset(std::shared_ptr<Schema> schema)
       : Dataset(std::move(schema)) {}
@@ -282,6 +289,7 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
   Result<FragmentIterator> GetFragmentsImpl(compute::Expression predicate) override;
 
   void SetupSubtreePruning();
+  void SetupIndexedPruning();
 
   std::shared_ptr<FileFormat> format_;
   std::shared_ptr<fs::FileSystem> filesystem_;
@@ -289,6 +297,7 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
   std::shared_ptr<Partitioning> partitioning_;
 
   std::shared_ptr<FragmentSubtrees> subtrees_;
+  std::shared_ptr<FragmentIndex> index_;
 };
 
 /// \brief Options for writing a file of this format.
@@ -401,6 +410,17 @@ struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
   /// This is mainly intended for filesystems that do not require directories such as S3.
   bool create_dir = true;
 
+  /// \brief If true, batches are encoded on the CPU thread pool
+  ///
+  /// By default, batches are encoded and written from the filesystem's IO thread
+  /// pool, which limits encoding parallelism to the (usually small) number of IO
+  /// threads.  When this is enabled, batches are encoded into memory on the CPU
+  /// thread pool and the encoded bytes are then written from the IO thread pool.
+  /// Batches of any given file are still encoded and written in order, while files
+  /// for different partitions are encoded concurrently.  Memory use remains bounded
+  /// by the dataset writer's max_rows_queued.
+  bool encode_on_cpu_thread_pool = false;
+
   /// Callback to be invoked against all FileWriters before
   /// they are finalized with FileWriter::Finish().
   std::function<Status(FileWriter*)> writer_pre_finish = [](FileWriter*) {
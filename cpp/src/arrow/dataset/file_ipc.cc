@@ -19,9 +19,15 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_nested.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/compute/exec/expression.h"
+#include "arrow/dataset/column_cache.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
@@ -34,6 +40,7 @@
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
 
 namespace dataset {
@@ -124,6 +131,74 @@ static inline Result<ipc::IpcReadOptions> GetReadOptions(
   return options;
 }
 
+// A guarantee on the values of a record batch of an IPC file, from the
+// statistics recorded for it (see ipc::IpcWriteOptions::write_batch_statistics)
+static inline Result<compute::Expression> BatchStatisticsAsExpression(
+    const RecordBatch& statistics, int64_t batch_index, const Schema& physical_schema) {
+  std::vector<compute::Expression> guarantees;
+  for (int i = 0; i < statistics.num_columns(); ++i) {
+    const auto& column = checked_cast<const StructArray&>(*statistics.column(i));
+    auto null_counts = column.GetFieldByName("null_count");
+    auto mins = column.GetFieldByName("min");
+    auto maxs = column.GetFieldByName("max");
+    if (null_counts == nullptr || mins == nullptr || maxs == nullptr) {
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto min, mins->GetScalar(batch_index));
+    ARROW_ASSIGN_OR_RAISE(auto max, maxs->GetScalar(batch_index));
+    if (!min->is_valid || !max->is_valid) {
+      continue;
+    }
+
+    auto field_expr = compute::field_ref(statistics.schema()->field(i)->name());
+    auto lower_bound = compute::greater_equal(field_expr, compute::literal(min));
+    auto upper_bound = compute::less_equal(field_expr, compute::literal(max));
+    compute::Expression guarantee;
+    if (checked_cast<const Int64Array&>(*null_counts).Value(batch_index) != 0) {
+      // Guarantee each bound separately so that they can still be used to
+      // simplify the filter (see SimplifyWithGuarantee)
+      guarantee = compute::and_(
+          compute::or_(std::move(lower_bound), compute::is_null(field_expr)),
+          compute::or_(std::move(upper_bound), compute::is_null(field_expr)));
+    } else if (min->Equals(*max)) {
+      guarantee = compute::equal(field_expr, compute::literal(std::move(min)));
+    } else {
+      guarantee = compute::and_(std::move(lower_bound), std::move(upper_bound));
+    }
+
+    // Columns which aren't read don't constrain the filter
+    auto maybe_bound = guarantee.Bind(physical_schema);
+    if (maybe_bound.ok()) {
+      guarantees.push_back(maybe_bound.MoveValueUnsafe());
+    }
+  }
+  return compute::and_(guarantees);
+}
+
+// The indices of the record batches of an IPC file which may satisfy the filter,
+// according to the statistics recorded in the file, if any
+static inline Result<util::optional<std::vector<int>>> FilterRecordBatches(
+    const ipc::RecordBatchFileReader& reader, const compute::Expression& filter) {
+  if (filter == compute::literal(true)) {
+    return util::nullopt;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto statistics, ipc::ReadBatchStatistics(reader));
+  if (statistics == nullptr) {
+    return util::nullopt;
+  }
+
+  std::vector<int> batch_indices;
+  for (int i = 0; i < reader.num_record_batches(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto guarantee,
+                          BatchStatisticsAsExpression(*statistics, i, *reader.schema()));
+    ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithGuarantee(filter, guarantee));
+    if (simplified.IsSatisfiable()) {
+      batch_indices.push_back(i);
+    }
+  }
+  return batch_indices;
+}
+
 Result<bool> IpcFileFormat::IsSupported(const FileSource& source) const {
   RETURN_NOT_OK(source.Open().status());
   return OpenReader(source).ok();
@@ -156,23 +231,122 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
         GetFragmentScanOptions<IpcFragmentScanOptions>(kIpcTypeName, options.get(),
                                                        default_fragment_scan_options));
 
+    ARROW_ASSIGN_OR_RAISE(auto batch_indices,
+                          FilterRecordBatches(*reader, options->filter));
+    if (!batch_indices) {
+      batch_indices = std::vector<int>(reader->num_record_batches());
+      std::iota(batch_indices->begin(), batch_indices->end(), 0);
+    }
+
+    // Only the record batches which may satisfy the filter are read
     RecordBatchGenerator generator;
     if (ipc_scan_options->cache_options) {
       // Transferring helps performance when coalescing
       ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
-                                           /*coalesce=*/true, options->io_context,
+                                           *batch_indices, /*coalesce=*/true,
+                                           options->io_context,
                                            *ipc_scan_options->cache_options,
                                            ::arrow::internal::GetCpuThreadPool()));
     } else {
+      // Decoding on the CPU thread pool lets the readahead below decode several
+      // record batches of the file in parallel
+      auto decode_executor =
+          options->use_threads ? ::arrow::internal::GetCpuThreadPool() : nullptr;
       ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
-                                           /*coalesce=*/false, options->io_context));
+                                           *batch_indices, /*coalesce=*/false,
+                                           options->io_context,
+                                           io::CacheOptions::LazyDefaults(),
+                                           decode_executor));
     }
     WRAP_ASYNC_GENERATOR_WITH_CHILD_SPAN(
         generator, "arrow::dataset::IpcFileFormat::ScanBatchesAsync::Next");
     auto batch_generator = MakeReadaheadGenerator(std::move(generator), readahead_level);
     return MakeChunkedBatchGenerator(std::move(batch_generator), options->batch_size);
   };
-  return MakeFromFuture(open_reader.Then(reopen_reader).Then(open_generator));
+  auto column_cache = this->column_cache;
+  if (!column_cache) {
+    return MakeFromFuture(open_reader.Then(reopen_reader).Then(open_generator));
+  }
+
+  // Look the columns up in the cache before reading any record batch, then only read
+  // the fields which are missing from it
+  auto open_cached_generator =
+      [=](const std::string& file_key,
+          const std::shared_ptr<ipc::RecordBatchFileReader>& reader)
+      -> Future<RecordBatchGenerator> {
+    if (file_key.empty()) {
+      return reopen_reader(reader).Then(open_generator);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto field_indices,
+                          internal::ColumnCacheFieldIndices(
+                              *reader->schema(), options->MaterializedFields()));
+    if (field_indices.empty()) {
+      return reopen_reader(reader).Then(open_generator);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto batch_indices,
+                          FilterRecordBatches(*reader, options->filter));
+    if (!batch_indices) {
+      batch_indices = std::vector<int>(reader->num_record_batches());
+      std::iota(batch_indices->begin(), batch_indices->end(), 0);
+    }
+    auto cached = internal::LookupCachedColumns(column_cache.get(), file_key,
+                                                std::move(*batch_indices),
+                                                std::move(field_indices));
+    if (cached.complete()) {
+      return internal::MakeCachedColumnsGenerator(
+          column_cache, file_key, std::move(cached), reader->schema(),
+          /*decode=*/{}, options->batch_size, readahead_level);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto read_options,
+                          GetReadOptions(*reader->schema(), *self, *options));
+    read_options.included_fields = cached.missing_field_indices();
+    auto included_fields = read_options.included_fields;
+    auto physical_schema = reader->schema();
+    auto cached_ptr = std::make_shared<internal::CachedColumns>(std::move(cached));
+    auto make_generator =
+        [=](const std::shared_ptr<ipc::RecordBatchFileReader>& missing_reader)
+        -> RecordBatchGenerator {
+      auto reader_mutex = std::make_shared<std::mutex>();
+      auto executor = options->io_context.executor();
+      auto decode = [=](int batch_index,
+                        std::vector<int> field_indices) -> Future<ChunkedArrayVector> {
+        return DeferNotOk(executor->Submit([=]() -> Result<ChunkedArrayVector> {
+          std::shared_ptr<RecordBatch> batch;
+          {
+            std::lock_guard<std::mutex> lock(*reader_mutex);
+            ARROW_ASSIGN_OR_RAISE(batch, missing_reader->ReadRecordBatch(batch_index));
+          }
+          // The batch holds the included fields, in the order of the file schema
+          ChunkedArrayVector columns;
+          for (int field_index : field_indices) {
+            auto position = std::lower_bound(included_fields.begin(),
+                                             included_fields.end(), field_index) -
+                            included_fields.begin();
+            columns.push_back(std::make_shared<ChunkedArray>(
+                batch->column(static_cast<int>(position))));
+          }
+          return columns;
+        }));
+      };
+      auto generator = internal::MakeCachedColumnsGenerator(
+          column_cache, file_key, std::move(*cached_ptr), physical_schema,
+          std::move(decode), options->batch_size, readahead_level);
+      return MakeTransferredGenerator(std::move(generator),
+                                      ::arrow::internal::GetCpuThreadPool());
+    };
+    return OpenReaderAsync(source, read_options).Then(std::move(make_generator));
+  };
+  // The file is stat'ed for its key while its footer is read
+  auto file_key = column_cache->FileKey(*this, source);
+  return MakeFromFuture(file_key.Then(
+      [open_reader, open_cached_generator](const std::string& file_key) {
+        return open_reader.Then(
+            [file_key, open_cached_generator](
+                const std::shared_ptr<ipc::RecordBatchFileReader>& reader) {
+              return open_cached_generator(file_key, reader);
+            });
+      }));
 }
 
 Future<util::optional<int64_t>> IpcFileFormat::CountRows(
@@ -76,7 +76,9 @@ class ARROW_DS_EXPORT IpcFragmentScanOptions : public FragmentScanOptions {
   /// Options passed to the IPC file reader.
   /// included_fields, memory_pool, and use_threads are ignored.
   std::shared_ptr<ipc::IpcReadOptions> options;
-  /// If present, the async scanner will enable I/O coalescing.
+  /// If present, the async scanner will enable I/O coalescing: neighbouring
+  /// record batches are read together (within the limits of the cache options)
+  /// and, if the options are lazy, when the first of them is needed.
   /// This is ignored by the sync scanner.
   std::shared_ptr<io::CacheOptions> cache_options;
 };
@@ -62,6 +62,14 @@ class IpcFormatHelper {
 
 class TestIpcFileFormat : public FileFormatFixtureMixin<IpcFormatHelper> {};
 
+// Reads from in-memory buffers are zero-copy, hence never coalesced
+class NoZeroCopyBufferReader : public io::BufferReader {
+ public:
+  using io::BufferReader::BufferReader;
+
+  bool supports_zero_copy() const override { return false; }
+};
+
 TEST_F(TestIpcFileFormat, WriteRecordBatchReader) { TestWrite(); }
 
 TEST_F(TestIpcFileFormat, WriteRecordBatchReaderCustomOptions) {
@@ -91,6 +99,66 @@ TEST_F(TestIpcFileFormat, IsSupported) { TestIsSupported(); }
 TEST_F(TestIpcFileFormat, CountRows) { TestCountRows(); }
 TEST_F(TestIpcFileFormat, FragmentEquals) { TestFragmentEquals(); }
 
+TEST_F(TestIpcFileFormat, ScanPrunesBatchesWithStatistics) {
+  auto dataset_schema = schema({field("i", int32()), field("s", utf8())});
+  RecordBatchVector batches = {
+      RecordBatchFromJSON(dataset_schema, R"([[0, "a"], [5, "b"], [9, null]])"),
+      RecordBatchFromJSON(dataset_schema, R"([[10, "c"], [null, "d"], [19, "e"]])"),
+      RecordBatchFromJSON(dataset_schema, R"([[20, "f"], [25, "g"], [29, "h"]])"),
+      RecordBatchFromJSON(dataset_schema, R"([[30, "i"], [35, "j"], [39, "k"]])"),
+  };
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  auto write_options = ipc::IpcWriteOptions::Defaults();
+  write_options.write_batch_statistics = true;
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       ipc::MakeFileWriter(sink, dataset_schema, write_options));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto fragment = MakeFragment(
+      FileSource([buffer]() -> Result<std::shared_ptr<io::RandomAccessFile>> {
+        return std::make_shared<NoZeroCopyBufferReader>(buffer);
+      }));
+  SetSchema(dataset_schema->fields());
+
+  auto ScannedRows = [&](compute::Expression filter) -> int64_t {
+    SetFilter(std::move(filter));
+    EXPECT_OK_AND_ASSIGN(auto batch_gen, fragment->ScanBatchesAsync(opts_));
+    EXPECT_FINISHES_OK_AND_ASSIGN(auto scanned, CollectAsyncGenerator(batch_gen));
+    int64_t num_rows = 0;
+    for (const auto& batch : scanned) {
+      num_rows += batch->num_rows();
+    }
+    return num_rows;
+  };
+
+  // With and without I/O coalescing
+  for (bool coalesce : {false, true}) {
+    ARROW_SCOPED_TRACE("coalesce = ", coalesce);
+    auto fragment_scan_options = std::make_shared<IpcFragmentScanOptions>();
+    if (coalesce) {
+      fragment_scan_options->cache_options =
+          std::make_shared<io::CacheOptions>(io::CacheOptions::LazyDefaults());
+    }
+    opts_->fragment_scan_options = fragment_scan_options;
+
+    // Only the batches whose bounds overlap the filter are read
+    ASSERT_EQ(ScannedRows(compute::and_(
+                  compute::greater_equal(compute::field_ref("i"), compute::literal(15)),
+                  compute::less(compute::field_ref("i"), compute::literal(25)))),
+              6);
+    ASSERT_EQ(
+        ScannedRows(compute::equal(compute::field_ref("s"), compute::literal("j"))), 3);
+    ASSERT_EQ(ScannedRows(compute::is_null(compute::field_ref("i"))), 3);
+    ASSERT_EQ(
+        ScannedRows(compute::greater(compute::field_ref("i"), compute::literal(50))), 0);
+    ASSERT_EQ(ScannedRows(compute::literal(true)), 12);
+  }
+}
+
 class TestIpcFileSystemDataset : public testing::Test,
                                  public WriteFileSystemDatasetMixin {
  public:
@@ -152,6 +220,7 @@ TEST_P(TestIpcFileFormatScan, ScanRecordBatchReaderWithDuplicateColumnError) {
   TestScanWithDuplicateColumnError();
 }
 TEST_P(TestIpcFileFormatScan, ScanWithPushdownNulls) { TestScanWithPushdownNulls(); }
+TEST_P(TestIpcFileFormatScan, ScanUsesColumnCache) { TestScanUsesColumnCache(); }
 TEST_P(TestIpcFileFormatScan, FragmentScanOptions) {
   auto reader = GetRecordBatchReader(
       // ARROW-12077: on Windows/mimalloc/release, nullable list column leads to crash
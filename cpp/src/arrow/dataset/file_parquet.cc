@@ -17,6 +17,7 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -25,6 +26,7 @@
 #include <vector>
 
 #include "arrow/compute/exec.h"
+#include "arrow/dataset/column_cache.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/path_util.h"
@@ -304,6 +306,121 @@ Result<bool> IsSupportedParquetFile(const ParquetFileFormat& format,
   END_PARQUET_CATCH_EXCEPTIONS
 }
 
+// Append the indices of the leaf columns of a field of a Parquet schema
+void AddLeafColumns(const SchemaField& field, std::vector<int>* column_indices) {
+  if (field.is_leaf()) {
+    column_indices->push_back(field.column_index);
+    return;
+  }
+  for (const auto& child : field.children) {
+    AddLeafColumns(child, column_indices);
+  }
+}
+
+// Look up the columns of some row groups needed by a scan in a ColumnCache, returning
+// null if the scan doesn't need any column of the file
+Result<std::shared_ptr<internal::CachedColumns>> LookupCachedRowGroups(
+    ColumnCache* column_cache, const std::string& file_key,
+    ParquetFileFragment* fragment, const std::vector<int>& row_groups,
+    const ScanOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto physical_schema, fragment->ReadPhysicalSchema());
+  ARROW_ASSIGN_OR_RAISE(auto field_indices,
+                        internal::ColumnCacheFieldIndices(*physical_schema,
+                                                          options.MaterializedFields()));
+  if (field_indices.empty()) return nullptr;
+  return std::make_shared<internal::CachedColumns>(internal::LookupCachedColumns(
+      column_cache, file_key, row_groups, std::move(field_indices)));
+}
+
+// Read the fields missing from a ColumnCache from the row groups missing any of them.
+//
+// A single record batch generator reads all these row groups, as an uncached scan does,
+// so pre-buffering and readahead apply to them.  Row groups are decoded in the order
+// they are scanned, so each call reads the next row group's batches.
+Result<internal::DecodeColumns> MakeMissingColumnsDecoder(
+    const std::shared_ptr<parquet::arrow::FileReader>& reader,
+    const internal::CachedColumns& cached, int64_t rows_to_readahead) {
+  std::vector<int> row_groups;
+  for (size_t i = 0; i < cached.chunk_indices.size(); ++i) {
+    for (const auto& column : cached.columns[i]) {
+      if (column == nullptr) {
+        row_groups.push_back(cached.chunk_indices[i]);
+        break;
+      }
+    }
+  }
+
+  struct State {
+    RecordBatchGenerator batches;
+    std::shared_ptr<parquet::FileMetaData> metadata;
+    std::vector<int> field_indices;
+    std::vector<std::shared_ptr<DataType>> types;
+    std::mutex mutex;
+    Future<> previous_read = Future<>::MakeFinished();
+  };
+  auto state = std::make_shared<State>();
+  state->metadata = reader->parquet_reader()->metadata();
+  state->field_indices = cached.missing_field_indices();
+  std::vector<int> column_indices;
+  for (int field_index : state->field_indices) {
+    const auto& schema_field = reader->manifest().schema_fields[field_index];
+    AddLeafColumns(schema_field, &column_indices);
+    state->types.push_back(schema_field.field->type());
+  }
+  ARROW_ASSIGN_OR_RAISE(state->batches,
+                        reader->GetRecordBatchGenerator(
+                            reader, row_groups, column_indices,
+                            ::arrow::internal::GetCpuThreadPool(), rows_to_readahead));
+
+  return [state](int row_group,
+                 std::vector<int> field_indices) -> Future<ChunkedArrayVector> {
+    const int64_t num_rows = state->metadata->RowGroup(row_group)->num_rows();
+    auto batches = std::make_shared<RecordBatchVector>();
+    auto read_row_group = [state, batches, num_rows]() -> Future<> {
+      auto rows_read = std::make_shared<int64_t>(0);
+      return Loop([state, batches, num_rows, rows_read]() -> Future<ControlFlow<>> {
+        if (*rows_read >= num_rows) {
+          return Future<ControlFlow<>>::MakeFinished(Break());
+        }
+        return state->batches().Then(
+            [batches, rows_read](
+                const std::shared_ptr<RecordBatch>& batch) -> Result<ControlFlow<>> {
+              if (IsIterationEnd(batch)) {
+                return Status::Invalid("Parquet row group ended unexpectedly");
+              }
+              *rows_read += batch->num_rows();
+              batches->push_back(batch);
+              return Continue();
+            });
+      });
+    };
+
+    Future<> read;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      read = state->previous_read.Then(std::move(read_row_group));
+      state->previous_read = read;
+    }
+    return read.Then([state, batches, field_indices]() -> Result<ChunkedArrayVector> {
+      // The batches hold the missing fields, in the order of the file schema
+      ChunkedArrayVector columns;
+      for (int field_index : field_indices) {
+        auto position = std::lower_bound(state->field_indices.begin(),
+                                         state->field_indices.end(), field_index) -
+                        state->field_indices.begin();
+        ArrayVector chunks;
+        for (const auto& batch : *batches) {
+          chunks.push_back(batch->column(static_cast<int>(position)));
+        }
+        ARROW_ASSIGN_OR_RAISE(
+            auto column, ChunkedArray::Make(std::move(chunks), state->types[position]));
+        columns.push_back(std::move(column));
+      }
+      return columns;
+    });
+  };
+}
+
 }  // namespace
 
 bool ParquetFileFormat::Equals(const FileFormat& other) const {
@@ -446,37 +563,86 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
     if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
   }
   int64_t batch_size = options->batch_size;
-  // Open the reader and pay the real IO cost.
-  auto make_generator =
-      [=](const std::shared_ptr<parquet::arrow::FileReader>& reader) mutable
-      -> Result<RecordBatchGenerator> {
-    // Ensure that parquet_fragment has FileMetaData
-    RETURN_NOT_OK(parquet_fragment->EnsureCompleteMetadata(reader.get()));
-    if (!pre_filtered) {
-      // row groups were not already filtered; do this now
-      ARROW_ASSIGN_OR_RAISE(row_groups,
-                            parquet_fragment->FilterRowGroups(options->filter));
-      if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+  int batch_readahead = options->batch_readahead;
+  int64_t rows_to_readahead = batch_readahead * batch_size;
+
+  // If the fragment's metadata is cached, the columns can be looked up in the column
+  // cache before opening a FileReader, avoiding all IO but the stat of the file if they
+  // are all found.
+  auto column_cache = this->column_cache;
+  auto self = checked_pointer_cast<const ParquetFileFormat>(shared_from_this());
+  auto scan = [=](const std::string& file_key) mutable -> Future<RecordBatchGenerator> {
+    std::shared_ptr<internal::CachedColumns> cached;
+    if (!file_key.empty() && pre_filtered) {
+      ARROW_ASSIGN_OR_RAISE(cached, LookupCachedRowGroups(column_cache.get(), file_key,
+                                                          parquet_fragment.get(),
+                                                          row_groups, *options));
+      if (cached && cached->complete()) {
+        ARROW_ASSIGN_OR_RAISE(auto physical_schema,
+                              parquet_fragment->ReadPhysicalSchema());
+        return MakeSerialReadaheadGenerator(
+            internal::MakeCachedColumnsGenerator(
+                column_cache, file_key, std::move(*cached), std::move(physical_schema),
+                /*decode=*/{}, batch_size, /*readahead=*/0),
+            batch_readahead);
+      }
     }
-    ARROW_ASSIGN_OR_RAISE(auto column_projection,
-                          InferColumnProjection(*reader, *options));
-    ARROW_ASSIGN_OR_RAISE(
-        auto parquet_scan_options,
-        GetFragmentScanOptions<ParquetFragmentScanOptions>(
-            kParquetTypeName, options.get(), default_fragment_scan_options));
-    int batch_readahead = options->batch_readahead;
-    int64_t rows_to_readahead = batch_readahead * batch_size;
-    ARROW_ASSIGN_OR_RAISE(auto generator,
-                          reader->GetRecordBatchGenerator(
-                              reader, row_groups, column_projection,
-                              ::arrow::internal::GetCpuThreadPool(), rows_to_readahead));
-    RecordBatchGenerator sliced = SlicingGenerator(std::move(generator), batch_size);
-    RecordBatchGenerator sliced_readahead =
-        MakeSerialReadaheadGenerator(std::move(sliced), batch_readahead);
-    return sliced_readahead;
+
+    // Open the reader and pay the real IO cost.
+    auto make_generator =
+        [=](const std::shared_ptr<parquet::arrow::FileReader>& reader) mutable
+        -> Result<RecordBatchGenerator> {
+      // Ensure that parquet_fragment has FileMetaData
+      RETURN_NOT_OK(parquet_fragment->EnsureCompleteMetadata(reader.get()));
+      if (!pre_filtered) {
+        // row groups were not already filtered; do this now
+        ARROW_ASSIGN_OR_RAISE(row_groups,
+                              parquet_fragment->FilterRowGroups(options->filter));
+        if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+        if (!file_key.empty()) {
+          ARROW_ASSIGN_OR_RAISE(cached,
+                                LookupCachedRowGroups(column_cache.get(), file_key,
+                                                      parquet_fragment.get(),
+                                                      row_groups, *options));
+        }
+      }
+      if (cached) {
+        ARROW_ASSIGN_OR_RAISE(auto physical_schema,
+                              parquet_fragment->ReadPhysicalSchema());
+        internal::DecodeColumns decode;
+        if (!cached->complete()) {
+          ARROW_ASSIGN_OR_RAISE(
+              decode, MakeMissingColumnsDecoder(reader, *cached, rows_to_readahead));
+        }
+        return MakeSerialReadaheadGenerator(
+            internal::MakeCachedColumnsGenerator(
+                column_cache, file_key, std::move(*cached), std::move(physical_schema),
+                std::move(decode), batch_size, /*readahead=*/0),
+            batch_readahead);
+      }
+      ARROW_ASSIGN_OR_RAISE(auto column_projection,
+                            InferColumnProjection(*reader, *options));
+      ARROW_ASSIGN_OR_RAISE(
+          auto parquet_scan_options,
+          GetFragmentScanOptions<ParquetFragmentScanOptions>(
+              kParquetTypeName, options.get(), default_fragment_scan_options));
+      ARROW_ASSIGN_OR_RAISE(
+          auto generator,
+          reader->GetRecordBatchGenerator(reader, row_groups, column_projection,
+                                          ::arrow::internal::GetCpuThreadPool(),
+                                          rows_to_readahead));
+      RecordBatchGenerator sliced = SlicingGenerator(std::move(generator), batch_size);
+      RecordBatchGenerator sliced_readahead =
+          MakeSerialReadaheadGenerator(std::move(sliced), batch_readahead);
+      return sliced_readahead;
+    };
+    return self->GetReaderAsync(parquet_fragment->source(), options)
+        .Then(std::move(make_generator));
   };
-  auto generator = MakeFromFuture(GetReaderAsync(parquet_fragment->source(), options)
-                                      .Then(std::move(make_generator)));
+  // The key of the file is only known once the file has been stat'ed
+  auto generator = MakeFromFuture(
+      column_cache ? column_cache->FileKey(*this, file->source()).Then(std::move(scan))
+                   : scan(""));
   WRAP_ASYNC_GENERATOR_WITH_CHILD_SPAN(
       generator, "arrow::dataset::ParquetFileFormat::ScanBatchesAsync::Next");
   return generator;
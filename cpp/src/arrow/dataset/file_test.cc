@@ -305,6 +305,65 @@ TEST_F(TestFileSystemDataset, FragmentPartitions) {
                 });
 }
 
+TEST_F(TestFileSystemDataset, IndexedPartitionPruning) {
+  // Enough partitions with integer, string, and null keys that pruning goes through
+  // the index over partition keys
+  std::vector<fs::FileInfo> files;
+  std::vector<compute::Expression> partitions;
+  for (int year = 2000; year < 2010; ++year) {
+    for (std::string region : {"eu", "na", "sa"}) {
+      auto path = "year=" + std::to_string(year) + "/region=" + region;
+      files.push_back(fs::File(path));
+      partitions.push_back(and_(equal(field_ref("year"), literal(year)),
+                                equal(field_ref("region"), literal(region))));
+    }
+  }
+  files.push_back(fs::File("year=2005/region=null"));
+  partitions.push_back(
+      and_(equal(field_ref("year"), literal(2005)), is_null(field_ref("region"))));
+  files.push_back(fs::File("unpartitioned"));
+  partitions.push_back(literal(true));
+
+  MakeDataset(files, literal(true), partitions,
+              schema({field("year", int32()), field("region", utf8())}));
+
+  auto GetFragments = [&](compute::Expression filter) {
+    return *dataset_->GetFragments(*filter.Bind(*dataset_->schema()));
+  };
+
+  AssertFragmentsAreFromPath(
+      GetFragments(equal(field_ref("year"), literal(2005))),
+      {"year=2005/region=eu", "year=2005/region=na", "year=2005/region=sa",
+       "year=2005/region=null", "unpartitioned"});
+
+  // implicit cast of the field to the literal's type
+  AssertFragmentsAreFromPath(
+      GetFragments(and_(equal(field_ref("year"), literal(int64_t(2005))),
+                        equal(field_ref("region"), literal("na")))),
+      {"year=2005/region=na", "unpartitioned"});
+
+  AssertFragmentsAreFromPath(
+      GetFragments(and_(greater(literal(2002), field_ref("year")),
+                        less_equal(field_ref("region"), literal("eu")))),
+      {"year=2000/region=eu", "year=2001/region=eu", "unpartitioned"});
+
+  AssertFragmentsAreFromPath(
+      GetFragments(and_(greater_equal(field_ref("year"), literal(2008)),
+                        is_null(field_ref("region")))),
+      {"unpartitioned"});
+
+  AssertFragmentsAreFromPath(GetFragments(equal(field_ref("region"), literal("af"))),
+                             {"unpartitioned"});
+
+  // predicates which can't be looked up in the index are still pruned
+  AssertFragmentsAreFromPath(
+      GetFragments(or_(equal(field_ref("year"), literal(2000)),
+                       equal(field_ref("year"), literal(2001)))),
+      {"year=2000/region=eu", "year=2000/region=na", "year=2000/region=sa",
+       "year=2001/region=eu", "year=2001/region=na", "year=2001/region=sa",
+       "unpartitioned"});
+}
+
 TEST_F(TestFileSystemDataset, WriteProjected) {
   // Regression test for ARROW-12620
   auto format = std::make_shared<IpcFileFormat>();
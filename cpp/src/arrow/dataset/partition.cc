@@ -26,9 +26,11 @@
 #include "arrow/array/array_dict.h"
 #include "arrow/array/array_nested.h"
 #include "arrow/array/builder_dict.h"
+#include "arrow/array/util.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
 #include "arrow/compute/exec/expression_internal.h"
 #include "arrow/compute/row/grouper.h"
 #include "arrow/dataset/dataset_internal.h"
@@ -104,6 +106,19 @@ std::shared_ptr<Partitioning> Partitioning::Default() {
   return std::make_shared<DefaultPartitioning>();
 }
 
+Result<Partitioning::PartitionedBatches> Partitioning::PartitionExecBatch(
+    const compute::ExecBatch& batch, const std::shared_ptr<Schema>& schema) const {
+  ARROW_ASSIGN_OR_RAISE(auto record_batch, batch.ToRecordBatch(schema));
+  return Partition(record_batch);
+}
+
+static compute::Expression KeyExpression(const std::string& name,
+                                         std::shared_ptr<Scalar> value) {
+  return value->is_valid
+             ? compute::equal(compute::field_ref(name), compute::literal(std::move(value)))
+             : compute::is_null(compute::field_ref(name));
+}
+
 static Result<RecordBatchVector> ApplyGroupings(
     const ListArray& groupings, const std::shared_ptr<RecordBatch>& batch) {
   ARROW_ASSIGN_OR_RAISE(Datum sorted,
@@ -191,10 +206,7 @@ Result<Partitioning::PartitionedBatches> KeyValuePartitioning::Partition(
     for (int i = 0; i < num_keys; ++i) {
       ARROW_ASSIGN_OR_RAISE(auto val, unique_arrays[i]->GetScalar(group));
       const auto& name = batch->schema()->field(key_indices[i])->name();
-
-      exprs[i] = val->is_valid ? compute::equal(compute::field_ref(name),
-                                                compute::literal(std::move(val)))
-                               : compute::is_null(compute::field_ref(name));
+      exprs[i] = KeyExpression(name, std::move(val));
     }
     out.expressions[group] = and_(std::move(exprs));
   }
@@ -212,6 +224,49 @@ Result<Partitioning::PartitionedBatches> KeyValuePartitioning::Partition(
   return out;
 }
 
+Result<Partitioning::PartitionedBatches> KeyValuePartitioning::PartitionExecBatch(
+    const compute::ExecBatch& batch, const std::shared_ptr<Schema>& schema) const {
+  std::vector<bool> is_key(schema->num_fields(), false);
+  std::vector<compute::Expression> exprs;
+
+  for (const auto& partition_field : schema_->fields()) {
+    ARROW_ASSIGN_OR_RAISE(auto match,
+                          FieldRef(partition_field->name()).FindOneOrNone(*schema));
+    if (match.empty()) continue;
+
+    const Datum& key = batch.values[match[0]];
+    if (!key.is_scalar()) {
+      // rows may belong to different partitions; group them
+      return Partitioning::PartitionExecBatch(batch, schema);
+    }
+    is_key[match[0]] = true;
+    exprs.push_back(KeyExpression(schema->field(match[0])->name(), key.scalar()));
+  }
+
+  // all keys are constant: the whole batch falls in a single partition, and the key
+  // columns (which are not written) need never be materialized
+  FieldVector fields;
+  ArrayVector columns;
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    if (is_key[i]) continue;
+    fields.push_back(schema->field(i));
+
+    const Datum& value = batch.values[i];
+    if (value.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(auto column,
+                            MakeArrayFromScalar(*value.scalar(), batch.length));
+      columns.push_back(std::move(column));
+    } else {
+      columns.push_back(value.make_array());
+    }
+  }
+
+  auto rest = RecordBatch::Make(::arrow::schema(std::move(fields), schema->metadata()),
+                                batch.length, std::move(columns));
+  auto expression = exprs.empty() ? compute::literal(true) : and_(std::move(exprs));
+  return PartitionedBatches{{std::move(rest)}, {std::move(expression)}};
+}
+
 std::ostream& operator<<(std::ostream& os, SegmentEncoding segment_encoding) {
   switch (segment_encoding) {
     case SegmentEncoding::None:
@@ -85,6 +85,13 @@ class ARROW_DS_EXPORT Partitioning : public util::EqualityComparable<Partitionin
   virtual Result<PartitionedBatches> Partition(
       const std::shared_ptr<RecordBatch>& batch) const = 0;
 
+  /// \brief Like Partition, for a batch whose columns may be scalars
+  ///
+  /// The default implementation materializes the batch. Partitionings may
+  /// avoid this, for example when the partition keys are scalars.
+  virtual Result<PartitionedBatches> PartitionExecBatch(
+      const compute::ExecBatch& batch, const std::shared_ptr<Schema>& schema) const;
+
   /// \brief Parse a path into a partition expression
   virtual Result<compute::Expression> Parse(const std::string& path) const = 0;
 
@@ -180,6 +187,12 @@ class ARROW_DS_EXPORT KeyValuePartitioning : public Partitioning {
   Result<PartitionedBatches> Partition(
       const std::shared_ptr<RecordBatch>& batch) const override;
 
+  /// If every key column of the batch is a scalar, the batch belongs to a single
+  /// partition and the key columns are dropped without being materialized.
+  Result<PartitionedBatches> PartitionExecBatch(
+      const compute::ExecBatch& batch,
+      const std::shared_ptr<Schema>& schema) const override;
+
   Result<compute::Expression> Parse(const std::string& path) const override;
 
   Result<PartitionPathFormat> Format(const compute::Expression& expr) const override;
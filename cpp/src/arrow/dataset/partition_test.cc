@@ -28,6 +28,7 @@
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/status.h"
@@ -186,6 +187,46 @@ TEST_F(TestPartitioning, Partition) {
                   expected_expressions);
 }
 
+TEST_F(TestPartitioning, PartitionExecBatch) {
+  auto dataset_schema =
+      schema({field("a", int32()), field("b", utf8()), field("c", uint32())});
+  auto partitioning = std::make_shared<HivePartitioning>(
+      schema({field("a", int32()), field("b", utf8())}));
+  auto c = ArrayFromJSON(uint32(), "[0, 1, 2]");
+
+  // scalar keys: a single partition, without grouping
+  compute::ExecBatch batch({MakeScalar(int32_t(3)), MakeNullScalar(utf8()), c}, 3);
+  ASSERT_OK_AND_ASSIGN(auto partitioned,
+                       partitioning->PartitionExecBatch(batch, dataset_schema));
+  ASSERT_EQ(partitioned.batches.size(), 1);
+  AssertBatchesEqual(*RecordBatch::Make(schema({field("c", uint32())}), 3, {c}),
+                     *partitioned.batches[0]);
+  ASSERT_EQ(partitioned.expressions[0],
+            and_(equal(field_ref("a"), literal(3)), is_null(field_ref("b"))));
+
+  // scalar non-key columns are broadcast
+  batch = compute::ExecBatch(
+      {MakeScalar(int32_t(3)), MakeScalar("x"), MakeScalar(uint32_t(7))}, 2);
+  ASSERT_OK_AND_ASSIGN(partitioned,
+                       partitioning->PartitionExecBatch(batch, dataset_schema));
+  ASSERT_EQ(partitioned.batches.size(), 1);
+  AssertBatchesEqual(*RecordBatchFromJSON(schema({field("c", uint32())}),
+                                          R"([{"c": 7}, {"c": 7}])"),
+                     *partitioned.batches[0]);
+
+  // any array key: rows are grouped
+  batch = compute::ExecBatch(
+      {MakeScalar(int32_t(3)), ArrayFromJSON(utf8(), R"(["x", "y", "x"])"), c}, 3);
+  ASSERT_OK_AND_ASSIGN(partitioned,
+                       partitioning->PartitionExecBatch(batch, dataset_schema));
+  ASSERT_EQ(partitioned.batches.size(), 2);
+  ASSERT_EQ(partitioned.expressions[0], and_(equal(field_ref("a"), literal(3)),
+                                             equal(field_ref("b"), literal("x"))));
+  AssertBatchesEqual(*RecordBatchFromJSON(schema({field("c", uint32())}),
+                                          R"([{"c": 0}, {"c": 2}])"),
+                     *partitioned.batches[0]);
+}
+
 TEST_F(TestPartitioning, DirectoryPartitioning) {
   partitioning_ = std::make_shared<DirectoryPartitioning>(
       schema({field("alpha", int32()), field("beta", utf8())}));
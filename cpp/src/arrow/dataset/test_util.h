@@ -33,6 +33,7 @@
 
 #include "arrow/array.h"
 #include "arrow/compute/exec/expression.h"
+#include "arrow/dataset/column_cache.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/discovery.h"
 #include "arrow/dataset/file_base.h"
@@ -896,6 +897,70 @@ class FileFormatScanMixin : public FileFormatFixtureMixin<FormatHelper>,
     }
     ASSERT_EQ(row_count, 1);
   }
+  void TestScanUsesColumnCache() {
+    auto dataset_schema = schema({field("i", int32()), field("s", utf8())});
+    // Each batch is written to a row group (or record batch) of the file
+    RecordBatchVector batches = {
+        RecordBatchFromJSON(dataset_schema, R"([[0, "a"], [1, "b"], [2, null]])"),
+        RecordBatchFromJSON(dataset_schema, R"([[3, "c"], [null, "d"]])"),
+    };
+    auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+    auto WriteFile = [&](const RecordBatchVector& batches) {
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches));
+      ASSERT_OK_AND_ASSIGN(auto buffer, FormatHelper::Write(reader.get()));
+      ASSERT_OK(mock_fs->CreateFile("data", buffer->ToString()));
+    };
+    WriteFile(batches);
+
+    auto cache = ColumnCache::Make(1 << 20);
+    this->format_->column_cache = cache;
+    auto fragment = this->MakeFragment(FileSource("data", mock_fs));
+    this->SetSchema(dataset_schema->fields());
+
+    auto AssertScanned = [&](const std::vector<std::string>& names,
+                             const RecordBatchVector& batches) {
+      this->Project(names);
+      ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(batches));
+      ASSERT_OK_AND_ASSIGN(auto batch_gen, fragment->ScanBatchesAsync(opts_));
+      ASSERT_FINISHES_OK_AND_ASSIGN(auto scanned, CollectAsyncGenerator(batch_gen));
+      ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(scanned));
+      ASSERT_EQ(table->num_columns(), static_cast<int>(names.size()));
+      for (const auto& name : names) {
+        AssertChunkedEquivalent(*expected->GetColumnByName(name),
+                                *table->GetColumnByName(name));
+      }
+    };
+
+    AssertScanned({"i"}, batches);
+    ASSERT_EQ(cache->stats().misses, 2);
+    ASSERT_EQ(cache->stats().insertions, 2);
+
+    // The second scan finds the columns in the cache
+    AssertScanned({"i"}, batches);
+    ASSERT_EQ(cache->stats().hits, 2);
+    ASSERT_EQ(cache->stats().insertions, 2);
+
+    // Only the column missing from the cache is decoded
+    AssertScanned({"s", "i"}, batches);
+    ASSERT_EQ(cache->stats().hits, 4);
+    ASSERT_EQ(cache->stats().misses, 4);
+    ASSERT_EQ(cache->stats().insertions, 4);
+
+    AssertScanned({"i", "s"}, batches);
+    ASSERT_EQ(cache->stats().hits, 8);
+    ASSERT_EQ(cache->stats().insertions, 4);
+
+    // The columns of the previous version of a modified file aren't used
+    RecordBatchVector modified = {
+        RecordBatchFromJSON(dataset_schema, R"([[5, "e"], [6, "f"]])"),
+    };
+    WriteFile(modified);
+    fragment = this->MakeFragment(FileSource("data", mock_fs));
+    AssertScanned({"i", "s"}, modified);
+    ASSERT_EQ(cache->stats().hits, 8);
+    ASSERT_EQ(cache->stats().misses, 6);
+    ASSERT_EQ(cache->stats().insertions, 6);
+  }
 
  protected:
   using FileFormatFixtureMixin<FormatHelper>::opts_;
@@ -43,6 +43,8 @@ using FragmentVector = std::vector<std::shared_ptr<Fragment>>;
 
 class FragmentScanOptions;
 
+class ColumnCache;
+
 class FileSource;
 class FileFormat;
 class FileFragment;
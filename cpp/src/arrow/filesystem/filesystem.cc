@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <deque>
+#include <mutex>
 #include <sstream>
 #include <utility>
 
@@ -40,9 +43,11 @@
 #include "arrow/status.h"
 #include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/uri.h"
 #include "arrow/util/vector.h"
 #include "arrow/util/windows_fixup.h"
@@ -590,9 +595,72 @@ Result<std::shared_ptr<io::OutputStream>> SlowFileSystem::OpenAppendStream(
   return base_fs_->OpenAppendStream(path, metadata);
 }
 
+namespace {
+
+// Bounds the total size of the buffers held by concurrent streamed copies
+class CopyBufferBudget {
+ public:
+  explicit CopyBufferBudget(int64_t capacity) : available_(capacity) {}
+
+  // Reserve `nbytes`, once other copies have released enough of their buffers.
+  // A reservation is always granted if no other is held, so that a budget smaller
+  // than a single chunk cannot block progress.
+  Future<> Acquire(int64_t nbytes) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (waiters_.empty() && CanGrant(nbytes)) {
+      Grant(nbytes);
+      return Future<>::MakeFinished();
+    }
+    auto fut = Future<>::Make();
+    waiters_.push_back({nbytes, fut});
+    return fut;
+  }
+
+  void Release(int64_t nbytes) {
+    std::vector<Future<>> granted;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      available_ += nbytes;
+      --num_holders_;
+      while (!waiters_.empty() && CanGrant(waiters_.front().nbytes)) {
+        Grant(waiters_.front().nbytes);
+        granted.push_back(std::move(waiters_.front().granted));
+        waiters_.pop_front();
+      }
+    }
+    // Run the waiters' continuations outside of the lock
+    for (auto& fut : granted) {
+      fut.MarkFinished();
+    }
+  }
+
+ private:
+  struct Waiter {
+    int64_t nbytes;
+    Future<> granted;
+  };
+
+  bool CanGrant(int64_t nbytes) const {
+    return num_holders_ == 0 || available_ >= nbytes;
+  }
+
+  void Grant(int64_t nbytes) {
+    available_ -= nbytes;
+    ++num_holders_;
+  }
+
+  std::mutex mutex_;
+  std::deque<Waiter> waiters_;
+  int64_t available_;
+  int num_holders_ = 0;
+};
+
+}  // namespace
+
 Status CopyFiles(const std::vector<FileLocator>& sources,
                  const std::vector<FileLocator>& destinations,
-                 const io::IOContext& io_context, int64_t chunk_size, bool use_threads) {
+                 const io::IOContext& io_context, int64_t chunk_size, bool use_threads,
+                 int64_t max_buffered_bytes) {
   if (sources.size() != destinations.size()) {
     return Status::Invalid("Trying to copy ", sources.size(), " files into ",
                            destinations.size(), " paths.");
@@ -600,6 +668,8 @@ Status CopyFiles(const std::vector<FileLocator>& sources,
 
   auto copy_one_file = [&](int i) {
     if (sources[i].filesystem->Equals(destinations[i].filesystem)) {
+      // Let the filesystem copy the file on its own (e.g. server-side),
+      // without going through our buffers
       return sources[i].filesystem->CopyFile(sources[i].path, destinations[i].path);
     }
 
@@ -613,16 +683,39 @@ Status CopyFiles(const std::vector<FileLocator>& sources,
     return destination->Close();
   };
 
-  return ::arrow::internal::OptionalParallelFor(
-      use_threads, static_cast<int>(sources.size()), std::move(copy_one_file),
-      io_context.executor());
+  if (!use_threads || max_buffered_bytes <= 0) {
+    return ::arrow::internal::OptionalParallelFor(
+        use_threads, static_cast<int>(sources.size()), std::move(copy_one_file),
+        io_context.executor());
+  }
+
+  // Streamed copies only start once their chunk buffer fits in the budget.  Waiting
+  // for it doesn't occupy an IO thread, which other copies may need to finish.
+  CopyBufferBudget budget(max_buffered_bytes);
+  std::vector<Future<>> copies;
+  copies.reserve(sources.size());
+  for (int i = 0; i < static_cast<int>(sources.size()); ++i) {
+    auto submit_copy = [&, i]() -> Future<> {
+      return DeferNotOk(io_context.executor()->Submit(copy_one_file, i));
+    };
+    if (sources[i].filesystem->Equals(destinations[i].filesystem)) {
+      copies.push_back(submit_copy());
+      continue;
+    }
+    copies.push_back(budget.Acquire(chunk_size).Then([&, submit_copy]() {
+      auto copy = submit_copy();
+      copy.AddCallback([&](const Status&) { budget.Release(chunk_size); });
+      return copy;
+    }));
+  }
+  return AllFinished(copies).status();
 }
 
 Status CopyFiles(const std::shared_ptr<FileSystem>& source_fs,
                  const FileSelector& source_sel,
                  const std::shared_ptr<FileSystem>& destination_fs,
                  const std::string& destination_base_dir, const io::IOContext& io_context,
-                 int64_t chunk_size, bool use_threads) {
+                 int64_t chunk_size, bool use_threads, int64_t max_buffered_bytes) {
   ARROW_ASSIGN_OR_RAISE(auto source_infos, source_fs->GetFileInfo(source_sel));
   if (source_infos.empty()) {
     return Status::OK();
@@ -656,7 +749,8 @@ Status CopyFiles(const std::shared_ptr<FileSystem>& source_fs,
       use_threads, static_cast<int>(dirs.size()), std::move(create_one_dir),
       io_context.executor()));
 
-  return CopyFiles(sources, destinations, io_context, chunk_size, use_threads);
+  return CopyFiles(sources, destinations, io_context, chunk_size, use_threads,
+                   max_buffered_bytes);
 }
 
 namespace {
@@ -502,11 +502,16 @@ Result<std::shared_ptr<FileSystem>> FileSystemFromUriOrPath(
 /// If a source and destination are resident in the same FileSystem FileSystem::CopyFile
 /// will be used, otherwise the file will be opened as a stream in both FileSystems and
 /// chunks copied from the source to the destination. No directories will be created.
+///
+/// With use_threads, files are copied concurrently on the IO executor.  If
+/// max_buffered_bytes is positive, it bounds the total size of the chunk buffers
+/// held at once by concurrent stream copies.
 ARROW_EXPORT
 Status CopyFiles(const std::vector<FileLocator>& sources,
                  const std::vector<FileLocator>& destinations,
                  const io::IOContext& io_context = io::default_io_context(),
-                 int64_t chunk_size = 1024 * 1024, bool use_threads = true);
+                 int64_t chunk_size = 1024 * 1024, bool use_threads = true,
+                 int64_t max_buffered_bytes = 0);
 
 /// \brief Copy selected files, including from one FileSystem to another
 ///
@@ -517,7 +522,8 @@ Status CopyFiles(const std::shared_ptr<FileSystem>& source_fs,
                  const std::shared_ptr<FileSystem>& destination_fs,
                  const std::string& destination_base_dir,
                  const io::IOContext& io_context = io::default_io_context(),
-                 int64_t chunk_size = 1024 * 1024, bool use_threads = true);
+                 int64_t chunk_size = 1024 * 1024, bool use_threads = true,
+                 int64_t max_buffered_bytes = 0);
 
 struct FileSystemGlobalOptions {
   /// Path to a single PEM file holding all TLS CA certificates
@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -330,6 +333,63 @@ TEST(InternalUtil, GlobFiles) {
   ASSERT_EQ(infos.size(), 0);
 }
 
+TEST(InternalUtil, ReadRangeConcurrently) {
+  std::string data;
+  for (int i = 0; i < 1000; ++i) {
+    data.push_back(static_cast<char>(i % 251));
+  }
+  std::atomic<int> in_flight(0), max_in_flight(0), num_calls(0);
+  auto read_range = [&](int64_t position, int64_t nbytes,
+                        uint8_t* out) -> Result<int64_t> {
+    int current = ++in_flight;
+    int expected = max_in_flight.load();
+    while (current > expected &&
+           !max_in_flight.compare_exchange_weak(expected, current)) {
+    }
+    ++num_calls;
+    SleepFor(1e-3);
+    nbytes = std::max<int64_t>(
+        0, std::min<int64_t>(nbytes, static_cast<int64_t>(data.size()) - position));
+    std::memcpy(out, data.data() + position, static_cast<size_t>(nbytes));
+    --in_flight;
+    return nbytes;
+  };
+  const auto& io_context = io::default_io_context();
+
+  std::vector<uint8_t> out(data.size());
+  ASSERT_OK_AND_EQ(900, ReadRangeConcurrently(io_context, 50, 900, out.data(),
+                                              /*split_size=*/64,
+                                              /*max_concurrency=*/4, read_range));
+  ASSERT_EQ(0, std::memcmp(out.data(), data.data() + 50, 900));
+  ASSERT_EQ(num_calls.load(), 15);
+  ASSERT_LE(max_in_flight.load(), 4);
+
+  // Small reads are not split
+  num_calls = 0;
+  ASSERT_OK_AND_EQ(64, ReadRangeConcurrently(io_context, 0, 64, out.data(),
+                                             /*split_size=*/64,
+                                             /*max_concurrency=*/4, read_range));
+  ASSERT_EQ(num_calls.load(), 1);
+
+  // Short read: only the contiguous prefix is reported
+  ASSERT_OK_AND_EQ(100, ReadRangeConcurrently(io_context, 900, 200, out.data(),
+                                              /*split_size=*/30,
+                                              /*max_concurrency=*/3, read_range));
+  ASSERT_EQ(0, std::memcmp(out.data(), data.data() + 900, 100));
+
+  // Errors are propagated
+  auto failing_read = [&](int64_t position, int64_t nbytes,
+                          uint8_t* out) -> Result<int64_t> {
+    if (position >= 500) {
+      return Status::IOError("injected failure");
+    }
+    return read_range(position, nbytes, out);
+  };
+  ASSERT_RAISES(IOError, ReadRangeConcurrently(io_context, 0, 1000, out.data(),
+                                               /*split_size=*/100,
+                                               /*max_concurrency=*/4, failing_read));
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Generic MockFileSystem tests
 
@@ -729,6 +789,25 @@ TEST_F(TestSubTreeFileSystem, CopyFiles) {
       {"sub/tree/CD/CD/cd", time_, "cd"},
       {"sub/tree/EF/EF/EF/ef", time_, "ef"},
   });
+
+  // Same with a tight budget for the copy buffers
+  ASSERT_OK(fs_->CreateDir("sub/copy2"));
+  dest_fs = std::make_shared<SubTreeFileSystem>("sub/copy2", fs_);
+  ASSERT_OK(CopyFiles(subfs_, sel, dest_fs, "", io::default_io_context(),
+                      /*chunk_size=*/1, /*use_threads=*/true,
+                      /*max_buffered_bytes=*/2));
+
+  CheckFiles({
+      {"sub/copy/AB/ab", time_, "ab"},
+      {"sub/copy/CD/CD/cd", time_, "cd"},
+      {"sub/copy/EF/EF/EF/ef", time_, "ef"},
+      {"sub/copy2/AB/ab", time_, "ab"},
+      {"sub/copy2/CD/CD/cd", time_, "cd"},
+      {"sub/copy2/EF/EF/EF/ef", time_, "ef"},
+      {"sub/tree/AB/ab", time_, "ab"},
+      {"sub/tree/CD/CD/cd", time_, "cd"},
+      {"sub/tree/EF/EF/EF/ef", time_, "ef"},
+  });
 }
 
 TEST_F(TestSubTreeFileSystem, OpenInputStream) {
@@ -232,10 +232,12 @@ using InputStreamFactory = std::function<Result<std::shared_ptr<io::InputStream>
 class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
  public:
   GcsRandomAccessFile(InputStreamFactory factory, gcs::ObjectMetadata metadata,
-                      std::shared_ptr<io::InputStream> stream)
+                      std::shared_ptr<io::InputStream> stream, const GcsOptions& options)
       : factory_(std::move(factory)),
         metadata_(std::move(metadata)),
-        stream_(std::move(stream)) {}
+        stream_(std::move(stream)),
+        read_split_size_(options.read_split_size),
+        read_concurrency_(options.read_concurrency) {}
   ~GcsRandomAccessFile() override = default;
 
   //@{
@@ -271,17 +273,31 @@ class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
   Result<int64_t> GetSize() override { return metadata_.size(); }
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
     if (closed()) return Status::Invalid("Cannot read from closed file");
-    std::shared_ptr<io::InputStream> stream;
-    ARROW_ASSIGN_OR_RAISE(stream, factory_(gcs::Generation(metadata_.generation()),
-                                           gcs::ReadFromOffset(position)));
-    return stream->Read(nbytes, out);
+    const int64_t size = static_cast<int64_t>(metadata_.size());
+    nbytes = std::max<int64_t>(0, std::min(nbytes, size - position));
+    // Large reads are split into concurrent ranged reads, each on its own stream
+    auto factory = factory_;
+    const auto generation = gcs::Generation(metadata_.generation());
+    auto read_range = [factory, generation](int64_t start, int64_t length,
+                                            uint8_t* dest) -> Result<int64_t> {
+      std::shared_ptr<io::InputStream> stream;
+      ARROW_ASSIGN_OR_RAISE(stream, factory(generation, gcs::ReadFromOffset(start)));
+      return stream->Read(length, dest);
+    };
+    return internal::ReadRangeConcurrently(
+        io_context(), position, nbytes, static_cast<uint8_t*>(out), read_split_size_,
+        read_concurrency_, std::move(read_range));
   }
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
     if (closed()) return Status::Invalid("Cannot read from closed file");
-    std::shared_ptr<io::InputStream> stream;
-    ARROW_ASSIGN_OR_RAISE(stream, factory_(gcs::Generation(metadata_.generation()),
-                                           gcs::ReadFromOffset(position)));
-    return stream->Read(nbytes);
+    const int64_t size = static_cast<int64_t>(metadata_.size());
+    nbytes = std::max<int64_t>(0, std::min(nbytes, size - position));
+    ARROW_ASSIGN_OR_RAISE(auto buffer,
+                          AllocateResizableBuffer(nbytes, io_context().pool()));
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read,
+                          ReadAt(position, nbytes, buffer->mutable_data()));
+    RETURN_NOT_OK(buffer->Resize(bytes_read, true));
+    return std::shared_ptr<Buffer>(std::move(buffer));
   }
   //@}
 
@@ -297,6 +313,8 @@ class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
   InputStreamFactory factory_;
   gcs::ObjectMetadata metadata_;
   std::shared_ptr<io::InputStream> stream_;
+  const int64_t read_split_size_;
+  const int read_concurrency_;
 };
 
 google::cloud::Options AsGoogleCloudOptions(const GcsOptions& o) {
@@ -704,7 +722,9 @@ bool GcsOptions::Equals(const GcsOptions& other) const {
   return credentials.Equals(other.credentials) &&
          endpoint_override == other.endpoint_override && scheme == other.scheme &&
          default_bucket_location == other.default_bucket_location &&
-         retry_limit_seconds == other.retry_limit_seconds;
+         retry_limit_seconds == other.retry_limit_seconds &&
+         read_split_size == other.read_split_size &&
+         read_concurrency == other.read_concurrency;
 }
 
 GcsOptions GcsOptions::Defaults() {
@@ -918,7 +938,8 @@ Result<std::shared_ptr<io::RandomAccessFile>> GcsFileSystem::OpenInputFile(
                                                gcs::ReadFromOffset()));
 
   return std::make_shared<GcsRandomAccessFile>(std::move(open_stream),
-                                               *std::move(metadata), std::move(stream));
+                                               *std::move(metadata), std::move(stream),
+                                               impl_->options());
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> GcsFileSystem::OpenInputFile(
@@ -940,7 +961,8 @@ Result<std::shared_ptr<io::RandomAccessFile>> GcsFileSystem::OpenInputFile(
                                                gcs::ReadFromOffset()));
 
   return std::make_shared<GcsRandomAccessFile>(std::move(open_stream),
-                                               *std::move(metadata), std::move(stream));
+                                               *std::move(metadata), std::move(stream),
+                                               impl_->options());
 }
 
 Result<std::shared_ptr<io::OutputStream>> GcsFileSystem::OpenOutputStream(
@@ -77,6 +77,15 @@ struct ARROW_EXPORT GcsOptions {
   /// This will be ignored if non-empty metadata is passed to OpenOutputStream.
   std::shared_ptr<const KeyValueMetadata> default_metadata;
 
+  /// \brief Size above which random access reads are split into several requests.
+  ///
+  /// Large ReadAt() calls are split into ranged reads of at most this size,
+  /// issued concurrently.  A non-positive value disables splitting.
+  int64_t read_split_size = 16 * 1024 * 1024;
+
+  /// Maximum number of concurrent ranged requests for a single split read.
+  int read_concurrency = 4;
+
   bool Equals(const GcsOptions& other) const;
 
   /// \brief Initialize with Google Default Credentials
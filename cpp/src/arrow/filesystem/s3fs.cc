@@ -28,6 +28,7 @@
 #include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #ifdef _WIN32
 // Undefine preprocessor macros that interfere with AWS function / method names
@@ -393,6 +394,11 @@ bool S3Options::Equals(const S3Options& other) const {
           proxy_options.Equals(other.proxy_options) &&
           credentials_kind == other.credentials_kind &&
           background_writes == other.background_writes &&
+          upload_part_size == other.upload_part_size &&
+          max_concurrent_part_uploads == other.max_concurrent_part_uploads &&
+          upload_memory_limit == other.upload_memory_limit &&
+          read_split_size == other.read_split_size &&
+          read_concurrency == other.read_concurrency &&
           allow_bucket_creation == other.allow_bucket_creation &&
           allow_bucket_deletion == other.allow_bucket_deletion &&
           default_metadata_equals && GetAccessKey() == other.GetAccessKey() &&
@@ -991,10 +997,12 @@ class ObjectInputFile final : public io::RandomAccessFile {
  public:
   ObjectInputFile(std::shared_ptr<Aws::S3::S3Client> client,
                   const io::IOContext& io_context, const S3Path& path,
-                  int64_t size = kNoSize)
+                  const S3Options& options, int64_t size = kNoSize)
       : client_(std::move(client)),
         io_context_(io_context),
         path_(path),
+        read_split_size_(options.read_split_size),
+        read_concurrency_(options.read_concurrency),
         content_length_(size) {}
 
   Status Init() {
@@ -1089,15 +1097,24 @@ class ObjectInputFile final : public io::RandomAccessFile {
       return 0;
     }
 
-    // Read the desired range of bytes
-    ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
-                          GetObjectRange(client_.get(), path_, position, nbytes, out));
-
-    auto& stream = result.GetBody();
-    stream.ignore(nbytes);
-    // NOTE: the stream is a stringstream by default, there is no actual error
-    // to check for.  However, stream.fail() may return true if EOF is reached.
-    return stream.gcount();
+    // Read the desired range of bytes, possibly split into concurrent requests
+    // (the client is thread-safe and pools its connections)
+    auto client = client_;
+    const S3Path path = path_;
+    auto read_range = [client, path](int64_t start, int64_t length,
+                                     uint8_t* dest) -> Result<int64_t> {
+      ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
+                            GetObjectRange(client.get(), path, start, length, dest));
+
+      auto& stream = result.GetBody();
+      stream.ignore(length);
+      // NOTE: the stream is a stringstream by default, there is no actual error
+      // to check for.  However, stream.fail() may return true if EOF is reached.
+      return stream.gcount();
+    };
+    return ::arrow::fs::internal::ReadRangeConcurrently(
+        io_context_, position, nbytes, static_cast<uint8_t*>(out), read_split_size_,
+        read_concurrency_, std::move(read_range));
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
@@ -1133,6 +1150,8 @@ class ObjectInputFile final : public io::RandomAccessFile {
   std::shared_ptr<Aws::S3::S3Client> client_;
   const io::IOContext io_context_;
   S3Path path_;
+  const int64_t read_split_size_;
+  const int read_concurrency_;
 
   bool closed_ = false;
   int64_t pos_ = 0;
@@ -1160,7 +1179,11 @@ class ObjectOutputStream final : public io::OutputStream {
         path_(path),
         metadata_(metadata),
         default_metadata_(options.default_metadata),
-        background_writes_(options.background_writes) {}
+        background_writes_(options.background_writes),
+        upload_part_size_(std::max(options.upload_part_size, kMinimumPartUpload)),
+        max_concurrent_part_uploads_(options.max_concurrent_part_uploads),
+        upload_memory_limit_(options.upload_memory_limit),
+        part_upload_threshold_(upload_part_size_) {}
 
   ~ObjectOutputStream() override {
     // For compliance with the rest of the IO stack, Close rather than Abort,
@@ -1195,6 +1218,9 @@ class ObjectOutputStream final : public io::OutputStream {
     }
     upload_id_ = outcome.GetResult().GetUploadId();
     upload_state_ = std::make_shared<UploadState>();
+    if (background_writes_ && max_concurrent_part_uploads_ > 0) {
+      upload_state_->max_free_buffers = max_concurrent_part_uploads_;
+    }
     closed_ = false;
     return Status::OK();
   }
@@ -1217,6 +1243,7 @@ class ObjectOutputStream final : public io::OutputStream {
           outcome.GetError());
     }
     current_part_.reset();
+    current_buffer_.reset();
     client_ = nullptr;
     closed_ = true;
     return Status::OK();
@@ -1303,9 +1330,8 @@ class ObjectOutputStream final : public io::OutputStream {
     }
     // Can't upload data on its own, need to buffer it
     if (!current_part_) {
-      ARROW_ASSIGN_OR_RAISE(
-          current_part_,
-          io::BufferOutputStream::Create(part_upload_threshold_, io_context_.pool()));
+      ARROW_ASSIGN_OR_RAISE(current_buffer_, AcquirePartBuffer());
+      current_part_ = std::make_shared<io::BufferOutputStream>(current_buffer_);
       current_part_size_ = 0;
     }
     RETURN_NOT_OK(current_part_->Write(data, nbytes));
@@ -1336,19 +1362,80 @@ class ObjectOutputStream final : public io::OutputStream {
 
   // Upload-related helpers
 
+  // Get a buffer for the next part, reusing the buffer of a finished upload if possible
+  Result<std::shared_ptr<ResizableBuffer>> AcquirePartBuffer() {
+    std::shared_ptr<ResizableBuffer> buffer;
+    {
+      std::unique_lock<std::mutex> lock(upload_state_->mutex);
+      if (!upload_state_->free_buffers.empty()) {
+        buffer = std::move(upload_state_->free_buffers.back());
+        upload_state_->free_buffers.pop_back();
+      }
+    }
+    if (buffer == nullptr) {
+      return AllocateResizableBuffer(part_upload_threshold_, io_context_.pool());
+    }
+    // Does not reallocate unless the part upload threshold was bumped
+    RETURN_NOT_OK(buffer->Resize(part_upload_threshold_, /*shrink_to_fit=*/false));
+    return buffer;
+  }
+
+  static void ReleasePartBuffer(const std::shared_ptr<UploadState>& state,
+                                std::shared_ptr<ResizableBuffer> buffer) {
+    if (buffer != nullptr &&
+        state->free_buffers.size() < static_cast<size_t>(state->max_free_buffers)) {
+      state->free_buffers.push_back(std::move(buffer));
+    }
+  }
+
   Status CommitCurrentPart() {
     ARROW_ASSIGN_OR_RAISE(auto buf, current_part_->Finish());
     current_part_.reset();
     current_part_size_ = 0;
-    return UploadPart(buf);
+    return UploadPart(buf->data(), buf->size(), buf, std::move(current_buffer_));
   }
 
   Status UploadPart(std::shared_ptr<Buffer> buffer) {
     return UploadPart(buffer->data(), buffer->size(), buffer);
   }
 
+  // Whether the in-progress uploads leave room for a new part of `nbytes`
+  bool HasUploadCapacity(const UploadState& state, int64_t nbytes) const {
+    if (state.parts_in_progress == 0) {
+      return true;
+    }
+    if (max_concurrent_part_uploads_ > 0 &&
+        state.parts_in_progress >= max_concurrent_part_uploads_) {
+      return false;
+    }
+    return upload_memory_limit_ <= 0 ||
+           state.bytes_in_progress + nbytes <= upload_memory_limit_;
+  }
+
+  // Wait until the in-progress uploads leave room for a new part of `nbytes`.
+  // Return false if the part should rather be uploaded synchronously.
+  //
+  // The uploads are run on the IO thread pool, so a writer running on that pool
+  // mustn't wait for them: it could occupy the threads the uploads need.  Instead,
+  // it uploads the part itself when there is no room, which throttles it without
+  // buffering more data.
+  Result<bool> WaitForUploadCapacity(int64_t nbytes) {
+    std::unique_lock<std::mutex> lock(upload_state_->mutex);
+    auto state = upload_state_.get();
+    if (io_context_.executor()->OwnsThisThread()) {
+      RETURN_NOT_OK(state->status);
+      return HasUploadCapacity(*state, nbytes);
+    }
+    state->cv.wait(lock, [&]() {
+      return !state->status.ok() || HasUploadCapacity(*state, nbytes);
+    });
+    RETURN_NOT_OK(state->status);
+    return true;
+  }
+
   Status UploadPart(const void* data, int64_t nbytes,
-                    std::shared_ptr<Buffer> owned_buffer = nullptr) {
+                    std::shared_ptr<Buffer> owned_buffer = nullptr,
+                    std::shared_ptr<ResizableBuffer> pooled_buffer = nullptr) {
     S3Model::UploadPartRequest req;
     req.SetBucket(ToAwsString(path_.bucket));
     req.SetKey(ToAwsString(path_.key));
@@ -1356,13 +1443,21 @@ class ObjectOutputStream final : public io::OutputStream {
     req.SetPartNumber(part_number_);
     req.SetContentLength(nbytes);
 
-    if (!background_writes_) {
+    bool upload_in_background = background_writes_;
+    if (upload_in_background) {
+      // Apply backpressure before buffering more data
+      ARROW_ASSIGN_OR_RAISE(upload_in_background, WaitForUploadCapacity(nbytes));
+    }
+
+    if (!upload_in_background) {
       req.SetBody(std::make_shared<StringViewStream>(data, nbytes));
       auto outcome = client_->UploadPart(req);
       if (!outcome.IsSuccess()) {
         return UploadPartError(req, outcome);
       } else {
+        std::unique_lock<std::mutex> lock(upload_state_->mutex);
         AddCompletedPart(upload_state_, part_number_, outcome.GetResult());
+        ReleasePartBuffer(upload_state_, std::move(pooled_buffer));
       }
     } else {
       // If the data isn't owned, make an immutable copy for the lifetime of the closure
@@ -1381,25 +1476,31 @@ class ObjectOutputStream final : public io::OutputStream {
         if (upload_state_->parts_in_progress++ == 0) {
           upload_state_->pending_parts_completed = Future<>::Make();
         }
+        upload_state_->bytes_in_progress += nbytes;
       }
-      auto client = client_;
-      ARROW_ASSIGN_OR_RAISE(auto fut, SubmitIO(io_context_, [client, req]() {
-                              return client->UploadPart(req);
-                            }));
       // The closure keeps the buffer and the upload state alive
       auto state = upload_state_;
       auto part_number = part_number_;
-      auto handler = [owned_buffer, state, part_number,
+      auto handler = [owned_buffer, pooled_buffer, state, part_number, nbytes,
                       req](const Result<S3Model::UploadPartOutcome>& result) -> void {
-        HandleUploadOutcome(state, part_number, req, result);
+        HandleUploadOutcome(state, part_number, nbytes, pooled_buffer, req, result);
       };
-      fut.AddCallback(std::move(handler));
+
+      auto client = client_;
+      auto fut =
+          SubmitIO(io_context_, [client, req]() { return client->UploadPart(req); });
+      if (!fut.ok()) {
+        handler(fut.status());
+        return fut.status();
+      }
+      fut->AddCallback(std::move(handler));
     }
 
     ++part_number_;
     // With up to 10000 parts in an upload (S3 limit), a stream writing chunks
     // of exactly 5MB would be limited to 50GB total.  To avoid that, we bump
-    // the upload threshold every 100 parts.  So the pattern is:
+    // the upload threshold by the part size every 100 parts.  With the default
+    // part size, the pattern is:
     // - part 1 to 99: 5MB threshold
     // - part 100 to 199: 10MB threshold
     // - part 200 to 299: 15MB threshold
@@ -1409,16 +1510,20 @@ class ObjectOutputStream final : public io::OutputStream {
     // chunk sizes and avoiding too much buffering in the common case of a small-ish
     // stream.  If the limit's not enough, we can revisit.
     if (part_number_ % 100 == 0) {
-      part_upload_threshold_ += kMinimumPartUpload;
+      part_upload_threshold_ += upload_part_size_;
     }
 
     return Status::OK();
   }
 
   static void HandleUploadOutcome(const std::shared_ptr<UploadState>& state,
-                                  int part_number, const S3Model::UploadPartRequest& req,
+                                  int part_number, int64_t nbytes,
+                                  std::shared_ptr<ResizableBuffer> pooled_buffer,
+                                  const S3Model::UploadPartRequest& req,
                                   const Result<S3Model::UploadPartOutcome>& result) {
     std::unique_lock<std::mutex> lock(state->mutex);
+    state->bytes_in_progress -= nbytes;
+    ReleasePartBuffer(state, std::move(pooled_buffer));
     if (!result.ok()) {
       state->status &= result.status();
     } else {
@@ -1429,6 +1534,8 @@ class ObjectOutputStream final : public io::OutputStream {
         AddCompletedPart(state, part_number, outcome.GetResult());
       }
     }
+    // Wake up writers waiting for upload capacity
+    state->cv.notify_all();
     // Notify completion
     if (--state->parts_in_progress == 0) {
       state->pending_parts_completed.MarkFinished(state->status);
@@ -1465,21 +1572,31 @@ class ObjectOutputStream final : public io::OutputStream {
   const std::shared_ptr<const KeyValueMetadata> metadata_;
   const std::shared_ptr<const KeyValueMetadata> default_metadata_;
   const bool background_writes_;
+  const int64_t upload_part_size_;
+  const int max_concurrent_part_uploads_;
+  const int64_t upload_memory_limit_;
 
   Aws::String upload_id_;
   bool closed_ = true;
   int64_t pos_ = 0;
   int32_t part_number_ = 1;
   std::shared_ptr<io::BufferOutputStream> current_part_;
+  std::shared_ptr<ResizableBuffer> current_buffer_;
   int64_t current_part_size_ = 0;
-  int64_t part_upload_threshold_ = kMinimumPartUpload;
+  int64_t part_upload_threshold_;
 
   // This struct is kept alive through background writes to avoid problems
   // in the completion handler.
   struct UploadState {
     std::mutex mutex;
+    std::condition_variable cv;
     Aws::Vector<S3Model::CompletedPart> completed_parts;
+    // Parts being uploaded in the background, and their size
     int64_t parts_in_progress = 0;
+    int64_t bytes_in_progress = 0;
+    // Part buffers of finished uploads, ready for reuse
+    std::vector<std::shared_ptr<ResizableBuffer>> free_buffers;
+    int max_free_buffers = 2;
     Status status;
     Future<> pending_parts_completed = Future<>::MakeFinished(Status::OK());
   };
@@ -2007,20 +2124,41 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
   }
 
   struct WalkResult {
+    // "Files" discovered but not yet scheduled for deletion
     std::vector<std::string> file_keys;
     std::vector<std::string> dir_keys;
+    // Deletions of "files" issued while walking
+    std::vector<Future<>> file_deletions;
+    int64_t num_files = 0;
   };
+  // Walk the tree under `key`, deleting "files" in full batches as they are
+  // discovered, so that deletion overlaps with listing.
   Future<std::shared_ptr<WalkResult>> WalkForDeleteDirAsync(const std::string& bucket,
                                                             const std::string& key) {
     auto state = std::make_shared<WalkResult>();
+    auto self = shared_from_this();
 
-    auto handle_results = [state](const std::string& prefix,
-                                  const S3Model::ListObjectsV2Result& result) -> Status {
+    auto handle_results = [state, self, bucket](
+                              const std::string& prefix,
+                              const S3Model::ListObjectsV2Result& result) -> Status {
       // Walk "files"
       state->file_keys.reserve(state->file_keys.size() + result.GetContents().size());
       for (const auto& obj : result.GetContents()) {
         state->file_keys.emplace_back(FromAwsString(obj.GetKey()));
       }
+      state->num_files += static_cast<int64_t>(result.GetContents().size());
+      const auto batch_size = static_cast<size_t>(self->kMultipleDeleteMaxKeys);
+      if (state->file_keys.size() >= batch_size) {
+        // Issue the full batches now, keep the remainder for later
+        const size_t num_batched =
+            state->file_keys.size() - state->file_keys.size() % batch_size;
+        std::vector<std::string> batched(
+            std::make_move_iterator(state->file_keys.begin()),
+            std::make_move_iterator(state->file_keys.begin() + num_batched));
+        state->file_keys.erase(state->file_keys.begin(),
+                               state->file_keys.begin() + num_batched);
+        state->file_deletions.push_back(self->DeleteObjectsAsync(bucket, batched));
+      }
       // Walk "directories"
       state->dir_keys.reserve(state->dir_keys.size() + result.GetCommonPrefixes().size());
       for (const auto& prefix : result.GetCommonPrefixes()) {
@@ -2035,7 +2173,6 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
                            error);
     };
 
-    auto self = shared_from_this();
     auto handle_recursion = [self](int32_t nesting_depth) -> Result<bool> {
       RETURN_NOT_OK(self->CheckNestingDepth(nesting_depth));
       return true;  // Recurse
@@ -2083,7 +2220,7 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     for (size_t start = 0; start < keys.size(); start += chunk_size) {
       S3Model::DeleteObjectsRequest req;
       S3Model::Delete del;
-      for (size_t i = start; i < std::min(keys.size(), chunk_size); ++i) {
+      for (size_t i = start; i < std::min(keys.size(), start + chunk_size); ++i) {
         del.AddObjects(S3Model::ObjectIdentifier().WithKey(ToAwsString(keys[i])));
       }
       req.SetBucket(ToAwsString(bucket));
@@ -2106,7 +2243,7 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     return WalkForDeleteDirAsync(bucket, key)
         .Then([bucket, key,
                self](const std::shared_ptr<WalkResult>& discovered) -> Future<> {
-          if (discovered->file_keys.empty() && discovered->dir_keys.empty() &&
+          if (discovered->num_files == 0 && discovered->dir_keys.empty() &&
               !key.empty()) {
             // No contents found, is it an empty directory?
             ARROW_ASSIGN_OR_RAISE(bool exists, self->IsEmptyDirectory(bucket, key));
@@ -2114,8 +2251,10 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
               return PathNotFound(bucket, key);
             }
           }
-          // First delete all "files", then delete all child "directories"
-          return self->DeleteObjectsAsync(bucket, discovered->file_keys)
+          // First delete all remaining "files", then delete all child "directories"
+          discovered->file_deletions.push_back(
+              self->DeleteObjectsAsync(bucket, discovered->file_keys));
+          return AllComplete(discovered->file_deletions)
               .Then([bucket, discovered, self]() {
                 // Delete directories in reverse lexicographic order, to ensure children
                 // are deleted before their parents (Minio).
@@ -2173,7 +2312,8 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
     RETURN_NOT_OK(ValidateFilePath(path));
 
-    auto ptr = std::make_shared<ObjectInputFile>(client_, fs->io_context(), path);
+    auto ptr = std::make_shared<ObjectInputFile>(client_, fs->io_context(), path,
+                                                 options());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -2191,8 +2331,8 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(info.path()));
     RETURN_NOT_OK(ValidateFilePath(path));
 
-    auto ptr =
-        std::make_shared<ObjectInputFile>(client_, fs->io_context(), path, info.size());
+    auto ptr = std::make_shared<ObjectInputFile>(client_, fs->io_context(), path,
+                                                 options(), info.size());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
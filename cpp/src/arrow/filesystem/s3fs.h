@@ -130,6 +130,37 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// \brief Size of the parts uploaded by OutputStream.
+  ///
+  /// S3 requires parts to be at least 5 MiB; smaller values are rounded up.
+  /// To stay within the 10000 parts limit of multipart uploads, the part size
+  /// is increased by this amount every 100 parts.
+  int64_t upload_part_size = 5 * 1024 * 1024;
+
+  /// \brief Maximum number of parts being uploaded concurrently by an OutputStream.
+  ///
+  /// Only applies to background writes.  When the limit is reached, Write()
+  /// blocks until an upload finishes.  Writes issued from the IO thread pool never
+  /// wait for other uploads: they upload the part synchronously instead.
+  /// A non-positive value means no limit.
+  int max_concurrent_part_uploads = 8;
+
+  /// \brief Maximum number of bytes held by in-progress part uploads of an OutputStream.
+  ///
+  /// Only applies to background writes.  When the limit is reached, Write()
+  /// blocks until an upload finishes, or uploads the part synchronously if it is
+  /// issued from the IO thread pool.  A non-positive value means no limit.
+  int64_t upload_memory_limit = 0;
+
+  /// \brief Size above which random access reads are split into several requests.
+  ///
+  /// Large ReadAt() calls are split into ranged GetObject requests of at most
+  /// this size, issued concurrently.  A non-positive value disables splitting.
+  int64_t read_split_size = 16 * 1024 * 1024;
+
+  /// Maximum number of concurrent ranged requests for a single split read.
+  int read_concurrency = 4;
+
   /// Whether to allow creation of buckets
   ///
   /// When S3FileSystem creates new buckets, it does not pass any non-default settings.
@@ -54,6 +54,7 @@
 #include "arrow/filesystem/s3_test_util.h"
 #include "arrow/filesystem/s3fs.h"
 #include "arrow/filesystem/test_util.h"
+#include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/testing/future_util.h"
@@ -66,6 +67,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace fs {
@@ -438,14 +440,14 @@ class TestS3FS : public S3TestMixin {
     }
   }
 
-  void MakeFileSystem() {
+  void MakeFileSystem(const io::IOContext& io_context = io::default_io_context()) {
     options_.ConfigureAccessKey(minio_->access_key(), minio_->secret_key());
     options_.scheme = "http";
     options_.endpoint_override = minio_->connect_string();
     if (!options_.retry_strategy) {
       options_.retry_strategy = std::make_shared<ShortRetryStrategy>();
     }
-    ASSERT_OK_AND_ASSIGN(fs_, S3FileSystem::Make(options_));
+    ASSERT_OK_AND_ASSIGN(fs_, S3FileSystem::Make(options_, io_context));
   }
 
   template <typename Matcher>
@@ -899,6 +901,32 @@ TEST_F(TestS3FS, DeleteDirContentsAsync) {
   AssertFileInfo(infos[3], "bucket/somefile", FileType::File);
 }
 
+TEST_F(TestS3FS, DeleteDirContentsManyFiles) {
+  // More keys than a single DeleteObjects request accepts (1000), so that deletion
+  // is split into several requests, the last of them partial
+  constexpr int kNumFiles = 2500;
+  Aws::S3::Model::PutObjectRequest req;
+  req.SetBucket(ToAwsString("bucket"));
+  for (int i = 0; i < kNumFiles; ++i) {
+    req.SetKey(ToAwsString("manyfiles/" + std::to_string(i % 3) + "/" +
+                           std::to_string(i)));
+    req.SetBody(std::make_shared<std::stringstream>("data"));
+    ASSERT_OK(OutcomeToStatus(client_->PutObject(req)));
+  }
+
+  FileSelector select;
+  select.base_dir = "bucket/manyfiles";
+  select.recursive = true;
+  std::vector<FileInfo> infos;
+  ASSERT_OK_AND_ASSIGN(infos, fs_->GetFileInfo(select));
+  ASSERT_EQ(infos.size(), kNumFiles + 3);
+
+  ASSERT_OK(fs_->DeleteDirContents("bucket/manyfiles"));
+  ASSERT_OK_AND_ASSIGN(infos, fs_->GetFileInfo(select));
+  ASSERT_EQ(infos.size(), 0);
+  AssertFileInfo(fs_.get(), "bucket/manyfiles", FileType::Directory);
+}
+
 TEST_F(TestS3FS, CopyFile) {
   // "File"
   ASSERT_OK(fs_->CopyFile("bucket/somefile", "bucket/newfile"));
@@ -1048,8 +1076,93 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+TEST_F(TestS3FS, OpenInputFileSplitReads) {
+  // Tiny split size so that every read fans out into several ranged requests
+  options_.read_split_size = 2;
+  options_.read_concurrency = 3;
+  MakeFileSystem();
+
+  std::shared_ptr<io::RandomAccessFile> file;
+  std::shared_ptr<Buffer> buf;
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 9));
+  AssertBufferEqual(*buf, "some data");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(1, 5));
+  AssertBufferEqual(*buf, "ome d");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(5, 20));
+  AssertBufferEqual(*buf, "data");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAsync({}, 2, 7).result());
+  AssertBufferEqual(*buf, "me data");
+
+  // Same with added latency on top of the S3 filesystem
+  auto slow_fs = std::make_shared<SlowFileSystem>(fs_, /*average_latency=*/0.01);
+  ASSERT_OK_AND_ASSIGN(file, slow_fs->OpenInputFile("bucket/somefile"));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(3, 6));
+  AssertBufferEqual(*buf, "e data");
+}
+
 TEST_F(TestS3FS, OpenOutputStreamBackgroundWrites) { TestOpenOutputStream(); }
 
+TEST_F(TestS3FS, OpenOutputStreamBoundedUploads) {
+  // A single part upload at a time, and memory for a single part
+  options_.max_concurrent_part_uploads = 1;
+  options_.upload_memory_limit = options_.upload_part_size;
+  MakeFileSystem();
+  TestOpenOutputStream();
+}
+
+TEST_F(TestS3FS, OpenOutputStreamFromIOThreadPool) {
+  // Allow more concurrent part uploads than there are IO threads: writers running on
+  // the IO thread pool mustn't wait for uploads which need an IO thread to finish
+  constexpr int64_t kPartSize = 6000000;
+  options_.max_concurrent_part_uploads = 4;
+  options_.upload_memory_limit = 2 * kPartSize;
+  ASSERT_OK_AND_ASSIGN(auto io_thread_pool, ::arrow::internal::ThreadPool::Make(2));
+  ProxyMemoryPool pool(default_memory_pool());
+  MakeFileSystem(io::IOContext(&pool, io_thread_pool.get()));
+
+  constexpr int kNumStreams = 2;
+  constexpr int kNumParts = 6;
+  std::string part = random_string(kPartSize, /*seed=*/42);
+  std::vector<Future<std::shared_ptr<io::OutputStream>>> writes;
+  for (int i = 0; i < kNumStreams; ++i) {
+    auto path = "bucket/from-io-pool-" + std::to_string(i);
+    ASSERT_OK_AND_ASSIGN(
+        auto write,
+        io_thread_pool->Submit([&, path]() -> Result<std::shared_ptr<io::OutputStream>> {
+          ARROW_ASSIGN_OR_RAISE(auto stream, fs_->OpenOutputStream(path));
+          for (int j = 0; j < kNumParts; ++j) {
+            RETURN_NOT_OK(stream->Write(part));
+          }
+          return stream;
+        }));
+    writes.push_back(std::move(write));
+  }
+  for (const auto& write : writes) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto stream, write);
+    ASSERT_OK(stream->Close());
+  }
+  // Parts which don't fit in the memory limit were uploaded by the writer itself
+  // rather than buffered
+  ASSERT_LE(pool.max_memory(), kNumStreams * options_.upload_memory_limit);
+
+  std::string expected;
+  for (int j = 0; j < kNumParts; ++j) {
+    expected += part;
+  }
+  for (int i = 0; i < kNumStreams; ++i) {
+    AssertObjectContents(client_.get(), "bucket", "from-io-pool-" + std::to_string(i),
+                         expected);
+  }
+}
+
+TEST_F(TestS3FS, OpenOutputStreamLargerParts) {
+  options_.upload_part_size = 8 * 1024 * 1024;
+  options_.max_concurrent_part_uploads = 2;
+  MakeFileSystem();
+  TestOpenOutputStream();
+}
+
 TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
   options_.background_writes = false;
   MakeFileSystem();
@@ -17,13 +17,18 @@
 
 #include "arrow/filesystem/util_internal.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -56,6 +61,116 @@ Status CopyStream(const std::shared_ptr<io::InputStream>& src,
   return Status::OK();
 }
 
+namespace {
+
+// State shared between the caller of ReadRangeConcurrently and its helper tasks.
+// Helpers may outlive the call, but they only touch the output buffer after
+// claiming a part, and no part can be claimed once the caller returns.
+struct ConcurrentRangeRead {
+  ConcurrentRangeRead(int64_t position, int64_t nbytes, uint8_t* out, int64_t split_size,
+                      StopToken stop_token, ReadRangeFunction read_range)
+      : position(position),
+        nbytes(nbytes),
+        out(out),
+        split_size(split_size),
+        num_parts((nbytes + split_size - 1) / split_size),
+        bytes_read(static_cast<size_t>(num_parts), 0),
+        stop_token(std::move(stop_token)),
+        read_range(std::move(read_range)) {}
+
+  int64_t PartLength(int64_t part) const {
+    return std::min(split_size, nbytes - part * split_size);
+  }
+
+  // Read parts until none are left or an error occurred
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (status.ok() && next_part < num_parts) {
+      const int64_t part = next_part++;
+      ++in_flight;
+      lock.unlock();
+
+      const int64_t offset = part * split_size;
+      Status st = stop_token.Poll();
+      int64_t part_read = 0;
+      if (st.ok()) {
+        auto maybe_read = read_range(position + offset, PartLength(part), out + offset);
+        if (maybe_read.ok()) {
+          part_read = *maybe_read;
+        } else {
+          st = maybe_read.status();
+        }
+      }
+
+      lock.lock();
+      bytes_read[part] = part_read;
+      if (!st.ok() && status.ok()) {
+        status = std::move(st);
+      }
+      --in_flight;
+    }
+    cv.notify_all();
+  }
+
+  void WaitForInFlightParts() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&] { return in_flight == 0; });
+  }
+
+  // Number of contiguous bytes read from the start of the range
+  Result<int64_t> Finish() {
+    RETURN_NOT_OK(status);
+    int64_t total = 0;
+    for (int64_t part = 0; part < num_parts; ++part) {
+      total += bytes_read[part];
+      if (bytes_read[part] < PartLength(part)) {
+        break;
+      }
+    }
+    return total;
+  }
+
+  const int64_t position;
+  const int64_t nbytes;
+  uint8_t* const out;
+  const int64_t split_size;
+  const int64_t num_parts;
+  std::vector<int64_t> bytes_read;
+  const StopToken stop_token;
+  const ReadRangeFunction read_range;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  int64_t next_part = 0;
+  int in_flight = 0;
+  Status status;
+};
+
+}  // namespace
+
+Result<int64_t> ReadRangeConcurrently(const io::IOContext& io_context, int64_t position,
+                                      int64_t nbytes, uint8_t* out, int64_t split_size,
+                                      int max_concurrency, ReadRangeFunction read_range) {
+  if (split_size <= 0 || max_concurrency <= 1 || nbytes <= split_size) {
+    return read_range(position, nbytes, out);
+  }
+  auto state = std::make_shared<ConcurrentRangeRead>(
+      position, nbytes, out, split_size, io_context.stop_token(), std::move(read_range));
+
+  // The calling thread takes part in the reads, so that progress is guaranteed
+  // even if the IO executor is saturated (for example if we are running on it).
+  const int64_t num_helpers =
+      std::min<int64_t>(max_concurrency, state->num_parts) - 1;
+  for (int64_t i = 0; i < num_helpers; ++i) {
+    if (!io_context.executor()->Spawn([state] { state->Run(); }).ok()) {
+      break;
+    }
+  }
+  state->Run();
+  state->WaitForInFlightParts();
+  return state->Finish();
+}
+
 Status PathNotFound(util::string_view path) {
   return Status::IOError("Path does not exist '", path, "'")
       .WithDetail(StatusDetailFromErrno(ENOENT));
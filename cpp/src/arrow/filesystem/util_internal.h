@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 
 #include "arrow/filesystem/filesystem.h"
@@ -38,6 +39,21 @@ Status CopyStream(const std::shared_ptr<io::InputStream>& src,
                   const std::shared_ptr<io::OutputStream>& dest, int64_t chunk_size,
                   const io::IOContext& io_context);
 
+/// \brief Read a byte range using several concurrent ranged requests
+///
+/// The range [position, position + nbytes) is split into parts of at most
+/// `split_size` bytes, each read by `read_range` directly into its slice of `out`.
+/// At most `max_concurrency` parts are in flight at once: the calling thread
+/// reads parts itself, and helpers are spawned on the IO executor of `io_context`.
+/// Returns the number of contiguous bytes read from `position`.
+using ReadRangeFunction =
+    std::function<Result<int64_t>(int64_t position, int64_t nbytes, uint8_t* out)>;
+
+ARROW_EXPORT
+Result<int64_t> ReadRangeConcurrently(const io::IOContext& io_context, int64_t position,
+                                      int64_t nbytes, uint8_t* out, int64_t split_size,
+                                      int max_concurrency, ReadRangeFunction read_range);
+
 ARROW_EXPORT
 Status PathNotFound(util::string_view path);
 
@@ -539,7 +539,7 @@ struct ArrayWriterV1 {
           std::is_same<DictionaryType, T>::value || is_duration_type<T>::value ||
           is_interval_type<T>::value || is_fixed_size_binary_type<T>::value ||
           std::is_same<Date64Type, T>::value || std::is_same<Time64Type, T>::value ||
-          std::is_same<ExtensionType, T>::value,
+          std::is_same<ExtensionType, T>::value || is_binary_view_like_type<T>::value,
       Status>::type
   Visit(const T& type) {
     return Status::NotImplemented(type.ToString());
@@ -609,15 +609,16 @@ class MessageDecoder::MessageDecoderImpl {
         pool_(pool),
         state_(initial_state),
         next_required_size_(initial_next_required_size),
-        chunks_(),
         buffered_size_(0),
         metadata_(nullptr),
         skip_body_(skip_body) {}
 
   Status ConsumeData(const uint8_t* data, int64_t size) {
-    if (buffered_size_ == 0) {
-      while (size > 0 && size >= next_required_size_) {
-        auto used_size = next_required_size_;
+    while (size > 0 && state_ != State::EOS) {
+      auto used_size = next_required_size_;
+      if (buffered_size_ > 0 || size < next_required_size_) {
+        ARROW_ASSIGN_OR_RAISE(used_size, ConsumePartialData(data, size));
+      } else {
         switch (state_) {
           case State::INITIAL:
             RETURN_NOT_OK(ConsumeInitialData(data, next_required_size_));
@@ -628,6 +629,11 @@ class MessageDecoder::MessageDecoderImpl {
           case State::METADATA: {
             auto buffer = std::make_shared<Buffer>(data, next_required_size_);
             RETURN_NOT_OK(ConsumeMetadataBuffer(buffer));
+            if (state_ == State::BODY && size - used_size < next_required_size_) {
+              // The body comes in a later call: don't keep referencing this data
+              ARROW_ASSIGN_OR_RAISE(metadata_,
+                                    metadata_->CopySlice(0, metadata_->size(), pool_));
+            }
           } break;
           case State::BODY: {
             auto buffer = std::make_shared<Buffer>(data, next_required_size_);
@@ -636,24 +642,26 @@ class MessageDecoder::MessageDecoderImpl {
           case State::EOS:
             return Status::OK();
         }
-        data += used_size;
-        size -= used_size;
       }
+      data += used_size;
+      size -= used_size;
     }
-
-    if (size == 0) {
-      return Status::OK();
-    }
-
-    chunks_.push_back(std::make_shared<Buffer>(data, size));
-    buffered_size_ += size;
-    return ConsumeChunks();
+    return Status::OK();
   }
 
   Status ConsumeBuffer(std::shared_ptr<Buffer> buffer) {
-    if (buffered_size_ == 0) {
-      while (buffer->size() >= next_required_size_) {
-        auto used_size = next_required_size_;
+    while (buffer->size() > 0 && state_ != State::EOS) {
+      auto used_size = next_required_size_;
+      if (buffered_size_ > 0 || buffer->size() < next_required_size_) {
+        auto partial = SliceBuffer(
+            buffer, 0, std::min(buffer->size(), next_required_size_ - buffered_size_));
+        if (!partial->is_cpu()) {
+          ARROW_ASSIGN_OR_RAISE(
+              partial, Buffer::ViewOrCopy(partial, CPUDevice::memory_manager(pool_)));
+        }
+        ARROW_ASSIGN_OR_RAISE(used_size,
+                              ConsumePartialData(partial->data(), partial->size()));
+      } else {
         switch (state_) {
           case State::INITIAL:
             RETURN_NOT_OK(ConsumeInitialBuffer(buffer));
@@ -663,11 +671,17 @@ class MessageDecoder::MessageDecoderImpl {
             break;
           case State::METADATA:
             if (buffer->size() == next_required_size_) {
-              return ConsumeMetadataBuffer(buffer);
+              RETURN_NOT_OK(ConsumeMetadataBuffer(buffer));
             } else {
               auto sliced_buffer = SliceBuffer(buffer, 0, next_required_size_);
               RETURN_NOT_OK(ConsumeMetadataBuffer(sliced_buffer));
             }
+            if (state_ == State::BODY &&
+                buffer->size() - used_size < next_required_size_) {
+              // The body comes in a later call: don't keep referencing this buffer
+              ARROW_ASSIGN_OR_RAISE(metadata_,
+                                    metadata_->CopySlice(0, metadata_->size(), pool_));
+            }
             break;
           case State::BODY:
             if (buffer->size() == next_required_size_) {
@@ -680,20 +694,13 @@ class MessageDecoder::MessageDecoderImpl {
           case State::EOS:
             return Status::OK();
         }
-        if (buffer->size() == used_size) {
-          return Status::OK();
-        }
-        buffer = SliceBuffer(buffer, used_size);
       }
+      if (buffer->size() == used_size) {
+        return Status::OK();
+      }
+      buffer = SliceBuffer(buffer, used_size);
     }
-
-    if (buffer->size() == 0) {
-      return Status::OK();
-    }
-
-    buffered_size_ += buffer->size();
-    chunks_.push_back(std::move(buffer));
-    return ConsumeChunks();
+    return Status::OK();
   }
 
   int64_t next_required_size() const { return next_required_size_ - buffered_size_; }
@@ -701,31 +708,44 @@ class MessageDecoder::MessageDecoderImpl {
   MessageDecoder::State state() const { return state_; }
 
  private:
-  Status ConsumeChunks() {
-    while (state_ != State::EOS) {
-      if (buffered_size_ < next_required_size_) {
-        return Status::OK();
-      }
-
-      switch (state_) {
-        case State::INITIAL:
-          RETURN_NOT_OK(ConsumeInitialChunks());
-          break;
-        case State::METADATA_LENGTH:
-          RETURN_NOT_OK(ConsumeMetadataLengthChunks());
-          break;
-        case State::METADATA:
-          RETURN_NOT_OK(ConsumeMetadataChunks());
-          break;
-        case State::BODY:
-          RETURN_NOT_OK(ConsumeBodyChunks());
-          break;
-        case State::EOS:
-          return Status::OK();
-      }
+  // Copy data which doesn't hold the whole current part of the message into
+  // an allocation of the part's size, then consume the part once complete.
+  // The decoder thus never keeps a reference to data passed in pieces.
+  Result<int64_t> ConsumePartialData(const uint8_t* data, int64_t size) {
+    const bool is_prefix = state_ == State::INITIAL || state_ == State::METADATA_LENGTH;
+    if (buffered_size_ == 0 && !is_prefix) {
+      ARROW_ASSIGN_OR_RAISE(partial_, AllocateBuffer(next_required_size_, pool_));
+    }
+    uint8_t* out = is_prefix ? reinterpret_cast<uint8_t*>(&partial_prefix_)
+                             : partial_->mutable_data();
+    const int64_t used_size = std::min(size, next_required_size_ - buffered_size_);
+    memcpy(out + buffered_size_, data, static_cast<size_t>(used_size));
+    buffered_size_ += used_size;
+    if (buffered_size_ < next_required_size_) {
+      return used_size;
     }
 
-    return Status::OK();
+    buffered_size_ = 0;
+    switch (state_) {
+      case State::INITIAL:
+        RETURN_NOT_OK(ConsumeInitial(bit_util::FromLittleEndian(partial_prefix_)));
+        break;
+      case State::METADATA_LENGTH:
+        RETURN_NOT_OK(
+            ConsumeMetadataLength(bit_util::FromLittleEndian(partial_prefix_)));
+        break;
+      case State::METADATA:
+        metadata_ = std::move(partial_);
+        RETURN_NOT_OK(ConsumeMetadata());
+        break;
+      case State::BODY: {
+        std::shared_ptr<Buffer> body = std::move(partial_);
+        RETURN_NOT_OK(ConsumeBody(&body));
+      } break;
+      case State::EOS:
+        break;
+    }
+    return used_size;
   }
 
   Status ConsumeInitialData(const uint8_t* data, int64_t size) {
@@ -737,12 +757,6 @@ class MessageDecoder::MessageDecoderImpl {
     return ConsumeInitial(bit_util::FromLittleEndian(continuation));
   }
 
-  Status ConsumeInitialChunks() {
-    int32_t continuation = 0;
-    RETURN_NOT_OK(ConsumeDataChunks(sizeof(int32_t), &continuation));
-    return ConsumeInitial(bit_util::FromLittleEndian(continuation));
-  }
-
   Status ConsumeInitial(int32_t continuation) {
     if (continuation == internal::kIpcContinuationToken) {
       state_ = State::METADATA_LENGTH;
@@ -777,12 +791,6 @@ class MessageDecoder::MessageDecoderImpl {
     return ConsumeMetadataLength(bit_util::FromLittleEndian(metadata_length));
   }
 
-  Status ConsumeMetadataLengthChunks() {
-    int32_t metadata_length = 0;
-    RETURN_NOT_OK(ConsumeDataChunks(sizeof(int32_t), &metadata_length));
-    return ConsumeMetadataLength(bit_util::FromLittleEndian(metadata_length));
-  }
-
   Status ConsumeMetadataLength(int32_t metadata_length) {
     if (metadata_length == 0) {
       state_ = State::EOS;
@@ -809,34 +817,6 @@ class MessageDecoder::MessageDecoderImpl {
     return ConsumeMetadata();
   }
 
-  Status ConsumeMetadataChunks() {
-    if (chunks_[0]->size() >= next_required_size_) {
-      if (chunks_[0]->size() == next_required_size_) {
-        if (chunks_[0]->is_cpu()) {
-          metadata_ = std::move(chunks_[0]);
-        } else {
-          ARROW_ASSIGN_OR_RAISE(
-              metadata_,
-              Buffer::ViewOrCopy(chunks_[0], CPUDevice::memory_manager(pool_)));
-        }
-        chunks_.erase(chunks_.begin());
-      } else {
-        metadata_ = SliceBuffer(chunks_[0], 0, next_required_size_);
-        if (!chunks_[0]->is_cpu()) {
-          ARROW_ASSIGN_OR_RAISE(
-              metadata_, Buffer::ViewOrCopy(metadata_, CPUDevice::memory_manager(pool_)));
-        }
-        chunks_[0] = SliceBuffer(chunks_[0], next_required_size_);
-      }
-      buffered_size_ -= next_required_size_;
-    } else {
-      ARROW_ASSIGN_OR_RAISE(auto metadata, AllocateBuffer(next_required_size_, pool_));
-      metadata_ = std::shared_ptr<Buffer>(metadata.release());
-      RETURN_NOT_OK(ConsumeDataChunks(next_required_size_, metadata_->mutable_data()));
-    }
-    return ConsumeMetadata();
-  }
-
   Status ConsumeMetadata() {
     RETURN_NOT_OK(MaybeAlignMetadata(&metadata_));
     int64_t body_length = -1;
@@ -858,27 +838,6 @@ class MessageDecoder::MessageDecoderImpl {
     return ConsumeBody(&buffer);
   }
 
-  Status ConsumeBodyChunks() {
-    if (chunks_[0]->size() >= next_required_size_) {
-      auto used_size = next_required_size_;
-      if (chunks_[0]->size() == next_required_size_) {
-        RETURN_NOT_OK(ConsumeBody(&chunks_[0]));
-        chunks_.erase(chunks_.begin());
-      } else {
-        auto body = SliceBuffer(chunks_[0], 0, next_required_size_);
-        RETURN_NOT_OK(ConsumeBody(&body));
-        chunks_[0] = SliceBuffer(chunks_[0], used_size);
-      }
-      buffered_size_ -= used_size;
-      return Status::OK();
-    } else {
-      ARROW_ASSIGN_OR_RAISE(auto body, AllocateBuffer(next_required_size_, pool_));
-      RETURN_NOT_OK(ConsumeDataChunks(next_required_size_, body->mutable_data()));
-      std::shared_ptr<Buffer> shared_body(body.release());
-      return ConsumeBody(&shared_body);
-    }
-  }
-
   Status ConsumeBody(std::shared_ptr<Buffer>* buffer) {
     ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Message> message,
                           Message::Open(metadata_, *buffer));
@@ -900,44 +859,14 @@ class MessageDecoder::MessageDecoderImpl {
     }
   }
 
-  Status ConsumeDataChunks(int64_t nbytes, void* out) {
-    size_t offset = 0;
-    size_t n_used_chunks = 0;
-    auto required_size = nbytes;
-    std::shared_ptr<Buffer> last_chunk;
-    for (auto& chunk : chunks_) {
-      if (!chunk->is_cpu()) {
-        ARROW_ASSIGN_OR_RAISE(
-            chunk, Buffer::ViewOrCopy(chunk, CPUDevice::memory_manager(pool_)));
-      }
-      auto data = chunk->data();
-      auto data_size = chunk->size();
-      auto copy_size = std::min(required_size, data_size);
-      memcpy(static_cast<uint8_t*>(out) + offset, data, copy_size);
-      n_used_chunks++;
-      offset += copy_size;
-      required_size -= copy_size;
-      if (required_size == 0) {
-        if (data_size != copy_size) {
-          last_chunk = SliceBuffer(chunk, copy_size);
-        }
-        break;
-      }
-    }
-    chunks_.erase(chunks_.begin(), chunks_.begin() + n_used_chunks);
-    if (last_chunk.get() != nullptr) {
-      chunks_.insert(chunks_.begin(), std::move(last_chunk));
-    }
-    buffered_size_ -= offset;
-    return Status::OK();
-  }
-
   std::shared_ptr<MessageDecoderListener> listener_;
   MemoryPool* pool_;
   State state_;
   int64_t next_required_size_;
-  std::vector<std::shared_ptr<Buffer>> chunks_;
+  // The bytes of the current part received so far, if it came in pieces
   int64_t buffered_size_;
+  std::unique_ptr<Buffer> partial_;
+  int32_t partial_prefix_ = 0;
   std::shared_ptr<Buffer> metadata_;  // Must be CPU buffer
   bool skip_body_;
 };
@@ -306,9 +306,10 @@ class ARROW_EXPORT MessageDecoder {
   /// * MessageDecoder::State::BODY: listener->OnBody()
   /// * MessageDecoder::State::EOS: listener->OnEOS()
   ///
-  /// \param[in] data a raw data to be processed. This data isn't
-  /// copied. The passed memory must be kept alive through message
-  /// processing.
+  /// \param[in] data a raw data to be processed. The parts of a message
+  /// that are contained in this data aren't copied, so the passed memory
+  /// must be kept alive as long as the decoded messages are used. Parts
+  /// that continue in later calls are copied and not referenced.
   /// \param[in] size raw data size.
   /// \return Status
   Status Consume(const uint8_t* data, int64_t size);
@@ -338,11 +339,15 @@ class ARROW_EXPORT MessageDecoder {
   /// ~~~
   ///
   /// Decoder has internal buffer. If consumed data isn't enough to
-  /// advance the state of the decoder, consumed data is buffered to
-  /// the internal buffer. It causes performance overhead.
-  ///
-  /// If you pass next_required_size() size data to each Consume()
-  /// call, the decoder doesn't use its internal buffer. It improves
+  /// advance the state of the decoder, consumed data is copied to
+  /// the internal buffer, a single allocation of the size of the
+  /// awaited message part (continuation token, metadata length,
+  /// metadata or body). It causes performance overhead.
+  ///
+  /// The returned size is always exactly the number of bytes missing
+  /// from the awaited part. If you pass next_required_size() size data
+  /// to each Consume() call, the decoder doesn't use its internal
+  /// buffer and slices the passed Buffers without copying. It improves
   /// performance.
   ///
   /// Here is an example usage to avoid using internal buffer:
@@ -384,6 +384,17 @@ Status ConcreteTypeFromFlatbuffer(flatbuf::Type type, const void* type_data,
     case flatbuf::Type::Union:
       return UnionFromFlatbuffer(static_cast<const flatbuf::Union*>(type_data), children,
                                  out);
+    case flatbuf::Type::RunEndEncoded:
+      if (children.size() != 2) {
+        return Status::Invalid("RunEndEncoded must have exactly 2 child fields");
+      }
+      if (!RunEndEncodedType::RunEndTypeValid(*children[0]->type())) {
+        return Status::Invalid(
+            "RunEndEncoded run_ends field must be typed as int16, int32, or int64");
+      }
+      *out =
+          std::make_shared<RunEndEncodedType>(children[0]->type(), children[1]->type());
+      return Status::OK();
     default:
       return Status::Invalid("Unrecognized type:" +
                              std::to_string(static_cast<int>(type)));
@@ -682,6 +693,17 @@ class FieldToFlatbufferVisitor {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    fb_type_ = flatbuf::Type::RunEndEncoded;
+    RETURN_NOT_OK(VisitChildFields(type));
+    type_offset_ = flatbuf::CreateRunEndEncoded(fbb_).Union();
+    return Status::OK();
+  }
+
+  Status Visit(const BinaryViewType& type) {
+    return Status::NotImplemented("IPC format does not support type: ", type.ToString());
+  }
+
   Status Visit(const DictionaryType& type) {
     // In this library, the dictionary "type" is a logical construct. Here we
     // pass through to the value type, as we've already captured the index
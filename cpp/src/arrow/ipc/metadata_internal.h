@@ -80,6 +80,11 @@ bool HasValidityBitmap(Type::type type_id, MetadataVersion version);
 
 static constexpr const char* kArrowMagicBytes = "ARROW1";
 
+// Footer custom metadata key of the record batch statistics of an IPC file,
+// see IpcWriteOptions::write_batch_statistics.  The statistics aren't part of
+// the format specification, so they stay out of its reserved "ARROW:" namespace.
+static constexpr const char* kBatchStatisticsKey = "arrow_cpp:batch_statistics";
+
 struct FieldMetadata {
   int64_t length;
   int64_t null_count;
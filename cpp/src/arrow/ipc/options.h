@@ -103,6 +103,40 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// and deltas.
   bool unify_dictionaries = false;
 
+  /// \brief Whether to unify the dictionaries of successive record batches
+  ///
+  /// If true, the writer keeps a running unified dictionary for each top-level
+  /// dictionary-encoded field, and transposes the indices of each record batch
+  /// against it.  Only the values that the unified dictionary did not contain
+  /// yet are emitted, as a dictionary delta, instead of a dictionary
+  /// replacement each time a record batch comes with a different dictionary.
+  /// If the unified dictionary outgrows the field's index type, it is started
+  /// over with a dictionary replacement (an error for the IPC file format).
+  ///
+  /// Dictionaries with nulls, or with a value type that DictionaryUnifier does
+  /// not support, are written as if this option were false.
+  bool unify_dictionary_deltas = false;
+
+  /// \brief Whether to record statistics of each record batch in IPC files
+  ///
+  /// If true, the IPC file writer records the null count of each column of
+  /// each record batch and, for columns with a boolean, numeric, temporal
+  /// (except interval) or base binary type, its minimum and maximum values.
+  /// They are stored in the custom metadata of the file footer, under the
+  /// "arrow_cpp:batch_statistics" key, where ReadBatchStatistics() finds them,
+  /// so that readers can skip record batches without reading them.
+  ///
+  /// This option is ignored for IPC streams.
+  bool write_batch_statistics = false;
+
+  /// \brief Maximum size in bytes of the minimum and maximum values recorded
+  /// with write_batch_statistics
+  ///
+  /// The bounds of a base binary column aren't recorded for a record batch
+  /// when its minimum or maximum value is longer, so that large values don't
+  /// inflate the file footer.
+  int64_t max_batch_statistics_size = 4096;
+
   /// \brief Format version to use for IPC messages and their metadata.
   ///
   /// Presently using V5 version (readable by 1.0.0 and later).
@@ -20,8 +20,11 @@
 #include <cstdint>
 #include <sstream>
 #include <string>
+#include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/builder.h"
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/test_common.h"
@@ -153,6 +156,55 @@ static void ReadStream(benchmark::State& state) {  // NOLINT non-const reference
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// Batches whose dictionaries are different windows over a common set of values,
+// as produced by independently dictionary-encoded sources
+RecordBatchVector MakeDictionaryBatches(int num_batches, int64_t length,
+                                        int32_t dictionary_size) {
+  constexpr int32_t kNumValues = 1 << 12;
+  random::RandomArrayGenerator rand(0x4f32a908);
+  auto type = dictionary(int16(), utf8());
+  auto schema = ::arrow::schema({field("f", type)});
+
+  RecordBatchVector batches;
+  for (int i = 0; i < num_batches; ++i) {
+    StringBuilder builder;
+    for (int32_t j = 0; j < dictionary_size; ++j) {
+      const int32_t value = (i * 37 + j * 7919) % kNumValues;
+      ABORT_NOT_OK(builder.Append("value_" + std::to_string(value)));
+    }
+    std::shared_ptr<Array> dict = *builder.Finish();
+    auto indices = rand.Int16(length, 0, static_cast<int16_t>(dictionary_size - 1));
+    auto array = *DictionaryArray::FromArrays(type, indices, dict);
+    batches.push_back(RecordBatch::Make(schema, length, {array}));
+  }
+  return batches;
+}
+
+static void WriteDictionaryStream(
+    benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int kNumBatches = 64;
+  constexpr int64_t kBatchLength = 1 << 14;
+  auto options = ipc::IpcWriteOptions::Defaults();
+  options.unify_dictionary_deltas = state.range(0) != 0;
+
+  const auto batches =
+      MakeDictionaryBatches(kNumBatches, kBatchLength, /*dictionary_size=*/1000);
+  std::shared_ptr<ResizableBuffer> buffer = *AllocateResizableBuffer(1024);
+
+  int64_t wire_bytes = 0;
+  for (auto _ : state) {
+    io::BufferOutputStream stream(buffer);
+    auto writer = *ipc::MakeStreamWriter(&stream, batches[0]->schema(), options);
+    for (const auto& batch : batches) {
+      ABORT_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ABORT_NOT_OK(writer->Close());
+    wire_bytes = *stream.Tell();
+  }
+  state.counters["wire_bytes"] = static_cast<double>(wire_bytes);
+  state.SetItemsProcessed(state.iterations() * kNumBatches * kBatchLength);
+}
+
 static void DecodeStream(benchmark::State& state) {  // NOLINT non-const reference
   // 1MB
   constexpr int64_t kTotalSize = 1 << 20;
@@ -370,5 +422,6 @@ BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime(
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(DecodeStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(WriteDictionaryStream)->ArgName("unify")->Arg(0)->Arg(1)->UseRealTime();
 
 }  // namespace arrow
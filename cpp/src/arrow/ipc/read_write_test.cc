@@ -17,12 +17,14 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <numeric>
 #include <ostream>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <flatbuffers/flatbuffers.h>
 #include <gtest/gtest.h>
@@ -346,6 +348,7 @@ const std::vector<test::MakeRecordBatch*> kBatchCases = {
     &MakeStringTypesRecordBatchWithNulls,
     &MakeStruct,
     &MakeUnion,
+    &MakeRunEndEncoded,
     &MakeDictionary,
     &MakeNestedDictionary,
     &MakeMap,
@@ -1778,6 +1781,99 @@ TEST(TestIpcFileFormat, FooterMetaData) {
   ASSERT_TRUE(out_metadata->Equals(*metadata));
 }
 
+TEST(TestIpcFileFormat, BatchStatistics) {
+  auto schema = ::arrow::schema({field("i", int32()), field("f", float64()),
+                                 field("s", utf8()), field("l", list(int8()))});
+  RecordBatchVector batches = {
+      RecordBatchFromJSON(schema, R"([{"i": 3, "f": 1.5, "s": "b", "l": [1]},
+                                      {"i": null, "f": 0, "s": "a", "l": null},
+                                      {"i": 1, "f": -2, "s": null, "l": []}])"),
+      RecordBatchFromJSON(schema, R"([{"i": null, "f": NaN, "s": "c", "l": []},
+                                      {"i": null, "f": 1, "s": "c", "l": []}])"),
+  };
+  auto metadata = key_value_metadata({"ARROW:example"}, {"something something"});
+
+  // Not recorded by default
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(schema, IpcWriteOptions::Defaults()));
+  for (const auto& batch : batches) {
+    ASSERT_OK(helper.WriteBatch(batch));
+  }
+  ASSERT_OK(helper.Finish());
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(
+                                        std::make_shared<io::BufferReader>(
+                                            helper.buffer_)));
+  ASSERT_OK_AND_ASSIGN(auto statistics, ReadBatchStatistics(*reader));
+  ASSERT_EQ(statistics, nullptr);
+
+  auto options = IpcWriteOptions::Defaults();
+  options.write_batch_statistics = true;
+  ASSERT_OK(helper.Init(schema, options, metadata));
+  for (const auto& batch : batches) {
+    ASSERT_OK(helper.WriteBatch(batch));
+  }
+  ASSERT_OK(helper.Finish());
+  ASSERT_OK_AND_ASSIGN(reader, RecordBatchFileReader::Open(
+                                   std::make_shared<io::BufferReader>(helper.buffer_)));
+  ASSERT_EQ(reader->metadata()->Get("ARROW:example"), "something something");
+  ASSERT_TRUE(reader->metadata()->Contains("arrow_cpp:batch_statistics"));
+  ASSERT_OK_AND_ASSIGN(statistics, ReadBatchStatistics(*reader));
+  ASSERT_NE(statistics, nullptr);
+  ASSERT_OK(statistics->ValidateFull());
+
+  auto StatisticsType = [](const std::shared_ptr<DataType>& type) {
+    return struct_({field("null_count", int64()), field("min", type),
+                    field("max", type)});
+  };
+  auto expected_schema = ::arrow::schema(
+      {field("i", StatisticsType(int32())), field("f", StatisticsType(float64())),
+       field("s", StatisticsType(utf8())),
+       field("l", struct_({field("null_count", int64())}))});
+  // Bounds are not recorded for batches with NaN values or only null values
+  auto expected = RecordBatchFromJSON(expected_schema, R"([
+    {"i": {"null_count": 1, "min": 1, "max": 3},
+     "f": {"null_count": 0, "min": -2, "max": 1.5},
+     "s": {"null_count": 1, "min": "a", "max": "b"},
+     "l": {"null_count": 1}},
+    {"i": {"null_count": 2, "min": null, "max": null},
+     "f": {"null_count": 0, "min": null, "max": null},
+     "s": {"null_count": 0, "min": "c", "max": "c"},
+     "l": {"null_count": 0}}
+  ])");
+  AssertBatchesEqual(*expected, *statistics);
+
+  // Binary bounds longer than the maximum size are not recorded
+  batches.push_back(RecordBatchFromJSON(
+      schema, R"([{"i": 4, "f": 2, "s": "ab", "l": []},
+                  {"i": 5, "f": 3, "s": "c", "l": []}])"));
+  options.max_batch_statistics_size = 1;
+  ASSERT_OK(helper.Init(schema, options));
+  for (const auto& batch : batches) {
+    ASSERT_OK(helper.WriteBatch(batch));
+  }
+  ASSERT_OK(helper.Finish());
+  ASSERT_OK_AND_ASSIGN(reader, RecordBatchFileReader::Open(
+                                   std::make_shared<io::BufferReader>(helper.buffer_)));
+  ASSERT_OK_AND_ASSIGN(statistics, ReadBatchStatistics(*reader));
+  ASSERT_NE(statistics, nullptr);
+  ASSERT_OK(statistics->ValidateFull());
+  expected = RecordBatchFromJSON(expected_schema, R"([
+    {"i": {"null_count": 1, "min": 1, "max": 3},
+     "f": {"null_count": 0, "min": -2, "max": 1.5},
+     "s": {"null_count": 1, "min": "a", "max": "b"},
+     "l": {"null_count": 1}},
+    {"i": {"null_count": 2, "min": null, "max": null},
+     "f": {"null_count": 0, "min": null, "max": null},
+     "s": {"null_count": 0, "min": "c", "max": "c"},
+     "l": {"null_count": 0}},
+    {"i": {"null_count": 0, "min": 4, "max": 5},
+     "f": {"null_count": 0, "min": 2, "max": 3},
+     "s": {"null_count": 0, "min": null, "max": null},
+     "l": {"null_count": 0}}
+  ])");
+  AssertBatchesEqual(*expected, *statistics);
+}
+
 TEST_F(TestWriteRecordBatch, RawAndSerializedSizes) {
   // ARROW-8823: Recording total raw and serialized record batch sizes in WriteStats
   FileWriterHelper helper;
@@ -1961,6 +2057,97 @@ class TrackedRandomAccessFile : public io::RandomAccessFile {
   }
 };
 
+TEST_F(TestFileFormatGeneratorCoalesced, ReadsAreBoundedByCacheOptions) {
+  const int kNumBatches = 8;
+  FileWriterHelper helper;
+  RecordBatchVector batches(kNumBatches);
+  for (int i = 0; i < kNumBatches; ++i) {
+    ASSERT_OK(MakeIntBatchSized(100, &batches[i], /*seed=*/i));
+    if (i == 0) {
+      ASSERT_OK(helper.Init(batches[i]->schema(), IpcWriteOptions::Defaults()));
+    }
+    ASSERT_OK(helper.WriteBatch(batches[i]));
+  }
+  ASSERT_OK(helper.Finish());
+
+  auto buf_reader = std::make_shared<NoZeroCopyBufferReader>(helper.buffer_);
+  auto tracked = std::make_shared<TrackedRandomAccessFile>(buf_reader.get());
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(tracked));
+  const int64_t num_open_reads = tracked->num_reads();
+
+  // Each read covers about two record batches
+  auto cache_options = io::CacheOptions::LazyDefaults();
+  cache_options.hole_size_limit = 1;
+  cache_options.range_size_limit = helper.footer_offset_ / (kNumBatches / 2);
+  ASSERT_OK_AND_ASSIGN(auto generator,
+                       reader->GetRecordBatchGenerator(
+                           /*coalesce=*/true, io::default_io_context(), cache_options));
+  ASSERT_EQ(tracked->num_reads(), num_open_reads);
+
+  // Reading the first batch doesn't read the whole file
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batch, generator());
+  AssertBatchesEqual(*batches[0], *batch);
+  ASSERT_EQ(tracked->num_reads(), num_open_reads + 1);
+
+  for (int i = 1; i < kNumBatches; ++i) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(batch, generator());
+    AssertBatchesEqual(*batches[i], *batch);
+  }
+  ASSERT_FINISHES_OK_AND_EQ(nullptr, generator());
+
+  const auto& read_ranges = tracked->get_read_ranges();
+  const int64_t num_batch_reads = tracked->num_reads() - num_open_reads;
+  ASSERT_GE(num_batch_reads, kNumBatches / 2);
+  ASSERT_LT(num_batch_reads, kNumBatches);
+  for (int64_t i = num_open_reads; i < tracked->num_reads(); ++i) {
+    ASSERT_LE(read_ranges[i].length, cache_options.range_size_limit);
+  }
+}
+
+TEST_F(TestFileFormatGeneratorCoalesced, SelectedBatches) {
+  const int kNumBatches = 8;
+  FileWriterHelper helper;
+  RecordBatchVector batches(kNumBatches);
+  for (int i = 0; i < kNumBatches; ++i) {
+    ASSERT_OK(MakeIntBatchSized(100, &batches[i], /*seed=*/i));
+    if (i == 0) {
+      ASSERT_OK(helper.Init(batches[i]->schema(), IpcWriteOptions::Defaults()));
+    }
+    ASSERT_OK(helper.WriteBatch(batches[i]));
+  }
+  ASSERT_OK(helper.Finish());
+
+  auto buf_reader = std::make_shared<NoZeroCopyBufferReader>(helper.buffer_);
+  auto tracked = std::make_shared<TrackedRandomAccessFile>(buf_reader.get());
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(tracked));
+  const int64_t num_open_reads = tracked->num_reads();
+
+  ASSERT_RAISES(IndexError, reader->GetRecordBatchGenerator({0, kNumBatches}));
+
+  // Only the selected batches are read, neighbouring ones coalesced
+  const std::vector<int> indices = {1, 4, 5};
+  auto cache_options = io::CacheOptions::LazyDefaults();
+  cache_options.hole_size_limit = 1;
+  ASSERT_OK_AND_ASSIGN(auto generator,
+                       reader->GetRecordBatchGenerator(indices, /*coalesce=*/true,
+                                                       io::default_io_context(),
+                                                       cache_options));
+  for (int index : indices) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batch, generator());
+    AssertBatchesEqual(*batches[index], *batch);
+  }
+  ASSERT_FINISHES_OK_AND_EQ(nullptr, generator());
+  ASSERT_EQ(tracked->num_reads(), num_open_reads + 2);
+
+  // Without coalescing
+  ASSERT_OK_AND_ASSIGN(generator, reader->GetRecordBatchGenerator(indices));
+  for (int index : indices) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batch, generator());
+    AssertBatchesEqual(*batches[index], *batch);
+  }
+  ASSERT_FINISHES_OK_AND_EQ(nullptr, generator());
+}
+
 TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   // ARROW-6006
   auto f0 = arrow::field("f0", arrow::dictionary(arrow::int8(), arrow::utf8()));
@@ -2081,6 +2268,137 @@ TEST(TestStreamDecoder, NextRequiredSize) {
   ASSERT_EQ(next_required_size - 1, decoder.next_required_size());
 }
 
+class TestStreamDecoderChunks : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK(MakeIntBatchSized(1000, &batch_));
+    ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+    ASSERT_OK_AND_ASSIGN(auto writer, MakeStreamWriter(sink, batch_->schema()));
+    ASSERT_OK(writer->WriteRecordBatch(*batch_));
+    ASSERT_OK(writer->WriteRecordBatch(*batch_));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK_AND_ASSIGN(stream_, sink->Finish());
+  }
+
+  // A fresh, pooled-like copy of a piece of the stream
+  std::shared_ptr<Buffer> CopyChunk(int64_t offset, int64_t length) {
+    return *stream_->CopySlice(offset, std::min(length, stream_->size() - offset));
+  }
+
+  void CheckBatches(const CollectListener& listener) {
+    ASSERT_EQ(listener.record_batches().size(), 2);
+    for (const auto& batch : listener.record_batches()) {
+      AssertBatchesEqual(*batch_, *batch);
+    }
+  }
+
+ protected:
+  std::shared_ptr<RecordBatch> batch_;
+  std::shared_ptr<Buffer> stream_;
+};
+
+TEST_F(TestStreamDecoderChunks, ExactSizeChunksAreSliced) {
+  auto listener = std::make_shared<CollectListener>();
+  StreamDecoder decoder(listener);
+  std::vector<std::shared_ptr<Buffer>> chunks;
+  int64_t offset = 0;
+  while (decoder.next_required_size() > 0) {
+    chunks.push_back(CopyChunk(offset, decoder.next_required_size()));
+    offset += chunks.back()->size();
+    ASSERT_OK(decoder.Consume(chunks.back()));
+  }
+  ASSERT_EQ(offset, stream_->size());
+  CheckBatches(*listener);
+
+  // The decoded bodies point into the consumed chunks
+  for (const auto& batch : listener->record_batches()) {
+    const uint8_t* data = batch->column_data(0)->buffers[1]->data();
+    ASSERT_TRUE(std::any_of(chunks.begin(), chunks.end(),
+                            [&](const std::shared_ptr<Buffer>& chunk) {
+                              return data >= chunk->data() &&
+                                     data < chunk->data() + chunk->size();
+                            }));
+  }
+}
+
+TEST_F(TestStreamDecoderChunks, SplitChunksAreNotReferenced) {
+  for (int64_t chunk_size : {1, 3, 7, 100}) {
+    ARROW_SCOPED_TRACE("chunk_size = ", chunk_size);
+    auto listener = std::make_shared<CollectListener>();
+    StreamDecoder decoder(listener);
+    for (int64_t offset = 0; offset < stream_->size(); offset += chunk_size) {
+      auto chunk = CopyChunk(offset, chunk_size);
+      const int64_t next_required_size = decoder.next_required_size();
+      ASSERT_OK(decoder.Consume(chunk));
+      if (chunk->size() < next_required_size) {
+        // Nothing but the start of a message part => copied
+        ASSERT_EQ(chunk.use_count(), 1);
+        ASSERT_EQ(decoder.next_required_size(), next_required_size - chunk->size());
+      }
+    }
+    ASSERT_EQ(decoder.next_required_size(), 0);
+    CheckBatches(*listener);
+  }
+}
+
+TEST_F(TestStreamDecoderChunks, MetadataIsCopiedWhenBodyComesLater) {
+  class CollectMessageListener : public MessageDecoderListener {
+   public:
+    Status OnMessageDecoded(std::unique_ptr<Message> message) override {
+      messages.push_back(std::move(message));
+      return Status::OK();
+    }
+    std::vector<std::unique_ptr<Message>> messages;
+  };
+
+  // Feed the metadata of each message as a chunk of its own, or together
+  // with the first byte of the body, then the rest of the body
+  for (int64_t body_prefix : {0, 1}) {
+    ARROW_SCOPED_TRACE("body_prefix = ", body_prefix);
+    auto listener = std::make_shared<CollectMessageListener>();
+    MessageDecoder decoder(listener);
+    int64_t offset = 0;
+    while (decoder.state() != MessageDecoder::State::EOS) {
+      const bool is_metadata = decoder.state() == MessageDecoder::State::METADATA;
+      const int64_t length =
+          decoder.next_required_size() + (is_metadata ? body_prefix : 0);
+      auto chunk = CopyChunk(offset, length);
+      offset += chunk->size();
+      ASSERT_OK(decoder.Consume(chunk));
+      if (is_metadata && decoder.state() == MessageDecoder::State::BODY &&
+          decoder.next_required_size() > 0) {
+        ASSERT_EQ(chunk.use_count(), 1);
+      }
+    }
+    ASSERT_EQ(offset, stream_->size());
+
+    io::BufferReader reader(stream_);
+    auto message_reader = MessageReader::Open(&reader);
+    for (const auto& message : listener->messages) {
+      ASSERT_OK_AND_ASSIGN(auto expected, message_reader->ReadNextMessage());
+      ASSERT_NE(expected, nullptr);
+      ASSERT_TRUE(message->Equals(*expected));
+    }
+    ASSERT_OK_AND_ASSIGN(auto expected, message_reader->ReadNextMessage());
+    ASSERT_EQ(expected, nullptr);
+  }
+}
+
+TEST_F(TestStreamDecoderChunks, SplitDataIsCopied) {
+  auto listener = std::make_shared<CollectListener>();
+  StreamDecoder decoder(listener);
+  // Feed the stream in pieces through a single reused scratch area
+  std::vector<uint8_t> scratch(5);
+  for (int64_t offset = 0; offset < stream_->size();
+       offset += static_cast<int64_t>(scratch.size())) {
+    const auto length = std::min<int64_t>(scratch.size(), stream_->size() - offset);
+    std::memcpy(scratch.data(), stream_->data() + offset, static_cast<size_t>(length));
+    ASSERT_OK(decoder.Consume(scratch.data(), length));
+    std::fill(scratch.begin(), scratch.end(), 0xff);
+  }
+  CheckBatches(*listener);
+}
+
 template <typename WriterHelperType>
 class TestDictionaryReplacement : public ::testing::Test {
  public:
@@ -2384,6 +2702,96 @@ class TestDictionaryReplacement : public ::testing::Test {
     }
   }
 
+  void TestUnifiedDeltaDict() {
+    write_options_.unify_dictionary_deltas = true;
+
+    // The second dictionary only adds "quux" to the unified dictionary
+    RecordBatchVector out_batches;
+    auto batches = DifferentValuesDictBatches();
+    ASSERT_OK(RoundTrip(batches, &out_batches));
+    CheckStatsConsistent();
+    CheckBatchesDecoded(batches, out_batches);
+    EXPECT_EQ(read_stats_.num_messages, 5);  // including schema message
+    EXPECT_EQ(read_stats_.num_record_batches, 2);
+    EXPECT_EQ(read_stats_.num_dictionary_batches, 2);
+    EXPECT_EQ(read_stats_.num_replaced_dictionaries, 0);
+    EXPECT_EQ(read_stats_.num_dictionary_deltas, 1);
+    AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["foo", "bar", "quux"])"),
+                      *checked_cast<const DictionaryArray&>(*out_batches[1]->column(0))
+                           .dictionary());
+
+    // Same values in a different order => only indices are transposed
+    batches = DifferentOrderDictBatches();
+    out_batches.clear();
+    ASSERT_OK(RoundTrip(batches, &out_batches));
+    CheckStatsConsistent();
+    CheckBatchesDecoded(batches, out_batches);
+    EXPECT_EQ(read_stats_.num_messages, 4);  // including schema message
+    EXPECT_EQ(read_stats_.num_dictionary_batches, 1);
+    EXPECT_EQ(read_stats_.num_dictionary_deltas, 0);
+
+    // Successive deltas are appended to the unified dictionary
+    for (const auto& value_type : {int32(), utf8()}) {
+      ARROW_SCOPED_TRACE("value type = ", *value_type);
+      auto make_range = [&](int start, int stop) {
+        std::string json = "[";
+        for (int value = start; value < stop; ++value) {
+          const auto value_str = std::to_string(value);
+          json += (value > start ? ", " : "") +
+                  (value_type->id() == Type::STRING ? "\"" + value_str + "\""
+                                                    : value_str);
+        }
+        return ArrayFromJSON(value_type, json + "]");
+      };
+      RecordBatchVector growing_batches;
+      for (int i = 0; i < 20; ++i) {
+        growing_batches.push_back(MakeBatch(dictionary(int16(), value_type),
+                                            ArrayFromJSON(int16(), "[0, 9, 4]"),
+                                            make_range(5 * i, 5 * i + 10)));
+      }
+      out_batches.clear();
+      ASSERT_OK(RoundTrip(growing_batches, &out_batches));
+      CheckStatsConsistent();
+      CheckBatchesDecoded(growing_batches, out_batches);
+      EXPECT_EQ(read_stats_.num_dictionary_batches, 20);
+      EXPECT_EQ(read_stats_.num_dictionary_deltas, 19);
+      AssertArraysEqual(
+          *make_range(0, 105),
+          *checked_cast<const DictionaryArray&>(*out_batches.back()->column(0))
+               .dictionary());
+    }
+
+    // The unified dictionary would outgrow the int8 index type
+    auto type = dictionary(int8(), int32());
+    auto batch1 = MakeBatch(type, ArrayFromJSON(int8(), "[0, 99, null]"),
+                            MakeInt32Range(0, 100));
+    auto batch2 =
+        MakeBatch(type, ArrayFromJSON(int8(), "[5, 99]"), MakeInt32Range(100, 200));
+    if (WriterHelper::kIsFileFormat) {
+      CheckWritingFails({batch1, batch2}, 1);
+    } else {
+      CheckRoundtrip({batch1, batch2});
+      EXPECT_EQ(read_stats_.num_messages, 5);  // including schema message
+      EXPECT_EQ(read_stats_.num_dictionary_batches, 2);
+      EXPECT_EQ(read_stats_.num_replaced_dictionaries, 1);
+      EXPECT_EQ(read_stats_.num_dictionary_deltas, 0);
+    }
+
+    // Dictionaries with nulls are not unified
+    auto str_type = dictionary(int8(), utf8());
+    batch1 = MakeBatch(str_type, ArrayFromJSON(int8(), "[0, 1]"),
+                       ArrayFromJSON(utf8(), R"(["foo", null])"));
+    batch2 = MakeBatch(str_type, ArrayFromJSON(int8(), "[2, 1]"),
+                       ArrayFromJSON(utf8(), R"(["bar", null, "foo"])"));
+    if (WriterHelper::kIsFileFormat) {
+      CheckWritingFails({batch1, batch2}, 1);
+    } else {
+      CheckRoundtrip({batch1, batch2});
+      EXPECT_EQ(read_stats_.num_dictionary_batches, 2);
+      EXPECT_EQ(read_stats_.num_replaced_dictionaries, 1);
+    }
+  }
+
   Status RoundTrip(const RecordBatchVector& in_batches, RecordBatchVector* out_batches) {
     WriterHelper writer_helper;
     RETURN_NOT_OK(writer_helper.Init(in_batches[0]->schema(), write_options_));
@@ -2430,6 +2838,33 @@ class TestDictionaryReplacement : public ::testing::Test {
     AssertTablesEqual(*expected_table, *actual_table);
   }
 
+  // Check that the dictionary columns of batches have the same values, even if
+  // their dictionaries or indices are different.
+  void CheckBatchesDecoded(const RecordBatchVector& expected,
+                           const RecordBatchVector& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(expected[i]->num_columns(), actual[i]->num_columns());
+      for (int j = 0; j < expected[i]->num_columns(); ++j) {
+        const auto& expected_column =
+            checked_cast<const DictionaryArray&>(*expected[i]->column(j));
+        const auto& actual_column =
+            checked_cast<const DictionaryArray&>(*actual[i]->column(j));
+        ASSERT_EQ(expected_column.length(), actual_column.length());
+        for (int64_t k = 0; k < expected_column.length(); ++k) {
+          ASSERT_EQ(expected_column.IsNull(k), actual_column.IsNull(k));
+          if (expected_column.IsNull(k)) continue;
+          ASSERT_OK_AND_ASSIGN(auto expected_value,
+                               expected_column.dictionary()->GetScalar(
+                                   expected_column.GetValueIndex(k)));
+          ASSERT_OK_AND_ASSIGN(auto actual_value, actual_column.dictionary()->GetScalar(
+                                                      actual_column.GetValueIndex(k)));
+          AssertScalarsEqual(*expected_value, *actual_value);
+        }
+      }
+    }
+  }
+
   RecordBatchVector ExpandDictionaries(const RecordBatchVector& in_batches) {
     RecordBatchVector out;
     ArrayVector full_dictionaries;
@@ -2566,6 +3001,14 @@ class TestDictionaryReplacement : public ::testing::Test {
     return MakeBatch(std::move(array));
   }
 
+  std::shared_ptr<Array> MakeInt32Range(int32_t start, int32_t stop) {
+    Int32Builder builder;
+    for (int32_t value = start; value < stop; ++value) {
+      ARROW_EXPECT_OK(builder.Append(value));
+    }
+    return builder.Finish().ValueOrDie();
+  }
+
  protected:
   IpcWriteOptions write_options_ = IpcWriteOptions::Defaults();
   IpcReadOptions read_options_ = IpcReadOptions::Defaults();
@@ -2597,6 +3040,10 @@ TYPED_TEST(TestDictionaryReplacement, DifferentDictValuesNested) {
   this->TestDifferentDictValuesNested();
 }
 
+TYPED_TEST(TestDictionaryReplacement, UnifiedDeltaDict) {
+  this->TestUnifiedDeltaDict();
+}
+
 TYPED_TEST(TestDictionaryReplacement, DeltaDictNestedOuter) {
   this->TestDeltaDictNestedOuter();
 }
@@ -45,6 +45,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -416,6 +417,19 @@ class ArrayLoader {
     return LoadChildren(type.fields());
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    out_->buffers.resize(1);
+    RETURN_NOT_OK(LoadCommon(type.id()));
+    // Nulls are represented in the values child
+    out_->buffers[0] = nullptr;
+    out_->null_count = 0;
+    return LoadChildren(type.fields());
+  }
+
+  Status Visit(const BinaryViewType& type) {
+    return Status::NotImplemented("IPC format does not support type: ", type.ToString());
+  }
+
   Status Visit(const DictionaryType& type) {
     // out_->dictionary will be filled later in ResolveDictionaries()
     return LoadType(*type.index_type());
@@ -1074,9 +1088,11 @@ class ARROW_EXPORT WholeIpcFileRecordBatchGenerator {
 
   explicit WholeIpcFileRecordBatchGenerator(
       std::shared_ptr<RecordBatchFileReaderImpl> state,
+      std::shared_ptr<const std::vector<int>> indices,
       std::shared_ptr<io::internal::ReadRangeCache> cached_source,
       const io::IOContext& io_context, arrow::internal::Executor* executor)
       : state_(std::move(state)),
+        indices_(std::move(indices)),
         cached_source_(std::move(cached_source)),
         io_context_(io_context),
         executor_(executor),
@@ -1093,6 +1109,7 @@ class ARROW_EXPORT WholeIpcFileRecordBatchGenerator {
 
  private:
   std::shared_ptr<RecordBatchFileReaderImpl> state_;
+  std::shared_ptr<const std::vector<int>> indices_;
   std::shared_ptr<io::internal::ReadRangeCache> cached_source_;
   io::IOContext io_context_;
   arrow::internal::Executor* executor_;
@@ -1110,14 +1127,16 @@ class ARROW_EXPORT SelectiveIpcFileRecordBatchGenerator {
   using Item = std::shared_ptr<RecordBatch>;
 
   explicit SelectiveIpcFileRecordBatchGenerator(
-      std::shared_ptr<RecordBatchFileReaderImpl> state)
-      : state_(std::move(state)), index_(0) {}
+      std::shared_ptr<RecordBatchFileReaderImpl> state,
+      std::shared_ptr<const std::vector<int>> indices)
+      : state_(std::move(state)), indices_(std::move(indices)), index_(0) {}
 
   Future<Item> operator()();
 
  private:
   std::shared_ptr<RecordBatchFileReaderImpl> state_;
-  int index_;
+  std::shared_ptr<const std::vector<int>> indices_;
+  size_t index_;
 };
 
 class RecordBatchFileReaderImpl : public RecordBatchFileReader {
@@ -1310,6 +1329,20 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       const bool coalesce, const io::IOContext& io_context,
       const io::CacheOptions cache_options,
       arrow::internal::Executor* executor) override {
+    return GetRecordBatchGenerator(AllIndices(), coalesce, io_context, cache_options,
+                                   executor);
+  }
+
+  Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
+      const std::vector<int>& indices, const bool coalesce,
+      const io::IOContext& io_context, const io::CacheOptions cache_options,
+      arrow::internal::Executor* executor) override {
+    for (int index : indices) {
+      if (index < 0 || index >= num_record_batches()) {
+        return Status::IndexError("Record batch index ", index, " out of bounds");
+      }
+    }
+    auto shared_indices = std::make_shared<const std::vector<int>>(indices);
     auto state = std::dynamic_pointer_cast<RecordBatchFileReaderImpl>(shared_from_this());
     // Prebuffering causes us to use a lot of futures which, at the moment,
     // can only slow things down when we are doing zero-copy in-memory reads.
@@ -1320,21 +1353,38 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     if (options_.included_fields.size() != 0 &&
         options_.included_fields.size() != schema_->fields().size() &&
         !file_->supports_zero_copy()) {
-      RETURN_NOT_OK(state->PreBufferMetadata({}));
-      return SelectiveIpcFileRecordBatchGenerator(std::move(state));
+      if (!indices.empty()) {
+        RETURN_NOT_OK(state->PreBufferMetadata(indices));
+      }
+      return SelectiveIpcFileRecordBatchGenerator(std::move(state),
+                                                  std::move(shared_indices));
     }
 
     std::shared_ptr<io::internal::ReadRangeCache> cached_source;
     if (coalesce && !file_->supports_zero_copy()) {
       if (!owned_file_) return Status::Invalid("Cannot coalesce without an owned file");
-      // Since the user is asking for all fields then we can cache the entire
-      // file (up to the footer)
+      // Since the user is asking for all fields then we can cache the whole
+      // dictionary and selected record batch blocks.  The cache coalesces them into reads
+      // bounded by the cache options, so that a lazy cache prefetches the
+      // upcoming batches along with the one requested, rather than reading the
+      // entire file up-front.
       cached_source = std::make_shared<io::internal::ReadRangeCache>(file_, io_context,
                                                                      cache_options);
-      RETURN_NOT_OK(cached_source->Cache({{0, footer_offset_}}));
+      std::vector<io::ReadRange> ranges;
+      ranges.reserve(num_dictionaries() + indices.size());
+      for (int i = 0; i < num_dictionaries(); ++i) {
+        const FileBlock block = GetDictionaryBlock(i);
+        ranges.push_back({block.offset, block.metadata_length + block.body_length});
+      }
+      for (int index : indices) {
+        const FileBlock block = GetRecordBatchBlock(index);
+        ranges.push_back({block.offset, block.metadata_length + block.body_length});
+      }
+      RETURN_NOT_OK(cached_source->Cache(std::move(ranges)));
     }
-    return WholeIpcFileRecordBatchGenerator(std::move(state), std::move(cached_source),
-                                            io_context, executor);
+    return WholeIpcFileRecordBatchGenerator(std::move(state), std::move(shared_indices),
+                                            std::move(cached_source), io_context,
+                                            executor);
   }
 
   Status DoPreBufferMetadata(const std::vector<int>& indices) {
@@ -1802,11 +1852,10 @@ Future<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::OpenAsync(
 
 Future<SelectiveIpcFileRecordBatchGenerator::Item>
 SelectiveIpcFileRecordBatchGenerator::operator()() {
-  int index = index_++;
-  if (index >= state_->num_record_batches()) {
+  if (index_ >= indices_->size()) {
     return IterationEnd<SelectiveIpcFileRecordBatchGenerator::Item>();
   }
-  return state_->ReadRecordBatchAsync(index);
+  return state_->ReadRecordBatchAsync((*indices_)[index_++]);
 }
 
 Future<WholeIpcFileRecordBatchGenerator::Item>
@@ -1828,10 +1877,11 @@ WholeIpcFileRecordBatchGenerator::operator()() {
           return ReadDictionaries(state.get(), std::move(messages));
         });
   }
-  if (index_ >= state_->num_record_batches()) {
+  if (index_ >= static_cast<int>(indices_->size())) {
     return Future<Item>::MakeFinished(IterationTraits<Item>::End());
   }
-  auto block = FileBlockFromFlatbuffer(state->footer_->recordBatches()->Get(index_++));
+  auto block = FileBlockFromFlatbuffer(
+      state->footer_->recordBatches()->Get((*indices_)[index_++]));
   auto read_message = ReadBlock(block);
   auto read_messages = read_dictionaries_.Then([read_message]() { return read_message; });
   // Force transfer. This may be wasteful in some cases, but ensures we get off the
@@ -2067,6 +2117,29 @@ Result<std::shared_ptr<Schema>> ReadSchema(const Message& message,
   return result;
 }
 
+Result<std::shared_ptr<RecordBatch>> ReadBatchStatistics(
+    const RecordBatchFileReader& reader) {
+  const auto metadata = reader.metadata();
+  if (metadata == nullptr) {
+    return nullptr;
+  }
+  const int index = metadata->FindKey(internal::kBatchStatisticsKey);
+  if (index == -1) {
+    return nullptr;
+  }
+
+  auto buffer = Buffer::FromString(util::base64_decode(metadata->value(index)));
+  ARROW_ASSIGN_OR_RAISE(auto statistics_reader,
+                        RecordBatchStreamReader::Open(
+                            std::make_shared<io::BufferReader>(std::move(buffer))));
+  std::shared_ptr<RecordBatch> statistics;
+  RETURN_NOT_OK(statistics_reader->ReadNext(&statistics));
+  if (statistics == nullptr || statistics->num_rows() != reader.num_record_batches()) {
+    return Status::Invalid("Record batch statistics don't match the IPC file");
+  }
+  return statistics;
+}
+
 Result<std::shared_ptr<Tensor>> ReadTensor(io::InputStream* file) {
   std::unique_ptr<Message> message;
   RETURN_NOT_OK(ReadContiguousPayload(file, &message));
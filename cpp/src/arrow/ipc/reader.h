@@ -217,7 +217,10 @@ class ARROW_EXPORT RecordBatchFileReader
 
   /// \brief Get a reentrant generator of record batches.
   ///
-  /// \param[in] coalesce If true, enable I/O coalescing.
+  /// \param[in] coalesce If true, enable I/O coalescing.  The dictionary and
+  ///     record batch messages are then read through a cache which coalesces
+  ///     neighbouring messages; with lazy cache options, reading a batch also
+  ///     prefetches the following batches which were coalesced with it.
   /// \param[in] io_context The IOContext to use (controls which thread pool
   ///     is used for I/O).
   /// \param[in] cache_options Options for coalescing (if enabled).
@@ -229,6 +232,19 @@ class ARROW_EXPORT RecordBatchFileReader
       const io::IOContext& io_context = io::default_io_context(),
       const io::CacheOptions cache_options = io::CacheOptions::LazyDefaults(),
       arrow::internal::Executor* executor = NULLPTR) = 0;
+
+  /// \brief Get a reentrant generator of a subset of the record batches.
+  ///
+  /// Like GetRecordBatchGenerator() above, but only the record batches at the
+  /// given indices are read, in the given order. With coalescing, only those
+  /// record batches (and the dictionaries) are cached.
+  ///
+  /// \param[in] indices Indices of the record batches to read
+  virtual Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
+      const std::vector<int>& indices, const bool coalesce = false,
+      const io::IOContext& io_context = io::default_io_context(),
+      const io::CacheOptions cache_options = io::CacheOptions::LazyDefaults(),
+      arrow::internal::Executor* executor = NULLPTR) = 0;
 };
 
 /// \brief A general listener class to receive events.
@@ -333,9 +349,10 @@ class ARROW_EXPORT StreamDecoder {
   /// the decoder calls listener->OnRecordBatchDecoded() with a
   /// decoded record batch multiple times.
   ///
-  /// \param[in] data a raw data to be processed. This data isn't
-  /// copied. The passed memory must be kept alive through record
-  /// batch processing.
+  /// \param[in] data a raw data to be processed. The parts of a message
+  /// that are contained in this data aren't copied, so the passed memory
+  /// must be kept alive as long as the decoded record batches are used. Parts
+  /// that continue in later calls are copied and not referenced.
   /// \param[in] size raw data size.
   /// \return Status
   Status Consume(const uint8_t* data, int64_t size);
@@ -368,11 +385,15 @@ class ARROW_EXPORT StreamDecoder {
   /// ~~~
   ///
   /// Decoder has internal buffer. If consumed data isn't enough to
-  /// advance the state of the decoder, consumed data is buffered to
-  /// the internal buffer. It causes performance overhead.
-  ///
-  /// If you pass next_required_size() size data to each Consume()
-  /// call, the decoder doesn't use its internal buffer. It improves
+  /// advance the state of the decoder, consumed data is copied to
+  /// the internal buffer, a single allocation of the size of the
+  /// awaited message part (continuation token, metadata length,
+  /// metadata or body). It causes performance overhead.
+  ///
+  /// The returned size is always exactly the number of bytes missing
+  /// from the awaited part. If you pass next_required_size() size data
+  /// to each Consume() call, the decoder doesn't use its internal
+  /// buffer and slices the passed Buffers without copying. It improves
   /// performance.
   ///
   /// Here is an example usage to avoid using internal buffer:
@@ -497,6 +518,21 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
     const DictionaryMemo* dictionary_memo, const IpcReadOptions& options,
     io::RandomAccessFile* file);
 
+/// \brief Read the record batch statistics of an IPC file
+///
+/// The statistics are a record batch with one row per record batch of the file,
+/// and a struct column per field of the file schema (regardless of
+/// IpcReadOptions::included_fields). Each struct has a "null_count" child and,
+/// if IpcWriteOptions::write_batch_statistics supports the field's type, "min"
+/// and "max" children of the field's type. These are null if the record batch
+/// has no non-null values in the column, or has NaN values.
+///
+/// \param[in] reader the reader of the IPC file
+/// \return the statistics, or null if the file was written without them
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatch>> ReadBatchStatistics(
+    const RecordBatchFileReader& reader);
+
 /// \brief Read arrow::Tensor as encapsulated IPC message in file
 ///
 /// \param[in] file an InputStream pointed at the start of the message
@@ -591,6 +591,30 @@ Status MakeUnion(std::shared_ptr<RecordBatch>* out) {
   return Status::OK();
 }
 
+Status MakeRunEndEncoded(std::shared_ptr<RecordBatch>* out) {
+  const int64_t length = 9;
+  auto values = ArrayFromJSON(int32(), "[-1, null, 1, 2]");
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto int_array,
+      RunEndEncodedArray::Make(length, ArrayFromJSON(int32(), "[2, 3, 7, 9]"), values));
+  ARROW_ASSIGN_OR_RAISE(
+      auto long_array, RunEndEncodedArray::Make(
+                           length, ArrayFromJSON(int64(), "[4, 5, 9]"), values->Slice(1)));
+  // A sliced array, whose run ends must be shifted when written
+  ARROW_ASSIGN_OR_RAISE(
+      auto unsliced_array,
+      RunEndEncodedArray::Make(length + 3, ArrayFromJSON(int16(), "[3, 4, 8, 12]"),
+                               values));
+  auto sliced_array = unsliced_array->Slice(2, length);
+
+  auto schema = ::arrow::schema({field("f0", int_array->type()),
+                                 field("f1", long_array->type()),
+                                 field("f2", sliced_array->type())});
+  *out = RecordBatch::Make(schema, length, {int_array, long_array, sliced_array});
+  return Status::OK();
+}
+
 Status MakeDictionary(std::shared_ptr<RecordBatch>* out) {
   const int64_t length = 6;
 
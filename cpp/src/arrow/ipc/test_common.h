@@ -125,6 +125,9 @@ Status MakeStruct(std::shared_ptr<RecordBatch>* out);
 ARROW_TESTING_EXPORT
 Status MakeUnion(std::shared_ptr<RecordBatch>* out);
 
+ARROW_TESTING_EXPORT
+Status MakeRunEndEncoded(std::shared_ptr<RecordBatch>* out);
+
 ARROW_TESTING_EXPORT
 Status MakeDictionary(std::shared_ptr<RecordBatch>* out);
 
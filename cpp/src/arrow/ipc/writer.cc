@@ -29,7 +29,9 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
+#include "arrow/builder.h"
 #include "arrow/device.h"
 #include "arrow/extension_type.h"
 #include "arrow/io/interfaces.h"
@@ -40,16 +42,19 @@
 #include "arrow/ipc/util.h"
 #include "arrow/record_batch.h"
 #include "arrow/result_internal.h"
+#include "arrow/scalar.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/endian.h"
+#include "arrow/util/int_util.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
@@ -521,6 +526,22 @@ class RecordBatchSerializer {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedArray& array) {
+    // IPC has no slice offset: write the run ends relative to the slice and
+    // only the values of the runs it covers
+    --max_recursion_depth_;
+    ARROW_ASSIGN_OR_RAISE(auto run_ends, array.LogicalRunEnds(options_.memory_pool));
+    RETURN_NOT_OK(VisitArray(*run_ends));
+    RETURN_NOT_OK(VisitArray(*array.LogicalValues()));
+    ++max_recursion_depth_;
+    return Status::OK();
+  }
+
+  Status Visit(const BinaryViewArray& array) {
+    return Status::NotImplemented("IPC format does not support type: ",
+                                  array.type()->ToString());
+  }
+
   Status Visit(const DictionaryArray& array) {
     // Dictionary written out separately. Slice offset contained in the indices
     return VisitType(*array.indices());
@@ -975,6 +996,128 @@ Status RecordBatchWriter::WriteTable(const Table& table) { return WriteTable(tab
 // ----------------------------------------------------------------------
 // Payload writer implementation
 
+namespace {
+
+// The values of a unified dictionary, to which deltas are appended without
+// copying the existing values.  The dictionaries returned by dictionary() share
+// the value buffers, which are only ever written to past their end, and are
+// reallocated with geometric growth when they run out of capacity (leaving the
+// previous allocation to the dictionaries still pointing into it).
+class DictionaryAccumulator {
+ public:
+  DictionaryAccumulator(std::shared_ptr<DataType> type, MemoryPool* pool)
+      : type_(std::move(type)),
+        pool_(pool),
+        buffers_(is_base_binary_like(type_->id()) ? 2 : 1) {}
+
+  int64_t length() const { return length_; }
+
+  const std::shared_ptr<Array>& dictionary() const { return dictionary_; }
+
+  Status Append(const std::shared_ptr<Array>& delta) {
+    DCHECK_EQ(delta->null_count(), 0);
+    if (dictionary_ != nullptr && delta->length() == 0) {
+      return Status::OK();
+    }
+    const ArrayData& data = *delta->data();
+    const Type::type type_id = type_->id();
+    if (is_large_binary_like(type_id)) {
+      RETURN_NOT_OK(AppendBinary<int64_t>(data));
+    } else if (is_base_binary_like(type_id)) {
+      RETURN_NOT_OK(AppendBinary<int32_t>(data));
+    } else if (is_fixed_width(type_id) &&
+               checked_cast<const FixedWidthType&>(*type_).bit_width() % 8 == 0) {
+      const int64_t byte_width =
+          checked_cast<const FixedWidthType&>(*type_).bit_width() / 8;
+      const uint8_t* values = data.buffers[1] == nullptr
+                                  ? nullptr
+                                  : data.buffers[1]->data() + data.offset * byte_width;
+      RETURN_NOT_OK(AppendBytes(&buffers_[0], values, data.length * byte_width));
+    } else {
+      // Bit-packed values can't be appended bytewise
+      if (dictionary_ == nullptr) {
+        dictionary_ = delta;
+      } else {
+        ARROW_ASSIGN_OR_RAISE(dictionary_, Concatenate({dictionary_, delta}, pool_));
+      }
+      length_ = dictionary_->length();
+      return Status::OK();
+    }
+
+    length_ += data.length;
+    std::vector<std::shared_ptr<Buffer>> buffers = {nullptr};
+    for (const auto& buffer : buffers_) {
+      buffers.push_back(SliceBuffer(buffer.data, 0, buffer.size));
+    }
+    dictionary_ =
+        MakeArray(ArrayData::Make(type_, length_, std::move(buffers), /*null_count=*/0));
+    return Status::OK();
+  }
+
+ private:
+  struct GrowableBuffer {
+    std::shared_ptr<ResizableBuffer> data;
+    int64_t size = 0;
+  };
+
+  template <typename OffsetType>
+  Status AppendBinary(const ArrayData& delta) {
+    const OffsetType* offsets = delta.GetValues<OffsetType>(1);
+    const int64_t data_length = offsets[delta.length] - offsets[0];
+    GrowableBuffer* out_offsets = &buffers_[0];
+    GrowableBuffer* out_data = &buffers_[1];
+    if (out_data->size + data_length > std::numeric_limits<OffsetType>::max()) {
+      return Status::CapacityError("Unified dictionary values would exceed ",
+                                   std::numeric_limits<OffsetType>::max(), " bytes");
+    }
+    if (out_offsets->size == 0) {
+      const OffsetType first_offset = 0;
+      RETURN_NOT_OK(AppendBytes(out_offsets,
+                                reinterpret_cast<const uint8_t*>(&first_offset),
+                                sizeof(OffsetType)));
+    }
+    const OffsetType shift = static_cast<OffsetType>(out_data->size) - offsets[0];
+    std::vector<OffsetType> shifted_offsets(delta.length);
+    for (int64_t i = 0; i < delta.length; ++i) {
+      shifted_offsets[i] = offsets[i + 1] + shift;
+    }
+    RETURN_NOT_OK(AppendBytes(out_offsets,
+                              reinterpret_cast<const uint8_t*>(shifted_offsets.data()),
+                              delta.length * sizeof(OffsetType)));
+    const uint8_t* values =
+        delta.buffers[2] == nullptr ? nullptr : delta.buffers[2]->data() + offsets[0];
+    return AppendBytes(out_data, values, data_length);
+  }
+
+  Status AppendBytes(GrowableBuffer* buffer, const uint8_t* bytes, int64_t length) {
+    const int64_t new_size = buffer->size + length;
+    if (buffer->data == nullptr || new_size > buffer->data->size()) {
+      // Not resized in place, as previous dictionaries may point into it
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<ResizableBuffer> grown,
+          AllocateResizableBuffer(std::max(new_size, 2 * buffer->size), pool_));
+      if (buffer->size > 0) {
+        std::memcpy(grown->mutable_data(), buffer->data->data(), buffer->size);
+      }
+      buffer->data = std::move(grown);
+    }
+    if (length > 0) {
+      std::memcpy(buffer->data->mutable_data() + buffer->size, bytes, length);
+    }
+    buffer->size = new_size;
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  // The values buffer, or the offsets and data buffers of binary-like values
+  std::vector<GrowableBuffer> buffers_;
+  int64_t length_ = 0;
+  std::shared_ptr<Array> dictionary_;
+};
+
+}  // namespace
+
 namespace internal {
 
 IpcPayloadWriter::~IpcPayloadWriter() {}
@@ -1014,10 +1157,17 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
 
     RETURN_NOT_OK(CheckStarted());
 
-    RETURN_NOT_OK(WriteDictionaries(batch));
+    std::shared_ptr<RecordBatch> unified_batch;
+    if (options_.unify_dictionary_deltas) {
+      ARROW_ASSIGN_OR_RAISE(unified_batch, UnifyDictionaries(batch));
+    }
+    const RecordBatch& batch_to_write = unified_batch ? *unified_batch : batch;
+
+    RETURN_NOT_OK(WriteDictionaries(batch_to_write));
 
     IpcPayload payload;
-    RETURN_NOT_OK(GetRecordBatchPayload(batch, custom_metadata, options_, &payload));
+    RETURN_NOT_OK(
+        GetRecordBatchPayload(batch_to_write, custom_metadata, options_, &payload));
     RETURN_NOT_OK(WritePayload(payload));
     ++stats_.num_record_batches;
 
@@ -1131,6 +1281,129 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  // The running unified dictionary of a top-level dictionary column,
+  // see IpcWriteOptions::unify_dictionary_deltas
+  struct UnifiedDictionary {
+    std::unique_ptr<DictionaryUnifier> unifier;
+    // The unified dictionary as emitted so far, or null if none was yet
+    std::unique_ptr<DictionaryAccumulator> dictionary;
+    // The last input dictionary and its transposition into `dictionary`
+    std::shared_ptr<ArrayData> input_dictionary;
+    std::shared_ptr<Buffer> transpose_map;
+    bool is_identity = false;
+    // Set if the column's dictionaries cannot be unified
+    bool disabled = false;
+  };
+
+  Result<std::shared_ptr<RecordBatch>> UnifyDictionaries(const RecordBatch& batch) {
+    std::vector<std::shared_ptr<Array>> columns = batch.columns();
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      if (columns[i]->type_id() != Type::DICTIONARY) {
+        continue;
+      }
+      auto* unified = &unified_dictionaries_[i];
+      if (unified->disabled) {
+        continue;
+      }
+      const auto& array = checked_cast<const DictionaryArray&>(*columns[i]);
+      const auto& dict_type = checked_cast<const DictionaryType&>(*array.type());
+      if (unified->unifier == nullptr) {
+        auto maybe_unifier =
+            DictionaryUnifier::Make(dict_type.value_type(), options_.memory_pool);
+        if (!maybe_unifier.ok()) {
+          unified->disabled = true;
+          continue;
+        }
+        unified->unifier = maybe_unifier.MoveValueUnsafe();
+      }
+      if (array.dictionary()->null_count() > 0) {
+        // Let WriteDictionaries emit this column's dictionaries from now on
+        unified->disabled = true;
+        continue;
+      }
+      if (unified->input_dictionary != array.dictionary()->data()) {
+        ARROW_ASSIGN_OR_RAISE(const int64_t dictionary_id, mapper_.GetFieldId({i}));
+        RETURN_NOT_OK(UnifyDictionary(dictionary_id, dict_type, *array.dictionary(),
+                                      unified));
+      }
+      if (unified->is_identity) {
+        columns[i] = std::make_shared<DictionaryArray>(
+            array.type(), array.indices(), unified->dictionary->dictionary());
+      } else {
+        const auto* transpose_map =
+            reinterpret_cast<const int32_t*>(unified->transpose_map->data());
+        ARROW_ASSIGN_OR_RAISE(columns[i],
+                              array.Transpose(array.type(),
+                                              unified->dictionary->dictionary(),
+                                              transpose_map, options_.memory_pool));
+      }
+    }
+    return RecordBatch::Make(batch.schema(), batch.num_rows(), std::move(columns));
+  }
+
+  Status UnifyDictionary(int64_t dictionary_id, const DictionaryType& dict_type,
+                         const Array& dictionary, UnifiedDictionary* unified) {
+    const int64_t unified_length =
+        unified->dictionary == nullptr ? 0 : unified->dictionary->length();
+    std::shared_ptr<Array> delta;
+    RETURN_NOT_OK(unified->unifier->Unify(dictionary, &unified->transpose_map));
+    RETURN_NOT_OK(unified->unifier->GetDelta(unified_length, &delta));
+
+    bool is_replacement = false;
+    const Int64Scalar max_index(unified_length + delta->length() - 1);
+    if (delta->length() > 0 &&
+        !::arrow::internal::IntegersCanFit(max_index, *dict_type.index_type()).ok()) {
+      // The unified dictionary outgrew the index type, start over from this one
+      if (is_file_format_) {
+        return Status::Invalid(
+            "Dictionary replacement detected when writing IPC file format: "
+            "the unified dictionary would outgrow the index type ",
+            dict_type.index_type()->ToString());
+      }
+      ARROW_ASSIGN_OR_RAISE(unified->unifier, DictionaryUnifier::Make(
+                                                  dict_type.value_type(),
+                                                  options_.memory_pool));
+      RETURN_NOT_OK(unified->unifier->Unify(dictionary, &unified->transpose_map));
+      RETURN_NOT_OK(unified->unifier->GetDelta(0, &delta));
+      is_replacement = true;
+    }
+
+    const bool is_delta = unified->dictionary != nullptr && !is_replacement;
+    if (!is_delta || delta->length() > 0) {
+      IpcPayload payload;
+      if (is_delta) {
+        RETURN_NOT_OK(GetDictionaryPayload(dictionary_id, /*is_delta=*/true, delta,
+                                           options_, &payload));
+      } else {
+        RETURN_NOT_OK(GetDictionaryPayload(dictionary_id, delta, options_, &payload));
+        unified->dictionary = ::arrow::internal::make_unique<DictionaryAccumulator>(
+            dict_type.value_type(), options_.memory_pool);
+      }
+      RETURN_NOT_OK(unified->dictionary->Append(delta));
+      RETURN_NOT_OK(WritePayload(payload));
+      ++stats_.num_dictionary_batches;
+      if (is_delta) {
+        ++stats_.num_dictionary_deltas;
+      } else if (is_replacement) {
+        ++stats_.num_replaced_dictionaries;
+      }
+      // Let WriteDictionaries skip it by pointer comparison
+      last_dictionaries_[dictionary_id] = unified->dictionary->dictionary();
+    }
+
+    unified->input_dictionary = dictionary.data();
+    const auto* transpose_map =
+        reinterpret_cast<const int32_t*>(unified->transpose_map->data());
+    unified->is_identity = true;
+    for (int64_t j = 0; j < dictionary.length(); ++j) {
+      if (transpose_map[j] != j) {
+        unified->is_identity = false;
+        break;
+      }
+    }
+    return Status::OK();
+  }
+
   Status WritePayload(const IpcPayload& payload) {
     RETURN_NOT_OK(payload_writer_->WritePayload(payload));
     ++stats_.num_messages;
@@ -1150,6 +1423,9 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   // The latter is also why we can't use weak_ptr.
   std::unordered_map<int64_t, std::shared_ptr<Array>> last_dictionaries_;
 
+  // Running unified dictionaries by column index, if unify_dictionary_deltas is set
+  std::unordered_map<int, UnifiedDictionary> unified_dictionaries_;
+
   bool started_ = false;
   IpcWriteOptions options_;
   WriteStats stats_;
@@ -1320,8 +1596,213 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
   std::shared_ptr<const KeyValueMetadata> metadata_;
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
+
+  friend class StatisticsFileWriter;
 };
 
+// The minimum and maximum values of an array, for the types whose values are
+// ordered (left null if the array has no non-null values, has NaN values, or
+// has binary bounds longer than max_size)
+struct MinMaxVisitor {
+  MinMaxVisitor(const Array& array, int64_t max_size)
+      : array(array), max_size(max_size) {}
+
+  template <typename T>
+  using enable_if_ordered_c_type =
+      enable_if_t<is_boolean_type<T>::value || is_integer_type<T>::value ||
+                      is_floating_type<T>::value || is_date_type<T>::value ||
+                      is_time_type<T>::value || is_timestamp_type<T>::value ||
+                      is_duration_type<T>::value,
+                  Status>;
+
+  template <typename T>
+  enable_if_ordered_c_type<T> Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    using CType = typename TypeTraits<T>::CType;
+    const auto& values = checked_cast<const ArrayType&>(array);
+    is_ordered = true;
+    bool found = false;
+    CType min_value{}, max_value{};
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsNull(i)) {
+        continue;
+      }
+      const CType value = values.GetView(i);
+      if (value != value) {
+        // NaN values are not ordered, don't record bounds which they violate
+        return Status::OK();
+      }
+      if (!found || value < min_value) min_value = value;
+      if (!found || value > max_value) max_value = value;
+      found = true;
+    }
+    if (found) {
+      ARROW_ASSIGN_OR_RAISE(min, MakeScalar(array.type(), min_value));
+      ARROW_ASSIGN_OR_RAISE(max, MakeScalar(array.type(), max_value));
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& values = checked_cast<const ArrayType&>(array);
+    is_ordered = true;
+    bool found = false;
+    util::string_view min_value, max_value;
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsNull(i)) {
+        continue;
+      }
+      const util::string_view value = values.GetView(i);
+      if (!found || value < min_value) min_value = value;
+      if (!found || value > max_value) max_value = value;
+      found = true;
+    }
+    if (found && static_cast<int64_t>(min_value.size()) <= max_size &&
+        static_cast<int64_t>(max_value.size()) <= max_size) {
+      ARROW_ASSIGN_OR_RAISE(
+          min, MakeScalar(array.type(), Buffer::FromString(std::string(min_value))));
+      ARROW_ASSIGN_OR_RAISE(
+          max, MakeScalar(array.type(), Buffer::FromString(std::string(max_value))));
+    }
+    return Status::OK();
+  }
+
+  // Half floats are not ordered as their c_type
+  Status Visit(const HalfFloatType&) { return Status::OK(); }
+
+  Status Visit(const DataType&) { return Status::OK(); }
+
+  const Array& array;
+  const int64_t max_size;
+  bool is_ordered = false;
+  std::shared_ptr<Scalar> min, max;
+};
+
+// An IPC file writer which records the statistics of each record batch in the
+// file footer, see IpcWriteOptions::write_batch_statistics
+class StatisticsFileWriter : public IpcFormatWriter {
+ public:
+  StatisticsFileWriter(std::unique_ptr<PayloadFileWriter> payload_writer,
+                       const std::shared_ptr<Schema>& schema,
+                       const IpcWriteOptions& options)
+      : IpcFormatWriter(std::move(payload_writer), schema, options,
+                        /*is_file_format=*/true),
+        file_writer_(checked_cast<PayloadFileWriter*>(payload_writer_.get())) {}
+
+  using IpcFormatWriter::WriteRecordBatch;
+
+  Status WriteRecordBatch(
+      const RecordBatch& batch,
+      const std::shared_ptr<const KeyValueMetadata>& custom_metadata) override {
+    RETURN_NOT_OK(IpcFormatWriter::WriteRecordBatch(batch, custom_metadata));
+    if (columns_.empty()) {
+      RETURN_NOT_OK(InitColumns());
+    }
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      const auto& array = *batch.column(i);
+      auto* column = &columns_[i];
+      RETURN_NOT_OK(column->null_counts.Append(array.null_count()));
+      if (column->mins == nullptr) {
+        continue;
+      }
+      MinMaxVisitor visitor(array, options_.max_batch_statistics_size);
+      RETURN_NOT_OK(VisitTypeInline(*array.type(), &visitor));
+      if (visitor.min != nullptr) {
+        RETURN_NOT_OK(column->mins->AppendScalar(*visitor.min));
+        RETURN_NOT_OK(column->maxs->AppendScalar(*visitor.max));
+      } else {
+        RETURN_NOT_OK(column->mins->AppendNull());
+        RETURN_NOT_OK(column->maxs->AppendNull());
+      }
+    }
+    ++num_batches_;
+    return Status::OK();
+  }
+
+  Status Close() override {
+    RETURN_NOT_OK(CheckStarted());
+    if (columns_.empty()) {
+      RETURN_NOT_OK(InitColumns());
+    }
+
+    // Serialize the statistics as a record batch with one row per record
+    // batch, and a struct column per column of the schema
+    FieldVector fields;
+    ArrayVector arrays;
+    for (int i = 0; i < schema_.num_fields(); ++i) {
+      auto* column = &columns_[i];
+      ArrayVector children(1);
+      std::vector<std::string> names = {"null_count"};
+      RETURN_NOT_OK(column->null_counts.Finish(&children[0]));
+      if (column->mins != nullptr) {
+        children.resize(3);
+        names.insert(names.end(), {"min", "max"});
+        RETURN_NOT_OK(column->mins->Finish(&children[1]));
+        RETURN_NOT_OK(column->maxs->Finish(&children[2]));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto array, StructArray::Make(children, names));
+      fields.push_back(field(schema_.field(i)->name(), array->type()));
+      arrays.push_back(std::move(array));
+    }
+    auto statistics =
+        RecordBatch::Make(::arrow::schema(std::move(fields)), num_batches_, arrays);
+
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create(
+                                         1024, options_.memory_pool));
+    ARROW_ASSIGN_OR_RAISE(auto writer,
+                          MakeStreamWriter(sink, statistics->schema(), options_));
+    RETURN_NOT_OK(writer->WriteRecordBatch(*statistics));
+    RETURN_NOT_OK(writer->Close());
+    ARROW_ASSIGN_OR_RAISE(auto buffer, sink->Finish());
+
+    auto metadata = file_writer_->metadata_ == nullptr
+                        ? std::make_shared<KeyValueMetadata>()
+                        : file_writer_->metadata_->Copy();
+    RETURN_NOT_OK(metadata->Set(kBatchStatisticsKey,
+                                arrow::util::base64_encode(util::string_view(*buffer))));
+    file_writer_->metadata_ = std::move(metadata);
+    return IpcFormatWriter::Close();
+  }
+
+ private:
+  struct ColumnStatistics {
+    Int64Builder null_counts;
+    std::unique_ptr<ArrayBuilder> mins, maxs;
+  };
+
+  Status InitColumns() {
+    columns_.resize(schema_.num_fields());
+    for (int i = 0; i < schema_.num_fields(); ++i) {
+      const auto& type = schema_.field(i)->type();
+      ARROW_ASSIGN_OR_RAISE(auto empty, MakeArrayOfNull(type, 0, options_.memory_pool));
+      MinMaxVisitor visitor(*empty, options_.max_batch_statistics_size);
+      RETURN_NOT_OK(VisitTypeInline(*type, &visitor));
+      if (visitor.is_ordered) {
+        RETURN_NOT_OK(MakeBuilder(options_.memory_pool, type, &columns_[i].mins));
+        RETURN_NOT_OK(MakeBuilder(options_.memory_pool, type, &columns_[i].maxs));
+      }
+    }
+    return Status::OK();
+  }
+
+  PayloadFileWriter* file_writer_;
+  std::vector<ColumnStatistics> columns_;
+  int64_t num_batches_ = 0;
+};
+
+Result<std::shared_ptr<RecordBatchWriter>> MakeFileFormatWriter(
+    std::unique_ptr<PayloadFileWriter> payload_writer,
+    const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options) {
+  if (options.write_batch_statistics) {
+    return std::make_shared<StatisticsFileWriter>(std::move(payload_writer), schema,
+                                                  options);
+  }
+  return std::make_shared<IpcFormatWriter>(std::move(payload_writer), schema, options,
+                                           /*is_file_format=*/true);
+}
+
 }  // namespace internal
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
@@ -1351,20 +1832,20 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
-  return std::make_shared<internal::IpcFormatWriter>(
+  return internal::MakeFileFormatWriter(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(options, schema,
                                                                   metadata, sink),
-      schema, options, /*is_file_format=*/true);
+      schema, options);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
-  return std::make_shared<internal::IpcFormatWriter>(
+  return internal::MakeFileFormatWriter(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(
           options, schema, metadata, std::move(sink)),
-      schema, options, /*is_file_format=*/true);
+      schema, options);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> NewFileWriter(
@@ -19,3 +19,4 @@
 
 #include "arrow/json/options.h"
 #include "arrow/json/reader.h"
+#include "arrow/json/writer.h"
@@ -20,7 +20,9 @@
 #include <cstdint>
 #include <memory>
 
+#include "arrow/io/interfaces.h"
 #include "arrow/json/type_fwd.h"
+#include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -70,5 +72,28 @@ struct ARROW_EXPORT ReadOptions {
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  // Writer options
+
+  /// \brief Maximum number of rows formatted at a time
+  ///
+  /// The JSON writer formats and writes data in batches of N rows.
+  /// This number can impact performance.
+  int32_t batch_size = 1024;
+
+  /// Whether to use the global CPU thread pool to format several batches
+  /// of rows in parallel (ignored when writing from a task of that pool)
+  bool use_threads = true;
+
+  /// \brief IO context for writing.
+  io::IOContext io_context;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+
+  /// \brief Test that all set options are valid
+  Status Validate() const;
+};
+
 }  // namespace json
 }  // namespace arrow
@@ -0,0 +1,821 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/writer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visit_data_inline.h"
+#include "arrow/visit_type_inline.h"
+
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+#include <xsimd/xsimd.hpp>
+#endif
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace json {
+// The algorithm used here follows the CSV writer's: RecordBatches/Tables are broken
+// into slices which are converted independently.  A slice is converted by first
+// formatting each column to determine the length of the JSON text of each of its
+// values.  This gives the precise length of each row, so that the JSON text of the
+// slice is written to a single allocation, column by column.  Numbers and temporal
+// values are formatted once in the first pass (through the same formatters as the
+// casts to string), strings are only scanned for characters which need escaping.
+//
+// Slices don't depend on each other, so several of them are converted in parallel
+// (unless WriteOptions::use_threads is false) and then written in order.
+
+namespace {
+
+struct SliceIteratorFunctor {
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    if (current_offset < batch->num_rows()) {
+      std::shared_ptr<RecordBatch> next = batch->Slice(current_offset, slice_size);
+      current_offset += slice_size;
+      return next;
+    }
+    return IterationTraits<std::shared_ptr<RecordBatch>>::End();
+  }
+  const RecordBatch* const batch;
+  const int64_t slice_size;
+  int64_t current_offset;
+};
+
+RecordBatchIterator RecordBatchSliceIterator(const RecordBatch& batch,
+                                             int64_t slice_size) {
+  SliceIteratorFunctor functor = {&batch, slice_size, /*offset=*/static_cast<int64_t>(0)};
+  return RecordBatchIterator(std::move(functor));
+}
+
+constexpr char kNull[] = "null";
+constexpr int64_t kNullLength = 4;
+
+// Quote pair character length.
+constexpr int64_t kQuoteCount = 2;
+
+char* WriteNull(char* out) {
+  memcpy(out, kNull, kNullLength);
+  return out + kNullLength;
+}
+
+// Whether c needs to be escaped in a JSON string
+inline bool NeedsEscaping(uint8_t c) { return c == '"' || c == '\\' || c < 0x20; }
+
+// Returns true if there's no character which needs escaping in the data
+bool NoEscapingNeeded(const uint8_t* data, int64_t size) {
+  int64_t offset = 0;
+#if defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
+  using simd_batch = xsimd::make_sized_batch_t<uint8_t, 16>;
+  const simd_batch control_chars_end(static_cast<uint8_t>(0x20));
+  while ((offset + 16) <= size) {
+    const auto v = simd_batch::load_unaligned(data + offset);
+    if (xsimd::any((v == '"') | (v == '\\') | (v < control_chars_end))) {
+      return false;
+    }
+    offset += 16;
+  }
+#endif
+  for (; offset < size; ++offset) {
+    if (NeedsEscaping(data[offset])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The number of characters s takes once escaped.
+int64_t EscapedLength(util::string_view s) {
+  int64_t length = static_cast<int64_t>(s.length());
+  for (const char c : s) {
+    const auto u = static_cast<uint8_t>(c);
+    if (NeedsEscaping(u)) {
+      // \uXXXX for control characters without a short escape sequence
+      length += (u == '"' || u == '\\' || u == '\b' || u == '\f' || u == '\n' ||
+                 u == '\r' || u == '\t')
+                    ? 1
+                    : 5;
+    }
+  }
+  return length;
+}
+
+// Copies the contents of s to out escaping any necessary characters.
+// Returns the position next to last copied character.
+char* Escape(util::string_view s, char* out) {
+  static constexpr char kHexDigits[] = "0123456789abcdef";
+  for (const char c : s) {
+    const auto u = static_cast<uint8_t>(c);
+    if (!NeedsEscaping(u)) {
+      *out++ = c;
+      continue;
+    }
+    *out++ = '\\';
+    switch (c) {
+      case '"':
+      case '\\':
+        *out++ = c;
+        break;
+      case '\b':
+        *out++ = 'b';
+        break;
+      case '\f':
+        *out++ = 'f';
+        break;
+      case '\n':
+        *out++ = 'n';
+        break;
+      case '\r':
+        *out++ = 'r';
+        break;
+      case '\t':
+        *out++ = 't';
+        break;
+      default:
+        memcpy(out, "u00", 3);
+        out[3] = kHexDigits[u >> 4];
+        out[4] = kHexDigits[u & 0xF];
+        out += 5;
+        break;
+    }
+  }
+  return out;
+}
+
+// The length of the base64 encoding of size bytes, including padding.
+int64_t Base64Length(int64_t size) { return (size + 2) / 3 * 4; }
+
+// Interface for formatting the values of an array as JSON text.
+// The intended usage is to call Prepare with an array, after which length(i)
+// is the length of the JSON text of the i-th value, and Write(i) writes it.
+// The array must outlive the formatter.
+class ValueFormatter {
+ public:
+  virtual ~ValueFormatter() = default;
+
+  Status Prepare(const Array& data) {
+    lengths_.resize(data.length());
+    return DoPrepare(data);
+  }
+
+  int64_t length(int64_t i) const { return lengths_[i]; }
+
+  // Writes the JSON text of the i-th value to out.
+  // Returns the position next to last written character.
+  virtual char* Write(int64_t i, char* out) const = 0;
+
+ protected:
+  virtual Status DoPrepare(const Array& data) = 0;
+
+  std::vector<int64_t> lengths_;
+};
+
+Result<std::unique_ptr<ValueFormatter>> MakeFormatter(const DataType& type);
+
+class NullFormatter : public ValueFormatter {
+ public:
+  char* Write(int64_t, char* out) const override { return WriteNull(out); }
+
+ protected:
+  Status DoPrepare(const Array&) override {
+    std::fill(lengths_.begin(), lengths_.end(), kNullLength);
+    return Status::OK();
+  }
+};
+
+inline bool IsFinite(float value) { return std::isfinite(value); }
+inline bool IsFinite(double value) { return std::isfinite(value); }
+template <typename T>
+bool IsFinite(const T&) {
+  return true;
+}
+
+// Formatter for the types whose JSON text comes from a StringFormatter (or for
+// decimals, FormatValue), optionally quoted.  The JSON text of all values is
+// formatted upfront, as it determines their lengths.
+template <typename T>
+class FormattedValueFormatter : public ValueFormatter {
+ public:
+  FormattedValueFormatter(const DataType& type, bool quoted, std::string suffix = "")
+      : type_(type), quoted_(quoted), suffix_(std::move(suffix)) {}
+
+  char* Write(int64_t i, char* out) const override {
+    const auto length = lengths_[i];
+    memcpy(out, formatted_.data() + offsets_[i], length);
+    return out + length;
+  }
+
+ protected:
+  Status DoPrepare(const Array& data) override {
+    offsets_.resize(data.length());
+    formatted_.clear();
+    FormatValues(data);
+    return Status::OK();
+  }
+
+ private:
+  template <typename U = T>
+  enable_if_t<!is_decimal_type<U>::value> FormatValues(const Array& data) {
+    internal::StringFormatter<T> formatter(&type_);
+    int64_t i = 0;
+    VisitArraySpanInline<T>(
+        *data.data(),
+        [&](typename internal::StringFormatter<T>::value_type value) {
+          if (!IsFinite(value)) {
+            // Infinities and NaN aren't valid JSON numbers
+            AppendNull(i++);
+            return;
+          }
+          formatter(value, [&](util::string_view s) { AppendFormatted(s, i++); });
+        },
+        [&]() { AppendNull(i++); });
+  }
+
+  template <typename U = T>
+  enable_if_decimal<U> FormatValues(const Array& data) {
+    const auto& decimals = checked_cast<const typename TypeTraits<T>::ArrayType&>(data);
+    for (int64_t i = 0; i < data.length(); ++i) {
+      if (decimals.IsNull(i)) {
+        AppendNull(i);
+      } else {
+        AppendFormatted(decimals.FormatValue(i), i);
+      }
+    }
+  }
+
+  void AppendFormatted(util::string_view s, int64_t i) {
+    offsets_[i] = static_cast<int64_t>(formatted_.size());
+    if (quoted_) formatted_.push_back('"');
+    formatted_.append(s.data(), s.size());
+    formatted_.append(suffix_);
+    if (quoted_) formatted_.push_back('"');
+    lengths_[i] = static_cast<int64_t>(formatted_.size()) - offsets_[i];
+  }
+
+  void AppendNull(int64_t i) {
+    offsets_[i] = static_cast<int64_t>(formatted_.size());
+    formatted_.append(kNull, kNullLength);
+    lengths_[i] = kNullLength;
+  }
+
+  const DataType& type_;
+  const bool quoted_;
+  const std::string suffix_;
+  std::vector<int64_t> offsets_;
+  std::string formatted_;
+};
+
+// Strings need special handling to ensure they are escaped properly.  The JSON
+// text of the values is written straight from the array, unless they need escaping.
+template <typename ArrayType>
+class StringFormatter : public ValueFormatter {
+ public:
+  char* Write(int64_t i, char* out) const override {
+    if (array_->IsNull(i)) {
+      return WriteNull(out);
+    }
+    const util::string_view s = array_->GetView(i);
+    *out++ = '"';
+    if (needs_escaping_) {
+      out = Escape(s, out);
+    } else {
+      memcpy(out, s.data(), s.length());
+      out += s.length();
+    }
+    *out++ = '"';
+    return out;
+  }
+
+ protected:
+  Status DoPrepare(const Array& data) override {
+    array_ = &checked_cast<const ArrayType&>(data);
+    needs_escaping_ = !NoEscapingNeeded(ValuesData(*array_), ValuesSize(*array_));
+    for (int64_t i = 0; i < array_->length(); ++i) {
+      if (array_->IsNull(i)) {
+        lengths_[i] = kNullLength;
+      } else if (needs_escaping_) {
+        lengths_[i] = EscapedLength(array_->GetView(i)) + kQuoteCount;
+      } else {
+        lengths_[i] = static_cast<int64_t>(array_->GetView(i).length()) + kQuoteCount;
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  // The values of the array, scanned as a single big string
+  static const uint8_t* ValuesData(const ArrayType& array) {
+    return array.raw_data() + array.value_offset(0);
+  }
+  static int64_t ValuesSize(const ArrayType& array) {
+    return array.length() == 0 ? 0 : array.total_values_length();
+  }
+
+  const ArrayType* array_ = NULLPTR;
+  bool needs_escaping_ = false;
+};
+
+// Binary values needn't be valid UTF-8, so they are written as base64-encoded
+// strings (which never need escaping).
+template <typename ArrayType>
+class Base64Formatter : public ValueFormatter {
+ public:
+  char* Write(int64_t i, char* out) const override {
+    if (array_->IsNull(i)) {
+      return WriteNull(out);
+    }
+    const std::string encoded = arrow::util::base64_encode(array_->GetView(i));
+    *out++ = '"';
+    memcpy(out, encoded.data(), encoded.length());
+    out += encoded.length();
+    *out++ = '"';
+    return out;
+  }
+
+ protected:
+  Status DoPrepare(const Array& data) override {
+    array_ = &checked_cast<const ArrayType&>(data);
+    for (int64_t i = 0; i < array_->length(); ++i) {
+      if (array_->IsNull(i)) {
+        lengths_[i] = kNullLength;
+      } else {
+        lengths_[i] =
+            Base64Length(static_cast<int64_t>(array_->GetView(i).length())) + kQuoteCount;
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  const ArrayType* array_ = NULLPTR;
+};
+
+// Lists are written as JSON arrays of their values
+template <typename ArrayType>
+class ListFormatter : public ValueFormatter {
+ public:
+  explicit ListFormatter(std::unique_ptr<ValueFormatter> value_formatter)
+      : value_formatter_(std::move(value_formatter)) {}
+
+  char* Write(int64_t i, char* out) const override {
+    if (array_->IsNull(i)) {
+      return WriteNull(out);
+    }
+    *out++ = '[';
+    const int64_t begin = array_->value_offset(i) - values_offset_;
+    const int64_t end = begin + array_->value_length(i);
+    for (int64_t j = begin; j < end; ++j) {
+      if (j != begin) *out++ = ',';
+      out = value_formatter_->Write(j, out);
+    }
+    *out++ = ']';
+    return out;
+  }
+
+ protected:
+  Status DoPrepare(const Array& data) override {
+    array_ = &checked_cast<const ArrayType&>(data);
+    const int64_t length = array_->length();
+    values_offset_ = length == 0 ? 0 : array_->value_offset(0);
+    const int64_t values_end =
+        length == 0 ? 0
+                    : array_->value_offset(length - 1) + array_->value_length(length - 1);
+    values_ = array_->values()->Slice(values_offset_, values_end - values_offset_);
+    RETURN_NOT_OK(value_formatter_->Prepare(*values_));
+
+    for (int64_t i = 0; i < length; ++i) {
+      if (array_->IsNull(i)) {
+        lengths_[i] = kNullLength;
+        continue;
+      }
+      const int64_t begin = array_->value_offset(i) - values_offset_;
+      const int64_t end = begin + array_->value_length(i);
+      // Brackets and separating commas
+      int64_t row_length = 2 + std::max<int64_t>(end - begin - 1, 0);
+      for (int64_t j = begin; j < end; ++j) {
+        row_length += value_formatter_->length(j);
+      }
+      lengths_[i] = row_length;
+    }
+    return Status::OK();
+  }
+
+ private:
+  const ArrayType* array_ = NULLPTR;
+  std::shared_ptr<Array> values_;
+  int64_t values_offset_ = 0;
+  std::unique_ptr<ValueFormatter> value_formatter_;
+};
+
+// Structs are written as JSON objects with a member per field
+class StructFormatter : public ValueFormatter {
+ public:
+  StructFormatter(std::vector<std::string> keys,
+                  std::vector<std::unique_ptr<ValueFormatter>> field_formatters)
+      : keys_(std::move(keys)), field_formatters_(std::move(field_formatters)) {}
+
+  char* Write(int64_t i, char* out) const override {
+    if (array_->IsNull(i)) {
+      return WriteNull(out);
+    }
+    *out++ = '{';
+    for (size_t k = 0; k < field_formatters_.size(); ++k) {
+      if (k != 0) *out++ = ',';
+      memcpy(out, keys_[k].data(), keys_[k].size());
+      out = field_formatters_[k]->Write(i, out + keys_[k].size());
+    }
+    *out++ = '}';
+    return out;
+  }
+
+ protected:
+  Status DoPrepare(const Array& data) override {
+    array_ = &checked_cast<const StructArray&>(data);
+    fields_.resize(field_formatters_.size());
+    // Braces and separating commas
+    int64_t keys_length =
+        2 + std::max<int64_t>(static_cast<int64_t>(field_formatters_.size()) - 1, 0);
+    for (size_t k = 0; k < field_formatters_.size(); ++k) {
+      fields_[k] = array_->field(static_cast<int>(k));
+      RETURN_NOT_OK(field_formatters_[k]->Prepare(*fields_[k]));
+      keys_length += static_cast<int64_t>(keys_[k].size());
+    }
+    for (int64_t i = 0; i < array_->length(); ++i) {
+      if (array_->IsNull(i)) {
+        lengths_[i] = kNullLength;
+        continue;
+      }
+      int64_t row_length = keys_length;
+      for (const auto& field_formatter : field_formatters_) {
+        row_length += field_formatter->length(i);
+      }
+      lengths_[i] = row_length;
+    }
+    return Status::OK();
+  }
+
+ private:
+  const StructArray* array_ = NULLPTR;
+  // The "<escaped name>": prefix of each field
+  const std::vector<std::string> keys_;
+  ArrayVector fields_;
+  std::vector<std::unique_ptr<ValueFormatter>> field_formatters_;
+};
+
+// Dictionary values are written as their decoded value.  The dictionary is
+// formatted once, and its JSON text is copied for each index referencing it.
+class DictionaryFormatter : public ValueFormatter {
+ public:
+  explicit DictionaryFormatter(std::unique_ptr<ValueFormatter> dictionary_formatter)
+      : dictionary_formatter_(std::move(dictionary_formatter)) {}
+
+  char* Write(int64_t i, char* out) const override {
+    if (array_->IsNull(i)) {
+      return WriteNull(out);
+    }
+    return dictionary_formatter_->Write(array_->GetValueIndex(i), out);
+  }
+
+ protected:
+  Status DoPrepare(const Array& data) override {
+    array_ = &checked_cast<const DictionaryArray&>(data);
+    dictionary_ = array_->dictionary();
+    RETURN_NOT_OK(dictionary_formatter_->Prepare(*dictionary_));
+    for (int64_t i = 0; i < array_->length(); ++i) {
+      lengths_[i] = array_->IsNull(i)
+                        ? kNullLength
+                        : dictionary_formatter_->length(array_->GetValueIndex(i));
+    }
+    return Status::OK();
+  }
+
+ private:
+  const DictionaryArray* array_ = NULLPTR;
+  std::shared_ptr<Array> dictionary_;
+  std::unique_ptr<ValueFormatter> dictionary_formatter_;
+};
+
+// The "<escaped name>": prefix of a JSON object member
+std::string MemberKey(const std::string& name) {
+  std::string key(EscapedLength(name) + kQuoteCount + 1, '\0');
+  char* out = &key[0];
+  *out++ = '"';
+  out = Escape(name, out);
+  *out++ = '"';
+  *out++ = ':';
+  DCHECK_EQ(out, key.data() + key.size());
+  return key;
+}
+
+struct FormatterFactory {
+  Status Visit(const NullType&) {
+    formatter = ::arrow::internal::make_unique<NullFormatter>();
+    return Status::OK();
+  }
+
+  // Written as JSON numbers or literals
+  template <typename TypeClass>
+  enable_if_t<is_boolean_type<TypeClass>::value || is_integer_type<TypeClass>::value ||
+                  is_physical_floating_type<TypeClass>::value ||
+                  is_duration_type<TypeClass>::value,
+              Status>
+  Visit(const TypeClass& type) {
+    formatter = ::arrow::internal::make_unique<FormattedValueFormatter<TypeClass>>(
+        type, /*quoted=*/false);
+    return Status::OK();
+  }
+
+  // Written as JSON strings
+  template <typename TypeClass>
+  enable_if_t<is_decimal_type<TypeClass>::value || is_date_type<TypeClass>::value ||
+                  is_time_type<TypeClass>::value || is_interval_type<TypeClass>::value,
+              Status>
+  Visit(const TypeClass& type) {
+    formatter = ::arrow::internal::make_unique<FormattedValueFormatter<TypeClass>>(
+        type, /*quoted=*/true);
+    return Status::OK();
+  }
+
+  Status Visit(const TimestampType& type) {
+    formatter = ::arrow::internal::make_unique<FormattedValueFormatter<TimestampType>>(
+        type, /*quoted=*/true, type.timezone().empty() ? "" : "Z");
+    return Status::OK();
+  }
+
+  template <typename TypeClass>
+  enable_if_string<TypeClass, Status> Visit(const TypeClass&) {
+    formatter = ::arrow::internal::make_unique<
+        StringFormatter<typename TypeTraits<TypeClass>::ArrayType>>();
+    return Status::OK();
+  }
+
+  template <typename TypeClass>
+  enable_if_t<is_binary_type<TypeClass>::value ||
+                  std::is_same<FixedSizeBinaryType, TypeClass>::value,
+              Status>
+  Visit(const TypeClass&) {
+    formatter = ::arrow::internal::make_unique<
+        Base64Formatter<typename TypeTraits<TypeClass>::ArrayType>>();
+    return Status::OK();
+  }
+
+  template <typename TypeClass>
+  enable_if_t<is_var_length_list_type<TypeClass>::value ||
+                  is_fixed_size_list_type<TypeClass>::value,
+              Status>
+  Visit(const TypeClass& type) {
+    ARROW_ASSIGN_OR_RAISE(auto value_formatter, MakeFormatter(*type.value_type()));
+    formatter = ::arrow::internal::make_unique<
+        ListFormatter<typename TypeTraits<TypeClass>::ArrayType>>(
+        std::move(value_formatter));
+    return Status::OK();
+  }
+
+  Status Visit(const StructType& type) {
+    std::vector<std::string> keys;
+    std::vector<std::unique_ptr<ValueFormatter>> field_formatters;
+    for (const auto& field : type.fields()) {
+      keys.push_back(MemberKey(field->name()));
+      ARROW_ASSIGN_OR_RAISE(auto field_formatter, MakeFormatter(*field->type()));
+      field_formatters.push_back(std::move(field_formatter));
+    }
+    formatter = ::arrow::internal::make_unique<StructFormatter>(
+        std::move(keys), std::move(field_formatters));
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    ARROW_ASSIGN_OR_RAISE(auto dictionary_formatter, MakeFormatter(*type.value_type()));
+    formatter = ::arrow::internal::make_unique<DictionaryFormatter>(
+        std::move(dictionary_formatter));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Unsupported Type: ", type.ToString());
+  }
+
+  std::unique_ptr<ValueFormatter> formatter;
+};
+
+Result<std::unique_ptr<ValueFormatter>> MakeFormatter(const DataType& type) {
+  FormatterFactory factory;
+  RETURN_NOT_OK(VisitTypeInline(type, &factory));
+  return std::move(factory.formatter);
+}
+
+class JSONWriterImpl : public ipc::RecordBatchWriter {
+ public:
+  static Result<std::shared_ptr<JSONWriterImpl>> Make(
+      io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
+      std::shared_ptr<Schema> schema, const WriteOptions& options) {
+    RETURN_NOT_OK(options.Validate());
+    // Check that all types are supported upfront
+    std::vector<std::string> keys(schema->num_fields());
+    for (int col = 0; col < schema->num_fields(); col++) {
+      RETURN_NOT_OK(MakeFormatter(*schema->field(col)->type()));
+      keys[col] = MemberKey(schema->field(col)->name());
+    }
+    return std::make_shared<JSONWriterImpl>(sink, std::move(owned_sink),
+                                            std::move(schema), std::move(keys), options);
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    return WriteSlices(RecordBatchSliceIterator(batch, options_.batch_size));
+  }
+
+  Status WriteTable(const Table& table, int64_t max_chunksize) override {
+    auto reader = std::make_shared<TableBatchReader>(table);
+    reader->set_chunksize(max_chunksize > 0 ? max_chunksize : options_.batch_size);
+    return WriteSlices(MakeFunctionIterator(
+        [reader]() -> Result<std::shared_ptr<RecordBatch>> { return reader->Next(); }));
+  }
+
+  Status Close() override { return Status::OK(); }
+
+  ipc::WriteStats stats() const override { return stats_; }
+
+  JSONWriterImpl(io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
+                 std::shared_ptr<Schema> schema, std::vector<std::string> keys,
+                 const WriteOptions& options)
+      : sink_(sink),
+        owned_sink_(std::move(owned_sink)),
+        schema_(std::move(schema)),
+        keys_(std::move(keys)),
+        options_(options) {}
+
+ private:
+  // Converts the slices, several at a time in parallel, and writes them in order
+  Status WriteSlices(RecordBatchIterator slices) {
+    auto* cpu_executor = ::arrow::internal::GetCpuThreadPool();
+    // A task of the CPU thread pool converts its slices serially, rather than block
+    // its thread waiting for other tasks of the pool
+    const bool use_threads = options_.use_threads && !cpu_executor->OwnsThisThread();
+    const int max_slices_in_flight =
+        use_threads ? std::max(1, cpu_executor->GetCapacity()) : 1;
+    RecordBatchVector batches;
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    bool finished = false;
+    while (!finished) {
+      batches.clear();
+      while (static_cast<int>(batches.size()) < max_slices_in_flight) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, slices.Next());
+        if (IsIterationEnd(batch)) {
+          finished = true;
+          break;
+        }
+        if (batch->num_rows() > 0) {
+          batches.push_back(std::move(batch));
+        }
+      }
+
+      buffers.resize(batches.size());
+      RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+          use_threads && batches.size() > 1, static_cast<int>(batches.size()),
+          [&](int i) { return TranslateMinimalBatch(*batches[i]).Value(&buffers[i]); }));
+      for (const auto& buffer : buffers) {
+        RETURN_NOT_OK(sink_->Write(buffer));
+        stats_.num_record_batches++;
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Buffer>> TranslateMinimalBatch(const RecordBatch& batch) const {
+    const int num_columns = batch.num_columns();
+    std::vector<std::unique_ptr<ValueFormatter>> formatters(num_columns);
+    for (int col = 0; col < num_columns; col++) {
+      ARROW_ASSIGN_OR_RAISE(formatters[col], MakeFormatter(*batch.column(col)->type()));
+      RETURN_NOT_OK(formatters[col]->Prepare(*batch.column(col)));
+    }
+
+    // Calculate the offset of each row: its members, the separating commas,
+    // the braces and the eol
+    int64_t fixed_row_length = 2 + std::max(num_columns - 1, 0) + 1;
+    for (const auto& key : keys_) {
+      fixed_row_length += static_cast<int64_t>(key.size());
+    }
+    std::vector<int64_t> offsets(batch.num_rows() + 1);
+    offsets[0] = 0;
+    for (int64_t row = 0; row < batch.num_rows(); ++row) {
+      int64_t row_length = fixed_row_length;
+      for (const auto& formatter : formatters) {
+        row_length += formatter->length(row);
+      }
+      offsets[row + 1] = offsets[row] + row_length;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(offsets.back(),
+                                                      options_.io_context.pool()));
+    char* output = reinterpret_cast<char*>(buffer->mutable_data());
+
+    // Use the offsets to populate contents, column by column.  The position
+    // where each row continues is tracked in rows.
+    std::vector<char*> rows(batch.num_rows());
+    for (int64_t row = 0; row < batch.num_rows(); ++row) {
+      rows[row] = output + offsets[row];
+    }
+    for (int col = 0; col < num_columns; col++) {
+      const std::string& key = keys_[col];
+      const ValueFormatter& formatter = *formatters[col];
+      for (int64_t row = 0; row < batch.num_rows(); ++row) {
+        char* out = rows[row];
+        *out++ = col == 0 ? '{' : ',';
+        memcpy(out, key.data(), key.size());
+        rows[row] = formatter.Write(row, out + key.size());
+      }
+    }
+    for (int64_t row = 0; row < batch.num_rows(); ++row) {
+      char* out = rows[row];
+      if (num_columns == 0) *out++ = '{';
+      *out++ = '}';
+      *out++ = '\n';
+      DCHECK_EQ(out - output, offsets[row + 1]);
+    }
+    return std::move(buffer);
+  }
+
+  io::OutputStream* sink_;
+  std::shared_ptr<io::OutputStream> owned_sink_;
+  const std::shared_ptr<Schema> schema_;
+  // The "<escaped name>": prefix of each column
+  const std::vector<std::string> keys_;
+  const WriteOptions options_;
+  ipc::WriteStats stats_;
+};
+
+}  // namespace
+
+Status WriteJSON(const Table& table, const WriteOptions& options,
+                 arrow::io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeJSONWriter(output, table.schema(), options));
+  RETURN_NOT_OK(writer->WriteTable(table));
+  return writer->Close();
+}
+
+Status WriteJSON(const RecordBatch& batch, const WriteOptions& options,
+                 arrow::io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeJSONWriter(output, batch.schema(), options));
+  RETURN_NOT_OK(writer->WriteRecordBatch(batch));
+  return writer->Close();
+}
+
+Status WriteJSON(const std::shared_ptr<RecordBatchReader>& reader,
+                 const WriteOptions& options, arrow::io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeJSONWriter(output, reader->schema(), options));
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(batch, reader->Next());
+    if (batch == nullptr) break;
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  return writer->Close();
+}
+
+Result<std::shared_ptr<ipc::RecordBatchWriter>> MakeJSONWriter(
+    std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
+    const WriteOptions& options) {
+  return JSONWriterImpl::Make(sink.get(), sink, schema, options);
+}
+
+Result<std::shared_ptr<ipc::RecordBatchWriter>> MakeJSONWriter(
+    io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+    const WriteOptions& options) {
+  return JSONWriterImpl::Make(sink, nullptr, schema, options);
+}
+
+}  // namespace json
+}  // namespace arrow
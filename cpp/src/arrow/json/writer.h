@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/type_fwd.h"
+#include "arrow/json/options.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+
+namespace arrow {
+namespace json {
+
+// Functionality for converting Arrow data to newline-delimited JSON text.
+// Each row is written as a JSON object on its own line, with a member per column.
+// It applies to following formatting rules:
+//  - Nulls (and non-finite floating point values) are written as null.
+//  - Integer, floating point and duration values are written as JSON numbers,
+//  booleans as true or false.
+//  - String values are written as JSON strings, escaping quotes, backslashes and
+//  control characters. Other bytes are copied as-is.
+//  - Binary and fixed size binary values, which needn't be valid UTF-8, are
+//  written as JSON strings of their base64 encoding.
+//  - Decimal, date, time, timestamp and interval values are written as JSON strings
+//  in the same representation as casting them to strings.  Timestamps with a time
+//  zone are suffixed with "Z", since their values are in UTC.
+//  - List values are written as JSON arrays, struct values as JSON objects, and
+//  dictionary values as their decoded value.
+
+/// \defgroup json-write-functions High-level functions for writing JSON files
+/// @{
+
+/// \brief Convert table to newline-delimited JSON and write the result to output.
+/// Experimental
+ARROW_EXPORT Status WriteJSON(const Table& table, const WriteOptions& options,
+                              arrow::io::OutputStream* output);
+/// \brief Convert batch to newline-delimited JSON and write the result to output.
+/// Experimental
+ARROW_EXPORT Status WriteJSON(const RecordBatch& batch, const WriteOptions& options,
+                              arrow::io::OutputStream* output);
+/// \brief Convert batches read through a RecordBatchReader
+/// to newline-delimited JSON and write the results to output.
+/// Experimental
+ARROW_EXPORT Status WriteJSON(const std::shared_ptr<RecordBatchReader>& reader,
+                              const WriteOptions& options,
+                              arrow::io::OutputStream* output);
+
+/// @}
+
+/// \defgroup json-writer-factories Functions for creating an incremental JSON writer
+/// @{
+
+/// \brief Create a new newline-delimited JSON writer. User is responsible for
+/// closing the actual OutputStream.
+///
+/// \param[in] sink output stream to write to
+/// \param[in] schema the schema of the record batches to be written
+/// \param[in] options options for serialization
+/// \return Result<std::shared_ptr<RecordBatchWriter>>
+ARROW_EXPORT
+Result<std::shared_ptr<ipc::RecordBatchWriter>> MakeJSONWriter(
+    std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
+    const WriteOptions& options = WriteOptions::Defaults());
+
+/// \brief Create a new newline-delimited JSON writer.
+///
+/// \param[in] sink output stream to write to (does not take ownership)
+/// \param[in] schema the schema of the record batches to be written
+/// \param[in] options options for serialization
+/// \return Result<std::shared_ptr<RecordBatchWriter>>
+ARROW_EXPORT
+Result<std::shared_ptr<ipc::RecordBatchWriter>> MakeJSONWriter(
+    io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+    const WriteOptions& options = WriteOptions::Defaults());
+
+/// @}
+
+}  // namespace json
+}  // namespace arrow
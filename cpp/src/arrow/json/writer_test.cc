@@ -0,0 +1,307 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/builder_binary.h"
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/json/reader.h"
+#include "arrow/json/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace json {
+
+Result<std::string> ToJsonString(const RecordBatch& batch, const WriteOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto out, io::BufferOutputStream::Create());
+  RETURN_NOT_OK(WriteJSON(batch, options, out.get()));
+  ARROW_ASSIGN_OR_RAISE(auto buffer, out->Finish());
+  return buffer->ToString();
+}
+
+Result<std::string> ToJsonString(const Table& table, const WriteOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto out, io::BufferOutputStream::Create());
+  RETURN_NOT_OK(WriteJSON(table, options, out.get()));
+  ARROW_ASSIGN_OR_RAISE(auto buffer, out->Finish());
+  return buffer->ToString();
+}
+
+Result<std::string> ToJsonString(const std::shared_ptr<RecordBatchReader>& reader,
+                                 const WriteOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto out, io::BufferOutputStream::Create());
+  RETURN_NOT_OK(WriteJSON(reader, options, out.get()));
+  ARROW_ASSIGN_OR_RAISE(auto buffer, out->Finish());
+  return buffer->ToString();
+}
+
+Result<std::string> ToJsonStringUsingWriter(const Table& data,
+                                            const WriteOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto out, io::BufferOutputStream::Create());
+  // Write row-by-row
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeJSONWriter(out, data.schema(), options));
+  TableBatchReader reader(data);
+  reader.set_chunksize(1);
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(reader.ReadNext(&batch));
+  while (batch != nullptr) {
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+  }
+  RETURN_NOT_OK(writer->Close());
+  EXPECT_EQ(data.num_rows(), writer->stats().num_record_batches);
+  ARROW_ASSIGN_OR_RAISE(auto buffer, out->Finish());
+  return buffer->ToString();
+}
+
+void AssertWritesJson(const std::shared_ptr<RecordBatch>& batch,
+                      const std::string& expected) {
+  for (const bool use_threads : {false, true}) {
+    for (const int32_t batch_size : {1, 2, 1024}) {
+      ARROW_SCOPED_TRACE("use_threads = ", use_threads, ", batch_size = ", batch_size);
+      auto options = WriteOptions::Defaults();
+      options.use_threads = use_threads;
+      options.batch_size = batch_size;
+
+      ASSERT_OK_AND_ASSIGN(auto json, ToJsonString(*batch, options));
+      EXPECT_EQ(json, expected);
+
+      // Table and Record batch should work identically.
+      ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches({batch, batch}));
+      ASSERT_OK_AND_ASSIGN(json, ToJsonString(*table, options));
+      EXPECT_EQ(json, expected + expected);
+
+      // RecordBatchReader should work identically.
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make({batch}));
+      ASSERT_OK_AND_ASSIGN(json, ToJsonString(reader, options));
+      EXPECT_EQ(json, expected);
+
+      // The writer should work identically.
+      ASSERT_OK_AND_ASSIGN(json, ToJsonStringUsingWriter(*table, options));
+      EXPECT_EQ(json, expected + expected);
+    }
+  }
+}
+
+TEST(TestWriteJSON, Primitives) {
+  auto schema = ::arrow::schema({field("null", null()), field("bool", boolean()),
+                                 field("int8", int8()), field("uint64", uint64()),
+                                 field("float64", float64()),
+                                 field("duration", duration(TimeUnit::MILLI))});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [null, true, -128, 18446744073709551615, 1.5, 5],
+    [null, false, 0, 0, -0.25, -5],
+    [null, null, null, null, null, null],
+    [null, true, 127, 1, NaN, 0],
+    [null, true, 127, 1, Inf, 0]
+  ])");
+  AssertWritesJson(batch, R"({"null":null,"bool":true,"int8":-128,)"
+                          R"("uint64":18446744073709551615,"float64":1.5,"duration":5})"
+                          "\n"
+                          R"({"null":null,"bool":false,"int8":0,"uint64":0,)"
+                          R"("float64":-0.25,"duration":-5})"
+                          "\n"
+                          R"({"null":null,"bool":null,"int8":null,"uint64":null,)"
+                          R"("float64":null,"duration":null})"
+                          "\n"
+                          R"({"null":null,"bool":true,"int8":127,"uint64":1,)"
+                          R"("float64":null,"duration":0})"
+                          "\n"
+                          R"({"null":null,"bool":true,"int8":127,"uint64":1,)"
+                          R"("float64":null,"duration":0})"
+                          "\n");
+}
+
+TEST(TestWriteJSON, Strings) {
+  auto schema =
+      ::arrow::schema({field("utf8", utf8()), field("large_utf8", large_utf8()),
+                       field("quote\"d\n", int8())});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    ["abc", "", 1],
+    ["a\"b\\c/", "\n\r\t\b\f", 2],
+    [null, "\u0001\u001f", 3],
+    ["\u00e9t\u00e9", null, 4]
+  ])");
+  AssertWritesJson(batch, R"({"utf8":"abc","large_utf8":"","quote\"d\n":1})"
+                          "\n"
+                          R"({"utf8":"a\"b\\c/","large_utf8":"\n\r\t\b\f",)"
+                          R"("quote\"d\n":2})"
+                          "\n"
+                          R"({"utf8":null,"large_utf8":"\u0001\u001f","quote\"d\n":3})"
+                          "\n"
+                          "{\"utf8\":\"\xc3\xa9t\xc3\xa9\",\"large_utf8\":null,"
+                          "\"quote\\\"d\\n\":4}\n");
+}
+
+template <typename BuilderType>
+std::shared_ptr<Array> MakeBinaryArray(const std::shared_ptr<DataType>& type,
+                                       const std::vector<const char*>& values) {
+  BuilderType builder(type, default_memory_pool());
+  for (const char* value : values) {
+    if (value == NULLPTR) {
+      ARROW_EXPECT_OK(builder.AppendNull());
+    } else {
+      ARROW_EXPECT_OK(builder.Append(util::string_view(value)));
+    }
+  }
+  return builder.Finish().ValueOrDie();
+}
+
+TEST(TestWriteJSON, Binary) {
+  // Binary values aren't necessarily valid UTF-8, they are written base64-encoded
+  auto binary_array =
+      MakeBinaryArray<BinaryBuilder>(binary(), {"\xff\xfe\x80", "", NULLPTR, "abcd"});
+  auto large_binary_array = MakeBinaryArray<LargeBinaryBuilder>(
+      large_binary(), {"a", NULLPTR, "\xc3\xa9", "\"\\\n"});
+  auto fixed_array = MakeBinaryArray<FixedSizeBinaryBuilder>(
+      fixed_size_binary(2), {"\xff\xfe", "ab", NULLPTR, "\xc3\xa9"});
+  auto batch = RecordBatch::Make(
+      ::arrow::schema({field("binary", binary()), field("large_binary", large_binary()),
+                       field("fixed", fixed_size_binary(2))}),
+      4, {binary_array, large_binary_array, fixed_array});
+  AssertWritesJson(batch, R"({"binary":"//6A","large_binary":"YQ==","fixed":"//4="})"
+                          "\n"
+                          R"({"binary":"","large_binary":null,"fixed":"YWI="})"
+                          "\n"
+                          R"({"binary":null,"large_binary":"w6k=","fixed":null})"
+                          "\n"
+                          R"({"binary":"YWJjZA==","large_binary":"IlwK","fixed":"w6k="})"
+                          "\n");
+}
+
+TEST(TestWriteJSON, TemporalAndDecimal) {
+  auto schema = ::arrow::schema(
+      {field("date32", date32()), field("time32", time32(TimeUnit::SECOND)),
+       field("ts", timestamp(TimeUnit::SECOND)),
+       field("ts_tz", timestamp(TimeUnit::MILLI, "America/Phoenix")),
+       field("decimal", decimal128(5, 2))});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [1, 3661, 1456767743, 1456767743000, "123.45"],
+    [null, null, null, null, null],
+    [-1, 0, 0, -1, "-0.01"]
+  ])");
+  AssertWritesJson(batch, R"({"date32":"1970-01-02","time32":"01:01:01",)"
+                          R"("ts":"2016-02-29 17:42:23",)"
+                          R"("ts_tz":"2016-02-29 17:42:23.000Z","decimal":"123.45"})"
+                          "\n"
+                          R"({"date32":null,"time32":null,"ts":null,"ts_tz":null,)"
+                          R"("decimal":null})"
+                          "\n"
+                          R"({"date32":"1969-12-31","time32":"00:00:00",)"
+                          R"("ts":"1970-01-01 00:00:00",)"
+                          R"("ts_tz":"1969-12-31 23:59:59.999Z","decimal":"-0.01"})"
+                          "\n");
+}
+
+TEST(TestWriteJSON, Nested) {
+  auto schema = ::arrow::schema(
+      {field("list", list(int32())), field("fixed_list", fixed_size_list(utf8(), 2)),
+       field("struct", struct_({field("a", int32()), field("b", list(boolean()))})),
+       field("dict", dictionary(int8(), utf8()))});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [[1, null, 3], ["a", null], {"a": 1, "b": [true]}, "x"],
+    [[], null, {"a": null, "b": null}, "y\"z"],
+    [null, ["", "c"], null, null],
+    [[4], ["d", "e"], {"a": 2, "b": []}, "x"]
+  ])");
+  AssertWritesJson(batch, R"({"list":[1,null,3],"fixed_list":["a",null],)"
+                          R"("struct":{"a":1,"b":[true]},"dict":"x"})"
+                          "\n"
+                          R"({"list":[],"fixed_list":null,"struct":{"a":null,"b":null},)"
+                          R"("dict":"y\"z"})"
+                          "\n"
+                          R"({"list":null,"fixed_list":["","c"],"struct":null,)"
+                          R"("dict":null})"
+                          "\n"
+                          R"({"list":[4],"fixed_list":["d","e"],"struct":{"a":2,"b":[]},)"
+                          R"("dict":"x"})"
+                          "\n");
+
+  // Sliced nested arrays
+  AssertWritesJson(batch->Slice(2, 1),
+                   R"({"list":null,"fixed_list":["","c"],"struct":null,"dict":null})"
+                   "\n");
+}
+
+TEST(TestWriteJSON, NoColumns) {
+  auto batch = RecordBatch::Make(::arrow::schema({}), 2, ArrayVector{});
+  AssertWritesJson(batch, "{}\n{}\n");
+}
+
+TEST(TestWriteJSON, RoundTrip) {
+  auto schema = ::arrow::schema(
+      {field("int64", int64()), field("float64", float64()), field("utf8", utf8()),
+       field("bool", boolean()), field("list", list(int64())),
+       field("struct", struct_({field("a", utf8())}))});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [1, 1.5, "a\"b\n", true, [1, 2], {"a": "\\"}],
+    [null, null, null, null, null, null],
+    [-9007199254740993, 1e-300, "\u0001", false, [], {"a": null}]
+  ])");
+  ASSERT_OK_AND_ASSIGN(auto json, ToJsonString(*batch, WriteOptions::Defaults()));
+
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.explicit_schema = schema;
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      TableReader::Make(default_memory_pool(),
+                        std::make_shared<io::BufferReader>(Buffer::FromString(json)),
+                        ReadOptions::Defaults(), parse_options));
+  ASSERT_OK_AND_ASSIGN(auto table, reader->Read());
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches({batch}));
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+}
+
+TEST(TestWriteJSON, FromCpuThreadPool) {
+  // Writing from a task of the CPU thread pool doesn't wait for other tasks of it
+  auto schema = ::arrow::schema({field("i", int32())});
+  auto batch = RecordBatchFromJSON(schema, "[[1], [2], [3], [4]]");
+  auto options = WriteOptions::Defaults();
+  options.batch_size = 1;
+  ASSERT_OK_AND_ASSIGN(auto future, ::arrow::internal::GetCpuThreadPool()->Submit(
+                                        [&] { return ToJsonString(*batch, options); }));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto json, future);
+  ASSERT_EQ(json, "{\"i\":1}\n{\"i\":2}\n{\"i\":3}\n{\"i\":4}\n");
+}
+
+TEST(TestWriteJSON, Errors) {
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("Unsupported Type: halffloat"),
+      MakeJSONWriter(out, ::arrow::schema({field("f", list(float16()))})));
+
+  auto options = WriteOptions::Defaults();
+  options.batch_size = 0;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("batch_size must be at least 1"),
+      MakeJSONWriter(out, ::arrow::schema({field("i", int32())}), options));
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -242,6 +242,20 @@ class ArrayPrinter : public PrettyPrinter {
     });
   }
 
+  Status WriteDataValues(const StringViewArray& array) {
+    return WriteValues(array, [&](int64_t i) {
+      (*sink_) << "\"" << array.GetView(i) << "\"";
+      return Status::OK();
+    });
+  }
+
+  Status WriteDataValues(const BinaryViewArray& array) {
+    return WriteValues(array, [&](int64_t i) {
+      (*sink_) << HexEncode(array.GetView(i));
+      return Status::OK();
+    });
+  }
+
   template <typename ArrayType, typename T = typename ArrayType::TypeClass>
   enable_if_decimal<T, Status> WriteDataValues(const ArrayType& array) {
     return WriteValues(array, [&](int64_t i) {
@@ -299,6 +313,7 @@ class ArrayPrinter : public PrettyPrinter {
                   std::is_base_of<FixedSizeBinaryArray, T>::value ||
                   std::is_base_of<BinaryArray, T>::value ||
                   std::is_base_of<LargeBinaryArray, T>::value ||
+                  std::is_base_of<BinaryViewArray, T>::value ||
                   std::is_base_of<ListArray, T>::value ||
                   std::is_base_of<LargeListArray, T>::value ||
                   std::is_base_of<MapArray, T>::value ||
@@ -376,6 +391,25 @@ class ArrayPrinter : public PrettyPrinter {
     return PrettyPrint(*array.indices(), ChildOptions(true), sink_);
   }
 
+  Status Visit(const RunEndEncodedArray& array) {
+    // Only print the runs covered by the array.  Note that run ends are not
+    // adjusted for the array offset.
+    const int64_t physical_offset = array.FindPhysicalOffset();
+    const int64_t physical_length = array.FindPhysicalLength();
+
+    Newline();
+    Indent();
+    Write("-- run_ends:\n");
+    RETURN_NOT_OK(PrettyPrint(*array.run_ends()->Slice(physical_offset, physical_length),
+                              ChildOptions(true), sink_));
+
+    Newline();
+    Indent();
+    Write("-- values:\n");
+    return PrettyPrint(*array.values()->Slice(physical_offset, physical_length),
+                       ChildOptions(true), sink_);
+  }
+
   Status Print(const Array& array) {
     RETURN_NOT_OK(VisitArrayInline(array, this));
     Flush();
@@ -16,12 +16,24 @@
 // under the License.
 
 #include "arrow/python/udf.h"
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/compute/function.h"
 #include "arrow/python/common.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/make_unique.h"
 
 namespace arrow {
 
 using compute::ExecResult;
+using internal::checked_cast;
 using compute::ExecSpan;
 
 namespace py {
@@ -89,6 +101,248 @@ Status PythonUdfExec(compute::KernelContext* ctx, const ExecSpan& batch,
   return SafeCallIntoPython([&]() -> Status { return udf->Exec(ctx, batch, out); });
 }
 
+// Collects the arguments of an aggregate UDF, which is called once on finalize
+struct PythonUdfScalarAggregator : public compute::KernelState {
+  PythonUdfScalarAggregator(std::shared_ptr<PythonUdf> udf,
+                            std::vector<TypeHolder> input_types)
+      : udf(std::move(udf)),
+        input_types(std::move(input_types)),
+        values(this->input_types.size()) {}
+
+  Status Consume(compute::KernelContext* ctx, const ExecSpan& batch) {
+    for (int arg_id = 0; arg_id < batch.num_values(); arg_id++) {
+      if (batch[arg_id].is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(auto array,
+                              MakeArrayFromScalar(*batch[arg_id].scalar, batch.length,
+                                                  ctx->memory_pool()));
+        values[arg_id].push_back(std::move(array));
+      } else {
+        values[arg_id].push_back(batch[arg_id].array.ToArray());
+      }
+    }
+    num_rows += batch.length;
+    return Status::OK();
+  }
+
+  Status MergeFrom(PythonUdfScalarAggregator&& other) {
+    for (size_t arg_id = 0; arg_id < values.size(); arg_id++) {
+      auto& other_values = other.values[arg_id];
+      std::move(other_values.begin(), other_values.end(),
+                std::back_inserter(values[arg_id]));
+    }
+    num_rows += other.num_rows;
+    return Status::OK();
+  }
+
+  Status Finalize(compute::KernelContext* ctx, Datum* out) {
+    // Concatenate the arguments before taking the GIL
+    const int num_args = static_cast<int>(values.size());
+    std::vector<std::shared_ptr<Array>> args(num_args);
+    for (int arg_id = 0; arg_id < num_args; arg_id++) {
+      if (values[arg_id].empty()) {
+        ARROW_ASSIGN_OR_RAISE(args[arg_id],
+                              MakeEmptyArray(input_types[arg_id].GetSharedPtr(),
+                                             ctx->memory_pool()));
+      } else if (values[arg_id].size() == 1) {
+        args[arg_id] = std::move(values[arg_id][0]);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(args[arg_id],
+                              Concatenate(values[arg_id], ctx->memory_pool()));
+      }
+      values[arg_id].clear();
+    }
+
+    return SafeCallIntoPython([&]() -> Status {
+      ScalarUdfContext udf_context{ctx->memory_pool(), num_rows};
+
+      OwnedRef arg_tuple(PyTuple_New(num_args));
+      RETURN_NOT_OK(CheckPyError());
+      for (int arg_id = 0; arg_id < num_args; arg_id++) {
+        PyObject* data = wrap_array(args[arg_id]);
+        PyTuple_SetItem(arg_tuple.obj(), arg_id, data);
+      }
+
+      OwnedRef result(udf->cb(udf->function->obj(), udf_context, arg_tuple.obj()));
+      RETURN_NOT_OK(CheckPyError());
+      // unwrapping the output for expected output type
+      if (is_scalar(result.obj())) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Scalar> val, unwrap_scalar(result.obj()));
+        if (!udf->output_type->Equals(*val->type)) {
+          return Status::TypeError("Expected output datatype ",
+                                   udf->output_type->ToString(),
+                                   ", but function returned datatype ",
+                                   val->type->ToString());
+        }
+        *out = Datum(std::move(val));
+        return Status::OK();
+      }
+      return Status::TypeError("Unexpected output type: ",
+                               Py_TYPE(result.obj())->tp_name, " (expected Scalar)");
+    });
+  }
+
+  std::shared_ptr<PythonUdf> udf;
+  std::vector<TypeHolder> input_types;
+  std::vector<std::vector<std::shared_ptr<Array>>> values;
+  int64_t num_rows = 0;
+};
+
+Result<std::unique_ptr<compute::KernelState>> PythonUdfAggregateInit(
+    compute::KernelContext* ctx, const compute::KernelInitArgs& args) {
+  auto udf = std::static_pointer_cast<PythonUdf>(args.kernel->data);
+  return ::arrow::internal::make_unique<PythonUdfScalarAggregator>(std::move(udf),
+                                                                   args.inputs);
+}
+
+Status PythonUdfAggregateConsume(compute::KernelContext* ctx, const ExecSpan& batch) {
+  return checked_cast<PythonUdfScalarAggregator*>(ctx->state())->Consume(ctx, batch);
+}
+
+Status PythonUdfAggregateMerge(compute::KernelContext* ctx, compute::KernelState&& src,
+                               compute::KernelState* dst) {
+  return checked_cast<PythonUdfScalarAggregator*>(dst)->MergeFrom(
+      std::move(checked_cast<PythonUdfScalarAggregator&>(src)));
+}
+
+Status PythonUdfAggregateFinalize(compute::KernelContext* ctx, Datum* out) {
+  return checked_cast<PythonUdfScalarAggregator*>(ctx->state())->Finalize(ctx, out);
+}
+
+// A registered tabular UDF
+struct PythonTableUdf {
+  PythonTableUdf(ScalarUdfWrapperCallback cb, std::shared_ptr<OwnedRefNoGIL> function,
+                 std::shared_ptr<Schema> schema)
+      : cb(std::move(cb)), function(std::move(function)), schema(std::move(schema)) {}
+
+  ~PythonTableUdf() {
+    if (_Py_IsFinalizing()) {
+      function->detach();
+    }
+  }
+
+  ScalarUdfWrapperCallback cb;
+  std::shared_ptr<OwnedRefNoGIL> function;
+  std::shared_ptr<Schema> schema;
+};
+
+// Tabular UDFs don't fit any kind of compute function, as they take no
+// arguments and produce several batches, so they have their own registry
+class PythonTableUdfRegistry {
+ public:
+  Status Add(const std::string& name, std::shared_ptr<PythonTableUdf> udf) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!udfs_.emplace(name, std::move(udf)).second) {
+      return Status::KeyError("Already have a tabular function registered with name: ",
+                              name);
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<PythonTableUdf>> Get(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = udfs_.find(name);
+    if (it == udfs_.end()) {
+      return Status::KeyError("No tabular function registered with name: ", name);
+    }
+    return it->second;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<PythonTableUdf>> udfs_;
+};
+
+PythonTableUdfRegistry* GetPythonTableUdfRegistry() {
+  static PythonTableUdfRegistry registry;
+  return &registry;
+}
+
+// Reads the batches of a tabular UDF until it returns an empty one
+class PythonTableUdfReader : public RecordBatchReader {
+ public:
+  PythonTableUdfReader(std::shared_ptr<PythonTableUdf> udf,
+                       std::shared_ptr<OwnedRefNoGIL> generator)
+      : udf_(std::move(udf)), generator_(std::move(generator)) {}
+
+  ~PythonTableUdfReader() override {
+    if (generator_ && _Py_IsFinalizing()) {
+      generator_->detach();
+    }
+  }
+
+  // Call the UDF to get the callable returning its batches
+  static Result<std::shared_ptr<RecordBatchReader>> Make(
+      std::shared_ptr<PythonTableUdf> udf) {
+    std::shared_ptr<OwnedRefNoGIL> generator;
+    RETURN_NOT_OK(SafeCallIntoPython([&]() -> Status {
+      ScalarUdfContext udf_context{default_memory_pool(), /*batch_length=*/0};
+      OwnedRef arg_tuple(PyTuple_New(0));
+      RETURN_NOT_OK(CheckPyError());
+      OwnedRef result(udf->cb(udf->function->obj(), udf_context, arg_tuple.obj()));
+      RETURN_NOT_OK(CheckPyError());
+      if (!PyCallable_Check(result.obj())) {
+        return Status::TypeError("Unexpected output type: ",
+                                 Py_TYPE(result.obj())->tp_name,
+                                 " (expected a callable)");
+      }
+      generator = std::make_shared<OwnedRefNoGIL>(result.detach());
+      return Status::OK();
+    }));
+    return std::make_shared<PythonTableUdfReader>(std::move(udf), std::move(generator));
+  }
+
+  std::shared_ptr<Schema> schema() const override { return udf_->schema; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    *batch = NULLPTR;
+    if (!generator_) {
+      return Status::OK();
+    }
+    std::shared_ptr<RecordBatch> next;
+    RETURN_NOT_OK(SafeCallIntoPython([&]() -> Status {
+      ScalarUdfContext udf_context{default_memory_pool(), /*batch_length=*/0};
+      OwnedRef arg_tuple(PyTuple_New(0));
+      RETURN_NOT_OK(CheckPyError());
+      OwnedRef result(udf_->cb(generator_->obj(), udf_context, arg_tuple.obj()));
+      RETURN_NOT_OK(CheckPyError());
+      if (is_batch(result.obj())) {
+        ARROW_ASSIGN_OR_RAISE(next, unwrap_batch(result.obj()));
+      } else if (is_array(result.obj())) {
+        ARROW_ASSIGN_OR_RAISE(auto array, unwrap_array(result.obj()));
+        if (array->type_id() == Type::STRUCT) {
+          ARROW_ASSIGN_OR_RAISE(next, RecordBatch::FromStructArray(array));
+        } else {
+          return Status::TypeError("Expected output datatype ",
+                                   struct_(udf_->schema->fields())->ToString(),
+                                   ", but function returned datatype ",
+                                   array->type()->ToString());
+        }
+      } else {
+        return Status::TypeError("Unexpected output type: ",
+                                 Py_TYPE(result.obj())->tp_name,
+                                 " (expected RecordBatch or Array)");
+      }
+      if (next->num_rows() == 0) {
+        generator_.reset();
+        next.reset();
+      }
+      return Status::OK();
+    }));
+    if (next && !next->schema()->Equals(*udf_->schema, /*check_metadata=*/false)) {
+      return Status::TypeError("Expected output datatype ",
+                               struct_(udf_->schema->fields())->ToString(),
+                               ", but function returned datatype ",
+                               struct_(next->schema()->fields())->ToString());
+    }
+    *batch = std::move(next);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<PythonTableUdf> udf_;
+  std::shared_ptr<OwnedRefNoGIL> generator_;
+};
+
 }  // namespace
 
 Status RegisterScalarFunction(PyObject* user_function, ScalarUdfWrapperCallback wrapper,
@@ -120,6 +374,62 @@ Status RegisterScalarFunction(PyObject* user_function, ScalarUdfWrapperCallback
   return Status::OK();
 }
 
+Status RegisterAggregateFunction(PyObject* user_function,
+                                 ScalarUdfWrapperCallback wrapper,
+                                 const ScalarUdfOptions& options) {
+  if (!PyCallable_Check(user_function)) {
+    return Status::TypeError("Expected a callable Python object.");
+  }
+  if (options.arity.is_varargs) {
+    return Status::NotImplemented("Varargs aggregate user-defined-functions");
+  }
+  auto aggregate_func = std::make_shared<compute::ScalarAggregateFunction>(
+      options.func_name, options.arity, options.func_doc);
+  Py_INCREF(user_function);
+  std::vector<compute::InputType> input_types;
+  for (const auto& in_dtype : options.input_types) {
+    input_types.emplace_back(in_dtype);
+  }
+  compute::OutputType output_type(options.output_type);
+  auto udf_data = std::make_shared<PythonUdf>(
+      wrapper, std::make_shared<OwnedRefNoGIL>(user_function), options.output_type);
+  compute::ScalarAggregateKernel kernel(
+      compute::KernelSignature::Make(std::move(input_types), std::move(output_type)),
+      PythonUdfAggregateInit, PythonUdfAggregateConsume, PythonUdfAggregateMerge,
+      PythonUdfAggregateFinalize);
+  kernel.data = std::move(udf_data);
+
+  RETURN_NOT_OK(aggregate_func->AddKernel(std::move(kernel)));
+  auto registry = compute::GetFunctionRegistry();
+  RETURN_NOT_OK(registry->AddFunction(std::move(aggregate_func)));
+  return Status::OK();
+}
+
+Status RegisterTabularFunction(PyObject* user_function, ScalarUdfWrapperCallback wrapper,
+                               const ScalarUdfOptions& options) {
+  if (!PyCallable_Check(user_function)) {
+    return Status::TypeError("Expected a callable Python object.");
+  }
+  if (options.arity.num_args != 0 || options.arity.is_varargs) {
+    return Status::NotImplemented("Tabular user-defined-functions with arguments");
+  }
+  if (options.output_type->id() != Type::STRUCT) {
+    return Status::TypeError("Expected a struct output type for a tabular function, got ",
+                             options.output_type->ToString());
+  }
+  Py_INCREF(user_function);
+  auto udf = std::make_shared<PythonTableUdf>(
+      wrapper, std::make_shared<OwnedRefNoGIL>(user_function),
+      schema(options.output_type->fields()));
+  return GetPythonTableUdfRegistry()->Add(options.func_name, std::move(udf));
+}
+
+Result<std::shared_ptr<RecordBatchReader>> CallTabularFunction(
+    const std::string& func_name) {
+  ARROW_ASSIGN_OR_RAISE(auto udf, GetPythonTableUdfRegistry()->Get(func_name));
+  return PythonTableUdfReader::Make(std::move(udf));
+}
+
 }  // namespace py
 
 }  // namespace arrow
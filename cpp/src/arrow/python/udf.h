@@ -20,6 +20,7 @@
 #include "arrow/compute/exec.h"
 #include "arrow/compute/function.h"
 #include "arrow/compute/registry.h"
+#include "arrow/record_batch.h"
 #include "arrow/python/platform.h"
 
 #include "arrow/python/common.h"
@@ -50,10 +51,42 @@ using ScalarUdfWrapperCallback = std::function<PyObject*(
     PyObject* user_function, const ScalarUdfContext& context, PyObject* inputs)>;
 
 /// \brief register a Scalar user-defined-function from Python
+///
+/// The function is called with the GIL held, once per batch of its arguments.
+/// In an exec plan, these are the batches received by the node evaluating it;
+/// coalesce them upstream with a "coalesce_batches" node to call the function
+/// less often.
 Status ARROW_PYTHON_EXPORT RegisterScalarFunction(PyObject* user_function,
                                                   ScalarUdfWrapperCallback wrapper,
                                                   const ScalarUdfOptions& options);
 
+/// \brief register a Scalar Aggregate user-defined-function from Python
+///
+/// The input batches are collected without calling into Python (and so
+/// without taking the GIL), and the Python function is called once with the
+/// concatenated arguments when the aggregation is finalized. It must return
+/// a Scalar of the output type.
+Status ARROW_PYTHON_EXPORT RegisterAggregateFunction(PyObject* user_function,
+                                                     ScalarUdfWrapperCallback wrapper,
+                                                     const ScalarUdfOptions& options);
+
+/// \brief register a Tabular user-defined-function from Python
+///
+/// The function takes no arguments and returns a callable. Each call of that
+/// callable returns the next batch of the table, as a RecordBatch or a
+/// StructArray of the output type, and an empty batch ends the table. The
+/// output type must be a struct type, whose fields are the columns of the table.
+///
+/// Tabular functions are kept apart from the compute function registry, and
+/// are only called through CallTabularFunction().
+Status ARROW_PYTHON_EXPORT RegisterTabularFunction(PyObject* user_function,
+                                                   ScalarUdfWrapperCallback wrapper,
+                                                   const ScalarUdfOptions& options);
+
+/// \brief Call a Tabular user-defined-function, returning a reader of its batches
+Result<std::shared_ptr<RecordBatchReader>> ARROW_PYTHON_EXPORT
+CallTabularFunction(const std::string& func_name);
+
 }  // namespace py
 
 }  // namespace arrow
@@ -29,6 +29,8 @@
 #include "arrow/pretty_print.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
+#include "arrow/tensor/converter.h"
 #include "arrow/type.h"
 #include "arrow/util/atomic_shared_ptr.h"
 #include "arrow/util/iterator.h"
@@ -223,6 +225,34 @@ Result<std::shared_ptr<StructArray>> RecordBatch::ToStructArray() const {
                                        /*offset=*/0);
 }
 
+namespace {
+
+ChunkedArrayVector ColumnsAsChunkedArrays(const RecordBatch& batch) {
+  ChunkedArrayVector columns(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    columns[i] = std::make_shared<ChunkedArray>(batch.column(i));
+  }
+  return columns;
+}
+
+}  // namespace
+
+Result<std::shared_ptr<Tensor>> RecordBatch::ToTensor(
+    const TensorConversionOptions& options) const {
+  return internal::MakeTensorFromColumns(ColumnsAsChunkedArrays(*this), num_rows_,
+                                         options);
+}
+
+Result<std::shared_ptr<Tensor>> RecordBatch::ToTensor() const {
+  return ToTensor(TensorConversionOptions::Defaults());
+}
+
+Result<std::shared_ptr<Tensor>> RecordBatch::ToValidityTensor(bool row_major,
+                                                              MemoryPool* pool) const {
+  return internal::MakeValidityTensorFromColumns(ColumnsAsChunkedArrays(*this),
+                                                 num_rows_, row_major, pool);
+}
+
 const std::string& RecordBatch::column_name(int i) const {
   return schema_->field(i)->name();
 }
@@ -78,6 +78,25 @@ class ARROW_EXPORT RecordBatch {
   /// in the resulting struct array.
   Result<std::shared_ptr<StructArray>> ToStructArray() const;
 
+  /// \brief Convert the record batch's numeric columns to a 2-dimensional Tensor
+  ///
+  /// The tensor has shape (num_rows, num_columns).  All columns must be of
+  /// integer or floating-point type (half-float is not supported).
+  ///
+  /// \param[in] options the conversion options, see TensorConversionOptions
+  Result<std::shared_ptr<Tensor>> ToTensor(const TensorConversionOptions& options) const;
+
+  /// \brief Convert to a Tensor with the default options
+  Result<std::shared_ptr<Tensor>> ToTensor() const;
+
+  /// \brief Compute a uint8 Tensor with the validity of each value
+  ///
+  /// The tensor has the same shape as the result of ToTensor() and contains
+  /// 1 for non-null values and 0 for nulls.  It can be used as a mask
+  /// alongside a tensor converted with `fill_nulls` enabled.
+  Result<std::shared_ptr<Tensor>> ToValidityTensor(
+      bool row_major = true, MemoryPool* pool = default_memory_pool()) const;
+
   /// \brief Construct record batch from struct array
   ///
   /// This constructs a record batch using the child arrays of the given
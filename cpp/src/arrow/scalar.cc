@@ -122,6 +122,11 @@ struct ScalarHashImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedScalar& s) {
+    AccumulateHashFrom(*s.value);
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionScalar& s) {
     AccumulateHashFrom(*s.value);
     return Status::OK();
@@ -228,6 +233,8 @@ struct ScalarValidateImpl {
 
   Status Visit(const LargeStringScalar& s) { return ValidateStringScalar(s); }
 
+  Status Visit(const StringViewScalar& s) { return ValidateStringScalar(s); }
+
   template <typename ScalarType>
   Status CheckValueNotNull(const ScalarType& s) {
     if (!s.value) {
@@ -456,6 +463,24 @@ struct ScalarValidateImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedScalar& s) {
+    const auto& ree_type = s.ree_type();
+    if (!s.value) {
+      return Status::Invalid(s.type->ToString(), " scalar doesn't have a value");
+    }
+    if (!ree_type.value_type()->Equals(*s.value->type)) {
+      return Status::Invalid(s.type->ToString(),
+                             " scalar should have an underlying value of type ",
+                             ree_type.value_type()->ToString(), ", got ",
+                             s.value->type->ToString());
+    }
+    if (s.is_valid != s.value->is_valid) {
+      return Status::Invalid(s.type->ToString(), " scalar validity (", s.is_valid,
+                             ") doesn't match the validity of its value");
+    }
+    return ValidateValue(s, *s.value);
+  }
+
   Status ValidateStringScalar(const BaseBinaryScalar& s) {
     RETURN_NOT_OK(ValidateBinaryScalar(s));
     if (s.is_valid && full_validation_) {
@@ -503,6 +528,12 @@ LargeBinaryScalar::LargeBinaryScalar(std::string s)
 LargeStringScalar::LargeStringScalar(std::string s)
     : LargeStringScalar(Buffer::FromString(std::move(s))) {}
 
+BinaryViewScalar::BinaryViewScalar(std::string s)
+    : BinaryViewScalar(Buffer::FromString(std::move(s))) {}
+
+StringViewScalar::StringViewScalar(std::string s)
+    : StringViewScalar(Buffer::FromString(std::move(s))) {}
+
 FixedSizeBinaryScalar::FixedSizeBinaryScalar(std::shared_ptr<Buffer> value,
                                              std::shared_ptr<DataType> type,
                                              bool is_valid)
@@ -646,6 +677,11 @@ std::shared_ptr<DictionaryScalar> DictionaryScalar::Make(std::shared_ptr<Scalar>
                                             std::move(type), is_valid);
 }
 
+RunEndEncodedScalar::RunEndEncodedScalar(const std::shared_ptr<DataType>& type)
+    : RunEndEncodedScalar(
+          MakeNullScalar(checked_cast<const RunEndEncodedType&>(*type).value_type()),
+          type) {}
+
 SparseUnionScalar::SparseUnionScalar(ValueType value, int8_t type_code,
                                      std::shared_ptr<DataType> type)
     : UnionScalar(std::move(type), type_code, /*is_valid=*/true),
@@ -760,6 +796,11 @@ struct MakeNullImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    out_ = std::make_shared<RunEndEncodedScalar>(type_);
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionType& type) {
     out_ = std::make_shared<ExtensionScalar>(MakeNullScalar(type.storage_type()), type_,
                                              /*is_valid=*/false);
@@ -816,6 +857,8 @@ struct ScalarParseImpl {
 
   Status Visit(const LargeBinaryType&) { return FinishWithBuffer(); }
 
+  Status Visit(const BinaryViewType&) { return FinishWithBuffer(); }
+
   Status Visit(const FixedSizeBinaryType&) { return FinishWithBuffer(); }
 
   Status Visit(const DictionaryType& t) {
@@ -1005,6 +1048,12 @@ Status CastImpl(const BinaryScalar& from, StringScalar* to) {
   return Status::OK();
 }
 
+// binary view to string
+Status CastImpl(const BinaryViewScalar& from, StringScalar* to) {
+  to->value = from.value;
+  return Status::OK();
+}
+
 // formattable to string
 template <typename ScalarType, typename T = typename ScalarType::TypeClass,
           typename Formatter = internal::StringFormatter<T>,
@@ -308,6 +308,33 @@ struct ARROW_EXPORT LargeStringScalar : public LargeBinaryScalar {
   LargeStringScalar() : LargeStringScalar(large_utf8()) {}
 };
 
+struct ARROW_EXPORT BinaryViewScalar : public BaseBinaryScalar {
+  using BaseBinaryScalar::BaseBinaryScalar;
+  using TypeClass = BinaryViewType;
+
+  BinaryViewScalar(std::shared_ptr<Buffer> value, std::shared_ptr<DataType> type)
+      : BaseBinaryScalar(std::move(value), std::move(type)) {}
+
+  explicit BinaryViewScalar(std::shared_ptr<Buffer> value)
+      : BinaryViewScalar(std::move(value), binary_view()) {}
+
+  explicit BinaryViewScalar(std::string s);
+
+  BinaryViewScalar() : BinaryViewScalar(binary_view()) {}
+};
+
+struct ARROW_EXPORT StringViewScalar : public BinaryViewScalar {
+  using BinaryViewScalar::BinaryViewScalar;
+  using TypeClass = StringViewType;
+
+  explicit StringViewScalar(std::shared_ptr<Buffer> value)
+      : StringViewScalar(std::move(value), utf8_view()) {}
+
+  explicit StringViewScalar(std::string s);
+
+  StringViewScalar() : StringViewScalar(utf8_view()) {}
+};
+
 struct ARROW_EXPORT FixedSizeBinaryScalar : public BinaryScalar {
   using TypeClass = FixedSizeBinaryType;
 
@@ -535,6 +562,26 @@ struct ARROW_EXPORT DenseUnionScalar : public UnionScalar {
         value(std::move(value)) {}
 };
 
+/// \brief A Scalar value for RunEndEncodedType
+///
+/// `is_valid` mirrors the validity of the underlying value.
+struct ARROW_EXPORT RunEndEncodedScalar : public Scalar {
+  using TypeClass = RunEndEncodedType;
+  using ValueType = std::shared_ptr<Scalar>;
+
+  ValueType value;
+
+  RunEndEncodedScalar(std::shared_ptr<Scalar> value, std::shared_ptr<DataType> type)
+      : Scalar(std::move(type), value->is_valid), value(std::move(value)) {}
+
+  /// \brief Constructs a NULL RunEndEncodedScalar
+  explicit RunEndEncodedScalar(const std::shared_ptr<DataType>& type);
+
+  const RunEndEncodedType& ree_type() const {
+    return internal::checked_cast<const RunEndEncodedType&>(*type);
+  }
+};
+
 /// \brief A Scalar value for DictionaryType
 ///
 /// `is_valid` denotes the validity of the `index`, regardless of
@@ -475,4 +475,34 @@ Result<std::shared_ptr<Tensor>> SparseTensor::ToTensor(MemoryPool* pool) const {
   }
 }
 
+namespace {
+
+template <typename OutSparseIndexType, typename InSparseIndexType>
+Result<std::shared_ptr<SparseTensorImpl<OutSparseIndexType>>> MakeSparseCSXMatrixTransposed(
+    const SparseTensorImpl<InSparseIndexType>& matrix, MemoryPool* pool) {
+  const auto& sparse_index =
+      internal::checked_cast<const InSparseIndexType&>(*matrix.sparse_index());
+  std::shared_ptr<SparseIndex> out_sparse_index;
+  std::shared_ptr<Buffer> out_data;
+  RETURN_NOT_OK(internal::MakeSparseCSXMatrixFromOtherAxis(
+      OutSparseIndexType::kCompressedAxis, sparse_index.indptr(), sparse_index.indices(),
+      matrix.type(), matrix.shape(), matrix.raw_data(), pool, &out_sparse_index,
+      &out_data));
+  return std::make_shared<SparseTensorImpl<OutSparseIndexType>>(
+      internal::checked_pointer_cast<OutSparseIndexType>(out_sparse_index),
+      matrix.type(), out_data, matrix.shape(), matrix.dim_names());
+}
+
+}  // namespace
+
+Result<std::shared_ptr<SparseCSCMatrix>> SparseCSRMatrixToCSC(
+    const SparseCSRMatrix& matrix, MemoryPool* pool) {
+  return MakeSparseCSXMatrixTransposed<SparseCSCIndex>(matrix, pool);
+}
+
+Result<std::shared_ptr<SparseCSRMatrix>> SparseCSCMatrixToCSR(
+    const SparseCSCMatrix& matrix, MemoryPool* pool) {
+  return MakeSparseCSXMatrixTransposed<SparseCSRIndex>(matrix, pool);
+}
+
 }  // namespace arrow
@@ -614,4 +614,19 @@ using SparseCSCMatrix = SparseTensorImpl<SparseCSCIndex>;
 /// \brief EXPERIMENTAL: Type alias for CSF sparse matrix
 using SparseCSFTensor = SparseTensorImpl<SparseCSFIndex>;
 
+/// \brief EXPERIMENTAL: Convert a CSR sparse matrix to the CSC format
+///
+/// The non-zero values are re-compressed along the columns directly, without
+/// going through a dense tensor.  The index value type is preserved.
+ARROW_EXPORT
+Result<std::shared_ptr<SparseCSCMatrix>> SparseCSRMatrixToCSC(
+    const SparseCSRMatrix& matrix, MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Convert a CSC sparse matrix to the CSR format
+///
+/// \see SparseCSRMatrixToCSC
+ARROW_EXPORT
+Result<std::shared_ptr<SparseCSRMatrix>> SparseCSCMatrixToCSR(
+    const SparseCSCMatrix& matrix, MemoryPool* pool = default_memory_pool());
+
 }  // namespace arrow
@@ -1204,6 +1204,38 @@ TEST_F(TestSparseCSCMatrix, TestToTensor) {
   ASSERT_TRUE(tensor.Equals(*dense_tensor));
 }
 
+TEST_F(TestSparseCSCMatrix, ConvertToCSR) {
+  std::shared_ptr<Buffer> buffer = Buffer::Wrap(this->dense_values_);
+  NumericTensor<Int64Type> tensor(buffer, this->shape_, {}, this->dim_names_);
+  ASSERT_OK_AND_ASSIGN(auto expected_csr, SparseCSRMatrix::Make(tensor));
+
+  ASSERT_OK_AND_ASSIGN(auto csr, SparseCSCMatrixToCSR(*this->sparse_tensor_from_dense_));
+  CheckSparseIndexFormatType(SparseTensorFormat::CSR, *csr);
+  ASSERT_TRUE(csr->Equals(*expected_csr));
+  ASSERT_EQ(this->dim_names_, csr->dim_names());
+
+  ASSERT_OK_AND_ASSIGN(auto csc, SparseCSRMatrixToCSC(*csr));
+  CheckSparseIndexFormatType(SparseTensorFormat::CSC, *csc);
+  ASSERT_TRUE(csc->Equals(*this->sparse_tensor_from_dense_));
+
+  // Index value type is preserved
+  ASSERT_OK_AND_ASSIGN(auto csr_int8, SparseCSRMatrix::Make(tensor, int8()));
+  ASSERT_OK_AND_ASSIGN(auto csc_int8, SparseCSRMatrixToCSC(*csr_int8));
+  auto si = internal::checked_pointer_cast<SparseCSCIndex>(csc_int8->sparse_index());
+  ASSERT_TRUE(si->indices()->type()->Equals(int8()));
+  ASSERT_OK_AND_ASSIGN(auto dense, csc_int8->ToTensor());
+  ASSERT_TRUE(dense->Equals(tensor));
+
+  // Empty matrix
+  std::vector<int64_t> zeros(this->dense_values_.size(), 0);
+  NumericTensor<Int64Type> zero_tensor(Buffer::Wrap(zeros), this->shape_);
+  ASSERT_OK_AND_ASSIGN(auto zero_csr, SparseCSRMatrix::Make(zero_tensor));
+  ASSERT_OK_AND_ASSIGN(auto zero_csc, SparseCSRMatrixToCSC(*zero_csr));
+  ASSERT_EQ(0, zero_csc->non_zero_length());
+  ASSERT_OK_AND_ASSIGN(dense, zero_csc->ToTensor());
+  ASSERT_TRUE(dense->Equals(zero_tensor));
+}
+
 template <typename ValueType>
 class TestSparseCSCMatrixEquality : public TestSparseTensorBase<ValueType> {
  public:
@@ -1676,4 +1708,41 @@ TEST(TestSparseCSFMatrixForUInt64Index, Make) {
   ASSERT_RAISES(Invalid, SparseCSFTensor::Make(dense_tensor, uint64()));
 }
 
+TEST(TestSparseTensorConversion, LargeMatrix) {
+  // Large enough for the conversions to be split into parallel tasks
+  const std::vector<int64_t> shape = {1000, 700};
+  std::vector<int32_t> values(shape[0] * shape[1], 0);
+  int64_t expected_non_zero = 0;
+  for (int64_t i = 0; i < shape[0]; ++i) {
+    for (int64_t j = 0; j < shape[1]; ++j) {
+      if ((i * 31 + j) % 7 == 0) {
+        values[i * shape[1] + j] = static_cast<int32_t>(i - j);
+        expected_non_zero += (i != j);
+      }
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto tensor,
+                       Tensor::Make(int32(), Buffer::Wrap(values), shape));
+
+  ASSERT_OK_AND_ASSIGN(auto coo, SparseCOOTensor::Make(*tensor));
+  ASSERT_EQ(expected_non_zero, coo->non_zero_length());
+  ASSERT_OK_AND_ASSIGN(auto dense, coo->ToTensor());
+  ASSERT_TRUE(dense->Equals(*tensor));
+
+  ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrix::Make(*tensor, int32()));
+  ASSERT_EQ(expected_non_zero, csr->non_zero_length());
+  ASSERT_OK_AND_ASSIGN(dense, csr->ToTensor());
+  ASSERT_TRUE(dense->Equals(*tensor));
+
+  ASSERT_OK_AND_ASSIGN(auto csc, SparseCSCMatrix::Make(*tensor, int32()));
+  ASSERT_EQ(expected_non_zero, csc->non_zero_length());
+  ASSERT_OK_AND_ASSIGN(dense, csc->ToTensor());
+  ASSERT_TRUE(dense->Equals(*tensor));
+
+  ASSERT_OK_AND_ASSIGN(auto csc_from_csr, SparseCSRMatrixToCSC(*csr));
+  ASSERT_TRUE(csc_from_csr->Equals(*csc));
+  ASSERT_OK_AND_ASSIGN(auto csr_from_csc, SparseCSCMatrixToCSR(*csc));
+  ASSERT_TRUE(csr_from_csc->Equals(*csr));
+}
+
 }  // namespace arrow
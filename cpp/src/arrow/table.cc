@@ -34,6 +34,8 @@
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/tensor.h"
+#include "arrow/tensor/converter.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
@@ -584,6 +586,21 @@ Result<std::shared_ptr<RecordBatch>> Table::CombineChunksToBatch(MemoryPool* poo
   }
   return RecordBatch::Make(schema_, num_rows_, std::move(arrays));
 }
+
+Result<std::shared_ptr<Tensor>> Table::ToTensor(
+    const TensorConversionOptions& options) const {
+  return internal::MakeTensorFromColumns(columns(), num_rows_, options);
+}
+
+Result<std::shared_ptr<Tensor>> Table::ToTensor() const {
+  return ToTensor(TensorConversionOptions::Defaults());
+}
+
+Result<std::shared_ptr<Tensor>> Table::ToValidityTensor(bool row_major,
+                                                        MemoryPool* pool) const {
+  return internal::MakeValidityTensorFromColumns(columns(), num_rows_, row_major, pool);
+}
+
 // ----------------------------------------------------------------------
 // Convert a table to a sequence of record batches
 
@@ -227,6 +227,23 @@ class ARROW_EXPORT Table {
   Result<std::shared_ptr<RecordBatch>> CombineChunksToBatch(
       MemoryPool* pool = default_memory_pool()) const;
 
+  /// \brief Convert the table's numeric columns to a 2-dimensional Tensor
+  ///
+  /// Chunks are copied directly into the result, without being combined
+  /// first.
+  ///
+  /// \see RecordBatch::ToTensor
+  Result<std::shared_ptr<Tensor>> ToTensor(const TensorConversionOptions& options) const;
+
+  /// \brief Convert to a Tensor with the default options
+  Result<std::shared_ptr<Tensor>> ToTensor() const;
+
+  /// \brief Compute a uint8 Tensor with the validity of each value
+  ///
+  /// \see RecordBatch::ToValidityTensor
+  Result<std::shared_ptr<Tensor>> ToValidityTensor(
+      bool row_major = true, MemoryPool* pool = default_memory_pool()) const;
+
  protected:
   Table();
 
@@ -18,12 +18,14 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/compare.h"
+#include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -198,6 +200,45 @@ class ARROW_EXPORT Tensor {
   ARROW_DISALLOW_COPY_AND_ASSIGN(Tensor);
 };
 
+/// \brief Options for converting the columns of a RecordBatch or Table to a Tensor
+///
+/// The result is a 2-dimensional tensor with one row per record and one
+/// column per field.
+struct ARROW_EXPORT TensorConversionOptions {
+  /// \brief The value type of the resulting tensor
+  ///
+  /// If null, the smallest type that can represent the values of all columns
+  /// is chosen: integer columns of mixed signedness or width are promoted to a
+  /// wider integer type and any floating-point column promotes the result to
+  /// floating-point (float64 unless all columns fit exactly in float32).
+  /// Values are converted with C casting semantics.
+  std::shared_ptr<DataType> type;
+
+  /// \brief Whether to lay out the result in row-major ("C") or column-major
+  /// ("Fortran") order
+  bool row_major = true;
+
+  /// \brief Whether to replace nulls with `null_fill_value`
+  ///
+  /// If false, converting a column containing nulls is an error.
+  bool fill_nulls = false;
+
+  /// \brief The value written in place of nulls when `fill_nulls` is true
+  ///
+  /// If the result type is inferred and this is NaN, integer columns promote
+  /// the result to float64.  Otherwise, the conversion fails if the value is out
+  /// of range of the result type.
+  double null_fill_value = std::numeric_limits<double>::quiet_NaN();
+
+  /// \brief Whether to copy the columns using the CPU thread pool
+  bool use_threads = true;
+
+  /// \brief The memory pool used to allocate the tensor data
+  MemoryPool* pool = default_memory_pool();
+
+  static TensorConversionOptions Defaults() { return TensorConversionOptions(); }
+};
+
 template <typename TYPE>
 class NumericTensor : public Tensor {
  public:
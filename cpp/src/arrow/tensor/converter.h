@@ -51,6 +51,17 @@ Status MakeSparseCSFTensorFromTensor(const Tensor& tensor,
                                      std::shared_ptr<SparseIndex>* out_sparse_index,
                                      std::shared_ptr<Buffer>* out_data);
 
+/// Re-compress a CSR matrix as CSC (if `axis` is COLUMN) or a CSC matrix as
+/// CSR (if `axis` is ROW), given the index and data of the input matrix
+Status MakeSparseCSXMatrixFromOtherAxis(SparseMatrixCompressedAxis axis,
+                                        const std::shared_ptr<Tensor>& indptr,
+                                        const std::shared_ptr<Tensor>& indices,
+                                        const std::shared_ptr<DataType>& value_type,
+                                        const std::vector<int64_t>& shape,
+                                        const uint8_t* raw_data, MemoryPool* pool,
+                                        std::shared_ptr<SparseIndex>* out_sparse_index,
+                                        std::shared_ptr<Buffer>* out_data);
+
 Result<std::shared_ptr<Tensor>> MakeTensorFromSparseCOOTensor(
     MemoryPool* pool, const SparseCOOTensor* sparse_tensor);
 
@@ -63,5 +74,13 @@ Result<std::shared_ptr<Tensor>> MakeTensorFromSparseCSCMatrix(
 Result<std::shared_ptr<Tensor>> MakeTensorFromSparseCSFTensor(
     MemoryPool* pool, const SparseCSFTensor* sparse_tensor);
 
+Result<std::shared_ptr<Tensor>> MakeTensorFromColumns(
+    const ChunkedArrayVector& columns, int64_t num_rows,
+    const TensorConversionOptions& options);
+
+Result<std::shared_ptr<Tensor>> MakeValidityTensorFromColumns(
+    const ChunkedArrayVector& columns, int64_t num_rows, bool row_major,
+    MemoryPool* pool);
+
 }  // namespace internal
 }  // namespace arrow
@@ -17,7 +17,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+
+#include "arrow/status.h"
 #include "arrow/tensor/converter.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 #define DISPATCH(ACTION, index_elsize, value_elsize, ...) \
   switch (index_elsize) {                                 \
@@ -86,3 +93,34 @@
       }                                                   \
       break;                                              \
   }
+
+namespace arrow {
+namespace internal {
+
+// Minimum number of tensor elements handled by a task of a parallel conversion
+constexpr int64_t kMinElementsPerConversionTask = 1 << 16;
+
+// Call `func(start, end)` on consecutive ranges of the lines [0, num_lines) of a
+// tensor, on the CPU thread pool if the lines hold enough elements in total.
+// `func` must only write the parts of the output that belong to its lines.
+template <typename Function>
+Status ParallelForLines(int64_t num_lines, int64_t line_length, Function&& func) {
+  const int64_t total = num_lines * std::max<int64_t>(line_length, 1);
+  int64_t num_tasks =
+      std::min<int64_t>(4 * GetCpuThreadPool()->GetCapacity(),
+                        std::min(num_lines, total / kMinElementsPerConversionTask));
+  if (num_tasks <= 1) {
+    func(int64_t(0), num_lines);
+    return Status::OK();
+  }
+  const int64_t lines_per_task = bit_util::CeilDiv(num_lines, num_tasks);
+  num_tasks = bit_util::CeilDiv(num_lines, lines_per_task);
+  return ParallelFor(static_cast<int>(num_tasks), [&](int task) {
+    const int64_t start = task * lines_per_task;
+    func(start, std::min(num_lines, start + lines_per_task));
+    return Status::OK();
+  });
+}
+
+}  // namespace internal
+}  // namespace arrow
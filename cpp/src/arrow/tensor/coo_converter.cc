@@ -27,6 +27,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/visit_type_inline.h"
 
@@ -53,35 +54,61 @@ inline void IncrementRowMajorIndex(std::vector<c_index_type>& coord,
 }
 
 template <typename c_index_type, typename c_value_type>
-void ConvertRowMajorTensor(const Tensor& tensor, c_index_type* indices,
-                           c_value_type* values, const int64_t size) {
+Status ConvertRowMajorTensor(const Tensor& tensor, c_index_type* indices,
+                             c_value_type* values, const int64_t size) {
   const auto ndim = tensor.ndim();
   const auto& shape = tensor.shape();
   const c_value_type* tensor_data =
       reinterpret_cast<const c_value_type*>(tensor.raw_data());
-
   constexpr c_value_type zero = 0;
-  std::vector<c_index_type> coord(ndim, 0);
-  for (int64_t n = tensor.size(); n > 0; --n) {
-    const c_value_type x = *tensor_data;
-    if (ARROW_PREDICT_FALSE(x != zero)) {
-      std::copy(coord.begin(), coord.end(), indices);
-      *values++ = x;
-      indices += ndim;
-    }
 
-    IncrementRowMajorIndex(coord, shape);
-    ++tensor_data;
+  // The tensor is split along its first dimension: count the non-zero values
+  // of each slice in parallel, then convert each slice at its output offset.
+  const int64_t n_slices = shape[0];
+  const int64_t slice_size = n_slices > 0 ? tensor.size() / n_slices : 0;
+  std::vector<int64_t> slice_offsets(n_slices + 1, 0);
+  RETURN_NOT_OK(ParallelForLines(n_slices, slice_size, [&](int64_t start, int64_t end) {
+    for (int64_t i = start; i < end; ++i) {
+      const c_value_type* data = tensor_data + i * slice_size;
+      int64_t count = 0;
+      for (int64_t j = 0; j < slice_size; ++j) {
+        count += data[j] != zero;
+      }
+      slice_offsets[i + 1] = count;
+    }
+  }));
+  for (int64_t i = 0; i < n_slices; ++i) {
+    slice_offsets[i + 1] += slice_offsets[i];
   }
+  DCHECK_EQ(slice_offsets[n_slices], size);
+
+  return ParallelForLines(n_slices, slice_size, [&](int64_t start, int64_t end) {
+    std::vector<c_index_type> coord(ndim, 0);
+    coord[0] = static_cast<c_index_type>(start);
+    c_index_type* out_indices = indices + slice_offsets[start] * ndim;
+    c_value_type* out_values = values + slice_offsets[start];
+    const c_value_type* data = tensor_data + start * slice_size;
+    for (int64_t n = (end - start) * slice_size; n > 0; --n) {
+      const c_value_type x = *data;
+      if (ARROW_PREDICT_FALSE(x != zero)) {
+        std::copy(coord.begin(), coord.end(), out_indices);
+        *out_values++ = x;
+        out_indices += ndim;
+      }
+
+      IncrementRowMajorIndex(coord, shape);
+      ++data;
+    }
+  });
 }
 
 template <typename c_index_type, typename c_value_type>
-void ConvertColumnMajorTensor(const Tensor& tensor, c_index_type* out_indices,
-                              c_value_type* out_values, const int64_t size) {
+Status ConvertColumnMajorTensor(const Tensor& tensor, c_index_type* out_indices,
+                                c_value_type* out_values, const int64_t size) {
   const auto ndim = tensor.ndim();
   std::vector<c_index_type> indices(ndim * size);
   std::vector<c_value_type> values(size);
-  ConvertRowMajorTensor(tensor, indices.data(), values.data(), size);
+  RETURN_NOT_OK(ConvertRowMajorTensor(tensor, indices.data(), values.data(), size));
 
   // transpose indices
   for (int64_t i = 0; i < size; ++i) {
@@ -114,11 +141,12 @@ void ConvertColumnMajorTensor(const Tensor& tensor, c_index_type* out_indices,
     indices_data += ndim;
     out_indices += ndim;
   }
+  return Status::OK();
 }
 
 template <typename c_index_type, typename c_value_type>
-void ConvertStridedTensor(const Tensor& tensor, c_index_type* indices,
-                          c_value_type* values, const int64_t size) {
+Status ConvertStridedTensor(const Tensor& tensor, c_index_type* indices,
+                            c_value_type* values, const int64_t size) {
   using ValueType = typename CTypeTraits<c_value_type>::ArrowType;
   const auto& shape = tensor.shape();
   const auto ndim = tensor.ndim();
@@ -138,11 +166,13 @@ void ConvertStridedTensor(const Tensor& tensor, c_index_type* indices,
 
     IncrementRowMajorIndex(coord, shape);
   }
+  return Status::OK();
 }
 
-#define CONVERT_TENSOR(func, index_type, value_type, indices, values, size)     \
-  func<index_type, value_type>(tensor_, reinterpret_cast<index_type*>(indices), \
-                               reinterpret_cast<value_type*>(values), size)
+#define CONVERT_TENSOR(func, index_type, value_type, indices, values, size)   \
+  RETURN_NOT_OK((func<index_type, value_type>(                                \
+      tensor_, reinterpret_cast<index_type*>(indices),                        \
+      reinterpret_cast<value_type*>(values), size)))
 
 // Using ARROW_EXPAND is necessary to expand __VA_ARGS__ correctly on VC++.
 #define CONVERT_ROW_MAJOR_TENSOR(index_type, value_type, ...) \
@@ -15,9 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include "arrow/tensor/converter.h"
+#include "arrow/tensor/converter_internal.h"
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -35,12 +36,65 @@ class MemoryPool;
 namespace internal {
 namespace {
 
+// ----------------------------------------------------------------------
+// Typed kernels operating on one line (row or column) of a matrix
+//
+// Values are handled as unsigned integers of the same width, so that a value
+// is non-zero iff any of its bytes is non-zero.
+
+template <typename c_value_type>
+int64_t CountNonZeroInLine(const uint8_t* data, int64_t length, int64_t stride) {
+  int64_t count = 0;
+  if (stride == sizeof(c_value_type)) {
+    // Branch-free so that the compiler vectorizes it
+    const auto* values = reinterpret_cast<const c_value_type*>(data);
+    for (int64_t j = 0; j < length; ++j) {
+      count += values[j] != 0;
+    }
+  } else {
+    for (int64_t j = 0; j < length; ++j) {
+      count += *reinterpret_cast<const c_value_type*>(data + j * stride) != 0;
+    }
+  }
+  return count;
+}
+
+template <typename c_index_type, typename c_value_type>
+void ConvertLine(const uint8_t* data, int64_t length, int64_t stride,
+                 uint8_t* out_indices, uint8_t* out_values) {
+  auto* indices = reinterpret_cast<c_index_type*>(out_indices);
+  auto* values = reinterpret_cast<c_value_type*>(out_values);
+  for (int64_t j = 0; j < length; ++j) {
+    const auto x = *reinterpret_cast<const c_value_type*>(data + j * stride);
+    if (ARROW_PREDICT_FALSE(x != 0)) {
+      *indices++ = static_cast<c_index_type>(j);
+      *values++ = x;
+    }
+  }
+}
+
+#define CONVERT_LINE(index_type, value_type, ...) \
+  ConvertLine<index_type, value_type>(__VA_ARGS__)
+
+int64_t CountNonZeroInLine(int value_elsize, const uint8_t* data, int64_t length,
+                           int64_t stride) {
+  switch (value_elsize) {
+    case 1:
+      return CountNonZeroInLine<uint8_t>(data, length, stride);
+    case 2:
+      return CountNonZeroInLine<uint16_t>(data, length, stride);
+    case 4:
+      return CountNonZeroInLine<uint32_t>(data, length, stride);
+    default:
+      return CountNonZeroInLine<uint64_t>(data, length, stride);
+  }
+}
+
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCSRIndex
 
 class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
   using SparseTensorConverterMixin::AssignIndex;
-  using SparseTensorConverterMixin::IsNonZero;
 
  public:
   SparseCSXMatrixConverter(SparseMatrixCompressedAxis axis, const Tensor& tensor,
@@ -59,59 +113,53 @@ class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
     if (ndim > 2) {
       return Status::Invalid("Invalid tensor dimension");
     }
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
 
     const int major_axis = static_cast<int>(axis_);
     const int64_t n_major = tensor_.shape()[major_axis];
     const int64_t n_minor = tensor_.shape()[1 - major_axis];
-    ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
+    const int64_t major_stride = tensor_.strides()[major_axis];
+    const int64_t minor_stride = tensor_.strides()[1 - major_axis];
+    const auto* tensor_data = tensor_.raw_data();
 
-    std::shared_ptr<Buffer> indptr_buffer;
-    std::shared_ptr<Buffer> indices_buffer;
+    // First pass: count the non-zero values of each line, in parallel
+    std::vector<int64_t> line_offsets(n_major + 1, 0);
+    RETURN_NOT_OK(ParallelForLines(n_major, n_minor, [&](int64_t start, int64_t end) {
+      for (int64_t i = start; i < end; ++i) {
+        line_offsets[i + 1] = CountNonZeroInLine(
+            value_elsize, tensor_data + i * major_stride, n_minor, minor_stride);
+      }
+    }));
+    for (int64_t i = 0; i < n_major; ++i) {
+      line_offsets[i + 1] += line_offsets[i];
+    }
+    const int64_t nonzero_count = line_offsets[n_major];
 
     ARROW_ASSIGN_OR_RAISE(auto values_buffer,
                           AllocateBuffer(value_elsize * nonzero_count, pool_));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indptr_buffer,
+                          AllocateBuffer(index_elsize * (n_major + 1), pool_));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices_buffer,
+                          AllocateBuffer(index_elsize * nonzero_count, pool_));
     auto* values = values_buffer->mutable_data();
+    auto* indptr = indptr_buffer->mutable_data();
+    auto* indices = indices_buffer->mutable_data();
 
-    const auto* tensor_data = tensor_.raw_data();
+    for (int64_t i = 0; i <= n_major; ++i) {
+      AssignIndex(indptr + i * index_elsize, line_offsets[i], index_elsize);
+    }
 
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      ARROW_ASSIGN_OR_RAISE(indptr_buffer,
-                            AllocateBuffer(index_elsize * (n_major + 1), pool_));
-      auto* indptr = indptr_buffer->mutable_data();
-
-      ARROW_ASSIGN_OR_RAISE(indices_buffer,
-                            AllocateBuffer(index_elsize * nonzero_count, pool_));
-      auto* indices = indices_buffer->mutable_data();
-
-      std::vector<int64_t> coords(2);
-      int64_t k = 0;
-      std::fill_n(indptr, index_elsize, 0);
-      indptr += index_elsize;
-      for (int64_t i = 0; i < n_major; ++i) {
-        for (int64_t j = 0; j < n_minor; ++j) {
-          if (axis_ == SparseMatrixCompressedAxis::ROW) {
-            coords = {i, j};
-          } else {
-            coords = {j, i};
-          }
-          const int64_t offset = tensor_.CalculateValueOffset(coords);
-          if (std::any_of(tensor_data + offset, tensor_data + offset + value_elsize,
-                          IsNonZero)) {
-            std::copy_n(tensor_data + offset, value_elsize, values);
-            values += value_elsize;
-
-            AssignIndex(indices, j, index_elsize);
-            indices += index_elsize;
-
-            k++;
-          }
-        }
-        AssignIndex(indptr, k, index_elsize);
-        indptr += index_elsize;
+    // Second pass: each line is written at its precomputed offset, in parallel
+    RETURN_NOT_OK(ParallelForLines(n_major, n_minor, [&](int64_t start, int64_t end) {
+      for (int64_t i = start; i < end; ++i) {
+        const int64_t offset = line_offsets[i];
+        DISPATCH(CONVERT_LINE, index_elsize, value_elsize,
+                 tensor_data + i * major_stride, n_minor, minor_stride,
+                 indices + offset * index_elsize, values + offset * value_elsize);
       }
-    }
+    }));
 
     std::vector<int64_t> indptr_shape({n_major + 1});
     std::shared_ptr<Tensor> indptr_tensor =
@@ -141,22 +189,39 @@ class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
   MemoryPool* pool_;
 };
 
-}  // namespace
-
-Status MakeSparseCSXMatrixFromTensor(SparseMatrixCompressedAxis axis,
-                                     const Tensor& tensor,
-                                     const std::shared_ptr<DataType>& index_value_type,
-                                     MemoryPool* pool,
-                                     std::shared_ptr<SparseIndex>* out_sparse_index,
-                                     std::shared_ptr<Buffer>* out_data) {
-  SparseCSXMatrixConverter converter(axis, tensor, index_value_type, pool);
-  RETURN_NOT_OK(converter.Convert());
-
-  *out_sparse_index = converter.sparse_index;
-  *out_data = converter.data;
-  return Status::OK();
+// ----------------------------------------------------------------------
+// Dense tensor from CSX matrix
+
+// Scatter the values of lines [start, end) of a CSX matrix into a row-major
+// dense matrix with `nc` columns
+template <typename c_index_type, typename c_value_type>
+void ScatterLines(SparseMatrixCompressedAxis axis, const uint8_t* indptr_data,
+                  int indptr_elsize, const uint8_t* indices_data, const uint8_t* raw_data,
+                  int64_t nc, int64_t start, int64_t end, uint8_t* out) {
+  const auto* indices = reinterpret_cast<const c_index_type*>(indices_data);
+  const auto* values = reinterpret_cast<const c_value_type*>(raw_data);
+  auto* dense = reinterpret_cast<c_value_type*>(out);
+  for (int64_t i = start; i < end; ++i) {
+    const auto line_start = SparseTensorConverterMixin::GetIndexValue(
+        indptr_data + i * indptr_elsize, indptr_elsize);
+    const auto line_stop = SparseTensorConverterMixin::GetIndexValue(
+        indptr_data + (i + 1) * indptr_elsize, indptr_elsize);
+    if (axis == SparseMatrixCompressedAxis::ROW) {
+      c_value_type* row = dense + i * nc;
+      for (int64_t k = line_start; k < line_stop; ++k) {
+        row[static_cast<int64_t>(indices[k])] = values[k];
+      }
+    } else {
+      for (int64_t k = line_start; k < line_stop; ++k) {
+        dense[static_cast<int64_t>(indices[k]) * nc + i] = values[k];
+      }
+    }
+  }
 }
 
+#define SCATTER_LINES(index_type, value_type, ...) \
+  ScatterLines<index_type, value_type>(__VA_ARGS__)
+
 Result<std::shared_ptr<Tensor>> MakeTensorFromSparseCSXMatrix(
     SparseMatrixCompressedAxis axis, MemoryPool* pool,
     const std::shared_ptr<Tensor>& indptr, const std::shared_ptr<Tensor>& indices,
@@ -174,41 +239,139 @@ Result<std::shared_ptr<Tensor>> MakeTensorFromSparseCSXMatrix(
   ARROW_ASSIGN_OR_RAISE(auto values_buffer,
                         AllocateBuffer(value_elsize * tensor_size, pool));
   auto values = values_buffer->mutable_data();
-  std::fill_n(values, value_elsize * tensor_size, 0);
 
   std::vector<int64_t> strides;
   RETURN_NOT_OK(ComputeRowMajorStrides(fw_value_type, shape, &strides));
 
+  const auto nr = shape[0];
   const auto nc = shape[1];
 
-  int64_t offset = 0;
-  for (int64_t i = 0; i < indptr->size() - 1; ++i) {
-    const auto start =
-        SparseTensorConverterMixin::GetIndexValue(indptr_data, indptr_elsize);
-    const auto stop = SparseTensorConverterMixin::GetIndexValue(
-        indptr_data + indptr_elsize, indptr_elsize);
-
-    for (int64_t j = start; j < stop; ++j) {
-      const auto index = SparseTensorConverterMixin::GetIndexValue(
-          indices_data + j * indices_elsize, indices_elsize);
-      switch (axis) {
-        case SparseMatrixCompressedAxis::ROW:
-          offset = (index + i * nc) * value_elsize;
-          break;
-        case SparseMatrixCompressedAxis::COLUMN:
-          offset = (i + index * nc) * value_elsize;
-          break;
-      }
+  // Zero the output rows in parallel
+  RETURN_NOT_OK(ParallelForLines(nr, nc, [&](int64_t start, int64_t end) {
+    std::memset(values + start * nc * value_elsize, 0,
+                (end - start) * nc * value_elsize);
+  }));
+
+  // Scatter the non-zero values; different lines never write the same cell
+  const int64_t n_major = indptr->size() - 1;
+  const int64_t average_line_length =
+      n_major > 0 ? std::max<int64_t>(1, non_zero_length / n_major) : 1;
+  RETURN_NOT_OK(
+      ParallelForLines(n_major, average_line_length, [&](int64_t start, int64_t end) {
+        DISPATCH(SCATTER_LINES, indices_elsize, value_elsize, axis, indptr_data,
+                 indptr_elsize, indices_data, raw_data, nc, start, end, values);
+      }));
 
-      std::copy_n(raw_data, value_elsize, values + offset);
-      raw_data += value_elsize;
-    }
+  return std::make_shared<Tensor>(value_type, std::move(values_buffer), shape, strides,
+                                  dim_names);
+}
 
-    indptr_data += indptr_elsize;
+// ----------------------------------------------------------------------
+// CSR <-> CSC transposition
+
+// Re-compress the non-zero values of a CSX matrix along its other axis.
+// `out_indptr` must be zero-initialized and hold `n_minor + 1` entries.
+template <typename c_index_type, typename c_value_type>
+void TransposeCSX(const uint8_t* indptr_data, int indptr_elsize, int64_t n_major,
+                  const uint8_t* indices_data, int64_t nnz, const uint8_t* raw_data,
+                  int64_t n_minor,
+                  uint8_t* out_indptr_data, uint8_t* out_indices_data,
+                  uint8_t* out_values_data) {
+  const auto* indices = reinterpret_cast<const c_index_type*>(indices_data);
+  const auto* values = reinterpret_cast<const c_value_type*>(raw_data);
+  auto* out_indptr = reinterpret_cast<c_index_type*>(out_indptr_data);
+  auto* out_indices = reinterpret_cast<c_index_type*>(out_indices_data);
+  auto* out_values = reinterpret_cast<c_value_type*>(out_values_data);
+
+  // Count the values of each output line, then turn the counts into the
+  // position where the next value of each line goes
+  std::vector<int64_t> next(n_minor + 1, 0);
+  for (int64_t k = 0; k < nnz; ++k) {
+    ++next[static_cast<int64_t>(indices[k]) + 1];
+  }
+  for (int64_t j = 0; j < n_minor; ++j) {
+    next[j + 1] += next[j];
+  }
+  for (int64_t j = 0; j <= n_minor; ++j) {
+    out_indptr[j] = static_cast<c_index_type>(next[j]);
   }
 
-  return std::make_shared<Tensor>(value_type, std::move(values_buffer), shape, strides,
-                                  dim_names);
+  // Visiting input lines in order keeps the output indices sorted
+  int64_t line_start = 0;
+  for (int64_t i = 0; i < n_major; ++i) {
+    const int64_t line_stop = SparseTensorConverterMixin::GetIndexValue(
+        indptr_data + (i + 1) * indptr_elsize, indptr_elsize);
+    for (int64_t k = line_start; k < line_stop; ++k) {
+      const int64_t pos = next[static_cast<int64_t>(indices[k])]++;
+      out_indices[pos] = static_cast<c_index_type>(i);
+      out_values[pos] = values[k];
+    }
+    line_start = line_stop;
+  }
+}
+
+#define TRANSPOSE_CSX(index_type, value_type, ...) \
+  TransposeCSX<index_type, value_type>(__VA_ARGS__)
+
+}  // namespace
+
+Status MakeSparseCSXMatrixFromTensor(SparseMatrixCompressedAxis axis,
+                                     const Tensor& tensor,
+                                     const std::shared_ptr<DataType>& index_value_type,
+                                     MemoryPool* pool,
+                                     std::shared_ptr<SparseIndex>* out_sparse_index,
+                                     std::shared_ptr<Buffer>* out_data) {
+  SparseCSXMatrixConverter converter(axis, tensor, index_value_type, pool);
+  RETURN_NOT_OK(converter.Convert());
+
+  *out_sparse_index = converter.sparse_index;
+  *out_data = converter.data;
+  return Status::OK();
+}
+
+Status MakeSparseCSXMatrixFromOtherAxis(SparseMatrixCompressedAxis axis,
+                                        const std::shared_ptr<Tensor>& indptr,
+                                        const std::shared_ptr<Tensor>& indices,
+                                        const std::shared_ptr<DataType>& value_type,
+                                        const std::vector<int64_t>& shape,
+                                        const uint8_t* raw_data, MemoryPool* pool,
+                                        std::shared_ptr<SparseIndex>* out_sparse_index,
+                                        std::shared_ptr<Buffer>* out_data) {
+  // `axis` is the compressed axis of the output
+  const auto& index_value_type = indices->type();
+  RETURN_NOT_OK(CheckSparseIndexMaximumValue(index_value_type, shape));
+
+  const int indptr_elsize = indptr->type()->byte_width();
+  const int index_elsize = index_value_type->byte_width();
+  const int value_elsize = value_type->byte_width();
+  const int64_t n_major = indptr->size() - 1;
+  const int64_t n_minor = shape[static_cast<int>(axis)];
+  const int64_t nonzero_count = indices->size();
+  // The total count must also be representable in the output indptr
+  RETURN_NOT_OK(CheckSparseIndexMaximumValue(index_value_type, {nonzero_count}));
+
+  ARROW_ASSIGN_OR_RAISE(auto indptr_buffer,
+                        AllocateBuffer(index_elsize * (n_minor + 1), pool));
+  ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                        AllocateBuffer(index_elsize * nonzero_count, pool));
+  ARROW_ASSIGN_OR_RAISE(auto values_buffer,
+                        AllocateBuffer(value_elsize * nonzero_count, pool));
+  DISPATCH(TRANSPOSE_CSX, index_elsize, value_elsize, indptr->raw_data(), indptr_elsize,
+           n_major, indices->raw_data(), nonzero_count, raw_data, n_minor,
+           indptr_buffer->mutable_data(), indices_buffer->mutable_data(),
+           values_buffer->mutable_data());
+
+  auto indptr_tensor = std::make_shared<Tensor>(
+      index_value_type, std::move(indptr_buffer), std::vector<int64_t>{n_minor + 1});
+  auto indices_tensor = std::make_shared<Tensor>(
+      index_value_type, std::move(indices_buffer), std::vector<int64_t>{nonzero_count});
+  if (axis == SparseMatrixCompressedAxis::ROW) {
+    *out_sparse_index = std::make_shared<SparseCSRIndex>(indptr_tensor, indices_tensor);
+  } else {
+    *out_sparse_index = std::make_shared<SparseCSCIndex>(indptr_tensor, indices_tensor);
+  }
+  *out_data = std::move(values_buffer);
+  return Status::OK();
 }
 
 Result<std::shared_ptr<Tensor>> MakeTensorFromSparseCSRMatrix(
@@ -0,0 +1,439 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/tensor/converter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/chunked_array.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+namespace internal {
+namespace {
+
+// ----------------------------------------------------------------------
+// Result type inference
+
+bool IsSupportedColumnType(const DataType& type) {
+  return is_tensor_supported(type.id()) && type.id() != Type::HALF_FLOAT;
+}
+
+std::shared_ptr<DataType> IntegerTypeOfWidth(int bit_width, bool is_signed) {
+  switch (bit_width) {
+    case 8:
+      return is_signed ? int8() : uint8();
+    case 16:
+      return is_signed ? int16() : uint16();
+    case 32:
+      return is_signed ? int32() : uint32();
+    default:
+      return is_signed ? int64() : uint64();
+  }
+}
+
+Result<std::shared_ptr<DataType>> InferTensorType(const ChunkedArrayVector& columns,
+                                                  const TensorConversionOptions& options) {
+  if (columns.empty()) {
+    return Status::Invalid("Cannot infer the tensor type of a conversion without columns");
+  }
+  int max_signed_width = 0;
+  int max_unsigned_width = 0;
+  int max_float_width = 0;
+  for (const auto& column : columns) {
+    const auto& type = checked_cast<const FixedWidthType&>(*column->type());
+    if (is_floating(type.id())) {
+      max_float_width = std::max(max_float_width, type.bit_width());
+    } else if (is_signed_integer(type.id())) {
+      max_signed_width = std::max(max_signed_width, type.bit_width());
+    } else {
+      max_unsigned_width = std::max(max_unsigned_width, type.bit_width());
+    }
+  }
+
+  const bool fill_with_nan = options.fill_nulls && std::isnan(options.null_fill_value);
+  if (max_float_width == 0 && !fill_with_nan) {
+    if (max_signed_width == 0) {
+      return IntegerTypeOfWidth(max_unsigned_width, /*is_signed=*/false);
+    }
+    // A signed type twice as wide as an unsigned type holds all its values
+    const int width = std::max(max_signed_width, 2 * max_unsigned_width);
+    if (width <= 64) {
+      return IntegerTypeOfWidth(width, /*is_signed=*/true);
+    }
+    return float64();
+  }
+  // float32 represents all integers of up to 16 bits exactly
+  if (max_float_width > 0 && max_float_width <= 32 && max_signed_width <= 16 &&
+      max_unsigned_width <= 16) {
+    return float32();
+  }
+  return float64();
+}
+
+// Whether `value` can be converted to OutCType without overflow
+template <typename OutCType>
+bool FillValueFits(double value) {
+  using Limits = std::numeric_limits<OutCType>;
+  if (!Limits::is_integer) {
+    return !std::isfinite(value) || std::fabs(value) <= Limits::max();
+  }
+  // Conversion truncates towards zero.  Integer bounds are powers of two (or
+  // one less), so `max() + 1` is exact and the comparisons are too.
+  return std::trunc(value) >= static_cast<double>(Limits::lowest()) &&
+         value < static_cast<double>(Limits::max()) + 1.0;
+}
+
+bool FillValueFits(Type::type out_type, double value) {
+  switch (out_type) {
+    case Type::UINT8:
+      return FillValueFits<uint8_t>(value);
+    case Type::INT8:
+      return FillValueFits<int8_t>(value);
+    case Type::UINT16:
+      return FillValueFits<uint16_t>(value);
+    case Type::INT16:
+      return FillValueFits<int16_t>(value);
+    case Type::UINT32:
+      return FillValueFits<uint32_t>(value);
+    case Type::INT32:
+      return FillValueFits<int32_t>(value);
+    case Type::UINT64:
+      return FillValueFits<uint64_t>(value);
+    case Type::INT64:
+      return FillValueFits<int64_t>(value);
+    case Type::FLOAT:
+      return FillValueFits<float>(value);
+    default:
+      return true;
+  }
+}
+
+// ----------------------------------------------------------------------
+// Value copy kernels
+
+// Copy `length` values of `in` starting at `offset` to `out`, `out_stride`
+// elements apart.  Nulls are replaced with `fill_value` if `fill_nulls` is true.
+using CopyValuesFunc = void (*)(const ArrayData& in, int64_t offset, int64_t length,
+                                bool fill_nulls, double fill_value, uint8_t* out,
+                                int64_t out_stride);
+
+template <typename OutCType, typename InCType>
+void CopyValues(const ArrayData& in, int64_t offset, int64_t length, bool fill_nulls,
+                double fill_value, uint8_t* out_bytes, int64_t out_stride) {
+  const InCType* values = in.GetValues<InCType>(1) + offset;
+  OutCType* out = reinterpret_cast<OutCType*>(out_bytes);
+  if (out_stride == 1) {
+    // Contiguous output, this loop is vectorized by the compiler
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = static_cast<OutCType>(values[i]);
+    }
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i * out_stride] = static_cast<OutCType>(values[i]);
+    }
+  }
+  if (!fill_nulls || !in.MayHaveNulls()) {
+    return;
+  }
+  const auto fill = static_cast<OutCType>(fill_value);
+  BitRunReader reader(in.buffers[0]->data(), in.offset + offset, length);
+  int64_t position = 0;
+  while (true) {
+    const BitRun run = reader.NextRun();
+    if (run.length == 0) break;
+    if (!run.set) {
+      for (int64_t i = position; i < position + run.length; ++i) {
+        out[i * out_stride] = fill;
+      }
+    }
+    position += run.length;
+  }
+}
+
+template <typename OutCType>
+CopyValuesFunc GetCopyValuesFunc(Type::type in_type) {
+  switch (in_type) {
+    case Type::UINT8:
+      return CopyValues<OutCType, uint8_t>;
+    case Type::INT8:
+      return CopyValues<OutCType, int8_t>;
+    case Type::UINT16:
+      return CopyValues<OutCType, uint16_t>;
+    case Type::INT16:
+      return CopyValues<OutCType, int16_t>;
+    case Type::UINT32:
+      return CopyValues<OutCType, uint32_t>;
+    case Type::INT32:
+      return CopyValues<OutCType, int32_t>;
+    case Type::UINT64:
+      return CopyValues<OutCType, uint64_t>;
+    case Type::INT64:
+      return CopyValues<OutCType, int64_t>;
+    case Type::FLOAT:
+      return CopyValues<OutCType, float>;
+    case Type::DOUBLE:
+      return CopyValues<OutCType, double>;
+    default:
+      return nullptr;
+  }
+}
+
+CopyValuesFunc GetCopyValuesFunc(Type::type out_type, Type::type in_type) {
+  switch (out_type) {
+    case Type::UINT8:
+      return GetCopyValuesFunc<uint8_t>(in_type);
+    case Type::INT8:
+      return GetCopyValuesFunc<int8_t>(in_type);
+    case Type::UINT16:
+      return GetCopyValuesFunc<uint16_t>(in_type);
+    case Type::INT16:
+      return GetCopyValuesFunc<int16_t>(in_type);
+    case Type::UINT32:
+      return GetCopyValuesFunc<uint32_t>(in_type);
+    case Type::INT32:
+      return GetCopyValuesFunc<int32_t>(in_type);
+    case Type::UINT64:
+      return GetCopyValuesFunc<uint64_t>(in_type);
+    case Type::INT64:
+      return GetCopyValuesFunc<int64_t>(in_type);
+    case Type::FLOAT:
+      return GetCopyValuesFunc<float>(in_type);
+    case Type::DOUBLE:
+      return GetCopyValuesFunc<double>(in_type);
+    default:
+      return nullptr;
+  }
+}
+
+void CopyValidity(const ArrayData& in, int64_t offset, int64_t length,
+                  bool /*fill_nulls*/, double /*fill_value*/, uint8_t* out,
+                  int64_t out_stride) {
+  if (!in.MayHaveNulls() || in.type->id() == Type::NA) {
+    const uint8_t value = in.type->id() == Type::NA ? 0 : 1;
+    for (int64_t i = 0; i < length; ++i) {
+      out[i * out_stride] = value;
+    }
+    return;
+  }
+  const uint8_t* bitmap = in.buffers[0]->data();
+  for (int64_t i = 0; i < length; ++i) {
+    out[i * out_stride] = bit_util::GetBit(bitmap, in.offset + offset + i) ? 1 : 0;
+  }
+}
+
+// ----------------------------------------------------------------------
+// Columns to tensor conversion
+
+class ColumnsToTensorConverter {
+ public:
+  ColumnsToTensorConverter(const ChunkedArrayVector& columns, int64_t num_rows,
+                           std::shared_ptr<DataType> type, bool row_major,
+                           bool fill_nulls, double fill_value)
+      : columns_(columns),
+        num_rows_(num_rows),
+        type_(std::move(type)),
+        byte_width_(checked_cast<const FixedWidthType&>(*type_).bit_width() / 8),
+        row_major_(row_major),
+        fill_nulls_(fill_nulls),
+        fill_value_(fill_value) {}
+
+  Result<std::shared_ptr<Tensor>> Convert(const std::vector<CopyValuesFunc>& copy_funcs,
+                                          bool use_threads, MemoryPool* pool) {
+    const auto num_columns = static_cast<int64_t>(columns_.size());
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> data,
+                          AllocateBuffer(num_rows_ * num_columns * byte_width_, pool));
+    out_ = data->mutable_data();
+    copy_funcs_ = &copy_funcs;
+
+    chunk_starts_.resize(columns_.size());
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      int64_t start = 0;
+      for (const auto& chunk : columns_[i]->chunks()) {
+        chunk_starts_[i].push_back(start);
+        start += chunk->length();
+      }
+    }
+
+    if (num_rows_ > 0 && num_columns > 0) {
+      if (row_major_) {
+        RETURN_NOT_OK(ConvertRowMajor(use_threads));
+      } else {
+        RETURN_NOT_OK(OptionalParallelFor(
+            use_threads && num_columns > 1, static_cast<int>(num_columns),
+            [this](int i) {
+              CopyColumnRange(i, 0, num_rows_);
+              return Status::OK();
+            }));
+      }
+    }
+
+    std::vector<int64_t> shape = {num_rows_, num_columns};
+    std::vector<int64_t> strides;
+    const auto& fw_type = checked_cast<const FixedWidthType&>(*type_);
+    if (row_major_) {
+      RETURN_NOT_OK(ComputeRowMajorStrides(fw_type, shape, &strides));
+    } else {
+      RETURN_NOT_OK(ComputeColumnMajorStrides(fw_type, shape, &strides));
+    }
+    return Tensor::Make(type_, std::move(data), shape, strides);
+  }
+
+ private:
+  // Rows per cache block: the output of a block should fit in the L2 cache,
+  // so that the strided writes of successive columns hit the same lines.
+  static constexpr int64_t kBlockBytes = 256 * 1024;
+  // Minimum number of rows per parallel task
+  static constexpr int64_t kMinRowsPerTask = 16 * 1024;
+
+  Status ConvertRowMajor(bool use_threads) {
+    const auto num_columns = static_cast<int64_t>(columns_.size());
+    const int64_t row_bytes = num_columns * byte_width_;
+    const int64_t block_rows = std::max<int64_t>(64, kBlockBytes / row_bytes);
+
+    int64_t num_tasks = 1;
+    if (use_threads) {
+      const int64_t capacity = GetCpuThreadPool()->GetCapacity();
+      num_tasks = std::max<int64_t>(
+          1, std::min(capacity * 4, num_rows_ / std::max(block_rows, kMinRowsPerTask)));
+    }
+    // Round the task size up to a whole number of blocks
+    const int64_t rows_per_task =
+        bit_util::CeilDiv(bit_util::CeilDiv(num_rows_, num_tasks), block_rows) *
+        block_rows;
+    num_tasks = bit_util::CeilDiv(num_rows_, rows_per_task);
+
+    return OptionalParallelFor(
+        use_threads && num_tasks > 1, static_cast<int>(num_tasks),
+        [&](int task) {
+          const int64_t task_start = task * rows_per_task;
+          const int64_t task_end = std::min(num_rows_, task_start + rows_per_task);
+          // Transpose one cache block at a time
+          for (int64_t start = task_start; start < task_end; start += block_rows) {
+            const int64_t end = std::min(task_end, start + block_rows);
+            for (int64_t i = 0; i < num_columns; ++i) {
+              CopyColumnRange(static_cast<int>(i), start, end);
+            }
+          }
+          return Status::OK();
+        });
+  }
+
+  // Copy rows [start, end) of column `i` to the output
+  void CopyColumnRange(int i, int64_t start, int64_t end) {
+    const auto num_columns = static_cast<int64_t>(columns_.size());
+    const CopyValuesFunc copy = (*copy_funcs_)[i];
+    const ChunkedArray& column = *columns_[i];
+    const std::vector<int64_t>& chunk_starts = chunk_starts_[i];
+    const int64_t out_stride = row_major_ ? num_columns : 1;
+
+    // Locate the chunk containing `start`
+    auto chunk_index = static_cast<int>(
+        std::upper_bound(chunk_starts.begin(), chunk_starts.end(), start) -
+        chunk_starts.begin() - 1);
+    int64_t row = start;
+    while (row < end) {
+      const ArrayData& chunk = *column.chunk(chunk_index)->data();
+      const int64_t offset = row - chunk_starts[chunk_index];
+      const int64_t length = std::min(end - row, chunk.length - offset);
+      uint8_t* out = row_major_ ? out_ + (row * num_columns + i) * byte_width_
+                                : out_ + (i * num_rows_ + row) * byte_width_;
+      copy(chunk, offset, length, fill_nulls_, fill_value_, out, out_stride);
+      row += length;
+      ++chunk_index;
+    }
+  }
+
+  const ChunkedArrayVector& columns_;
+  const int64_t num_rows_;
+  const std::shared_ptr<DataType> type_;
+  const int64_t byte_width_;
+  const bool row_major_;
+  const bool fill_nulls_;
+  const double fill_value_;
+
+  const std::vector<CopyValuesFunc>* copy_funcs_ = nullptr;
+  std::vector<std::vector<int64_t>> chunk_starts_;
+  uint8_t* out_ = nullptr;
+};
+
+constexpr int64_t ColumnsToTensorConverter::kBlockBytes;
+constexpr int64_t ColumnsToTensorConverter::kMinRowsPerTask;
+
+}  // namespace
+
+Result<std::shared_ptr<Tensor>> MakeTensorFromColumns(
+    const ChunkedArrayVector& columns, int64_t num_rows,
+    const TensorConversionOptions& options) {
+  for (const auto& column : columns) {
+    if (!IsSupportedColumnType(*column->type())) {
+      return Status::TypeError("Cannot convert column of type ", *column->type(),
+                               " to a Tensor");
+    }
+    if (!options.fill_nulls && column->null_count() > 0) {
+      return Status::Invalid(
+          "Cannot convert a column with nulls to a Tensor unless fill_nulls is set");
+    }
+  }
+
+  std::shared_ptr<DataType> type = options.type;
+  if (type == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(type, InferTensorType(columns, options));
+  } else if (!IsSupportedColumnType(*type)) {
+    return Status::TypeError("Cannot convert to a Tensor of type ", *type);
+  }
+  if (options.fill_nulls && !FillValueFits(type->id(), options.null_fill_value)) {
+    return Status::Invalid("Cannot fill nulls of a ", *type, " Tensor with ",
+                           options.null_fill_value, ": value out of range");
+  }
+
+  std::vector<CopyValuesFunc> copy_funcs(columns.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    copy_funcs[i] = GetCopyValuesFunc(type->id(), columns[i]->type()->id());
+    DCHECK_NE(copy_funcs[i], nullptr);
+  }
+  ColumnsToTensorConverter converter(columns, num_rows, std::move(type),
+                                     options.row_major, options.fill_nulls,
+                                     options.null_fill_value);
+  return converter.Convert(copy_funcs, options.use_threads, options.pool);
+}
+
+Result<std::shared_ptr<Tensor>> MakeValidityTensorFromColumns(
+    const ChunkedArrayVector& columns, int64_t num_rows, bool row_major,
+    MemoryPool* pool) {
+  std::vector<CopyValuesFunc> copy_funcs(columns.size(), CopyValidity);
+  ColumnsToTensorConverter converter(columns, num_rows, uint8(), row_major,
+                                     /*fill_nulls=*/false, /*fill_value=*/0);
+  return converter.Convert(copy_funcs, /*use_threads=*/false, pool);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -17,11 +17,14 @@
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
 #include <numeric>
 #include <random>
 
+#include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 
 namespace arrow {
 
@@ -228,4 +231,136 @@ BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Float, Int64);
 BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Double, Int32);
 BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Double, Int64);
 
+struct LargeSparseMatrixData {
+  std::vector<int64_t> indptr;
+  std::vector<int64_t> indices;
+  std::vector<double> values;
+};
+
+// A square matrix of 1e5 x 1e5 with 10 non-zero values per row, too large
+// to be densified
+static std::shared_ptr<SparseCSRMatrix> MakeLargeSparseCSRMatrix(
+    LargeSparseMatrixData* data) {
+  const int64_t n = 100000;
+  const int64_t non_zero_per_row = 10;
+  std::mt19937_64 rng(42);
+  std::uniform_int_distribution<int64_t> column_dist(0, n - 1);
+
+  data->indptr.resize(n + 1);
+  for (int64_t i = 0; i < n; ++i) {
+    data->indptr[i] = static_cast<int64_t>(data->indices.size());
+    std::vector<int64_t> columns(non_zero_per_row);
+    for (auto& column : columns) {
+      column = column_dist(rng);
+    }
+    std::sort(columns.begin(), columns.end());
+    columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+    for (auto column : columns) {
+      data->indices.push_back(column);
+      data->values.push_back(static_cast<double>(i + column + 1));
+    }
+  }
+  const auto non_zero_length = static_cast<int64_t>(data->indices.size());
+  data->indptr[n] = non_zero_length;
+
+  const std::vector<int64_t> shape = {n, n};
+  auto sparse_index =
+      SparseCSRIndex::Make(int64(), shape, non_zero_length, Buffer::Wrap(data->indptr),
+                           Buffer::Wrap(data->indices))
+          .ValueOrDie();
+  return SparseCSRMatrix::Make(sparse_index, float64(), Buffer::Wrap(data->values),
+                               shape, {})
+      .ValueOrDie();
+}
+
+static void TransposeSparseCSRToCSC(benchmark::State& state) {  // NOLINT non-const reference
+  LargeSparseMatrixData data;
+  auto csr = MakeLargeSparseCSRMatrix(&data);
+  for (auto _ : state) {
+    ABORT_NOT_OK(SparseCSRMatrixToCSC(*csr));
+  }
+  state.SetItemsProcessed(state.iterations() * csr->non_zero_length());
+}
+
+static void TransposeSparseCSCToCSR(benchmark::State& state) {  // NOLINT non-const reference
+  LargeSparseMatrixData data;
+  auto csc = SparseCSRMatrixToCSC(*MakeLargeSparseCSRMatrix(&data)).ValueOrDie();
+  for (auto _ : state) {
+    ABORT_NOT_OK(SparseCSCMatrixToCSR(*csc));
+  }
+  state.SetItemsProcessed(state.iterations() * csc->non_zero_length());
+}
+
+// A dense 4096 x 4096 matrix with 1% non-zero values, large enough for the
+// conversions to run on several threads
+static std::shared_ptr<Tensor> MakeLargeDenseMatrix(std::vector<double>* values) {
+  const int64_t n = 4096;
+  values->assign(n * n, 0);
+  std::mt19937_64 rng(42);
+  std::uniform_int_distribution<int64_t> position_dist(0, n * n - 1);
+  for (int64_t k = 0; k < n * n / 100; ++k) {
+    (*values)[position_dist(rng)] = static_cast<double>(k + 1);
+  }
+  return Tensor::Make(float64(), Buffer::Wrap(*values), {n, n}).ValueOrDie();
+}
+
+template <typename SparseType>
+static void ConvertLargeDenseMatrix(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<double> values;
+  auto tensor = MakeLargeDenseMatrix(&values);
+  for (auto _ : state) {
+    ABORT_NOT_OK(SparseType::Make(*tensor));
+  }
+  state.SetItemsProcessed(state.iterations() * tensor->size());
+  state.SetBytesProcessed(state.iterations() * tensor->data()->size());
+}
+
+template <typename SparseType>
+static void DensifyLargeMatrix(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<double> values;
+  auto sparse = SparseType::Make(*MakeLargeDenseMatrix(&values)).ValueOrDie();
+  for (auto _ : state) {
+    ABORT_NOT_OK(sparse->ToTensor());
+  }
+  state.SetItemsProcessed(state.iterations() * sparse->size());
+}
+
+BENCHMARK(TransposeSparseCSRToCSC)->UseRealTime();
+BENCHMARK(TransposeSparseCSCToCSR)->UseRealTime();
+BENCHMARK_TEMPLATE(ConvertLargeDenseMatrix, SparseCOOTensor)->UseRealTime();
+BENCHMARK_TEMPLATE(ConvertLargeDenseMatrix, SparseCSRMatrix)->UseRealTime();
+BENCHMARK_TEMPLATE(ConvertLargeDenseMatrix, SparseCSCMatrix)->UseRealTime();
+BENCHMARK_TEMPLATE(DensifyLargeMatrix, SparseCSRMatrix)->UseRealTime();
+BENCHMARK_TEMPLATE(DensifyLargeMatrix, SparseCSCMatrix)->UseRealTime();
+
+static void RecordBatchToTensor(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t num_rows = 1 << 20;
+  const int num_columns = 16;
+  const bool row_major = state.range(0) != 0;
+  const bool use_threads = state.range(1) != 0;
+
+  random::RandomArrayGenerator rng(0);
+  FieldVector fields;
+  for (int i = 0; i < num_columns; ++i) {
+    // Mix integer and floating-point columns to exercise type promotion
+    fields.push_back(field("f" + std::to_string(i), i % 2 ? int16() : float32(),
+                           /*nullable=*/false));
+  }
+  auto batch = rng.BatchOf(fields, num_rows);
+
+  TensorConversionOptions options;
+  options.row_major = row_major;
+  options.use_threads = use_threads;
+  for (auto _ : state) {
+    ABORT_NOT_OK(batch->ToTensor(options));
+  }
+  state.SetItemsProcessed(state.iterations() * num_rows * num_columns);
+  state.SetBytesProcessed(state.iterations() * num_rows * num_columns * sizeof(float));
+}
+
+BENCHMARK(RecordBatchToTensor)
+    ->ArgNames({"row_major", "use_threads"})
+    ->ArgsProduct({{0, 1}, {0, 1}})
+    ->UseRealTime();
+
 }  // namespace arrow
@@ -27,13 +27,22 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
+#include "arrow/chunked_array.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 
+using internal::checked_cast;
+
 void AssertCountNonZero(const Tensor& t, int64_t expected) {
   ASSERT_OK_AND_ASSIGN(int64_t count, t.CountNonZero());
   ASSERT_EQ(count, expected);
@@ -752,4 +761,193 @@ TEST(TestNumericTensor, ElementAccessWithNonContiguousStrides) {
   ASSERT_EQ(11.1f, t_f32.Value({2, 2}));
 }
 
+template <typename ValueType>
+void AssertTensorValues(
+    const Tensor& tensor,
+    const std::vector<std::vector<typename ValueType::c_type>>& expected_rows) {
+  ASSERT_EQ(tensor.ndim(), 2);
+  ASSERT_EQ(tensor.shape()[0], static_cast<int64_t>(expected_rows.size()));
+  for (int64_t i = 0; i < tensor.shape()[0]; ++i) {
+    ASSERT_EQ(tensor.shape()[1], static_cast<int64_t>(expected_rows[i].size()));
+    for (int64_t j = 0; j < tensor.shape()[1]; ++j) {
+      const auto expected = expected_rows[i][j];
+      const auto actual = tensor.Value<ValueType>({i, j});
+      if (std::isnan(static_cast<double>(expected))) {
+        ASSERT_TRUE(std::isnan(static_cast<double>(actual))) << "at " << i << ", " << j;
+      } else {
+        ASSERT_EQ(expected, actual) << "at " << i << ", " << j;
+      }
+    }
+  }
+}
+
+TEST(TestRecordBatchToTensor, SameType) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("a", float64()), field("b", float64()), field("c", float64())}),
+      "[[1, 2, 3], [4, 5, 6]]");
+  for (bool row_major : {true, false}) {
+    TensorConversionOptions options;
+    options.row_major = row_major;
+    ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(options));
+    ASSERT_OK(tensor->Validate());
+    ASSERT_TRUE(tensor->type()->Equals(float64()));
+    ASSERT_EQ(row_major, tensor->is_row_major());
+    ASSERT_EQ(!row_major, tensor->is_column_major());
+    AssertTensorValues<DoubleType>(*tensor, {{1, 2, 3}, {4, 5, 6}});
+  }
+}
+
+TEST(TestRecordBatchToTensor, TypePromotion) {
+  auto check = [](const std::shared_ptr<Schema>& schema,
+                  const std::shared_ptr<DataType>& expected) {
+    auto batch = RecordBatchFromJSON(schema, "[[1, 2], [3, 4]]");
+    ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+    AssertTypeEqual(*expected, *tensor->type());
+  };
+  check(schema({field("a", int8()), field("b", int32())}), int32());
+  check(schema({field("a", uint8()), field("b", uint16())}), uint16());
+  check(schema({field("a", uint16()), field("b", int8())}), int32());
+  check(schema({field("a", uint64()), field("b", int8())}), float64());
+  check(schema({field("a", int16()), field("b", float32())}), float32());
+  check(schema({field("a", int32()), field("b", float32())}), float64());
+  check(schema({field("a", uint8()), field("b", float64())}), float64());
+
+  auto batch = RecordBatchFromJSON(schema({field("a", int8()), field("b", float32())}),
+                                   "[[-1, 2.5], [3, 4.5]]");
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+  AssertTensorValues<FloatType>(*tensor, {{-1, 2.5}, {3, 4.5}});
+
+  TensorConversionOptions options;
+  options.type = int64();
+  ASSERT_OK_AND_ASSIGN(tensor, batch->ToTensor(options));
+  AssertTensorValues<Int64Type>(*tensor, {{-1, 2}, {3, 4}});
+}
+
+TEST(TestRecordBatchToTensor, Nulls) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", float64())}),
+                                   "[[1, null], [null, 2], [3, 4]]");
+  ASSERT_RAISES(Invalid, batch->ToTensor());
+
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  for (bool row_major : {true, false}) {
+    TensorConversionOptions options;
+    options.row_major = row_major;
+    options.fill_nulls = true;
+    ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(options));
+    AssertTensorValues<DoubleType>(*tensor, {{1, nan}, {nan, 2}, {3, 4}});
+
+    options.null_fill_value = -1;
+    options.type = int32();
+    ASSERT_OK_AND_ASSIGN(tensor, batch->ToTensor(options));
+    AssertTensorValues<Int32Type>(*tensor, {{1, -1}, {-1, 2}, {3, 4}});
+
+    ASSERT_OK_AND_ASSIGN(auto mask, batch->ToValidityTensor(row_major));
+    ASSERT_EQ(row_major, mask->is_row_major());
+    AssertTensorValues<UInt8Type>(*mask, {{1, 0}, {0, 1}, {1, 1}});
+  }
+
+  // NaN can't be written to an integer tensor
+  TensorConversionOptions options;
+  options.fill_nulls = true;
+  options.type = int32();
+  ASSERT_RAISES(Invalid, batch->ToTensor(options));
+  // A finite fill value doesn't promote integer columns to floating-point
+  options.type = nullptr;
+  options.null_fill_value = 0;
+  auto int_batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", int8())}),
+                                       "[[1, null], [null, 2]]");
+  ASSERT_OK_AND_ASSIGN(auto tensor, int_batch->ToTensor(options));
+  AssertTensorValues<Int32Type>(*tensor, {{1, 0}, {0, 2}});
+
+  // Fill values must be representable in the tensor type
+  options.null_fill_value = 1e20;
+  ASSERT_RAISES(Invalid, int_batch->ToTensor(options));
+  options.type = int64();
+  ASSERT_RAISES(Invalid, int_batch->ToTensor(options));
+  options.type = float32();
+  options.null_fill_value = 1e40;
+  ASSERT_RAISES(Invalid, int_batch->ToTensor(options));
+  options.type = uint8();
+  options.null_fill_value = -1;
+  ASSERT_RAISES(Invalid, int_batch->ToTensor(options));
+  options.null_fill_value = 255.5;
+  ASSERT_OK_AND_ASSIGN(tensor, int_batch->ToTensor(options));
+  AssertTensorValues<UInt8Type>(*tensor, {{1, 255}, {255, 2}});
+  options.type = int64();
+  options.null_fill_value = -9223372036854775808.0;
+  ASSERT_OK_AND_ASSIGN(tensor, int_batch->ToTensor(options));
+  AssertTensorValues<Int64Type>(
+      *tensor, {{1, std::numeric_limits<int64_t>::min()},
+                {std::numeric_limits<int64_t>::min(), 2}});
+  options.type = float64();
+  options.null_fill_value = 1e20;
+  ASSERT_OK_AND_ASSIGN(tensor, int_batch->ToTensor(options));
+  AssertTensorValues<DoubleType>(*tensor, {{1, 1e20}, {1e20, 2}});
+}
+
+TEST(TestRecordBatchToTensor, Unsupported) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", utf8())}),
+                                   R"([[1, "x"]])");
+  ASSERT_RAISES(TypeError, batch->ToTensor());
+  ASSERT_OK_AND_ASSIGN(auto empty, RecordBatch::MakeEmpty(schema({})));
+  ASSERT_RAISES(Invalid, empty->ToTensor());
+}
+
+TEST(TestRecordBatchToTensor, Large) {
+  // Enough rows to be split into several blocks and parallel tasks
+  const int64_t length = 100000;
+  random::RandomArrayGenerator rng(42);
+  auto batch = rng.BatchOf({field("a", int16()), field("b", float32()),
+                            field("c", uint8()), field("d", float32())},
+                           length);
+  batch = batch->Slice(7);
+  for (bool use_threads : {false, true}) {
+    for (bool row_major : {true, false}) {
+      TensorConversionOptions options;
+      options.use_threads = use_threads;
+      options.row_major = row_major;
+      options.fill_nulls = true;
+      options.null_fill_value = 0;
+      ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(options));
+      ASSERT_OK_AND_ASSIGN(auto mask, batch->ToValidityTensor(row_major));
+      AssertTypeEqual(*float32(), *tensor->type());
+      for (int j = 0; j < batch->num_columns(); ++j) {
+        const Array& column = *batch->column(j);
+        for (int64_t i = 0; i < batch->num_rows(); ++i) {
+          float expected = 0;
+          if (column.IsValid(i)) {
+            ASSERT_OK_AND_ASSIGN(auto scalar, column.GetScalar(i));
+            ASSERT_OK_AND_ASSIGN(scalar, scalar->CastTo(float32()));
+            expected = checked_cast<const FloatScalar&>(*scalar).value;
+          }
+          ASSERT_EQ(expected, tensor->Value<FloatType>({i, j}));
+          ASSERT_EQ(column.IsValid(i), mask->Value<UInt8Type>({i, j}) != 0);
+        }
+      }
+    }
+  }
+}
+
+TEST(TestTableToTensor, Chunked) {
+  auto schm = schema({field("a", int64()), field("b", int32())});
+  auto table = TableFromJSON(schm, {"[[1, 10], [2, 20]]", "[]", "[[3, 30]]",
+                                    "[[4, 40], [5, 50], [6, 60]]"});
+  // Give the columns different chunk layouts
+  ASSERT_OK_AND_ASSIGN(auto b, Concatenate(table->column(1)->chunks()));
+  table = Table::Make(schm, {table->column(0), std::make_shared<ChunkedArray>(
+                                                  ArrayVector{b->Slice(0, 3),
+                                                              b->Slice(3)})});
+  for (bool row_major : {true, false}) {
+    TensorConversionOptions options;
+    options.row_major = row_major;
+    ASSERT_OK_AND_ASSIGN(auto tensor, table->ToTensor(options));
+    AssertTypeEqual(*int64(), *tensor->type());
+    AssertTensorValues<Int64Type>(
+        *tensor, {{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}, {6, 60}});
+    ASSERT_OK_AND_ASSIGN(auto mask, table->ToValidityTensor(row_major));
+    AssertTensorValues<UInt8Type>(*mask,
+                                  {{1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+  }
+}
+
 }  // namespace arrow
@@ -439,6 +439,10 @@ class SchemaWriter {
 
   Status Visit(const ExtensionType& type) { return Status::NotImplemented(type.name()); }
 
+  Status Visit(const RunEndEncodedType& type) {
+    return Status::NotImplemented(type.name());
+  }
+
  private:
   const Schema& schema_;
   const DictionaryFieldMapper& mapper_;
@@ -745,6 +749,10 @@ class ArrayWriter {
 
   Status Visit(const ExtensionArray& array) { return VisitArrayValues(*array.storage()); }
 
+  Status Visit(const RunEndEncodedArray& array) {
+    return Status::NotImplemented(array.type()->name());
+  }
+
  private:
   const std::string& name_;
   const Array& array_;
@@ -1553,6 +1561,10 @@ class ArrayReader {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    return Status::NotImplemented(type.name());
+  }
+
   Status InitializeData(int num_buffers) {
     data_ = std::make_shared<ArrayData>(type_, length_);
     data_->buffers.resize(num_buffers);
@@ -63,6 +63,13 @@ constexpr Type::type StringType::type_id;
 
 constexpr Type::type LargeStringType::type_id;
 
+constexpr Type::type BinaryViewType::type_id;
+constexpr int BinaryViewType::kSize;
+constexpr int BinaryViewType::kInlineSize;
+constexpr int BinaryViewType::kPrefixSize;
+
+constexpr Type::type StringViewType::type_id;
+
 constexpr Type::type FixedSizeBinaryType::type_id;
 
 constexpr Type::type StructType::type_id;
@@ -75,6 +82,8 @@ constexpr Type::type SparseUnionType::type_id;
 
 constexpr Type::type DenseUnionType::type_id;
 
+constexpr Type::type RunEndEncodedType::type_id;
+
 constexpr Type::type Date32Type::type_id;
 
 constexpr Type::type Date64Type::type_id;
@@ -148,6 +157,8 @@ std::string ToString(Type::type id) {
     TO_STRING_CASE(BINARY)
     TO_STRING_CASE(LARGE_STRING)
     TO_STRING_CASE(LARGE_BINARY)
+    TO_STRING_CASE(STRING_VIEW)
+    TO_STRING_CASE(BINARY_VIEW)
     TO_STRING_CASE(FIXED_SIZE_BINARY)
     TO_STRING_CASE(STRUCT)
     TO_STRING_CASE(LIST)
@@ -156,6 +167,7 @@ std::string ToString(Type::type id) {
     TO_STRING_CASE(MAP)
     TO_STRING_CASE(DENSE_UNION)
     TO_STRING_CASE(SPARSE_UNION)
+    TO_STRING_CASE(RUN_END_ENCODED)
     TO_STRING_CASE(DICTIONARY)
     TO_STRING_CASE(EXTENSION)
 
@@ -527,6 +539,10 @@ std::string StringType::ToString() const { return "string"; }
 
 std::string LargeStringType::ToString() const { return "large_string"; }
 
+std::string BinaryViewType::ToString() const { return "binary_view"; }
+
+std::string StringViewType::ToString() const { return "string_view"; }
+
 int FixedSizeBinaryType::bit_width() const { return CHAR_BIT * byte_width(); }
 
 Result<std::shared_ptr<DataType>> FixedSizeBinaryType::Make(int32_t byte_width) {
@@ -714,6 +730,48 @@ Result<std::shared_ptr<DataType>> DenseUnionType::Make(
   return std::make_shared<DenseUnionType>(fields, type_codes);
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded type
+
+RunEndEncodedType::RunEndEncodedType(std::shared_ptr<DataType> run_end_type,
+                                     std::shared_ptr<DataType> value_type)
+    : NestedType(Type::RUN_END_ENCODED) {
+  DCHECK(RunEndTypeValid(*run_end_type));
+  children_ = {std::make_shared<Field>("run_ends", std::move(run_end_type), false),
+               std::make_shared<Field>("values", std::move(value_type), true)};
+}
+
+Result<std::shared_ptr<DataType>> RunEndEncodedType::Make(
+    std::shared_ptr<DataType> run_end_type, std::shared_ptr<DataType> value_type) {
+  if (run_end_type == nullptr || value_type == nullptr) {
+    return Status::Invalid("Run-end encoded type needs non-null child types");
+  }
+  if (!RunEndTypeValid(*run_end_type)) {
+    return Status::TypeError("Run end type must be int16, int32 or int64 (got ",
+                             *run_end_type, ")");
+  }
+  return std::make_shared<RunEndEncodedType>(std::move(run_end_type),
+                                             std::move(value_type));
+}
+
+bool RunEndEncodedType::RunEndTypeValid(const DataType& run_end_type) {
+  switch (run_end_type.id()) {
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::string RunEndEncodedType::ToString() const {
+  std::stringstream s;
+  s << "run_end_encoded<run_ends: " << run_end_type()->ToString()
+    << ", values: " << value_type()->ToString() << ">";
+  return s.str();
+}
+
 // ----------------------------------------------------------------------
 // Struct type
 
@@ -2022,6 +2080,8 @@ PARAMETER_LESS_FINGERPRINT(Binary)
 PARAMETER_LESS_FINGERPRINT(LargeBinary)
 PARAMETER_LESS_FINGERPRINT(String)
 PARAMETER_LESS_FINGERPRINT(LargeString)
+PARAMETER_LESS_FINGERPRINT(BinaryView)
+PARAMETER_LESS_FINGERPRINT(StringView)
 PARAMETER_LESS_FINGERPRINT(Date32)
 PARAMETER_LESS_FINGERPRINT(Date64)
 
@@ -2080,6 +2140,16 @@ std::string FixedSizeListType::ComputeFingerprint() const {
   return "";
 }
 
+std::string RunEndEncodedType::ComputeFingerprint() const {
+  const auto& run_end_fingerprint = children_[0]->fingerprint();
+  const auto& value_fingerprint = children_[1]->fingerprint();
+  if (!run_end_fingerprint.empty() && !value_fingerprint.empty()) {
+    return TypeIdFingerprint(*this) + "{" + run_end_fingerprint + value_fingerprint +
+           "}";
+  }
+  return "";
+}
+
 std::string FixedSizeBinaryType::ComputeFingerprint() const {
   std::stringstream ss;
   ss << TypeIdFingerprint(*this) << "[" << byte_width_ << "]";
@@ -2191,6 +2261,8 @@ TYPE_FACTORY(utf8, StringType)
 TYPE_FACTORY(large_utf8, LargeStringType)
 TYPE_FACTORY(binary, BinaryType)
 TYPE_FACTORY(large_binary, LargeBinaryType)
+TYPE_FACTORY(utf8_view, StringViewType)
+TYPE_FACTORY(binary_view, BinaryViewType)
 TYPE_FACTORY(date64, Date64Type)
 TYPE_FACTORY(date32, Date32Type)
 
@@ -2288,6 +2360,12 @@ std::shared_ptr<DataType> dense_union(FieldVector child_fields,
   return std::make_shared<DenseUnionType>(std::move(child_fields), std::move(type_codes));
 }
 
+std::shared_ptr<DataType> run_end_encoded(std::shared_ptr<DataType> run_end_type,
+                                          std::shared_ptr<DataType> value_type) {
+  return std::make_shared<RunEndEncodedType>(std::move(run_end_type),
+                                             std::move(value_type));
+}
+
 FieldVector FieldsFromArraysAndNames(std::vector<std::string> names,
                                      const ArrayVector& arrays) {
   FieldVector fields(arrays.size());
@@ -2454,6 +2532,11 @@ const std::vector<std::shared_ptr<DataType>>& StringTypes() {
   return types;
 }
 
+const std::vector<std::shared_ptr<DataType>>& BinaryViewTypes() {
+  static DataTypeVector types = {binary_view(), utf8_view()};
+  return types;
+}
+
 const std::vector<std::shared_ptr<DataType>>& SignedIntTypes() {
   std::call_once(static_data_initialized, InitStaticData);
   return g_signed_int_types;
@@ -32,6 +32,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/endian.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/variant.h"
 #include "arrow/util/visibility.h"
 #include "arrow/visitor.h"  // IWYU pragma: keep
@@ -113,8 +114,13 @@ struct ARROW_EXPORT DataTypeLayout {
   std::vector<BufferSpec> buffers;
   /// Whether this type expects an associated dictionary array.
   bool has_dictionary = false;
+  /// Specification of the buffers following the fixed ones, for types which
+  /// accept any number of additional buffers (such as binary views).
+  util::optional<BufferSpec> variadic_spec;
 
   explicit DataTypeLayout(std::vector<BufferSpec> v) : buffers(std::move(v)) {}
+  DataTypeLayout(std::vector<BufferSpec> v, BufferSpec variadic_spec)
+      : buffers(std::move(v)), variadic_spec(variadic_spec) {}
 };
 
 /// \brief Base class for all data types
@@ -755,6 +761,81 @@ class ARROW_EXPORT LargeStringType : public LargeBinaryType {
   std::string ComputeFingerprint() const override;
 };
 
+/// \brief Concrete type class for variable-size binary data stored as views
+///
+/// Each value is described by a 16-byte view. Values of up to kInlineSize
+/// bytes are stored entirely inside their view; longer values keep their
+/// first kPrefixSize bytes inline and reference the rest in one of any number
+/// of data buffers. Views may share and reorder data, so gathering values
+/// only moves views, and most comparisons are decided by the inline prefix.
+class ARROW_EXPORT BinaryViewType : public DataType {
+ public:
+  static constexpr Type::type type_id = Type::BINARY_VIEW;
+  static constexpr bool is_utf8 = false;
+  using PhysicalType = BinaryViewType;
+
+  static constexpr int kSize = 16;
+  static constexpr int kInlineSize = 12;
+  static constexpr int kPrefixSize = 4;
+
+  /// \brief The view of a single value
+  union c_type {
+    struct {
+      int32_t size;
+      uint8_t data[kInlineSize];
+    } inlined;
+    struct {
+      int32_t size;
+      uint8_t prefix[kPrefixSize];
+      int32_t buffer_index;
+      int32_t offset;
+    } ref;
+
+    /// The size of the value in bytes
+    int32_t size() const { return inlined.size; }
+    /// Whether the value is stored entirely inside the view
+    bool is_inline() const { return inlined.size <= kInlineSize; }
+  };
+
+  static constexpr const char* type_name() { return "binary_view"; }
+
+  BinaryViewType() : BinaryViewType(Type::BINARY_VIEW) {}
+
+  DataTypeLayout layout() const override {
+    return DataTypeLayout(
+        {DataTypeLayout::Bitmap(), DataTypeLayout::FixedWidth(kSize)},
+        DataTypeLayout::VariableWidth());
+  }
+
+  std::string ToString() const override;
+  std::string name() const override { return "binary_view"; }
+
+ protected:
+  std::string ComputeFingerprint() const override;
+
+  // Allow subclasses like StringViewType to change the logical type.
+  explicit BinaryViewType(Type::type logical_type) : DataType(logical_type) {}
+};
+
+/// \brief Concrete type class for variable-size string data stored as views,
+/// utf8-encoded
+class ARROW_EXPORT StringViewType : public BinaryViewType {
+ public:
+  static constexpr Type::type type_id = Type::STRING_VIEW;
+  static constexpr bool is_utf8 = true;
+  using PhysicalType = BinaryViewType;
+
+  static constexpr const char* type_name() { return "utf8_view"; }
+
+  StringViewType() : BinaryViewType(Type::STRING_VIEW) {}
+
+  std::string ToString() const override;
+  std::string name() const override { return "utf8_view"; }
+
+ protected:
+  std::string ComputeFingerprint() const override;
+};
+
 /// \brief Concrete type class for fixed-size binary data
 class ARROW_EXPORT FixedSizeBinaryType : public FixedWidthType, public ParametricType {
  public:
@@ -1201,6 +1282,45 @@ class ARROW_EXPORT DenseUnionType : public UnionType {
   std::string name() const override { return "dense_union"; }
 };
 
+/// \brief Concrete type class for run-end encoded data
+///
+/// A run-end encoded array has two children: a signed integer array of
+/// strictly increasing logical end offsets (one per run) and an array holding
+/// the value of each run.  Like unions, run-end encoded arrays don't have a
+/// top-level validity bitmap: nulls are represented in the values child.
+class ARROW_EXPORT RunEndEncodedType : public NestedType {
+ public:
+  static constexpr Type::type type_id = Type::RUN_END_ENCODED;
+
+  static constexpr const char* type_name() { return "run_end_encoded"; }
+
+  RunEndEncodedType(std::shared_ptr<DataType> run_end_type,
+                    std::shared_ptr<DataType> value_type);
+
+  // A constructor variant that validates input parameters
+  static Result<std::shared_ptr<DataType>> Make(std::shared_ptr<DataType> run_end_type,
+                                                std::shared_ptr<DataType> value_type);
+
+  DataTypeLayout layout() const override {
+    // A layout with a dummy null bitmap buffer, so that run end encoded arrays
+    // don't need a special case for the layout.
+    return DataTypeLayout({DataTypeLayout::AlwaysNull()});
+  }
+
+  const std::shared_ptr<DataType>& run_end_type() const { return fields()[0]->type(); }
+  const std::shared_ptr<DataType>& value_type() const { return fields()[1]->type(); }
+
+  std::string ToString() const override;
+
+  std::string name() const override { return "run_end_encoded"; }
+
+  /// \brief Whether the given type can be used to store run ends
+  static bool RunEndTypeValid(const DataType& run_end_type);
+
+ protected:
+  std::string ComputeFingerprint() const override;
+};
+
 /// @}
 
 // ----------------------------------------------------------------------
@@ -2104,6 +2224,7 @@ static inline bool HasValidityBitmap(Type::type id) {
     case Type::NA:
     case Type::DENSE_UNION:
     case Type::SPARSE_UNION:
+    case Type::RUN_END_ENCODED:
       return false;
     default:
       return true;
@@ -2141,6 +2262,9 @@ ARROW_EXPORT
 const std::vector<std::shared_ptr<DataType>>& BinaryTypes();
 ARROW_EXPORT
 const std::vector<std::shared_ptr<DataType>>& StringTypes();
+// Binary and string view types
+ARROW_EXPORT
+const std::vector<std::shared_ptr<DataType>>& BinaryViewTypes();
 // Temporal types including time and timestamps for each unit
 ARROW_EXPORT
 const std::vector<std::shared_ptr<DataType>>& TemporalTypes();
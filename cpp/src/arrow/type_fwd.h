@@ -128,6 +128,16 @@ class LargeStringArray;
 class LargeStringBuilder;
 struct LargeStringScalar;
 
+class BinaryViewType;
+class BinaryViewArray;
+class BinaryViewBuilder;
+struct BinaryViewScalar;
+
+class StringViewType;
+class StringViewArray;
+class StringViewBuilder;
+struct StringViewScalar;
+
 class ListType;
 class ListArray;
 class ListBuilder;
@@ -179,6 +189,11 @@ class DenseUnionArray;
 class DenseUnionBuilder;
 struct DenseUnionScalar;
 
+class RunEndEncodedType;
+class RunEndEncodedArray;
+class RunEndEncodedBuilder;
+struct RunEndEncodedScalar;
+
 template <typename TypeClass>
 class NumericArray;
 
@@ -272,6 +287,7 @@ struct ExtensionScalar;
 
 class Tensor;
 class SparseTensor;
+struct TensorConversionOptions;
 
 // ----------------------------------------------------------------------
 
@@ -405,6 +421,18 @@ struct Type {
     /// Calendar interval type with three fields.
     INTERVAL_MONTH_DAY_NANO,
 
+    /// Run-end encoded data: a child array of run ends and a child array of
+    /// values, one per run
+    RUN_END_ENCODED,
+
+    /// Like STRING, but with 16-byte views inlining short values and
+    /// referencing longer ones in any number of data buffers
+    STRING_VIEW,
+
+    /// Like BINARY, but with 16-byte views inlining short values and
+    /// referencing longer ones in any number of data buffers
+    BINARY_VIEW,
+
     // Leave this at the end
     MAX_ID
   };
@@ -449,6 +477,10 @@ ARROW_EXPORT const std::shared_ptr<DataType>& large_utf8();
 ARROW_EXPORT const std::shared_ptr<DataType>& binary();
 /// \brief Return a LargeBinaryType instance
 ARROW_EXPORT const std::shared_ptr<DataType>& large_binary();
+/// \brief Return a StringViewType instance
+ARROW_EXPORT const std::shared_ptr<DataType>& utf8_view();
+/// \brief Return a BinaryViewType instance
+ARROW_EXPORT const std::shared_ptr<DataType>& binary_view();
 /// \brief Return a Date32Type instance
 ARROW_EXPORT const std::shared_ptr<DataType>& date32();
 /// \brief Return a Date64Type instance
@@ -563,6 +595,13 @@ std::shared_ptr<DataType> ARROW_EXPORT
 dense_union(const ArrayVector& children, std::vector<std::string> field_names = {},
             std::vector<int8_t> type_codes = {});
 
+/// \brief Create a RunEndEncodedType instance
+/// \param[in] run_end_type the type of the run ends (must be int16, int32 or int64)
+/// \param[in] value_type the type of the run values
+ARROW_EXPORT
+std::shared_ptr<DataType> run_end_encoded(std::shared_ptr<DataType> run_end_type,
+                                          std::shared_ptr<DataType> value_type);
+
 /// \brief Create a DictionaryType instance
 /// \param[in] index_type the type of the dictionary indices (must be
 /// a signed integer)
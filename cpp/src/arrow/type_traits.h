@@ -57,6 +57,8 @@ TYPE_ID_TRAIT(STRING, StringType)
 TYPE_ID_TRAIT(BINARY, BinaryType)
 TYPE_ID_TRAIT(LARGE_STRING, LargeStringType)
 TYPE_ID_TRAIT(LARGE_BINARY, LargeBinaryType)
+TYPE_ID_TRAIT(BINARY_VIEW, BinaryViewType)
+TYPE_ID_TRAIT(STRING_VIEW, StringViewType)
 TYPE_ID_TRAIT(FIXED_SIZE_BINARY, FixedSizeBinaryType)
 TYPE_ID_TRAIT(DATE32, Date32Type)
 TYPE_ID_TRAIT(DATE64, Date64Type)
@@ -76,6 +78,7 @@ TYPE_ID_TRAIT(FIXED_SIZE_LIST, FixedSizeListType)
 TYPE_ID_TRAIT(MAP, MapType)
 TYPE_ID_TRAIT(DENSE_UNION, DenseUnionType)
 TYPE_ID_TRAIT(SPARSE_UNION, SparseUnionType)
+TYPE_ID_TRAIT(RUN_END_ENCODED, RunEndEncodedType)
 TYPE_ID_TRAIT(DICTIONARY, DictionaryType)
 TYPE_ID_TRAIT(EXTENSION, ExtensionType)
 
@@ -381,6 +384,26 @@ struct TypeTraits<LargeStringType> {
   static inline std::shared_ptr<DataType> type_singleton() { return large_utf8(); }
 };
 
+template <>
+struct TypeTraits<BinaryViewType> {
+  using ArrayType = BinaryViewArray;
+  using BuilderType = BinaryViewBuilder;
+  using ScalarType = BinaryViewScalar;
+  using CType = BinaryViewType::c_type;
+  constexpr static bool is_parameter_free = true;
+  static inline std::shared_ptr<DataType> type_singleton() { return binary_view(); }
+};
+
+template <>
+struct TypeTraits<StringViewType> {
+  using ArrayType = StringViewArray;
+  using BuilderType = StringViewBuilder;
+  using ScalarType = StringViewScalar;
+  using CType = BinaryViewType::c_type;
+  constexpr static bool is_parameter_free = true;
+  static inline std::shared_ptr<DataType> type_singleton() { return utf8_view(); }
+};
+
 /// @}
 
 /// \addtogroup c-type-traits
@@ -485,6 +508,14 @@ struct TypeTraits<DenseUnionType> {
   constexpr static bool is_parameter_free = false;
 };
 
+template <>
+struct TypeTraits<RunEndEncodedType> {
+  using ArrayType = RunEndEncodedArray;
+  using BuilderType = RunEndEncodedBuilder;
+  using ScalarType = RunEndEncodedScalar;
+  constexpr static bool is_parameter_free = false;
+};
+
 template <>
 struct TypeTraits<DictionaryType> {
   using ArrayType = DictionaryArray;
@@ -612,6 +643,13 @@ using is_string_like_type =
 template <typename T, typename R = void>
 using enable_if_string_like = enable_if_t<is_string_like_type<T>::value, R>;
 
+// Binary view refers to BinaryView/StringView
+template <typename T>
+using is_binary_view_like_type = std::is_base_of<BinaryViewType, T>;
+
+template <typename T, typename R = void>
+using enable_if_binary_view_like = enable_if_t<is_binary_view_like_type<T>::value, R>;
+
 template <typename T, typename U, typename R = void>
 using enable_if_same = enable_if_t<std::is_same<T, U>::value, R>;
 
@@ -711,6 +749,12 @@ using is_union_type = std::is_base_of<UnionType, T>;
 template <typename T, typename R = void>
 using enable_if_union = enable_if_t<is_union_type<T>::value, R>;
 
+template <typename T>
+using is_run_end_encoded_type = std::is_base_of<RunEndEncodedType, T>;
+
+template <typename T, typename R = void>
+using enable_if_run_end_encoded = enable_if_t<is_run_end_encoded_type<T>::value, R>;
+
 // TemporalTypes
 
 template <typename T>
@@ -977,6 +1021,17 @@ static inline bool is_large_binary_like(Type::type type_id) {
   return false;
 }
 
+static inline bool is_binary_view_like(Type::type type_id) {
+  switch (type_id) {
+    case Type::BINARY_VIEW:
+    case Type::STRING_VIEW:
+      return true;
+    default:
+      break;
+  }
+  return false;
+}
+
 static inline bool is_dictionary(Type::type type_id) {
   return type_id == Type::DICTIONARY;
 }
@@ -1067,6 +1122,7 @@ static inline bool is_nested(Type::type type_id) {
     case Type::STRUCT:
     case Type::SPARSE_UNION:
     case Type::DENSE_UNION:
+    case Type::RUN_END_ENCODED:
       return true;
     default:
       break;
@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Helpers for creating, reading and comparing binary views
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "arrow/buffer.h"
+#include "arrow/type.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace util {
+
+using BinaryViewCType = BinaryViewType::c_type;
+
+/// \brief Make a view of a value short enough to be stored inline
+inline BinaryViewCType ToInlineBinaryView(const void* data, int32_t size) {
+  // Unused inline bytes must be zeroed
+  BinaryViewCType out{};
+  out.inlined.size = size;
+  std::memcpy(&out.inlined.data, data, size);
+  return out;
+}
+
+/// \brief Make a view of a value located at `offset` in data buffer `buffer_index`
+///
+/// Values of up to BinaryViewType::kInlineSize bytes are inlined regardless.
+inline BinaryViewCType ToBinaryView(const void* data, int32_t size,
+                                    int32_t buffer_index, int32_t offset) {
+  if (size <= BinaryViewType::kInlineSize) {
+    return ToInlineBinaryView(data, size);
+  }
+  BinaryViewCType out;
+  out.ref.size = size;
+  std::memcpy(&out.ref.prefix, data, BinaryViewType::kPrefixSize);
+  out.ref.buffer_index = buffer_index;
+  out.ref.offset = offset;
+  return out;
+}
+
+/// \brief Return a pointer to the first byte of a viewed value
+inline const uint8_t* BinaryViewData(const BinaryViewCType& v,
+                                     const std::shared_ptr<Buffer>* data_buffers) {
+  return v.is_inline() ? v.inlined.data
+                       : data_buffers[v.ref.buffer_index]->data() + v.ref.offset;
+}
+
+inline string_view FromBinaryView(const BinaryViewCType& v,
+                                  const std::shared_ptr<Buffer>* data_buffers) {
+  return string_view(reinterpret_cast<const char*>(BinaryViewData(v, data_buffers)),
+                     v.size());
+}
+
+/// \brief Return the size and prefix of a view as a single integer
+///
+/// Two views with different size-and-prefix hold different values.
+inline uint64_t BinaryViewSizeAndPrefix(const BinaryViewCType& v) {
+  uint64_t out;
+  std::memcpy(&out, &v, sizeof(out));
+  return out;
+}
+
+/// \brief Compare two viewed values for equality
+///
+/// Most unequal values are told apart by their size and prefix, without
+/// looking into the data buffers.
+inline bool EqualBinaryView(const BinaryViewCType& left,
+                            const std::shared_ptr<Buffer>* left_buffers,
+                            const BinaryViewCType& right,
+                            const std::shared_ptr<Buffer>* right_buffers) {
+  if (BinaryViewSizeAndPrefix(left) != BinaryViewSizeAndPrefix(right)) {
+    return false;
+  }
+  if (left.is_inline()) {
+    // Unused inline bytes are zeroed, so the remaining 8 bytes can be compared
+    // as a whole
+    return std::memcmp(reinterpret_cast<const uint8_t*>(&left) + 8,
+                       reinterpret_cast<const uint8_t*>(&right) + 8, 8) == 0;
+  }
+  return std::memcmp(BinaryViewData(left, left_buffers) + BinaryViewType::kPrefixSize,
+                     BinaryViewData(right, right_buffers) + BinaryViewType::kPrefixSize,
+                     left.size() - BinaryViewType::kPrefixSize) == 0;
+}
+
+/// \brief Compare two viewed values lexicographically
+///
+/// Returns a negative value, zero or a positive value if `left` is respectively
+/// less than, equal to or greater than `right`. The inline prefixes are compared
+/// first, so the data buffers are only read for values sharing a prefix.
+inline int CompareBinaryView(const BinaryViewCType& left,
+                             const std::shared_ptr<Buffer>* left_buffers,
+                             const BinaryViewCType& right,
+                             const std::shared_ptr<Buffer>* right_buffers) {
+  const int32_t left_size = left.size();
+  const int32_t right_size = right.size();
+  const int32_t prefix_size =
+      std::min(BinaryViewType::kPrefixSize, std::min(left_size, right_size));
+  int cmp = std::memcmp(left.inlined.data, right.inlined.data, prefix_size);
+  if (cmp != 0) {
+    return cmp;
+  }
+  if (prefix_size < BinaryViewType::kPrefixSize) {
+    // One of the values is a prefix of the other
+    return (left_size > right_size) - (left_size < right_size);
+  }
+  const int32_t rest_size = std::min(left_size, right_size) - prefix_size;
+  cmp = std::memcmp(BinaryViewData(left, left_buffers) + prefix_size,
+                    BinaryViewData(right, right_buffers) + prefix_size, rest_size);
+  if (cmp != 0) {
+    return cmp;
+  }
+  return (left_size > right_size) - (left_size < right_size);
+}
+
+}  // namespace util
+}  // namespace arrow
@@ -879,8 +879,9 @@ struct HashTraits<T, enable_if_t<has_c_type<T>::value && !is_8bit_int<T>::value>
 };
 
 template <typename T>
-struct HashTraits<T, enable_if_t<has_string_view<T>::value &&
-                                 !std::is_base_of<LargeBinaryType, T>::value>> {
+struct HashTraits<T, enable_if_t<(has_string_view<T>::value &&
+                                  !std::is_base_of<LargeBinaryType, T>::value) ||
+                                 is_binary_view_like_type<T>::value>> {
   using MemoTableType = BinaryMemoTable<BinaryBuilder>;
 };
 
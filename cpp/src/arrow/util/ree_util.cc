@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/ree_util.h"
+
+#include <limits>
+
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace ree_util {
+
+namespace {
+
+template <typename RunEndCType>
+int64_t FindPhysicalLengthImpl(const ArraySpan& span) {
+  if (span.length == 0) {
+    return 0;
+  }
+  const auto* run_ends = RunEnds<RunEndCType>(span);
+  const int64_t num_runs = RunEndsArray(span).length;
+  const int64_t first = FindPhysicalIndex(run_ends, num_runs, 0, span.offset);
+  const int64_t last =
+      FindPhysicalIndex(run_ends, num_runs, span.length - 1, span.offset);
+  return last - first + 1;
+}
+
+template <typename RunEndCType>
+int64_t LogicalNullCountImpl(const ArraySpan& span) {
+  const ArraySpan& values = ValuesArray(span);
+  const uint8_t* validity = values.buffers[0].data;
+  int64_t null_count = 0;
+  RunEndEncodedArraySpan<RunEndCType> ree_span(span);
+  for (auto it = ree_span.begin(); it != ree_span.end(); ++it) {
+    if (!bit_util::GetBit(validity, values.offset + it.index_into_array())) {
+      null_count += it.run_length();
+    }
+  }
+  return null_count;
+}
+
+template <typename RunEndCType>
+Status ValidateRunEnds(int64_t logical_length, int64_t logical_offset,
+                       const ArraySpan& run_ends_span, bool full) {
+  const int64_t num_runs = run_ends_span.length;
+  if (logical_offset + logical_length >
+      static_cast<int64_t>(std::numeric_limits<RunEndCType>::max())) {
+    return Status::Invalid("Offset + length of a run-end encoded array must fit in ",
+                           *run_ends_span.type, " but got offset ", logical_offset,
+                           " and length ", logical_length);
+  }
+  if (num_runs == 0) {
+    if (logical_length > 0) {
+      return Status::Invalid("Run-end encoded array has non-zero length ",
+                             logical_length, ", but run ends array has zero length");
+    }
+    return Status::OK();
+  }
+  const auto* run_ends = run_ends_span.GetValues<RunEndCType>(1);
+  if (static_cast<int64_t>(run_ends[num_runs - 1]) < logical_offset + logical_length) {
+    return Status::Invalid("Last run end is ", run_ends[num_runs - 1],
+                           " but it should match ", logical_offset + logical_length,
+                           " (offset: ", logical_offset, ", length: ", logical_length,
+                           ")");
+  }
+  if (!full) {
+    return Status::OK();
+  }
+  if (run_ends_span.GetNullCount() != 0) {
+    return Status::Invalid("Null values in run ends array");
+  }
+  RunEndCType prev = 0;
+  for (int64_t i = 0; i < num_runs; ++i) {
+    if (run_ends[i] <= prev) {
+      if (i == 0) {
+        return Status::Invalid(
+            "All run ends must be greater than 0 but the first run end is ", run_ends[i]);
+      }
+      return Status::Invalid(
+          "Every run end must be strictly greater than the previous run end, but "
+          "run_ends[",
+          i, "] is ", run_ends[i], " and run_ends[", i - 1, "] is ", prev);
+    }
+    prev = run_ends[i];
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+int64_t FindPhysicalIndex(const ArraySpan& span, int64_t i, int64_t absolute_offset) {
+  const auto& run_ends_span = RunEndsArray(span);
+  switch (run_ends_span.type->id()) {
+    case Type::INT16:
+      return FindPhysicalIndex(run_ends_span.GetValues<int16_t>(1), run_ends_span.length,
+                               i, absolute_offset);
+    case Type::INT32:
+      return FindPhysicalIndex(run_ends_span.GetValues<int32_t>(1), run_ends_span.length,
+                               i, absolute_offset);
+    default:
+      DCHECK_EQ(run_ends_span.type->id(), Type::INT64);
+      return FindPhysicalIndex(run_ends_span.GetValues<int64_t>(1), run_ends_span.length,
+                               i, absolute_offset);
+  }
+}
+
+int64_t FindPhysicalLength(const ArraySpan& span) {
+  switch (RunEndsArray(span).type->id()) {
+    case Type::INT16:
+      return FindPhysicalLengthImpl<int16_t>(span);
+    case Type::INT32:
+      return FindPhysicalLengthImpl<int32_t>(span);
+    default:
+      DCHECK_EQ(RunEndsArray(span).type->id(), Type::INT64);
+      return FindPhysicalLengthImpl<int64_t>(span);
+  }
+}
+
+int64_t LogicalNullCount(const ArraySpan& span) {
+  const ArraySpan& values = ValuesArray(span);
+  if (values.type->id() == Type::NA) {
+    return span.length;
+  }
+  if (!values.MayHaveNulls()) {
+    return 0;
+  }
+  switch (RunEndsArray(span).type->id()) {
+    case Type::INT16:
+      return LogicalNullCountImpl<int16_t>(span);
+    case Type::INT32:
+      return LogicalNullCountImpl<int32_t>(span);
+    default:
+      DCHECK_EQ(RunEndsArray(span).type->id(), Type::INT64);
+      return LogicalNullCountImpl<int64_t>(span);
+  }
+}
+
+Status ValidateRunEndEncodedChildren(const RunEndEncodedType& type,
+                                     int64_t logical_length, int64_t logical_offset,
+                                     const ArraySpan& run_ends, const ArraySpan& values,
+                                     bool full) {
+  if (!run_ends.type->Equals(*type.run_end_type())) {
+    return Status::Invalid("Run ends array of type ", *run_ends.type,
+                           " doesn't match the run end type ", *type.run_end_type());
+  }
+  if (!values.type->Equals(*type.value_type())) {
+    return Status::Invalid("Values array of type ", *values.type,
+                           " doesn't match the value type ", *type.value_type());
+  }
+  if (run_ends.length > values.length) {
+    return Status::Invalid("Length of run_ends (", run_ends.length,
+                           ") is greater than the length of values (", values.length,
+                           ")");
+  }
+  switch (run_ends.type->id()) {
+    case Type::INT16:
+      return ValidateRunEnds<int16_t>(logical_length, logical_offset, run_ends, full);
+    case Type::INT32:
+      return ValidateRunEnds<int32_t>(logical_length, logical_offset, run_ends, full);
+    case Type::INT64:
+      return ValidateRunEnds<int64_t>(logical_length, logical_offset, run_ends, full);
+    default:
+      return Status::Invalid("Run end type must be int16, int32 or int64 (got ",
+                             *run_ends.type, ")");
+  }
+}
+
+}  // namespace ree_util
+}  // namespace arrow
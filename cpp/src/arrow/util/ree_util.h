@@ -0,0 +1,173 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "arrow/array/data.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace ree_util {
+
+/// \brief Get the child array holding the run ends from a run-end encoded span
+inline const ArraySpan& RunEndsArray(const ArraySpan& span) { return span.child_data[0]; }
+
+/// \brief Get the child array holding the run values from a run-end encoded span
+inline const ArraySpan& ValuesArray(const ArraySpan& span) { return span.child_data[1]; }
+
+/// \brief Get a pointer to the run ends of a run-end encoded span
+///
+/// Note that the run ends are *not* adjusted for the span offset: they
+/// refer to logical positions in the unsliced array.
+template <typename RunEndCType>
+const RunEndCType* RunEnds(const ArraySpan& span) {
+  DCHECK(RunEndsArray(span).type->id() == CTypeTraits<RunEndCType>::ArrowType::type_id);
+  return RunEndsArray(span).GetValues<RunEndCType>(1);
+}
+
+/// \brief Find the index of the run containing the given logical position
+///
+/// \param[in] run_ends the run ends, strictly increasing
+/// \param[in] run_ends_size the number of runs
+/// \param[in] i the logical position, relative to absolute_offset
+/// \param[in] absolute_offset the offset of the (possibly sliced) array
+/// \return the physical index of the run, or run_ends_size if out of bounds
+template <typename RunEndCType>
+int64_t FindPhysicalIndex(const RunEndCType* run_ends, int64_t run_ends_size, int64_t i,
+                          int64_t absolute_offset) {
+  DCHECK_GE(absolute_offset + i, 0);
+  // The first run whose end is strictly greater than the position contains it
+  auto it = std::upper_bound(run_ends, run_ends + run_ends_size, absolute_offset + i);
+  return static_cast<int64_t>(std::distance(run_ends, it));
+}
+
+/// \brief Find the index of the run containing logical position i of a span
+ARROW_EXPORT int64_t FindPhysicalIndex(const ArraySpan& span, int64_t i,
+                                       int64_t absolute_offset);
+
+/// \brief Find the index of the first run covered by a (possibly sliced) span
+inline int64_t FindPhysicalOffset(const ArraySpan& span) {
+  return FindPhysicalIndex(span, 0, span.offset);
+}
+
+/// \brief Find the number of runs covered by a (possibly sliced) span
+ARROW_EXPORT int64_t FindPhysicalLength(const ArraySpan& span);
+
+/// \brief Count the logical nulls of a (possibly sliced) span
+///
+/// Run-end encoded arrays have no validity bitmap: a logical value is null
+/// if the value of its run is null.  Null runs are weighted by their length.
+ARROW_EXPORT int64_t LogicalNullCount(const ArraySpan& span);
+
+/// \brief Validate the structure of run ends (not the values child)
+///
+/// Checks that the run ends are non-null, positive, strictly increasing and
+/// cover the logical range [0, offset + length).
+ARROW_EXPORT Status ValidateRunEndEncodedChildren(const RunEndEncodedType& type,
+                                                  int64_t logical_length,
+                                                  int64_t logical_offset,
+                                                  const ArraySpan& run_ends,
+                                                  const ArraySpan& values, bool full);
+
+/// \brief A view over a run-end encoded span that iterates over its runs
+///
+/// Runs are clipped to the logical range of the span, so the first and the
+/// last run may be shorter than in the unsliced array.
+///
+/// \code
+/// RunEndEncodedArraySpan<int32_t> ree_span(span);
+/// for (auto it = ree_span.begin(); it != ree_span.end(); ++it) {
+///   Consume(values, it.index_into_array(), it.run_length());
+/// }
+/// \endcode
+template <typename RunEndCType>
+class RunEndEncodedArraySpan {
+ public:
+  class Iterator {
+   public:
+    Iterator(const RunEndEncodedArraySpan& span, int64_t logical_pos,
+             int64_t physical_pos)
+        : span_(&span), logical_pos_(logical_pos), physical_pos_(physical_pos) {}
+
+    /// \brief The physical index of the current run in the values child
+    int64_t index_into_array() const { return physical_pos_; }
+
+    /// \brief The logical position where the current run starts, relative to the span
+    int64_t logical_position() const { return logical_pos_; }
+
+    /// \brief The logical position where the current run ends, relative to the span
+    int64_t run_end() const {
+      return std::min(static_cast<int64_t>(span_->run_ends_[physical_pos_]) -
+                          span_->span_.offset,
+                      span_->span_.length);
+    }
+
+    /// \brief The number of logical values covered by the current run
+    int64_t run_length() const { return run_end() - logical_pos_; }
+
+    Iterator& operator++() {
+      logical_pos_ = run_end();
+      ++physical_pos_;
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return logical_pos_ == other.logical_pos_;
+    }
+    bool operator!=(const Iterator& other) const {
+      return logical_pos_ != other.logical_pos_;
+    }
+
+   private:
+    const RunEndEncodedArraySpan* span_;
+    int64_t logical_pos_;
+    int64_t physical_pos_;
+  };
+
+  explicit RunEndEncodedArraySpan(const ArraySpan& span)
+      : span_(span), run_ends_(RunEnds<RunEndCType>(span)) {}
+
+  int64_t length() const { return span_.length; }
+  int64_t offset() const { return span_.offset; }
+
+  /// \brief The physical index of the run containing logical position i
+  int64_t PhysicalIndex(int64_t i) const {
+    return FindPhysicalIndex(run_ends_, RunEndsArray(span_).length, i, span_.offset);
+  }
+
+  Iterator begin() const { return Iterator(*this, 0, PhysicalIndex(0)); }
+
+  Iterator end() const {
+    return Iterator(*this, length(),
+                    length() == 0 ? PhysicalIndex(0) : PhysicalIndex(length() - 1) + 1);
+  }
+
+ private:
+  const ArraySpan& span_;
+  const RunEndCType* run_ends_;
+};
+
+}  // namespace ree_util
+}  // namespace arrow
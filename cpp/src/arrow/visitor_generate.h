@@ -43,6 +43,8 @@ namespace arrow {
   ACTION(Binary);                               \
   ACTION(LargeString);                          \
   ACTION(LargeBinary);                          \
+  ACTION(StringView);                           \
+  ACTION(BinaryView);                           \
   ACTION(FixedSizeBinary);                      \
   ACTION(Duration);                             \
   ACTION(Date32);                               \
@@ -62,6 +64,7 @@ namespace arrow {
   ACTION(Struct);                               \
   ACTION(SparseUnion);                          \
   ACTION(DenseUnion);                           \
+  ACTION(RunEndEncoded);                        \
   ACTION(Dictionary);                           \
   ACTION(Extension)
 
@@ -2514,6 +2514,61 @@ def _get_scalar_udf_context(memory_pool, batch_length):
     return context
 
 
+cdef CScalarUdfOptions _make_udf_options(func, function_name, function_doc,
+                                         in_types, out_type) except *:
+    """
+    Helper function to validate the arguments common to all kinds of
+    user-defined functions and convert them to CScalarUdfOptions.
+    """
+    cdef:
+        c_string c_func_name
+        CArity c_arity
+        CFunctionDoc c_func_doc
+        vector[shared_ptr[CDataType]] c_in_types
+        shared_ptr[CDataType] c_out_type
+        CScalarUdfOptions c_options
+
+    if not callable(func):
+        raise TypeError("func must be a callable")
+
+    c_func_name = tobytes(function_name)
+
+    func_spec = inspect.getfullargspec(func)
+    num_args = -1
+    if isinstance(in_types, dict):
+        for in_type in in_types.values():
+            c_in_types.push_back(
+                pyarrow_unwrap_data_type(ensure_type(in_type)))
+        function_doc["arg_names"] = in_types.keys()
+        num_args = len(in_types)
+    else:
+        raise TypeError(
+            "in_types must be a dictionary of DataType")
+
+    c_arity = CArity(num_args, func_spec.varargs)
+
+    if "summary" not in function_doc:
+        raise ValueError("Function doc must contain a summary")
+
+    if "description" not in function_doc:
+        raise ValueError("Function doc must contain a description")
+
+    if "arg_names" not in function_doc:
+        raise ValueError("Function doc must contain arg_names")
+
+    c_func_doc = _make_function_doc(function_doc)
+
+    c_out_type = pyarrow_unwrap_data_type(ensure_type(out_type))
+
+    c_options.func_name = c_func_name
+    c_options.arity = c_arity
+    c_options.func_doc = c_func_doc
+    c_options.input_types = c_in_types
+    c_options.output_type = c_out_type
+
+    return c_options
+
+
 def register_scalar_function(func, function_name, function_doc, in_types,
                              out_type):
     """
@@ -2585,54 +2640,166 @@ def register_scalar_function(func, function_name, function_doc, in_types,
       21
     ]
     """
-    cdef:
-        c_string c_func_name
-        CArity c_arity
-        CFunctionDoc c_func_doc
-        vector[shared_ptr[CDataType]] c_in_types
-        PyObject* c_function
-        shared_ptr[CDataType] c_out_type
-        CScalarUdfOptions c_options
+    cdef CScalarUdfOptions c_options = _make_udf_options(
+        func, function_name, function_doc, in_types, out_type)
 
-    if callable(func):
-        c_function = <PyObject*>func
-    else:
-        raise TypeError("func must be a callable")
+    check_status(RegisterScalarFunction(<PyObject*>func,
+                                        <function[CallbackUdf]> &_scalar_udf_callback, c_options))
 
-    c_func_name = tobytes(function_name)
 
-    func_spec = inspect.getfullargspec(func)
-    num_args = -1
-    if isinstance(in_types, dict):
-        for in_type in in_types.values():
-            c_in_types.push_back(
-                pyarrow_unwrap_data_type(ensure_type(in_type)))
-        function_doc["arg_names"] = in_types.keys()
-        num_args = len(in_types)
-    else:
-        raise TypeError(
-            "in_types must be a dictionary of DataType")
+def register_aggregate_function(func, function_name, function_doc, in_types,
+                                out_type):
+    """
+    Register a user-defined scalar aggregate function.
 
-    c_arity = CArity(num_args, func_spec.varargs)
+    A scalar aggregate function reduces all of its input rows to a
+    single value. The input batches are collected without calling into
+    Python, and `func` is called once with the concatenated arguments,
+    so that it is not invoked (nor the GIL taken) for every batch.
 
-    if "summary" not in function_doc:
-        raise ValueError("Function doc must contain a summary")
+    Parameters
+    ----------
+    func : callable
+        A callable implementing the user-defined function.
+        The first argument is the context argument of type
+        ScalarUdfContext.
+        Then, it must take arguments equal to the number of
+        in_types defined. Each argument is an Array holding all the
+        input rows. It must return a Scalar matching the out_type.
+    function_name : str
+        Name of the function. This name must be globally unique.
+    function_doc : dict
+        A dictionary object with keys "summary" (str),
+        and "description" (str).
+    in_types : Dict[str, DataType]
+        A dictionary mapping function argument names to
+        their respective DataType.
+        The argument names will be used to generate
+        documentation for the function. The number of
+        arguments specified here determines the function
+        arity.
+    out_type : DataType
+        Output type of the function.
 
-    if "description" not in function_doc:
-        raise ValueError("Function doc must contain a description")
+    Examples
+    --------
+    >>> import pyarrow as pa
+    >>> import pyarrow.compute as pc
+    >>>
+    >>> func_doc = {}
+    >>> func_doc["summary"] = "simple aggregate udf"
+    >>> func_doc["description"] = "compute the median of an array"
+    >>>
+    >>> def median(ctx, array):
+    ...     return pc.quantile(array, q=0.5, memory_pool=ctx.memory_pool)[0]
+    >>>
+    >>> func_name = "py_median_func"
+    >>> in_types = {"array": pa.int64()}
+    >>> out_type = pa.float64()
+    >>> pc.register_aggregate_function(median, func_name, func_doc,
+    ...                   in_types, out_type)
+    >>>
+    >>> answer = pc.call_function(func_name, [pa.array([20, 40, 10])])
+    >>> answer
+    <pyarrow.DoubleScalar: 20.0>
+    """
+    cdef CScalarUdfOptions c_options = _make_udf_options(
+        func, function_name, function_doc, in_types, out_type)
 
-    if "arg_names" not in function_doc:
-        raise ValueError("Function doc must contain arg_names")
+    check_status(RegisterAggregateFunction(<PyObject*>func,
+                                           <function[CallbackUdf]> &_scalar_udf_callback,
+                                           c_options))
 
-    c_func_doc = _make_function_doc(function_doc)
 
-    c_out_type = pyarrow_unwrap_data_type(ensure_type(out_type))
+def register_tabular_function(func, function_name, function_doc, schema):
+    """
+    Register a user-defined tabular function.
 
-    c_options.func_name = c_func_name
-    c_options.arity = c_arity
-    c_options.func_doc = c_func_doc
-    c_options.input_types = c_in_types
-    c_options.output_type = c_out_type
+    A tabular function takes no arguments and produces a table, one
+    batch at a time. It is called with `call_tabular_function`, and
+    is not a compute function: it can't be called with `call_function`.
 
-    check_status(RegisterScalarFunction(c_function,
-                                        <function[CallbackUdf]> &_scalar_udf_callback, c_options))
+    Parameters
+    ----------
+    func : callable
+        A callable implementing the user-defined function.
+        It takes the context argument of type ScalarUdfContext
+        and returns a callable. Each call of that callable with a
+        ScalarUdfContext returns the next RecordBatch of the table
+        (or a StructArray of the same type), and an empty batch
+        ends the table.
+    function_name : str
+        Name of the function. This name must be globally unique.
+    function_doc : dict
+        A dictionary object with keys "summary" (str),
+        and "description" (str).
+    schema : Schema
+        Schema of the batches returned by the function.
+
+    Examples
+    --------
+    >>> import pyarrow as pa
+    >>> import pyarrow.compute as pc
+    >>>
+    >>> func_doc = {}
+    >>> func_doc["summary"] = "simple tabular udf"
+    >>> func_doc["description"] = "generate the numbers from 0 to 5"
+    >>>
+    >>> schema = pa.schema([("n", pa.int64())])
+    >>> def numbers(ctx):
+    ...     batches = iter([pa.array([0, 1, 2]), pa.array([3, 4]),
+    ...                     pa.array([], pa.int64())])
+    ...     return lambda ctx: pa.record_batch([next(batches)], schema=schema)
+    >>>
+    >>> func_name = "py_numbers_func"
+    >>> pc.register_tabular_function(numbers, func_name, func_doc, schema)
+    >>>
+    >>> pc.call_tabular_function(func_name).read_all().column("n")
+    <pyarrow.lib.ChunkedArray object at ...>
+    [
+      [
+        0,
+        1,
+        2
+      ],
+      [
+        3,
+        4
+      ]
+    ]
+    """
+    cdef CScalarUdfOptions c_options
+    if not isinstance(schema, lib.Schema):
+        raise TypeError("schema must be a Schema")
+    c_options = _make_udf_options(
+        func, function_name, function_doc, {}, lib.struct(list(schema)))
+
+    check_status(RegisterTabularFunction(<PyObject*>func,
+                                         <function[CallbackUdf]> &_scalar_udf_callback,
+                                         c_options))
+
+
+def call_tabular_function(function_name):
+    """
+    Call a user-defined tabular function.
+
+    Parameters
+    ----------
+    function_name : str
+        Name of a function registered with `register_tabular_function`.
+
+    Returns
+    -------
+    RecordBatchReader
+        A reader of the batches returned by the function.
+    """
+    cdef:
+        c_string c_func_name = tobytes(function_name)
+        shared_ptr[CRecordBatchReader] c_reader
+        RecordBatchReader reader
+
+    with nogil:
+        c_reader = GetResultValue(CallTabularFunction(c_func_name))
+    reader = RecordBatchReader.__new__(RecordBatchReader)
+    reader.reader = c_reader
+    return reader
@@ -504,3 +504,130 @@ def test_input_lifetime(unary_func_fixture):
     # Calling a UDF should not have kept `v` alive longer than required
     v = None
     assert proxy_pool.bytes_allocated() == 0
+
+
+@pytest.fixture(scope="session")
+def unary_agg_func_fixture():
+    """
+    Register a unary aggregate function
+    """
+    def sum_function(ctx, x):
+        return pc.sum(x, memory_pool=ctx.memory_pool)
+    func_name = "y=sum(x)"
+    sum_doc = {"summary": "sum function",
+               "description": "test aggregate sum function"}
+    pc.register_aggregate_function(sum_function,
+                                   func_name,
+                                   sum_doc,
+                                   {"array": pa.int64()},
+                                   pa.int64())
+    return sum_function, func_name
+
+
+def test_aggregate_udf_array(unary_agg_func_fixture):
+    _, func_name = unary_agg_func_fixture
+
+    res = pc.call_function(func_name, [pa.array([1, 2, None, 3])])
+    assert res == pa.scalar(6)
+
+    res = pc.call_function(func_name, [pa.array([], type=pa.int64())])
+    assert res == pa.scalar(None, type=pa.int64())
+
+
+def test_aggregate_udf_chunked_array(unary_agg_func_fixture):
+    _, func_name = unary_agg_func_fixture
+
+    # the function is called once with all chunks concatenated
+    res = pc.call_function(func_name,
+                           [pa.chunked_array([[1, 2], [], [3, None, 4]])])
+    assert res == pa.scalar(10)
+
+
+def test_aggregate_udf_wrong_output_type():
+    def wrong_output_type(ctx, x):
+        return x
+
+    func_name = "test_aggregate_wrong_output_type"
+    doc = {"summary": "return wrong output type",
+           "description": ""}
+    pc.register_aggregate_function(wrong_output_type, func_name, doc,
+                                   {"array": pa.int64()}, pa.int64())
+
+    with pytest.raises(TypeError, match="expected Scalar"):
+        pc.call_function(func_name, [pa.array([1, 2])])
+
+
+@pytest.fixture(scope="session")
+def tabular_func_fixture():
+    """
+    Register a tabular function returning 3 batches
+    """
+    schema = pa.schema([("a", pa.int64()), ("b", pa.string())])
+
+    def make_batches(ctx):
+        batches = iter([
+            pa.record_batch([pa.array([1, 2]), pa.array(["x", "y"])],
+                            schema=schema),
+            # A struct array is accepted too
+            pa.StructArray.from_arrays([pa.array([3]), pa.array(["z"])],
+                                       fields=list(schema)),
+            # An empty batch ends the table
+            pa.record_batch([pa.array([], pa.int64()),
+                             pa.array([], pa.string())], schema=schema),
+        ])
+        return lambda ctx: next(batches)
+
+    func_name = "test_tabular_udf"
+    doc = {"summary": "tabular function",
+           "description": "test producing a table"}
+    pc.register_tabular_function(make_batches, func_name, doc, schema)
+    return schema, func_name
+
+
+def test_tabular_udf(tabular_func_fixture):
+    schema, func_name = tabular_func_fixture
+
+    # Every call starts a new table
+    for _ in range(2):
+        reader = pc.call_tabular_function(func_name)
+        assert reader.schema == schema
+        table = reader.read_all()
+        assert table == pa.table({"a": [1, 2, 3], "b": ["x", "y", "z"]})
+
+    # Tabular functions are not compute functions
+    assert func_name not in pc.list_functions()
+    with pytest.raises(KeyError):
+        pc.call_function(func_name, [])
+
+
+def test_tabular_udf_errors():
+    doc = {"summary": "tabular function",
+           "description": ""}
+    schema = pa.schema([("a", pa.int64())])
+
+    def wrong_output_type(ctx):
+        return lambda ctx: pa.record_batch([pa.array(["x"])], names=["a"])
+
+    pc.register_tabular_function(wrong_output_type,
+                                 "test_tabular_udf_wrong_output_type",
+                                 doc, schema)
+    with pytest.raises(TypeError, match="Expected output datatype"):
+        pc.call_tabular_function(
+            "test_tabular_udf_wrong_output_type").read_all()
+
+    def not_a_generator(ctx):
+        return 42
+
+    pc.register_tabular_function(not_a_generator,
+                                 "test_tabular_udf_not_a_generator",
+                                 doc, schema)
+    with pytest.raises(TypeError, match="expected a callable"):
+        pc.call_tabular_function("test_tabular_udf_not_a_generator")
+
+    with pytest.raises(KeyError, match="No tabular function"):
+        pc.call_tabular_function("add")
+
+    with pytest.raises(KeyError, match="Already have a tabular function"):
+        pc.register_tabular_function(not_a_generator,
+                                     "test_tabular_udf_not_a_generator",
+                                     doc, schema)